@@ -0,0 +1,271 @@
+#include "aos_codec.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#  define CODEC_X86
+#  include <emmintrin.h>
+#  include <tmmintrin.h>
+#  ifdef _MSC_VER
+#    include <intrin.h>
+#    define CODEC_SSSE3_TARGET
+#  else
+#    include <cpuid.h>
+#    define CODEC_SSSE3_TARGET __attribute__((target("ssse3")))
+#  endif
+#endif
+
+static const char codec_hex_upper[] = "0123456789ABCDEF";
+static const char codec_hex_lower[] = "0123456789abcdef";
+static const char codec_base64[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/* 1 for the unreserved characters of RFC 3986: ALPHA DIGIT - . _ ~ */
+static const unsigned char codec_url_unreserved[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+#ifdef CODEC_X86
+
+/* 0xff in the bytes holding an unreserved character, SSE2 is always there
+   on x86-64. The bytes from 0x80 are negative and fall outside the ranges. */
+static __m128i url_unreserved_x16(__m128i v)
+{
+    __m128i folded = _mm_or_si128(v, _mm_set1_epi8(0x20));
+    __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(folded, _mm_set1_epi8('a' - 1)),
+                                  _mm_cmplt_epi8(folded, _mm_set1_epi8('z' + 1)));
+    __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)),
+                                  _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1)));
+    __m128i mark = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('-')),
+                                             _mm_cmpeq_epi8(v, _mm_set1_epi8('.'))),
+                                _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('_')),
+                                             _mm_cmpeq_epi8(v, _mm_set1_epi8('~'))));
+
+    return _mm_or_si128(_mm_or_si128(alpha, digit), mark);
+}
+
+/* Check SSSE3 for the byte shuffles of the base64 kernel. */
+static int codec_ssse3_supported(void)
+{
+#ifdef _MSC_VER
+    int info[4];
+
+    __cpuid(info, 1);
+    return (info[2] & (1 << 9)) != 0;
+#else
+    unsigned int eax, ebx, ecx, edx;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        return 0;
+    return (ecx & bit_SSSE3) != 0;
+#endif
+}
+
+/* Twelve bytes to sixteen base64 characters per round, reading sixteen
+   bytes, so the caller leaves at least four bytes for the scalar tail. */
+CODEC_SSSE3_TARGET
+static apr_size_t base64_encode_ssse3(const unsigned char *in, apr_size_t len, char *out)
+{
+    const __m128i shuffle = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    const __m128i shift = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                        '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+    __m128i v, hi, lo, idx, r;
+    apr_size_t done = 0;
+
+    while (len - done >= 16) {
+        v = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(in + done)), shuffle);
+
+        /* the four 6-bit indices of each 3-byte group, one per byte */
+        hi = _mm_mulhi_epu16(_mm_and_si128(v, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040));
+        lo = _mm_mullo_epi16(_mm_and_si128(v, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010));
+        idx = _mm_or_si128(hi, lo);
+
+        /* 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12 */
+        r = _mm_subs_epu8(idx, _mm_set1_epi8(51));
+        r = _mm_or_si128(r, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), idx), _mm_set1_epi8(13)));
+        r = _mm_add_epi8(_mm_shuffle_epi8(shift, r), idx);
+
+        _mm_storeu_si128((__m128i *)out, r);
+        out += 16;
+        done += 12;
+    }
+    return done;
+}
+
+#endif
+
+/* -1 until an encoder first asks cpuid for ssse3, every thread finds the same answer. */
+static volatile int codec_ssse3 = -1;
+
+static int codec_use_ssse3(void)
+{
+    int ssse3 = codec_ssse3;
+
+    if (ssse3 < 0) {
+#ifdef CODEC_X86
+        ssse3 = codec_ssse3_supported();
+#else
+        ssse3 = 0;
+#endif
+        codec_ssse3 = ssse3;
+    }
+    return ssse3;
+}
+
+const char *aos_codec_kernel(void)
+{
+#ifdef CODEC_X86
+    return codec_use_ssse3() ? "ssse3" : "sse2";
+#else
+    return "scalar";
+#endif
+}
+
+apr_size_t aos_url_encode_len(const char *src, apr_size_t len)
+{
+    const unsigned char *p = (const unsigned char *)src;
+    apr_size_t escaped = 0;
+    apr_size_t i = 0;
+
+#ifdef CODEC_X86
+    __m128i acc = _mm_setzero_si128();
+    __m128i reserved;
+
+    /* count the reserved bytes sixteen at a time, 1 per byte summed by psadbw */
+    for ( ; i + 16 <= len; i += 16) {
+        reserved = _mm_andnot_si128(url_unreserved_x16(_mm_loadu_si128((const __m128i *)(p + i))),
+                                    _mm_set1_epi8(1));
+        acc = _mm_add_epi64(acc, _mm_sad_epu8(reserved, _mm_setzero_si128()));
+    }
+    escaped = (apr_size_t)_mm_cvtsi128_si32(acc) + (apr_size_t)_mm_cvtsi128_si32(_mm_srli_si128(acc, 8));
+#endif
+
+    for ( ; i < len; i++) {
+        escaped += !codec_url_unreserved[p[i]];
+    }
+    return len + 2 * escaped;
+}
+
+apr_size_t aos_url_encode_buf(char *dest, const char *src, apr_size_t len)
+{
+    const unsigned char *p = (const unsigned char *)src;
+    char *out = dest;
+    apr_size_t end;
+    apr_size_t i = 0;
+    unsigned char c;
+
+    while (i < len) {
+#ifdef CODEC_X86
+        /* copy the runs of sixteen unreserved bytes as they are */
+        while (i + 16 <= len) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(p + i));
+            if (_mm_movemask_epi8(url_unreserved_x16(v)) != 0xffff) {
+                break;
+            }
+            _mm_storeu_si128((__m128i *)out, v);
+            out += 16;
+            i += 16;
+        }
+        end = i + 16 < len ? i + 16 : len;
+#else
+        end = len;
+#endif
+        for ( ; i < end; i++) {
+            c = p[i];
+            if (codec_url_unreserved[c]) {
+                *out++ = (char)c;
+            } else {
+                out[0] = '%';
+                out[1] = codec_hex_upper[c >> 4];
+                out[2] = codec_hex_upper[c & 15];
+                out += 3;
+            }
+        }
+    }
+    return (apr_size_t)(out - dest);
+}
+
+apr_size_t aos_base64_encode_buf(const unsigned char *in, apr_size_t len, char *out)
+{
+    char *original_out = out;
+    apr_size_t i = 0;
+    unsigned int v;
+
+#ifdef CODEC_X86
+    if (len >= 16 && codec_use_ssse3()) {
+        i = base64_encode_ssse3(in, len, out);
+        out += i / 3 * 4;
+    }
+#endif
+
+    for ( ; i + 3 <= len; i += 3) {
+        v = ((unsigned int)in[i] << 16) | ((unsigned int)in[i + 1] << 8) | in[i + 2];
+        out[0] = codec_base64[v >> 18];
+        out[1] = codec_base64[(v >> 12) & 63];
+        out[2] = codec_base64[(v >> 6) & 63];
+        out[3] = codec_base64[v & 63];
+        out += 4;
+    }
+
+    if (i + 1 == len) {
+        v = (unsigned int)in[i] << 16;
+        out[0] = codec_base64[v >> 18];
+        out[1] = codec_base64[(v >> 12) & 63];
+        out[2] = '=';
+        out[3] = '=';
+        out += 4;
+    } else if (i + 2 == len) {
+        v = ((unsigned int)in[i] << 16) | ((unsigned int)in[i + 1] << 8);
+        out[0] = codec_base64[v >> 18];
+        out[1] = codec_base64[(v >> 12) & 63];
+        out[2] = codec_base64[(v >> 6) & 63];
+        out[3] = '=';
+        out += 4;
+    }
+
+    return (apr_size_t)(out - original_out);
+}
+
+void aos_hex_encode(const unsigned char *in, apr_size_t len, char *out, int upper)
+{
+    const char *hex = upper ? codec_hex_upper : codec_hex_lower;
+    apr_size_t i = 0;
+
+#ifdef CODEC_X86
+    /* nibble + '0', plus the gap to 'A' or 'a' above 9 */
+    const __m128i nine = _mm_set1_epi8(9);
+    const __m128i gap = _mm_set1_epi8(upper ? 'A' - '0' - 10 : 'a' - '0' - 10);
+    const __m128i zero = _mm_set1_epi8('0');
+    const __m128i mask = _mm_set1_epi8(0x0f);
+    __m128i v, hi, lo;
+
+    for ( ; i + 16 <= len; i += 16) {
+        v = _mm_loadu_si128((const __m128i *)(in + i));
+        hi = _mm_and_si128(_mm_srli_epi16(v, 4), mask);
+        lo = _mm_and_si128(v, mask);
+        hi = _mm_add_epi8(_mm_add_epi8(hi, zero), _mm_and_si128(_mm_cmpgt_epi8(hi, nine), gap));
+        lo = _mm_add_epi8(_mm_add_epi8(lo, zero), _mm_and_si128(_mm_cmpgt_epi8(lo, nine), gap));
+        _mm_storeu_si128((__m128i *)(out + 2 * i), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128((__m128i *)(out + 2 * i + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+#endif
+
+    for ( ; i < len; i++) {
+        out[2 * i] = hex[in[i] >> 4];
+        out[2 * i + 1] = hex[in[i] & 15];
+    }
+}
@@ -0,0 +1,45 @@
+#ifndef LIBAOS_CODEC_H
+#define LIBAOS_CODEC_H
+
+#include "aos_define.h"
+
+AOS_CPP_START
+
+/* The exact base64 length of len bytes, with the padding, without a null. */
+#define AOS_BASE64_ENCODE_LEN(len) ((((len) + 2) / 3) * 4)
+
+/**
+ * The length of len bytes of src url-encoded by aos_url_encode_buf, the
+ * unreserved characters of RFC 3986 are kept and every other byte is
+ * written as %XX.
+ */
+apr_size_t aos_url_encode_len(const char *src, apr_size_t len);
+
+/**
+ * Url-encode len bytes of src into dest, which must hold
+ * aos_url_encode_len(src, len) bytes. No null is appended, the number of
+ * bytes written is returned.
+ */
+apr_size_t aos_url_encode_buf(char *dest, const char *src, apr_size_t len);
+
+/**
+ * Base64-encode len bytes of in into out, which must hold
+ * AOS_BASE64_ENCODE_LEN(len) bytes. No null is appended, the number of
+ * bytes written is returned.
+ */
+apr_size_t aos_base64_encode_buf(const unsigned char *in, apr_size_t len, char *out);
+
+/**
+ * Write len bytes of in as 2 * len hex digits to out, upper or lower case.
+ * No null is appended.
+ */
+void aos_hex_encode(const unsigned char *in, apr_size_t len, char *out, int upper);
+
+/**
+ * The name of the kernels used by the encoders: ssse3, sse2 or scalar.
+ */
+const char *aos_codec_kernel(void);
+
+AOS_CPP_END
+
+#endif
@@ -35,54 +35,43 @@
    1.3  15 Dec 2013  Add eight-byte processing for big endian as well
                      Make use of the pthread library optional
    1.4  16 Dec 2013  Make once variable volatile for limited thread protection
+   Altered for the aos sdk: the tables are compile-time constants, and a
+   folding carry-less multiply kernel (x86-64 PCLMULQDQ, ARMv8 PMULL) is used
+   when the cpu supports it, the slice-by-8 code is kept as the fallback.
  */
 
 #include "aos_crc64.h"
+#include "aos_crc64_table.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#  define CRC64_CLMUL_X86
+#  include <emmintrin.h>
+#  include <wmmintrin.h>
+#  ifdef _MSC_VER
+#    include <intrin.h>
+#    define CRC64_CLMUL_TARGET
+#  else
+#    include <cpuid.h>
+#    define CRC64_CLMUL_TARGET __attribute__((target("sse2,pclmul")))
+#  endif
+#elif defined(__aarch64__) && defined(__linux__) && defined(__GNUC__) && \
+      defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#  define CRC64_CLMUL_ARM
+#  include <arm_neon.h>
+#  include <sys/auxv.h>
+#  include <asm/hwcap.h>
+#  ifdef __clang__
+#    define CRC64_CLMUL_TARGET __attribute__((target("aes")))
+#  else
+#    define CRC64_CLMUL_TARGET __attribute__((target("+crypto")))
+#  endif
+#endif
 
 /* 64-bit CRC polynomial with these coefficients, but reversed:
     64, 62, 57, 55, 54, 53, 52, 47, 46, 45, 40, 39, 38, 37, 35, 33, 32,
     31, 29, 27, 24, 23, 22, 21, 19, 17, 13, 12, 10, 9, 7, 4, 1, 0 */
 #define POLY UINT64_C(0xc96c5795d7870f42)
 
-/* Tables for CRC calculation -- filled in by initialization functions that are
-   called once.  These could be replaced by constant tables generated in the
-   same way.  There are two tables, one for each endianess.  Since these are
-   static, i.e. local, one should be compiled out of existence if the compiler
-   can evaluate the endianess check in crc64() at compile time. */
-static uint64_t crc64_little_table[8][256];
-static uint64_t crc64_big_table[8][256];
-
-/* Fill in the CRC-64 constants table. */
-static void crc64_init(uint64_t table[][256])
-{
-    unsigned n, k;
-    uint64_t crc;
-
-    /* generate CRC-64's for all single byte sequences */
-    for (n = 0; n < 256; n++) {
-        crc = n;
-        for (k = 0; k < 8; k++)
-            crc = crc & 1 ? POLY ^ (crc >> 1) : crc >> 1;
-        table[0][n] = crc;
-    }
-
-    /* generate CRC-64's for those followed by 1 to 7 zeros */
-    for (n = 0; n < 256; n++) {
-        crc = table[0][n];
-        for (k = 1; k < 8; k++) {
-            crc = table[0][crc & 0xff] ^ (crc >> 8);
-            table[k][n] = crc;
-        }
-    }
-}
-
-/* This function is called once to initialize the CRC-64 table for use on a
-   little-endian architecture. */
-static void crc64_little_init(void)
-{
-    crc64_init(crc64_little_table);
-}
-
 /* Reverse the bytes in a 64-bit word. */
 static APR_INLINE uint64_t rev8(uint64_t a)
 {
@@ -95,49 +84,11 @@ static APR_INLINE uint64_t rev8(uint64_t a)
     return a >> 32 | a << 32;
 }
 
-/* This function is called once to initialize the CRC-64 table for use on a
-   big-endian architecture. */
-static void crc64_big_init(void)
-{
-    unsigned k, n;
-
-    crc64_init(crc64_big_table);
-    for (k = 0; k < 8; k++)
-        for (n = 0; n < 256; n++)
-            crc64_big_table[k][n] = rev8(crc64_big_table[k][n]);
-}
-
-/* Run the init() function exactly once.  If pthread.h is not included, then
-   this macro will use a simple static state variable for the purpose, which is
-   not thread-safe.  The init function must be of the type void init(void). */
-#ifdef PTHREAD_ONCE_INIT
-#  define ONCE(init) \
-    do { \
-        static pthread_once_t once = PTHREAD_ONCE_INIT; \
-        pthread_once(&once, init); \
-    } while (0)
-#else
-#  define ONCE(init) \
-    do { \
-        static volatile int once = 1; \
-        if (once) { \
-            if (once++ == 1) { \
-                init(); \
-                once = 0; \
-            } \
-            else \
-                while (once) \
-                    ; \
-        } \
-    } while (0)
-#endif
-
 /* Calculate a CRC-64 eight bytes at a time on a little-endian architecture. */
 static APR_INLINE uint64_t crc64_little(uint64_t crc, void *buf, size_t len)
 {
     unsigned char *next = buf;
 
-    ONCE(crc64_little_init);
     crc = ~crc;
     while (len && ((uintptr_t)next & 7) != 0) {
         crc = crc64_little_table[0][(crc ^ *next++) & 0xff] ^ (crc >> 8);
@@ -168,7 +119,6 @@ static APR_INLINE uint64_t crc64_big(uint64_t crc, void *buf, size_t len)
 {
     unsigned char *next = buf;
 
-    ONCE(crc64_big_init);
     crc = ~rev8(crc);
     while (len && ((uintptr_t)next & 7) != 0) {
         crc = crc64_big_table[0][(crc >> 56) ^ *next++] ^ (crc << 8);
@@ -199,8 +149,8 @@ static APR_INLINE uint64_t crc64_big(uint64_t crc, void *buf, size_t len)
    the architecture.  A good optimizing compiler will determine the endianess
    at compile time if it can, and get rid of the unused code and table.  If the
    endianess can be changed at run time, then this code will handle that as
-   well, initializing and using two tables, if called upon to do so. */
-uint64_t aos_crc64(uint64_t crc, void *buf, size_t len)
+   well, using two tables, if called upon to do so. */
+uint64_t aos_crc64_slice8(uint64_t crc, void *buf, size_t len)
 {
     uint64_t n = 1;
 
@@ -208,6 +158,249 @@ uint64_t aos_crc64(uint64_t crc, void *buf, size_t len)
                          crc64_big(crc, buf, len);
 }
 
+#if defined(CRC64_CLMUL_X86) || defined(CRC64_CLMUL_ARM)
+
+/* Folding constants, x^n mod P bit-reversed.  A 128-bit block is moved
+   forward by D bits by multiplying its first 64 bits by x^(D+63) mod P and
+   its last 64 bits by x^(D-1) mod P, the carry-less product of two reflected
+   operands being one bit short of the block layout. */
+#define CRC64_K_1087 UINT64_C(0x8757d71d4fcc1000)
+#define CRC64_K_1023 UINT64_C(0xd7d86b2af73de740)
+#define CRC64_K_959  UINT64_C(0x9e735cb59b4724da)
+#define CRC64_K_895  UINT64_C(0x947874de595052cb)
+#define CRC64_K_831  UINT64_C(0x2fe3fd2920ce82ec)
+#define CRC64_K_767  UINT64_C(0xe4ce2cd55fea0037)
+#define CRC64_K_703  UINT64_C(0x2e30203212cac325)
+#define CRC64_K_639  UINT64_C(0x0e31d519421a63a5)
+#define CRC64_K_575  UINT64_C(0x6ae3efbb9dd441f3)
+#define CRC64_K_511  UINT64_C(0x081f6054a7842df4)
+#define CRC64_K_447  UINT64_C(0xb5ea1af9c013aca4)
+#define CRC64_K_383  UINT64_C(0x69a35d91c3730254)
+#define CRC64_K_319  UINT64_C(0x60095b008a9efa44)
+#define CRC64_K_255  UINT64_C(0x3be653a30fe1af51)
+#define CRC64_K_191  UINT64_C(0xe05dd497ca393ae4)
+#define CRC64_K_127  UINT64_C(0xdabe95afc7875f40)
+
+/* Eight blocks of 16 bytes are folded in parallel, shorter buffers are not
+   worth the setup. */
+#define CRC64_CLMUL_MIN_LEN 256
+
+/* Finish the folded state: the CRC-64 of the data so far equals the CRC-64
+   of the 16 state bytes from a zero register, the remaining bytes are then
+   processed by the tables. */
+static uint64_t crc64_clmul_finish(unsigned char *state, unsigned char *next, size_t len)
+{
+    uint64_t crc;
+
+    crc = crc64_little(~UINT64_C(0), state, 16);
+    return crc64_little(crc, next, len);
+}
+
+#endif
+
+#ifdef CRC64_CLMUL_X86
+
+static CRC64_CLMUL_TARGET APR_INLINE __m128i crc64_fold(__m128i x, __m128i k, __m128i data)
+{
+    return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00),
+                                       _mm_clmulepi64_si128(x, k, 0x11)), data);
+}
+
+#define CRC64_CONST(k1, k2) _mm_set_epi64x((long long)(k2), (long long)(k1))
+
+/* Calculate a CRC-64 by folding 128 bytes at a time with PCLMULQDQ. */
+static CRC64_CLMUL_TARGET uint64_t crc64_clmul(uint64_t crc, void *buf, size_t len)
+{
+    unsigned char *next = buf;
+    unsigned char state[16];
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7;
+    __m128i k;
+
+    if (len < CRC64_CLMUL_MIN_LEN)
+        return crc64_little(crc, buf, len);
+
+    x0 = _mm_loadu_si128((const __m128i *)next);
+    x1 = _mm_loadu_si128((const __m128i *)(next + 16));
+    x2 = _mm_loadu_si128((const __m128i *)(next + 32));
+    x3 = _mm_loadu_si128((const __m128i *)(next + 48));
+    x4 = _mm_loadu_si128((const __m128i *)(next + 64));
+    x5 = _mm_loadu_si128((const __m128i *)(next + 80));
+    x6 = _mm_loadu_si128((const __m128i *)(next + 96));
+    x7 = _mm_loadu_si128((const __m128i *)(next + 112));
+    x0 = _mm_xor_si128(x0, CRC64_CONST(~crc, 0));
+    next += 128;
+    len -= 128;
+
+    /* fold eight blocks forward by 1024 bits */
+    k = CRC64_CONST(CRC64_K_1087, CRC64_K_1023);
+    while (len >= 128) {
+        x0 = crc64_fold(x0, k, _mm_loadu_si128((const __m128i *)next));
+        x1 = crc64_fold(x1, k, _mm_loadu_si128((const __m128i *)(next + 16)));
+        x2 = crc64_fold(x2, k, _mm_loadu_si128((const __m128i *)(next + 32)));
+        x3 = crc64_fold(x3, k, _mm_loadu_si128((const __m128i *)(next + 48)));
+        x4 = crc64_fold(x4, k, _mm_loadu_si128((const __m128i *)(next + 64)));
+        x5 = crc64_fold(x5, k, _mm_loadu_si128((const __m128i *)(next + 80)));
+        x6 = crc64_fold(x6, k, _mm_loadu_si128((const __m128i *)(next + 96)));
+        x7 = crc64_fold(x7, k, _mm_loadu_si128((const __m128i *)(next + 112)));
+        next += 128;
+        len -= 128;
+    }
+
+    /* fold the eight blocks into the last one */
+    x7 = crc64_fold(x0, CRC64_CONST(CRC64_K_959, CRC64_K_895), x7);
+    x7 = crc64_fold(x1, CRC64_CONST(CRC64_K_831, CRC64_K_767), x7);
+    x7 = crc64_fold(x2, CRC64_CONST(CRC64_K_703, CRC64_K_639), x7);
+    x7 = crc64_fold(x3, CRC64_CONST(CRC64_K_575, CRC64_K_511), x7);
+    x7 = crc64_fold(x4, CRC64_CONST(CRC64_K_447, CRC64_K_383), x7);
+    x7 = crc64_fold(x5, CRC64_CONST(CRC64_K_319, CRC64_K_255), x7);
+    x7 = crc64_fold(x6, CRC64_CONST(CRC64_K_191, CRC64_K_127), x7);
+
+    /* fold the remaining blocks of 16 bytes */
+    while (len >= 16) {
+        x7 = crc64_fold(x7, CRC64_CONST(CRC64_K_191, CRC64_K_127), 
+                        _mm_loadu_si128((const __m128i *)next));
+        next += 16;
+        len -= 16;
+    }
+
+    _mm_storeu_si128((__m128i *)state, x7);
+    return crc64_clmul_finish(state, next, len);
+}
+
+/* Check PCLMULQDQ, SSE2 is always there on x86-64. */
+static int crc64_clmul_supported(void)
+{
+#ifdef _MSC_VER
+    int info[4];
+
+    __cpuid(info, 1);
+    return (info[2] & (1 << 1)) != 0;
+#else
+    unsigned int eax, ebx, ecx, edx;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        return 0;
+    return (ecx & bit_PCLMUL) != 0;
+#endif
+}
+
+#define CRC64_CLMUL_NAME "pclmulqdq"
+
+#endif
+
+#ifdef CRC64_CLMUL_ARM
+
+static CRC64_CLMUL_TARGET APR_INLINE uint64x2_t crc64_fold(uint64x2_t x, poly64_t k1, poly64_t k2, uint64x2_t data)
+{
+    uint64x2_t lo, hi;
+
+    lo = vreinterpretq_u64_p128(vmull_p64((poly64_t)vgetq_lane_u64(x, 0), k1));
+    hi = vreinterpretq_u64_p128(vmull_p64((poly64_t)vgetq_lane_u64(x, 1), k2));
+    return veorq_u64(veorq_u64(lo, hi), data);
+}
+
+#define CRC64_LOAD(p) vreinterpretq_u64_u8(vld1q_u8(p))
+
+/* Calculate a CRC-64 by folding 128 bytes at a time with PMULL. */
+static CRC64_CLMUL_TARGET uint64_t crc64_clmul(uint64_t crc, void *buf, size_t len)
+{
+    unsigned char *next = buf;
+    unsigned char state[16];
+    uint64x2_t x0, x1, x2, x3, x4, x5, x6, x7;
+
+    if (len < CRC64_CLMUL_MIN_LEN)
+        return crc64_little(crc, buf, len);
+
+    x0 = CRC64_LOAD(next);
+    x1 = CRC64_LOAD(next + 16);
+    x2 = CRC64_LOAD(next + 32);
+    x3 = CRC64_LOAD(next + 48);
+    x4 = CRC64_LOAD(next + 64);
+    x5 = CRC64_LOAD(next + 80);
+    x6 = CRC64_LOAD(next + 96);
+    x7 = CRC64_LOAD(next + 112);
+    x0 = veorq_u64(x0, vsetq_lane_u64(~crc, vdupq_n_u64(0), 0));
+    next += 128;
+    len -= 128;
+
+    /* fold eight blocks forward by 1024 bits */
+    while (len >= 128) {
+        x0 = crc64_fold(x0, CRC64_K_1087, CRC64_K_1023, CRC64_LOAD(next));
+        x1 = crc64_fold(x1, CRC64_K_1087, CRC64_K_1023, CRC64_LOAD(next + 16));
+        x2 = crc64_fold(x2, CRC64_K_1087, CRC64_K_1023, CRC64_LOAD(next + 32));
+        x3 = crc64_fold(x3, CRC64_K_1087, CRC64_K_1023, CRC64_LOAD(next + 48));
+        x4 = crc64_fold(x4, CRC64_K_1087, CRC64_K_1023, CRC64_LOAD(next + 64));
+        x5 = crc64_fold(x5, CRC64_K_1087, CRC64_K_1023, CRC64_LOAD(next + 80));
+        x6 = crc64_fold(x6, CRC64_K_1087, CRC64_K_1023, CRC64_LOAD(next + 96));
+        x7 = crc64_fold(x7, CRC64_K_1087, CRC64_K_1023, CRC64_LOAD(next + 112));
+        next += 128;
+        len -= 128;
+    }
+
+    /* fold the eight blocks into the last one */
+    x7 = crc64_fold(x0, CRC64_K_959, CRC64_K_895, x7);
+    x7 = crc64_fold(x1, CRC64_K_831, CRC64_K_767, x7);
+    x7 = crc64_fold(x2, CRC64_K_703, CRC64_K_639, x7);
+    x7 = crc64_fold(x3, CRC64_K_575, CRC64_K_511, x7);
+    x7 = crc64_fold(x4, CRC64_K_447, CRC64_K_383, x7);
+    x7 = crc64_fold(x5, CRC64_K_319, CRC64_K_255, x7);
+    x7 = crc64_fold(x6, CRC64_K_191, CRC64_K_127, x7);
+
+    /* fold the remaining blocks of 16 bytes */
+    while (len >= 16) {
+        x7 = crc64_fold(x7, CRC64_K_191, CRC64_K_127, CRC64_LOAD(next));
+        next += 16;
+        len -= 16;
+    }
+
+    vst1q_u8(state, vreinterpretq_u8_u64(x7));
+    return crc64_clmul_finish(state, next, len);
+}
+
+static int crc64_clmul_supported(void)
+{
+    return (getauxval(AT_HWCAP) & HWCAP_PMULL) != 0;
+}
+
+#define CRC64_CLMUL_NAME "pmull"
+
+#endif
+
+typedef uint64_t (*crc64_func_pt)(uint64_t crc, void *buf, size_t len);
+
+/* Set by the first aos_crc64, concurrent first calls store the same pointer. */
+static volatile crc64_func_pt crc64_func = NULL;
+static const char *crc64_name = "slice-by-8";
+
+static crc64_func_pt crc64_select(void)
+{
+#if defined(CRC64_CLMUL_X86) || defined(CRC64_CLMUL_ARM)
+    if (crc64_clmul_supported()) {
+        crc64_name = CRC64_CLMUL_NAME;
+        crc64_func = crc64_clmul;
+        return crc64_func;
+    }
+#endif
+    crc64_func = aos_crc64_slice8;
+    return crc64_func;
+}
+
+uint64_t aos_crc64(uint64_t crc, void *buf, size_t len)
+{
+    crc64_func_pt func = crc64_func;
+
+    if (func == NULL)
+        func = crc64_select();
+    return func(crc, buf, len);
+}
+
+const char *aos_crc64_kernel(void)
+{
+    if (crc64_func == NULL)
+        crc64_select();
+    return crc64_name;
+}
+
 #define GF2_DIM 64      /* dimension of GF(2) vectors (length of CRC) */
 
 static uint64_t gf2_matrix_times(uint64_t *mat, uint64_t vec)
@@ -286,3 +479,70 @@ uint64_t aos_crc64_combine(uint64_t crc1, uint64_t crc2, uintmax_t len2)
     crc1 ^= crc2;
     return crc1;
 }
+
+/* Set mat to the product of mat and the operator op, so that mat applies op
+   after its former operation.  All operators used here are powers of the same
+   matrix, so the order does not matter. */
+static void gf2_matrix_apply(uint64_t *mat, uint64_t *op)
+{
+    unsigned n;
+
+    for (n = 0; n < GF2_DIM; n++)
+        mat[n] = gf2_matrix_times(op, mat[n]);
+}
+
+/* Build the operator appending len zero bytes to a CRC-64, the same squares
+   as aos_crc64_combine(), but the operators for the bits of len are
+   multiplied into one matrix instead of being applied to a CRC. */
+void aos_crc64_zeros_init(aos_crc64_zeros_t *zeros, uintmax_t len)
+{
+    unsigned n;
+    uint64_t row;
+    uint64_t even[GF2_DIM];     /* even-power-of-two zeros operator */
+    uint64_t odd[GF2_DIM];      /* odd-power-of-two zeros operator */
+
+    /* identity */
+    zeros->len = len;
+    row = 1;
+    for (n = 0; n < GF2_DIM; n++) {
+        zeros->op[n] = row;
+        row <<= 1;
+    }
+    if (len == 0)
+        return;
+
+    /* put operator for one zero bit in odd */
+    odd[0] = POLY;
+    row = 1;
+    for (n = 1; n < GF2_DIM; n++) {
+        odd[n] = row;
+        row <<= 1;
+    }
+
+    /* put operator for two zero bits in even, and four zero bits in odd */
+    gf2_matrix_square(even, odd);
+    gf2_matrix_square(odd, even);
+
+    do {
+        gf2_matrix_square(even, odd);
+        if (len & 1)
+            gf2_matrix_apply(zeros->op, even);
+        len >>= 1;
+        if (len == 0)
+            break;
+
+        gf2_matrix_square(odd, even);
+        if (len & 1)
+            gf2_matrix_apply(zeros->op, odd);
+        len >>= 1;
+    } while (len != 0);
+}
+
+/* Return the CRC-64 of two sequential blocks, where the length of the second
+   block is zeros->len.  This costs one matrix times vector. */
+uint64_t aos_crc64_combine_zeros(const aos_crc64_zeros_t *zeros, uint64_t crc1, uint64_t crc2)
+{
+    if (zeros->len == 0)
+        return crc1;
+    return gf2_matrix_times((uint64_t *)zeros->op, crc1) ^ crc2;
+}
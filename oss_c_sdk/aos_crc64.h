@@ -6,8 +6,24 @@
 AOS_CPP_START
 
 uint64_t aos_crc64(uint64_t crc, void *buf, size_t len);
+
+/* The slice-by-8 table code, used when the cpu has no carry-less multiply. */
+uint64_t aos_crc64_slice8(uint64_t crc, void *buf, size_t len);
+
+/* The name of the kernel selected by aos_crc64: pclmulqdq, pmull or slice-by-8. */
+const char *aos_crc64_kernel(void);
 uint64_t aos_crc64_combine(uint64_t crc1, uint64_t crc2, uintmax_t len2);
 
+/* The GF(2) operator appending len zero bytes to a CRC-64, built once and
+   reused to combine many blocks of the same length. */
+typedef struct {
+    uintmax_t len;
+    uint64_t op[64];
+} aos_crc64_zeros_t;
+
+void aos_crc64_zeros_init(aos_crc64_zeros_t *zeros, uintmax_t len);
+uint64_t aos_crc64_combine_zeros(const aos_crc64_zeros_t *zeros, uint64_t crc1, uint64_t crc2);
+
 AOS_CPP_END
 
 #endif
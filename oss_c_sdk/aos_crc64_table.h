@@ -0,0 +1,1423 @@
+/* aos_crc64_table.h -- tables for aos_crc64.c
+ * Generated by the former crc64_init() with the ECMA-182 polynomial, the
+ * big-endian table holds the byte reversed entries of the little-endian one.
+ */
+
+#ifndef LIBAOS_CRC64_TABLE_H
+#define LIBAOS_CRC64_TABLE_H
+
+static const uint64_t crc64_little_table[8][256] = {
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0xb32e4cbe03a75f6f), UINT64_C(0xf4843657a840a05b),
+        UINT64_C(0x47aa7ae9abe7ff34), UINT64_C(0x7bd0c384ff8f5e33), UINT64_C(0xc8fe8f3afc28015c),
+        UINT64_C(0x8f54f5d357cffe68), UINT64_C(0x3c7ab96d5468a107), UINT64_C(0xf7a18709ff1ebc66),
+        UINT64_C(0x448fcbb7fcb9e309), UINT64_C(0x0325b15e575e1c3d), UINT64_C(0xb00bfde054f94352),
+        UINT64_C(0x8c71448d0091e255), UINT64_C(0x3f5f08330336bd3a), UINT64_C(0x78f572daa8d1420e),
+        UINT64_C(0xcbdb3e64ab761d61), UINT64_C(0x7d9ba13851336649), UINT64_C(0xceb5ed8652943926),
+        UINT64_C(0x891f976ff973c612), UINT64_C(0x3a31dbd1fad4997d), UINT64_C(0x064b62bcaebc387a),
+        UINT64_C(0xb5652e02ad1b6715), UINT64_C(0xf2cf54eb06fc9821), UINT64_C(0x41e11855055bc74e),
+        UINT64_C(0x8a3a2631ae2dda2f), UINT64_C(0x39146a8fad8a8540), UINT64_C(0x7ebe1066066d7a74),
+        UINT64_C(0xcd905cd805ca251b), UINT64_C(0xf1eae5b551a2841c), UINT64_C(0x42c4a90b5205db73),
+        UINT64_C(0x056ed3e2f9e22447), UINT64_C(0xb6409f5cfa457b28), UINT64_C(0xfb374270a266cc92),
+        UINT64_C(0x48190ecea1c193fd), UINT64_C(0x0fb374270a266cc9), UINT64_C(0xbc9d3899098133a6),
+        UINT64_C(0x80e781f45de992a1), UINT64_C(0x33c9cd4a5e4ecdce), UINT64_C(0x7463b7a3f5a932fa),
+        UINT64_C(0xc74dfb1df60e6d95), UINT64_C(0x0c96c5795d7870f4), UINT64_C(0xbfb889c75edf2f9b),
+        UINT64_C(0xf812f32ef538d0af), UINT64_C(0x4b3cbf90f69f8fc0), UINT64_C(0x774606fda2f72ec7),
+        UINT64_C(0xc4684a43a15071a8), UINT64_C(0x83c230aa0ab78e9c), UINT64_C(0x30ec7c140910d1f3),
+        UINT64_C(0x86ace348f355aadb), UINT64_C(0x3582aff6f0f2f5b4), UINT64_C(0x7228d51f5b150a80),
+        UINT64_C(0xc10699a158b255ef), UINT64_C(0xfd7c20cc0cdaf4e8), UINT64_C(0x4e526c720f7dab87),
+        UINT64_C(0x09f8169ba49a54b3), UINT64_C(0xbad65a25a73d0bdc), UINT64_C(0x710d64410c4b16bd),
+        UINT64_C(0xc22328ff0fec49d2), UINT64_C(0x85895216a40bb6e6), UINT64_C(0x36a71ea8a7ace989),
+        UINT64_C(0x0adda7c5f3c4488e), UINT64_C(0xb9f3eb7bf06317e1), UINT64_C(0xfe5991925b84e8d5),
+        UINT64_C(0x4d77dd2c5823b7ba), UINT64_C(0x64b62bcaebc387a1), UINT64_C(0xd7986774e864d8ce),
+        UINT64_C(0x90321d9d438327fa), UINT64_C(0x231c512340247895), UINT64_C(0x1f66e84e144cd992),
+        UINT64_C(0xac48a4f017eb86fd), UINT64_C(0xebe2de19bc0c79c9), UINT64_C(0x58cc92a7bfab26a6),
+        UINT64_C(0x9317acc314dd3bc7), UINT64_C(0x2039e07d177a64a8), UINT64_C(0x67939a94bc9d9b9c),
+        UINT64_C(0xd4bdd62abf3ac4f3), UINT64_C(0xe8c76f47eb5265f4), UINT64_C(0x5be923f9e8f53a9b),
+        UINT64_C(0x1c4359104312c5af), UINT64_C(0xaf6d15ae40b59ac0), UINT64_C(0x192d8af2baf0e1e8),
+        UINT64_C(0xaa03c64cb957be87), UINT64_C(0xeda9bca512b041b3), UINT64_C(0x5e87f01b11171edc),
+        UINT64_C(0x62fd4976457fbfdb), UINT64_C(0xd1d305c846d8e0b4), UINT64_C(0x96797f21ed3f1f80),
+        UINT64_C(0x2557339fee9840ef), UINT64_C(0xee8c0dfb45ee5d8e), UINT64_C(0x5da24145464902e1),
+        UINT64_C(0x1a083bacedaefdd5), UINT64_C(0xa9267712ee09a2ba), UINT64_C(0x955cce7fba6103bd),
+        UINT64_C(0x267282c1b9c65cd2), UINT64_C(0x61d8f8281221a3e6), UINT64_C(0xd2f6b4961186fc89),
+        UINT64_C(0x9f8169ba49a54b33), UINT64_C(0x2caf25044a02145c), UINT64_C(0x6b055fede1e5eb68),
+        UINT64_C(0xd82b1353e242b407), UINT64_C(0xe451aa3eb62a1500), UINT64_C(0x577fe680b58d4a6f),
+        UINT64_C(0x10d59c691e6ab55b), UINT64_C(0xa3fbd0d71dcdea34), UINT64_C(0x6820eeb3b6bbf755),
+        UINT64_C(0xdb0ea20db51ca83a), UINT64_C(0x9ca4d8e41efb570e), UINT64_C(0x2f8a945a1d5c0861),
+        UINT64_C(0x13f02d374934a966), UINT64_C(0xa0de61894a93f609), UINT64_C(0xe7741b60e174093d),
+        UINT64_C(0x545a57dee2d35652), UINT64_C(0xe21ac88218962d7a), UINT64_C(0x5134843c1b317215),
+        UINT64_C(0x169efed5b0d68d21), UINT64_C(0xa5b0b26bb371d24e), UINT64_C(0x99ca0b06e7197349),
+        UINT64_C(0x2ae447b8e4be2c26), UINT64_C(0x6d4e3d514f59d312), UINT64_C(0xde6071ef4cfe8c7d),
+        UINT64_C(0x15bb4f8be788911c), UINT64_C(0xa6950335e42fce73), UINT64_C(0xe13f79dc4fc83147),
+        UINT64_C(0x521135624c6f6e28), UINT64_C(0x6e6b8c0f1807cf2f), UINT64_C(0xdd45c0b11ba09040),
+        UINT64_C(0x9aefba58b0476f74), UINT64_C(0x29c1f6e6b3e0301b), UINT64_C(0xc96c5795d7870f42),
+        UINT64_C(0x7a421b2bd420502d), UINT64_C(0x3de861c27fc7af19), UINT64_C(0x8ec62d7c7c60f076),
+        UINT64_C(0xb2bc941128085171), UINT64_C(0x0192d8af2baf0e1e), UINT64_C(0x4638a2468048f12a),
+        UINT64_C(0xf516eef883efae45), UINT64_C(0x3ecdd09c2899b324), UINT64_C(0x8de39c222b3eec4b),
+        UINT64_C(0xca49e6cb80d9137f), UINT64_C(0x7967aa75837e4c10), UINT64_C(0x451d1318d716ed17),
+        UINT64_C(0xf6335fa6d4b1b278), UINT64_C(0xb199254f7f564d4c), UINT64_C(0x02b769f17cf11223),
+        UINT64_C(0xb4f7f6ad86b4690b), UINT64_C(0x07d9ba1385133664), UINT64_C(0x4073c0fa2ef4c950),
+        UINT64_C(0xf35d8c442d53963f), UINT64_C(0xcf273529793b3738), UINT64_C(0x7c0979977a9c6857),
+        UINT64_C(0x3ba3037ed17b9763), UINT64_C(0x888d4fc0d2dcc80c), UINT64_C(0x435671a479aad56d),
+        UINT64_C(0xf0783d1a7a0d8a02), UINT64_C(0xb7d247f3d1ea7536), UINT64_C(0x04fc0b4dd24d2a59),
+        UINT64_C(0x3886b22086258b5e), UINT64_C(0x8ba8fe9e8582d431), UINT64_C(0xcc0284772e652b05),
+        UINT64_C(0x7f2cc8c92dc2746a), UINT64_C(0x325b15e575e1c3d0), UINT64_C(0x8175595b76469cbf),
+        UINT64_C(0xc6df23b2dda1638b), UINT64_C(0x75f16f0cde063ce4), UINT64_C(0x498bd6618a6e9de3),
+        UINT64_C(0xfaa59adf89c9c28c), UINT64_C(0xbd0fe036222e3db8), UINT64_C(0x0e21ac88218962d7),
+        UINT64_C(0xc5fa92ec8aff7fb6), UINT64_C(0x76d4de52895820d9), UINT64_C(0x317ea4bb22bfdfed),
+        UINT64_C(0x8250e80521188082), UINT64_C(0xbe2a516875702185), UINT64_C(0x0d041dd676d77eea),
+        UINT64_C(0x4aae673fdd3081de), UINT64_C(0xf9802b81de97deb1), UINT64_C(0x4fc0b4dd24d2a599),
+        UINT64_C(0xfceef8632775faf6), UINT64_C(0xbb44828a8c9205c2), UINT64_C(0x086ace348f355aad),
+        UINT64_C(0x34107759db5dfbaa), UINT64_C(0x873e3be7d8faa4c5), UINT64_C(0xc094410e731d5bf1),
+        UINT64_C(0x73ba0db070ba049e), UINT64_C(0xb86133d4dbcc19ff), UINT64_C(0x0b4f7f6ad86b4690),
+        UINT64_C(0x4ce50583738cb9a4), UINT64_C(0xffcb493d702be6cb), UINT64_C(0xc3b1f050244347cc),
+        UINT64_C(0x709fbcee27e418a3), UINT64_C(0x3735c6078c03e797), UINT64_C(0x841b8ab98fa4b8f8),
+        UINT64_C(0xadda7c5f3c4488e3), UINT64_C(0x1ef430e13fe3d78c), UINT64_C(0x595e4a08940428b8),
+        UINT64_C(0xea7006b697a377d7), UINT64_C(0xd60abfdbc3cbd6d0), UINT64_C(0x6524f365c06c89bf),
+        UINT64_C(0x228e898c6b8b768b), UINT64_C(0x91a0c532682c29e4), UINT64_C(0x5a7bfb56c35a3485),
+        UINT64_C(0xe955b7e8c0fd6bea), UINT64_C(0xaeffcd016b1a94de), UINT64_C(0x1dd181bf68bdcbb1),
+        UINT64_C(0x21ab38d23cd56ab6), UINT64_C(0x9285746c3f7235d9), UINT64_C(0xd52f0e859495caed),
+        UINT64_C(0x6601423b97329582), UINT64_C(0xd041dd676d77eeaa), UINT64_C(0x636f91d96ed0b1c5),
+        UINT64_C(0x24c5eb30c5374ef1), UINT64_C(0x97eba78ec690119e), UINT64_C(0xab911ee392f8b099),
+        UINT64_C(0x18bf525d915feff6), UINT64_C(0x5f1528b43ab810c2), UINT64_C(0xec3b640a391f4fad),
+        UINT64_C(0x27e05a6e926952cc), UINT64_C(0x94ce16d091ce0da3), UINT64_C(0xd3646c393a29f297),
+        UINT64_C(0x604a2087398eadf8), UINT64_C(0x5c3099ea6de60cff), UINT64_C(0xef1ed5546e415390),
+        UINT64_C(0xa8b4afbdc5a6aca4), UINT64_C(0x1b9ae303c601f3cb), UINT64_C(0x56ed3e2f9e224471),
+        UINT64_C(0xe5c372919d851b1e), UINT64_C(0xa26908783662e42a), UINT64_C(0x114744c635c5bb45),
+        UINT64_C(0x2d3dfdab61ad1a42), UINT64_C(0x9e13b115620a452d), UINT64_C(0xd9b9cbfcc9edba19),
+        UINT64_C(0x6a978742ca4ae576), UINT64_C(0xa14cb926613cf817), UINT64_C(0x1262f598629ba778),
+        UINT64_C(0x55c88f71c97c584c), UINT64_C(0xe6e6c3cfcadb0723), UINT64_C(0xda9c7aa29eb3a624),
+        UINT64_C(0x69b2361c9d14f94b), UINT64_C(0x2e184cf536f3067f), UINT64_C(0x9d36004b35545910),
+        UINT64_C(0x2b769f17cf112238), UINT64_C(0x9858d3a9ccb67d57), UINT64_C(0xdff2a94067518263),
+        UINT64_C(0x6cdce5fe64f6dd0c), UINT64_C(0x50a65c93309e7c0b), UINT64_C(0xe388102d33392364),
+        UINT64_C(0xa4226ac498dedc50), UINT64_C(0x170c267a9b79833f), UINT64_C(0xdcd7181e300f9e5e),
+        UINT64_C(0x6ff954a033a8c131), UINT64_C(0x28532e49984f3e05), UINT64_C(0x9b7d62f79be8616a),
+        UINT64_C(0xa707db9acf80c06d), UINT64_C(0x14299724cc279f02), UINT64_C(0x5383edcd67c06036),
+        UINT64_C(0xe0ada17364673f59)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0x54e979925cd0f10d), UINT64_C(0xa9d2f324b9a1e21a),
+        UINT64_C(0xfd3b8ab6e5711317), UINT64_C(0xc17d4962dc4ddab1), UINT64_C(0x959430f0809d2bbc),
+        UINT64_C(0x68afba4665ec38ab), UINT64_C(0x3c46c3d4393cc9a6), UINT64_C(0x10223dee1795abe7),
+        UINT64_C(0x44cb447c4b455aea), UINT64_C(0xb9f0cecaae3449fd), UINT64_C(0xed19b758f2e4b8f0),
+        UINT64_C(0xd15f748ccbd87156), UINT64_C(0x85b60d1e9708805b), UINT64_C(0x788d87a87279934c),
+        UINT64_C(0x2c64fe3a2ea96241), UINT64_C(0x20447bdc2f2b57ce), UINT64_C(0x74ad024e73fba6c3),
+        UINT64_C(0x899688f8968ab5d4), UINT64_C(0xdd7ff16aca5a44d9), UINT64_C(0xe13932bef3668d7f),
+        UINT64_C(0xb5d04b2cafb67c72), UINT64_C(0x48ebc19a4ac76f65), UINT64_C(0x1c02b80816179e68),
+        UINT64_C(0x3066463238befc29), UINT64_C(0x648f3fa0646e0d24), UINT64_C(0x99b4b516811f1e33),
+        UINT64_C(0xcd5dcc84ddcfef3e), UINT64_C(0xf11b0f50e4f32698), UINT64_C(0xa5f276c2b823d795),
+        UINT64_C(0x58c9fc745d52c482), UINT64_C(0x0c2085e60182358f), UINT64_C(0x4088f7b85e56af9c),
+        UINT64_C(0x14618e2a02865e91), UINT64_C(0xe95a049ce7f74d86), UINT64_C(0xbdb37d0ebb27bc8b),
+        UINT64_C(0x81f5beda821b752d), UINT64_C(0xd51cc748decb8420), UINT64_C(0x28274dfe3bba9737),
+        UINT64_C(0x7cce346c676a663a), UINT64_C(0x50aaca5649c3047b), UINT64_C(0x0443b3c41513f576),
+        UINT64_C(0xf9783972f062e661), UINT64_C(0xad9140e0acb2176c), UINT64_C(0x91d78334958edeca),
+        UINT64_C(0xc53efaa6c95e2fc7), UINT64_C(0x380570102c2f3cd0), UINT64_C(0x6cec098270ffcddd),
+        UINT64_C(0x60cc8c64717df852), UINT64_C(0x3425f5f62dad095f), UINT64_C(0xc91e7f40c8dc1a48),
+        UINT64_C(0x9df706d2940ceb45), UINT64_C(0xa1b1c506ad3022e3), UINT64_C(0xf558bc94f1e0d3ee),
+        UINT64_C(0x086336221491c0f9), UINT64_C(0x5c8a4fb0484131f4), UINT64_C(0x70eeb18a66e853b5),
+        UINT64_C(0x2407c8183a38a2b8), UINT64_C(0xd93c42aedf49b1af), UINT64_C(0x8dd53b3c839940a2),
+        UINT64_C(0xb193f8e8baa58904), UINT64_C(0xe57a817ae6757809), UINT64_C(0x18410bcc03046b1e),
+        UINT64_C(0x4ca8725e5fd49a13), UINT64_C(0x8111ef70bcad5f38), UINT64_C(0xd5f896e2e07dae35),
+        UINT64_C(0x28c31c54050cbd22), UINT64_C(0x7c2a65c659dc4c2f), UINT64_C(0x406ca61260e08589),
+        UINT64_C(0x1485df803c307484), UINT64_C(0xe9be5536d9416793), UINT64_C(0xbd572ca48591969e),
+        UINT64_C(0x9133d29eab38f4df), UINT64_C(0xc5daab0cf7e805d2), UINT64_C(0x38e121ba129916c5),
+        UINT64_C(0x6c0858284e49e7c8), UINT64_C(0x504e9bfc77752e6e), UINT64_C(0x04a7e26e2ba5df63),
+        UINT64_C(0xf99c68d8ced4cc74), UINT64_C(0xad75114a92043d79), UINT64_C(0xa15594ac938608f6),
+        UINT64_C(0xf5bced3ecf56f9fb), UINT64_C(0x088767882a27eaec), UINT64_C(0x5c6e1e1a76f71be1),
+        UINT64_C(0x6028ddce4fcbd247), UINT64_C(0x34c1a45c131b234a), UINT64_C(0xc9fa2eeaf66a305d),
+        UINT64_C(0x9d135778aabac150), UINT64_C(0xb177a9428413a311), UINT64_C(0xe59ed0d0d8c3521c),
+        UINT64_C(0x18a55a663db2410b), UINT64_C(0x4c4c23f46162b006), UINT64_C(0x700ae020585e79a0),
+        UINT64_C(0x24e399b2048e88ad), UINT64_C(0xd9d81304e1ff9bba), UINT64_C(0x8d316a96bd2f6ab7),
+        UINT64_C(0xc19918c8e2fbf0a4), UINT64_C(0x9570615abe2b01a9), UINT64_C(0x684bebec5b5a12be),
+        UINT64_C(0x3ca2927e078ae3b3), UINT64_C(0x00e451aa3eb62a15), UINT64_C(0x540d28386266db18),
+        UINT64_C(0xa936a28e8717c80f), UINT64_C(0xfddfdb1cdbc73902), UINT64_C(0xd1bb2526f56e5b43),
+        UINT64_C(0x85525cb4a9beaa4e), UINT64_C(0x7869d6024ccfb959), UINT64_C(0x2c80af90101f4854),
+        UINT64_C(0x10c66c44292381f2), UINT64_C(0x442f15d675f370ff), UINT64_C(0xb9149f60908263e8),
+        UINT64_C(0xedfde6f2cc5292e5), UINT64_C(0xe1dd6314cdd0a76a), UINT64_C(0xb5341a8691005667),
+        UINT64_C(0x480f903074714570), UINT64_C(0x1ce6e9a228a1b47d), UINT64_C(0x20a02a76119d7ddb),
+        UINT64_C(0x744953e44d4d8cd6), UINT64_C(0x8972d952a83c9fc1), UINT64_C(0xdd9ba0c0f4ec6ecc),
+        UINT64_C(0xf1ff5efada450c8d), UINT64_C(0xa51627688695fd80), UINT64_C(0x582dadde63e4ee97),
+        UINT64_C(0x0cc4d44c3f341f9a), UINT64_C(0x308217980608d63c), UINT64_C(0x646b6e0a5ad82731),
+        UINT64_C(0x9950e4bcbfa93426), UINT64_C(0xcdb99d2ee379c52b), UINT64_C(0x90fb71cad654a0f5),
+        UINT64_C(0xc41208588a8451f8), UINT64_C(0x392982ee6ff542ef), UINT64_C(0x6dc0fb7c3325b3e2),
+        UINT64_C(0x518638a80a197a44), UINT64_C(0x056f413a56c98b49), UINT64_C(0xf854cb8cb3b8985e),
+        UINT64_C(0xacbdb21eef686953), UINT64_C(0x80d94c24c1c10b12), UINT64_C(0xd43035b69d11fa1f),
+        UINT64_C(0x290bbf007860e908), UINT64_C(0x7de2c69224b01805), UINT64_C(0x41a405461d8cd1a3),
+        UINT64_C(0x154d7cd4415c20ae), UINT64_C(0xe876f662a42d33b9), UINT64_C(0xbc9f8ff0f8fdc2b4),
+        UINT64_C(0xb0bf0a16f97ff73b), UINT64_C(0xe4567384a5af0636), UINT64_C(0x196df93240de1521),
+        UINT64_C(0x4d8480a01c0ee42c), UINT64_C(0x71c2437425322d8a), UINT64_C(0x252b3ae679e2dc87),
+        UINT64_C(0xd810b0509c93cf90), UINT64_C(0x8cf9c9c2c0433e9d), UINT64_C(0xa09d37f8eeea5cdc),
+        UINT64_C(0xf4744e6ab23aadd1), UINT64_C(0x094fc4dc574bbec6), UINT64_C(0x5da6bd4e0b9b4fcb),
+        UINT64_C(0x61e07e9a32a7866d), UINT64_C(0x350907086e777760), UINT64_C(0xc8328dbe8b066477),
+        UINT64_C(0x9cdbf42cd7d6957a), UINT64_C(0xd073867288020f69), UINT64_C(0x849affe0d4d2fe64),
+        UINT64_C(0x79a1755631a3ed73), UINT64_C(0x2d480cc46d731c7e), UINT64_C(0x110ecf10544fd5d8),
+        UINT64_C(0x45e7b682089f24d5), UINT64_C(0xb8dc3c34edee37c2), UINT64_C(0xec3545a6b13ec6cf),
+        UINT64_C(0xc051bb9c9f97a48e), UINT64_C(0x94b8c20ec3475583), UINT64_C(0x698348b826364694),
+        UINT64_C(0x3d6a312a7ae6b799), UINT64_C(0x012cf2fe43da7e3f), UINT64_C(0x55c58b6c1f0a8f32),
+        UINT64_C(0xa8fe01dafa7b9c25), UINT64_C(0xfc177848a6ab6d28), UINT64_C(0xf037fdaea72958a7),
+        UINT64_C(0xa4de843cfbf9a9aa), UINT64_C(0x59e50e8a1e88babd), UINT64_C(0x0d0c771842584bb0),
+        UINT64_C(0x314ab4cc7b648216), UINT64_C(0x65a3cd5e27b4731b), UINT64_C(0x989847e8c2c5600c),
+        UINT64_C(0xcc713e7a9e159101), UINT64_C(0xe015c040b0bcf340), UINT64_C(0xb4fcb9d2ec6c024d),
+        UINT64_C(0x49c73364091d115a), UINT64_C(0x1d2e4af655cde057), UINT64_C(0x216889226cf129f1),
+        UINT64_C(0x7581f0b03021d8fc), UINT64_C(0x88ba7a06d550cbeb), UINT64_C(0xdc53039489803ae6),
+        UINT64_C(0x11ea9eba6af9ffcd), UINT64_C(0x4503e72836290ec0), UINT64_C(0xb8386d9ed3581dd7),
+        UINT64_C(0xecd1140c8f88ecda), UINT64_C(0xd097d7d8b6b4257c), UINT64_C(0x847eae4aea64d471),
+        UINT64_C(0x794524fc0f15c766), UINT64_C(0x2dac5d6e53c5366b), UINT64_C(0x01c8a3547d6c542a),
+        UINT64_C(0x5521dac621bca527), UINT64_C(0xa81a5070c4cdb630), UINT64_C(0xfcf329e2981d473d),
+        UINT64_C(0xc0b5ea36a1218e9b), UINT64_C(0x945c93a4fdf17f96), UINT64_C(0x6967191218806c81),
+        UINT64_C(0x3d8e608044509d8c), UINT64_C(0x31aee56645d2a803), UINT64_C(0x65479cf41902590e),
+        UINT64_C(0x987c1642fc734a19), UINT64_C(0xcc956fd0a0a3bb14), UINT64_C(0xf0d3ac04999f72b2),
+        UINT64_C(0xa43ad596c54f83bf), UINT64_C(0x59015f20203e90a8), UINT64_C(0x0de826b27cee61a5),
+        UINT64_C(0x218cd888524703e4), UINT64_C(0x7565a11a0e97f2e9), UINT64_C(0x885e2bacebe6e1fe),
+        UINT64_C(0xdcb7523eb73610f3), UINT64_C(0xe0f191ea8e0ad955), UINT64_C(0xb418e878d2da2858),
+        UINT64_C(0x492362ce37ab3b4f), UINT64_C(0x1dca1b5c6b7bca42), UINT64_C(0x5162690234af5051),
+        UINT64_C(0x058b1090687fa15c), UINT64_C(0xf8b09a268d0eb24b), UINT64_C(0xac59e3b4d1de4346),
+        UINT64_C(0x901f2060e8e28ae0), UINT64_C(0xc4f659f2b4327bed), UINT64_C(0x39cdd344514368fa),
+        UINT64_C(0x6d24aad60d9399f7), UINT64_C(0x414054ec233afbb6), UINT64_C(0x15a92d7e7fea0abb),
+        UINT64_C(0xe892a7c89a9b19ac), UINT64_C(0xbc7bde5ac64be8a1), UINT64_C(0x803d1d8eff772107),
+        UINT64_C(0xd4d4641ca3a7d00a), UINT64_C(0x29efeeaa46d6c31d), UINT64_C(0x7d0697381a063210),
+        UINT64_C(0x712612de1b84079f), UINT64_C(0x25cf6b4c4754f692), UINT64_C(0xd8f4e1faa225e585),
+        UINT64_C(0x8c1d9868fef51488), UINT64_C(0xb05b5bbcc7c9dd2e), UINT64_C(0xe4b2222e9b192c23),
+        UINT64_C(0x1989a8987e683f34), UINT64_C(0x4d60d10a22b8ce39), UINT64_C(0x61042f300c11ac78),
+        UINT64_C(0x35ed56a250c15d75), UINT64_C(0xc8d6dc14b5b04e62), UINT64_C(0x9c3fa586e960bf6f),
+        UINT64_C(0xa0796652d05c76c9), UINT64_C(0xf4901fc08c8c87c4), UINT64_C(0x09ab957669fd94d3),
+        UINT64_C(0x5d42ece4352d65de)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0x3f0be14a916a6dcb), UINT64_C(0x7e17c29522d4db96),
+        UINT64_C(0x411c23dfb3beb65d), UINT64_C(0xfc2f852a45a9b72c), UINT64_C(0xc3246460d4c3dae7),
+        UINT64_C(0x823847bf677d6cba), UINT64_C(0xbd33a6f5f6170171), UINT64_C(0x6a87a57f245d70dd),
+        UINT64_C(0x558c4435b5371d16), UINT64_C(0x149067ea0689ab4b), UINT64_C(0x2b9b86a097e3c680),
+        UINT64_C(0x96a8205561f4c7f1), UINT64_C(0xa9a3c11ff09eaa3a), UINT64_C(0xe8bfe2c043201c67),
+        UINT64_C(0xd7b4038ad24a71ac), UINT64_C(0xd50f4afe48bae1ba), UINT64_C(0xea04abb4d9d08c71),
+        UINT64_C(0xab18886b6a6e3a2c), UINT64_C(0x94136921fb0457e7), UINT64_C(0x2920cfd40d135696),
+        UINT64_C(0x162b2e9e9c793b5d), UINT64_C(0x57370d412fc78d00), UINT64_C(0x683cec0bbeade0cb),
+        UINT64_C(0xbf88ef816ce79167), UINT64_C(0x80830ecbfd8dfcac), UINT64_C(0xc19f2d144e334af1),
+        UINT64_C(0xfe94cc5edf59273a), UINT64_C(0x43a76aab294e264b), UINT64_C(0x7cac8be1b8244b80),
+        UINT64_C(0x3db0a83e0b9afddd), UINT64_C(0x02bb49749af09016), UINT64_C(0x38c63ad73e7bddf1),
+        UINT64_C(0x07cddb9daf11b03a), UINT64_C(0x46d1f8421caf0667), UINT64_C(0x79da19088dc56bac),
+        UINT64_C(0xc4e9bffd7bd26add), UINT64_C(0xfbe25eb7eab80716), UINT64_C(0xbafe7d685906b14b),
+        UINT64_C(0x85f59c22c86cdc80), UINT64_C(0x52419fa81a26ad2c), UINT64_C(0x6d4a7ee28b4cc0e7),
+        UINT64_C(0x2c565d3d38f276ba), UINT64_C(0x135dbc77a9981b71), UINT64_C(0xae6e1a825f8f1a00),
+        UINT64_C(0x9165fbc8cee577cb), UINT64_C(0xd079d8177d5bc196), UINT64_C(0xef72395dec31ac5d),
+        UINT64_C(0xedc9702976c13c4b), UINT64_C(0xd2c29163e7ab5180), UINT64_C(0x93deb2bc5415e7dd),
+        UINT64_C(0xacd553f6c57f8a16), UINT64_C(0x11e6f50333688b67), UINT64_C(0x2eed1449a202e6ac),
+        UINT64_C(0x6ff1379611bc50f1), UINT64_C(0x50fad6dc80d63d3a), UINT64_C(0x874ed556529c4c96),
+        UINT64_C(0xb845341cc3f6215d), UINT64_C(0xf95917c370489700), UINT64_C(0xc652f689e122facb),
+        UINT64_C(0x7b61507c1735fbba), UINT64_C(0x446ab136865f9671), UINT64_C(0x057692e935e1202c),
+        UINT64_C(0x3a7d73a3a48b4de7), UINT64_C(0x718c75ae7cf7bbe2), UINT64_C(0x4e8794e4ed9dd629),
+        UINT64_C(0x0f9bb73b5e236074), UINT64_C(0x30905671cf490dbf), UINT64_C(0x8da3f084395e0cce),
+        UINT64_C(0xb2a811cea8346105), UINT64_C(0xf3b432111b8ad758), UINT64_C(0xccbfd35b8ae0ba93),
+        UINT64_C(0x1b0bd0d158aacb3f), UINT64_C(0x2400319bc9c0a6f4), UINT64_C(0x651c12447a7e10a9),
+        UINT64_C(0x5a17f30eeb147d62), UINT64_C(0xe72455fb1d037c13), UINT64_C(0xd82fb4b18c6911d8),
+        UINT64_C(0x9933976e3fd7a785), UINT64_C(0xa6387624aebdca4e), UINT64_C(0xa4833f50344d5a58),
+        UINT64_C(0x9b88de1aa5273793), UINT64_C(0xda94fdc5169981ce), UINT64_C(0xe59f1c8f87f3ec05),
+        UINT64_C(0x58acba7a71e4ed74), UINT64_C(0x67a75b30e08e80bf), UINT64_C(0x26bb78ef533036e2),
+        UINT64_C(0x19b099a5c25a5b29), UINT64_C(0xce049a2f10102a85), UINT64_C(0xf10f7b65817a474e),
+        UINT64_C(0xb01358ba32c4f113), UINT64_C(0x8f18b9f0a3ae9cd8), UINT64_C(0x322b1f0555b99da9),
+        UINT64_C(0x0d20fe4fc4d3f062), UINT64_C(0x4c3cdd90776d463f), UINT64_C(0x73373cdae6072bf4),
+        UINT64_C(0x494a4f79428c6613), UINT64_C(0x7641ae33d3e60bd8), UINT64_C(0x375d8dec6058bd85),
+        UINT64_C(0x08566ca6f132d04e), UINT64_C(0xb565ca530725d13f), UINT64_C(0x8a6e2b19964fbcf4),
+        UINT64_C(0xcb7208c625f10aa9), UINT64_C(0xf479e98cb49b6762), UINT64_C(0x23cdea0666d116ce),
+        UINT64_C(0x1cc60b4cf7bb7b05), UINT64_C(0x5dda28934405cd58), UINT64_C(0x62d1c9d9d56fa093),
+        UINT64_C(0xdfe26f2c2378a1e2), UINT64_C(0xe0e98e66b212cc29), UINT64_C(0xa1f5adb901ac7a74),
+        UINT64_C(0x9efe4cf390c617bf), UINT64_C(0x9c4505870a3687a9), UINT64_C(0xa34ee4cd9b5cea62),
+        UINT64_C(0xe252c71228e25c3f), UINT64_C(0xdd592658b98831f4), UINT64_C(0x606a80ad4f9f3085),
+        UINT64_C(0x5f6161e7def55d4e), UINT64_C(0x1e7d42386d4beb13), UINT64_C(0x2176a372fc2186d8),
+        UINT64_C(0xf6c2a0f82e6bf774), UINT64_C(0xc9c941b2bf019abf), UINT64_C(0x88d5626d0cbf2ce2),
+        UINT64_C(0xb7de83279dd54129), UINT64_C(0x0aed25d26bc24058), UINT64_C(0x35e6c498faa82d93),
+        UINT64_C(0x74fae74749169bce), UINT64_C(0x4bf1060dd87cf605), UINT64_C(0xe318eb5cf9ef77c4),
+        UINT64_C(0xdc130a1668851a0f), UINT64_C(0x9d0f29c9db3bac52), UINT64_C(0xa204c8834a51c199),
+        UINT64_C(0x1f376e76bc46c0e8), UINT64_C(0x203c8f3c2d2cad23), UINT64_C(0x6120ace39e921b7e),
+        UINT64_C(0x5e2b4da90ff876b5), UINT64_C(0x899f4e23ddb20719), UINT64_C(0xb694af694cd86ad2),
+        UINT64_C(0xf7888cb6ff66dc8f), UINT64_C(0xc8836dfc6e0cb144), UINT64_C(0x75b0cb09981bb035),
+        UINT64_C(0x4abb2a430971ddfe), UINT64_C(0x0ba7099cbacf6ba3), UINT64_C(0x34ace8d62ba50668),
+        UINT64_C(0x3617a1a2b155967e), UINT64_C(0x091c40e8203ffbb5), UINT64_C(0x4800633793814de8),
+        UINT64_C(0x770b827d02eb2023), UINT64_C(0xca382488f4fc2152), UINT64_C(0xf533c5c265964c99),
+        UINT64_C(0xb42fe61dd628fac4), UINT64_C(0x8b2407574742970f), UINT64_C(0x5c9004dd9508e6a3),
+        UINT64_C(0x639be59704628b68), UINT64_C(0x2287c648b7dc3d35), UINT64_C(0x1d8c270226b650fe),
+        UINT64_C(0xa0bf81f7d0a1518f), UINT64_C(0x9fb460bd41cb3c44), UINT64_C(0xdea84362f2758a19),
+        UINT64_C(0xe1a3a228631fe7d2), UINT64_C(0xdbded18bc794aa35), UINT64_C(0xe4d530c156fec7fe),
+        UINT64_C(0xa5c9131ee54071a3), UINT64_C(0x9ac2f254742a1c68), UINT64_C(0x27f154a1823d1d19),
+        UINT64_C(0x18fab5eb135770d2), UINT64_C(0x59e69634a0e9c68f), UINT64_C(0x66ed777e3183ab44),
+        UINT64_C(0xb15974f4e3c9dae8), UINT64_C(0x8e5295be72a3b723), UINT64_C(0xcf4eb661c11d017e),
+        UINT64_C(0xf045572b50776cb5), UINT64_C(0x4d76f1dea6606dc4), UINT64_C(0x727d1094370a000f),
+        UINT64_C(0x3361334b84b4b652), UINT64_C(0x0c6ad20115dedb99), UINT64_C(0x0ed19b758f2e4b8f),
+        UINT64_C(0x31da7a3f1e442644), UINT64_C(0x70c659e0adfa9019), UINT64_C(0x4fcdb8aa3c90fdd2),
+        UINT64_C(0xf2fe1e5fca87fca3), UINT64_C(0xcdf5ff155bed9168), UINT64_C(0x8ce9dccae8532735),
+        UINT64_C(0xb3e23d8079394afe), UINT64_C(0x64563e0aab733b52), UINT64_C(0x5b5ddf403a195699),
+        UINT64_C(0x1a41fc9f89a7e0c4), UINT64_C(0x254a1dd518cd8d0f), UINT64_C(0x9879bb20eeda8c7e),
+        UINT64_C(0xa7725a6a7fb0e1b5), UINT64_C(0xe66e79b5cc0e57e8), UINT64_C(0xd96598ff5d643a23),
+        UINT64_C(0x92949ef28518cc26), UINT64_C(0xad9f7fb81472a1ed), UINT64_C(0xec835c67a7cc17b0),
+        UINT64_C(0xd388bd2d36a67a7b), UINT64_C(0x6ebb1bd8c0b17b0a), UINT64_C(0x51b0fa9251db16c1),
+        UINT64_C(0x10acd94de265a09c), UINT64_C(0x2fa73807730fcd57), UINT64_C(0xf8133b8da145bcfb),
+        UINT64_C(0xc718dac7302fd130), UINT64_C(0x8604f9188391676d), UINT64_C(0xb90f185212fb0aa6),
+        UINT64_C(0x043cbea7e4ec0bd7), UINT64_C(0x3b375fed7586661c), UINT64_C(0x7a2b7c32c638d041),
+        UINT64_C(0x45209d785752bd8a), UINT64_C(0x479bd40ccda22d9c), UINT64_C(0x789035465cc84057),
+        UINT64_C(0x398c1699ef76f60a), UINT64_C(0x0687f7d37e1c9bc1), UINT64_C(0xbbb45126880b9ab0),
+        UINT64_C(0x84bfb06c1961f77b), UINT64_C(0xc5a393b3aadf4126), UINT64_C(0xfaa872f93bb52ced),
+        UINT64_C(0x2d1c7173e9ff5d41), UINT64_C(0x121790397895308a), UINT64_C(0x530bb3e6cb2b86d7),
+        UINT64_C(0x6c0052ac5a41eb1c), UINT64_C(0xd133f459ac56ea6d), UINT64_C(0xee3815133d3c87a6),
+        UINT64_C(0xaf2436cc8e8231fb), UINT64_C(0x902fd7861fe85c30), UINT64_C(0xaa52a425bb6311d7),
+        UINT64_C(0x9559456f2a097c1c), UINT64_C(0xd44566b099b7ca41), UINT64_C(0xeb4e87fa08dda78a),
+        UINT64_C(0x567d210ffecaa6fb), UINT64_C(0x6976c0456fa0cb30), UINT64_C(0x286ae39adc1e7d6d),
+        UINT64_C(0x176102d04d7410a6), UINT64_C(0xc0d5015a9f3e610a), UINT64_C(0xffdee0100e540cc1),
+        UINT64_C(0xbec2c3cfbdeaba9c), UINT64_C(0x81c922852c80d757), UINT64_C(0x3cfa8470da97d626),
+        UINT64_C(0x03f1653a4bfdbbed), UINT64_C(0x42ed46e5f8430db0), UINT64_C(0x7de6a7af6929607b),
+        UINT64_C(0x7f5deedbf3d9f06d), UINT64_C(0x40560f9162b39da6), UINT64_C(0x014a2c4ed10d2bfb),
+        UINT64_C(0x3e41cd0440674630), UINT64_C(0x83726bf1b6704741), UINT64_C(0xbc798abb271a2a8a),
+        UINT64_C(0xfd65a96494a49cd7), UINT64_C(0xc26e482e05cef11c), UINT64_C(0x15da4ba4d78480b0),
+        UINT64_C(0x2ad1aaee46eeed7b), UINT64_C(0x6bcd8931f5505b26), UINT64_C(0x54c6687b643a36ed),
+        UINT64_C(0xe9f5ce8e922d379c), UINT64_C(0xd6fe2fc403475a57), UINT64_C(0x97e20c1bb0f9ec0a),
+        UINT64_C(0xa8e9ed51219381c1)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0x1dee8a5e222ca1dc), UINT64_C(0x3bdd14bc445943b8),
+        UINT64_C(0x26339ee26675e264), UINT64_C(0x77ba297888b28770), UINT64_C(0x6a54a326aa9e26ac),
+        UINT64_C(0x4c673dc4ccebc4c8), UINT64_C(0x5189b79aeec76514), UINT64_C(0xef7452f111650ee0),
+        UINT64_C(0xf29ad8af3349af3c), UINT64_C(0xd4a9464d553c4d58), UINT64_C(0xc947cc137710ec84),
+        UINT64_C(0x98ce7b8999d78990), UINT64_C(0x8520f1d7bbfb284c), UINT64_C(0xa3136f35dd8eca28),
+        UINT64_C(0xbefde56bffa26bf4), UINT64_C(0x4c300ac98dc40345), UINT64_C(0x51de8097afe8a299),
+        UINT64_C(0x77ed1e75c99d40fd), UINT64_C(0x6a03942bebb1e121), UINT64_C(0x3b8a23b105768435),
+        UINT64_C(0x2664a9ef275a25e9), UINT64_C(0x0057370d412fc78d), UINT64_C(0x1db9bd5363036651),
+        UINT64_C(0xa34458389ca10da5), UINT64_C(0xbeaad266be8dac79), UINT64_C(0x98994c84d8f84e1d),
+        UINT64_C(0x8577c6dafad4efc1), UINT64_C(0xd4fe714014138ad5), UINT64_C(0xc910fb1e363f2b09),
+        UINT64_C(0xef2365fc504ac96d), UINT64_C(0xf2cdefa2726668b1), UINT64_C(0x986015931b88068a),
+        UINT64_C(0x858e9fcd39a4a756), UINT64_C(0xa3bd012f5fd14532), UINT64_C(0xbe538b717dfde4ee),
+        UINT64_C(0xefda3ceb933a81fa), UINT64_C(0xf234b6b5b1162026), UINT64_C(0xd4072857d763c242),
+        UINT64_C(0xc9e9a209f54f639e), UINT64_C(0x771447620aed086a), UINT64_C(0x6afacd3c28c1a9b6),
+        UINT64_C(0x4cc953de4eb44bd2), UINT64_C(0x5127d9806c98ea0e), UINT64_C(0x00ae6e1a825f8f1a),
+        UINT64_C(0x1d40e444a0732ec6), UINT64_C(0x3b737aa6c606cca2), UINT64_C(0x269df0f8e42a6d7e),
+        UINT64_C(0xd4501f5a964c05cf), UINT64_C(0xc9be9504b460a413), UINT64_C(0xef8d0be6d2154677),
+        UINT64_C(0xf26381b8f039e7ab), UINT64_C(0xa3ea36221efe82bf), UINT64_C(0xbe04bc7c3cd22363),
+        UINT64_C(0x9837229e5aa7c107), UINT64_C(0x85d9a8c0788b60db), UINT64_C(0x3b244dab87290b2f),
+        UINT64_C(0x26cac7f5a505aaf3), UINT64_C(0x00f95917c3704897), UINT64_C(0x1d17d349e15ce94b),
+        UINT64_C(0x4c9e64d30f9b8c5f), UINT64_C(0x5170ee8d2db72d83), UINT64_C(0x7743706f4bc2cfe7),
+        UINT64_C(0x6aadfa3169ee6e3b), UINT64_C(0xa218840d981e1391), UINT64_C(0xbff60e53ba32b24d),
+        UINT64_C(0x99c590b1dc475029), UINT64_C(0x842b1aeffe6bf1f5), UINT64_C(0xd5a2ad7510ac94e1),
+        UINT64_C(0xc84c272b3280353d), UINT64_C(0xee7fb9c954f5d759), UINT64_C(0xf391339776d97685),
+        UINT64_C(0x4d6cd6fc897b1d71), UINT64_C(0x50825ca2ab57bcad), UINT64_C(0x76b1c240cd225ec9),
+        UINT64_C(0x6b5f481eef0eff15), UINT64_C(0x3ad6ff8401c99a01), UINT64_C(0x273875da23e53bdd),
+        UINT64_C(0x010beb384590d9b9), UINT64_C(0x1ce5616667bc7865), UINT64_C(0xee288ec415da10d4),
+        UINT64_C(0xf3c6049a37f6b108), UINT64_C(0xd5f59a785183536c), UINT64_C(0xc81b102673aff2b0),
+        UINT64_C(0x9992a7bc9d6897a4), UINT64_C(0x847c2de2bf443678), UINT64_C(0xa24fb300d931d41c),
+        UINT64_C(0xbfa1395efb1d75c0), UINT64_C(0x015cdc3504bf1e34), UINT64_C(0x1cb2566b2693bfe8),
+        UINT64_C(0x3a81c88940e65d8c), UINT64_C(0x276f42d762cafc50), UINT64_C(0x76e6f54d8c0d9944),
+        UINT64_C(0x6b087f13ae213898), UINT64_C(0x4d3be1f1c854dafc), UINT64_C(0x50d56bafea787b20),
+        UINT64_C(0x3a78919e8396151b), UINT64_C(0x27961bc0a1bab4c7), UINT64_C(0x01a58522c7cf56a3),
+        UINT64_C(0x1c4b0f7ce5e3f77f), UINT64_C(0x4dc2b8e60b24926b), UINT64_C(0x502c32b8290833b7),
+        UINT64_C(0x761fac5a4f7dd1d3), UINT64_C(0x6bf126046d51700f), UINT64_C(0xd50cc36f92f31bfb),
+        UINT64_C(0xc8e24931b0dfba27), UINT64_C(0xeed1d7d3d6aa5843), UINT64_C(0xf33f5d8df486f99f),
+        UINT64_C(0xa2b6ea171a419c8b), UINT64_C(0xbf586049386d3d57), UINT64_C(0x996bfeab5e18df33),
+        UINT64_C(0x848574f57c347eef), UINT64_C(0x76489b570e52165e), UINT64_C(0x6ba611092c7eb782),
+        UINT64_C(0x4d958feb4a0b55e6), UINT64_C(0x507b05b56827f43a), UINT64_C(0x01f2b22f86e0912e),
+        UINT64_C(0x1c1c3871a4cc30f2), UINT64_C(0x3a2fa693c2b9d296), UINT64_C(0x27c12ccde095734a),
+        UINT64_C(0x993cc9a61f3718be), UINT64_C(0x84d243f83d1bb962), UINT64_C(0xa2e1dd1a5b6e5b06),
+        UINT64_C(0xbf0f57447942fada), UINT64_C(0xee86e0de97859fce), UINT64_C(0xf3686a80b5a93e12),
+        UINT64_C(0xd55bf462d3dcdc76), UINT64_C(0xc8b57e3cf1f07daa), UINT64_C(0xd6e9a7309f3239a7),
+        UINT64_C(0xcb072d6ebd1e987b), UINT64_C(0xed34b38cdb6b7a1f), UINT64_C(0xf0da39d2f947dbc3),
+        UINT64_C(0xa1538e481780bed7), UINT64_C(0xbcbd041635ac1f0b), UINT64_C(0x9a8e9af453d9fd6f),
+        UINT64_C(0x876010aa71f55cb3), UINT64_C(0x399df5c18e573747), UINT64_C(0x24737f9fac7b969b),
+        UINT64_C(0x0240e17dca0e74ff), UINT64_C(0x1fae6b23e822d523), UINT64_C(0x4e27dcb906e5b037),
+        UINT64_C(0x53c956e724c911eb), UINT64_C(0x75fac80542bcf38f), UINT64_C(0x6814425b60905253),
+        UINT64_C(0x9ad9adf912f63ae2), UINT64_C(0x873727a730da9b3e), UINT64_C(0xa104b94556af795a),
+        UINT64_C(0xbcea331b7483d886), UINT64_C(0xed6384819a44bd92), UINT64_C(0xf08d0edfb8681c4e),
+        UINT64_C(0xd6be903dde1dfe2a), UINT64_C(0xcb501a63fc315ff6), UINT64_C(0x75adff0803933402),
+        UINT64_C(0x6843755621bf95de), UINT64_C(0x4e70ebb447ca77ba), UINT64_C(0x539e61ea65e6d666),
+        UINT64_C(0x0217d6708b21b372), UINT64_C(0x1ff95c2ea90d12ae), UINT64_C(0x39cac2cccf78f0ca),
+        UINT64_C(0x24244892ed545116), UINT64_C(0x4e89b2a384ba3f2d), UINT64_C(0x536738fda6969ef1),
+        UINT64_C(0x7554a61fc0e37c95), UINT64_C(0x68ba2c41e2cfdd49), UINT64_C(0x39339bdb0c08b85d),
+        UINT64_C(0x24dd11852e241981), UINT64_C(0x02ee8f674851fbe5), UINT64_C(0x1f0005396a7d5a39),
+        UINT64_C(0xa1fde05295df31cd), UINT64_C(0xbc136a0cb7f39011), UINT64_C(0x9a20f4eed1867275),
+        UINT64_C(0x87ce7eb0f3aad3a9), UINT64_C(0xd647c92a1d6db6bd), UINT64_C(0xcba943743f411761),
+        UINT64_C(0xed9add965934f505), UINT64_C(0xf07457c87b1854d9), UINT64_C(0x02b9b86a097e3c68),
+        UINT64_C(0x1f5732342b529db4), UINT64_C(0x3964acd64d277fd0), UINT64_C(0x248a26886f0bde0c),
+        UINT64_C(0x7503911281ccbb18), UINT64_C(0x68ed1b4ca3e01ac4), UINT64_C(0x4ede85aec595f8a0),
+        UINT64_C(0x53300ff0e7b9597c), UINT64_C(0xedcdea9b181b3288), UINT64_C(0xf02360c53a379354),
+        UINT64_C(0xd610fe275c427130), UINT64_C(0xcbfe74797e6ed0ec), UINT64_C(0x9a77c3e390a9b5f8),
+        UINT64_C(0x879949bdb2851424), UINT64_C(0xa1aad75fd4f0f640), UINT64_C(0xbc445d01f6dc579c),
+        UINT64_C(0x74f1233d072c2a36), UINT64_C(0x691fa96325008bea), UINT64_C(0x4f2c37814375698e),
+        UINT64_C(0x52c2bddf6159c852), UINT64_C(0x034b0a458f9ead46), UINT64_C(0x1ea5801badb20c9a),
+        UINT64_C(0x38961ef9cbc7eefe), UINT64_C(0x257894a7e9eb4f22), UINT64_C(0x9b8571cc164924d6),
+        UINT64_C(0x866bfb923465850a), UINT64_C(0xa05865705210676e), UINT64_C(0xbdb6ef2e703cc6b2),
+        UINT64_C(0xec3f58b49efba3a6), UINT64_C(0xf1d1d2eabcd7027a), UINT64_C(0xd7e24c08daa2e01e),
+        UINT64_C(0xca0cc656f88e41c2), UINT64_C(0x38c129f48ae82973), UINT64_C(0x252fa3aaa8c488af),
+        UINT64_C(0x031c3d48ceb16acb), UINT64_C(0x1ef2b716ec9dcb17), UINT64_C(0x4f7b008c025aae03),
+        UINT64_C(0x52958ad220760fdf), UINT64_C(0x74a614304603edbb), UINT64_C(0x69489e6e642f4c67),
+        UINT64_C(0xd7b57b059b8d2793), UINT64_C(0xca5bf15bb9a1864f), UINT64_C(0xec686fb9dfd4642b),
+        UINT64_C(0xf186e5e7fdf8c5f7), UINT64_C(0xa00f527d133fa0e3), UINT64_C(0xbde1d8233113013f),
+        UINT64_C(0x9bd246c15766e35b), UINT64_C(0x863ccc9f754a4287), UINT64_C(0xec9136ae1ca42cbc),
+        UINT64_C(0xf17fbcf03e888d60), UINT64_C(0xd74c221258fd6f04), UINT64_C(0xcaa2a84c7ad1ced8),
+        UINT64_C(0x9b2b1fd69416abcc), UINT64_C(0x86c59588b63a0a10), UINT64_C(0xa0f60b6ad04fe874),
+        UINT64_C(0xbd188134f26349a8), UINT64_C(0x03e5645f0dc1225c), UINT64_C(0x1e0bee012fed8380),
+        UINT64_C(0x383870e3499861e4), UINT64_C(0x25d6fabd6bb4c038), UINT64_C(0x745f4d278573a52c),
+        UINT64_C(0x69b1c779a75f04f0), UINT64_C(0x4f82599bc12ae694), UINT64_C(0x526cd3c5e3064748),
+        UINT64_C(0xa0a13c6791602ff9), UINT64_C(0xbd4fb639b34c8e25), UINT64_C(0x9b7c28dbd5396c41),
+        UINT64_C(0x8692a285f715cd9d), UINT64_C(0xd71b151f19d2a889), UINT64_C(0xcaf59f413bfe0955),
+        UINT64_C(0xecc601a35d8beb31), UINT64_C(0xf1288bfd7fa74aed), UINT64_C(0x4fd56e9680052119),
+        UINT64_C(0x523be4c8a22980c5), UINT64_C(0x74087a2ac45c62a1), UINT64_C(0x69e6f074e670c37d),
+        UINT64_C(0x386f47ee08b7a669), UINT64_C(0x2581cdb02a9b07b5), UINT64_C(0x03b253524ceee5d1),
+        UINT64_C(0x1e5cd90c6ec2440d)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0x5c2d776033c4205e), UINT64_C(0xb85aeec0678840bc),
+        UINT64_C(0xe47799a0544c60e2), UINT64_C(0xe26d72ab601e9ffd), UINT64_C(0xbe4005cb53dabfa3),
+        UINT64_C(0x5a379c6b0796df41), UINT64_C(0x061aeb0b3452ff1f), UINT64_C(0x56024a7d6f33217f),
+        UINT64_C(0x0a2f3d1d5cf70121), UINT64_C(0xee58a4bd08bb61c3), UINT64_C(0xb275d3dd3b7f419d),
+        UINT64_C(0xb46f38d60f2dbe82), UINT64_C(0xe8424fb63ce99edc), UINT64_C(0x0c35d61668a5fe3e),
+        UINT64_C(0x5018a1765b61de60), UINT64_C(0xac0494fade6642fe), UINT64_C(0xf029e39aeda262a0),
+        UINT64_C(0x145e7a3ab9ee0242), UINT64_C(0x48730d5a8a2a221c), UINT64_C(0x4e69e651be78dd03),
+        UINT64_C(0x124491318dbcfd5d), UINT64_C(0xf6330891d9f09dbf), UINT64_C(0xaa1e7ff1ea34bde1),
+        UINT64_C(0xfa06de87b1556381), UINT64_C(0xa62ba9e7829143df), UINT64_C(0x425c3047d6dd233d),
+        UINT64_C(0x1e714727e5190363), UINT64_C(0x186bac2cd14bfc7c), UINT64_C(0x4446db4ce28fdc22),
+        UINT64_C(0xa03142ecb6c3bcc0), UINT64_C(0xfc1c358c85079c9e), UINT64_C(0xcad186de13c29b79),
+        UINT64_C(0x96fcf1be2006bb27), UINT64_C(0x728b681e744adbc5), UINT64_C(0x2ea61f7e478efb9b),
+        UINT64_C(0x28bcf47573dc0484), UINT64_C(0x74918315401824da), UINT64_C(0x90e61ab514544438),
+        UINT64_C(0xcccb6dd527906466), UINT64_C(0x9cd3cca37cf1ba06), UINT64_C(0xc0febbc34f359a58),
+        UINT64_C(0x248922631b79faba), UINT64_C(0x78a4550328bddae4), UINT64_C(0x7ebebe081cef25fb),
+        UINT64_C(0x2293c9682f2b05a5), UINT64_C(0xc6e450c87b676547), UINT64_C(0x9ac927a848a34519),
+        UINT64_C(0x66d51224cda4d987), UINT64_C(0x3af86544fe60f9d9), UINT64_C(0xde8ffce4aa2c993b),
+        UINT64_C(0x82a28b8499e8b965), UINT64_C(0x84b8608fadba467a), UINT64_C(0xd89517ef9e7e6624),
+        UINT64_C(0x3ce28e4fca3206c6), UINT64_C(0x60cff92ff9f62698), UINT64_C(0x30d75859a297f8f8),
+        UINT64_C(0x6cfa2f399153d8a6), UINT64_C(0x888db699c51fb844), UINT64_C(0xd4a0c1f9f6db981a),
+        UINT64_C(0xd2ba2af2c2896705), UINT64_C(0x8e975d92f14d475b), UINT64_C(0x6ae0c432a50127b9),
+        UINT64_C(0x36cdb35296c507e7), UINT64_C(0x077ba297888b2877), UINT64_C(0x5b56d5f7bb4f0829),
+        UINT64_C(0xbf214c57ef0368cb), UINT64_C(0xe30c3b37dcc74895), UINT64_C(0xe516d03ce895b78a),
+        UINT64_C(0xb93ba75cdb5197d4), UINT64_C(0x5d4c3efc8f1df736), UINT64_C(0x0161499cbcd9d768),
+        UINT64_C(0x5179e8eae7b80908), UINT64_C(0x0d549f8ad47c2956), UINT64_C(0xe923062a803049b4),
+        UINT64_C(0xb50e714ab3f469ea), UINT64_C(0xb3149a4187a696f5), UINT64_C(0xef39ed21b462b6ab),
+        UINT64_C(0x0b4e7481e02ed649), UINT64_C(0x576303e1d3eaf617), UINT64_C(0xab7f366d56ed6a89),
+        UINT64_C(0xf752410d65294ad7), UINT64_C(0x1325d8ad31652a35), UINT64_C(0x4f08afcd02a10a6b),
+        UINT64_C(0x491244c636f3f574), UINT64_C(0x153f33a60537d52a), UINT64_C(0xf148aa06517bb5c8),
+        UINT64_C(0xad65dd6662bf9596), UINT64_C(0xfd7d7c1039de4bf6), UINT64_C(0xa1500b700a1a6ba8),
+        UINT64_C(0x452792d05e560b4a), UINT64_C(0x190ae5b06d922b14), UINT64_C(0x1f100ebb59c0d40b),
+        UINT64_C(0x433d79db6a04f455), UINT64_C(0xa74ae07b3e4894b7), UINT64_C(0xfb67971b0d8cb4e9),
+        UINT64_C(0xcdaa24499b49b30e), UINT64_C(0x91875329a88d9350), UINT64_C(0x75f0ca89fcc1f3b2),
+        UINT64_C(0x29ddbde9cf05d3ec), UINT64_C(0x2fc756e2fb572cf3), UINT64_C(0x73ea2182c8930cad),
+        UINT64_C(0x979db8229cdf6c4f), UINT64_C(0xcbb0cf42af1b4c11), UINT64_C(0x9ba86e34f47a9271),
+        UINT64_C(0xc7851954c7beb22f), UINT64_C(0x23f280f493f2d2cd), UINT64_C(0x7fdff794a036f293),
+        UINT64_C(0x79c51c9f94640d8c), UINT64_C(0x25e86bffa7a02dd2), UINT64_C(0xc19ff25ff3ec4d30),
+        UINT64_C(0x9db2853fc0286d6e), UINT64_C(0x61aeb0b3452ff1f0), UINT64_C(0x3d83c7d376ebd1ae),
+        UINT64_C(0xd9f45e7322a7b14c), UINT64_C(0x85d9291311639112), UINT64_C(0x83c3c21825316e0d),
+        UINT64_C(0xdfeeb57816f54e53), UINT64_C(0x3b992cd842b92eb1), UINT64_C(0x67b45bb8717d0eef),
+        UINT64_C(0x37acface2a1cd08f), UINT64_C(0x6b818dae19d8f0d1), UINT64_C(0x8ff6140e4d949033),
+        UINT64_C(0xd3db636e7e50b06d), UINT64_C(0xd5c188654a024f72), UINT64_C(0x89ecff0579c66f2c),
+        UINT64_C(0x6d9b66a52d8a0fce), UINT64_C(0x31b611c51e4e2f90), UINT64_C(0x0ef7452f111650ee),
+        UINT64_C(0x52da324f22d270b0), UINT64_C(0xb6adabef769e1052), UINT64_C(0xea80dc8f455a300c),
+        UINT64_C(0xec9a37847108cf13), UINT64_C(0xb0b740e442ccef4d), UINT64_C(0x54c0d94416808faf),
+        UINT64_C(0x08edae242544aff1), UINT64_C(0x58f50f527e257191), UINT64_C(0x04d878324de151cf),
+        UINT64_C(0xe0afe19219ad312d), UINT64_C(0xbc8296f22a691173), UINT64_C(0xba987df91e3bee6c),
+        UINT64_C(0xe6b50a992dffce32), UINT64_C(0x02c2933979b3aed0), UINT64_C(0x5eefe4594a778e8e),
+        UINT64_C(0xa2f3d1d5cf701210), UINT64_C(0xfedea6b5fcb4324e), UINT64_C(0x1aa93f15a8f852ac),
+        UINT64_C(0x468448759b3c72f2), UINT64_C(0x409ea37eaf6e8ded), UINT64_C(0x1cb3d41e9caaadb3),
+        UINT64_C(0xf8c44dbec8e6cd51), UINT64_C(0xa4e93adefb22ed0f), UINT64_C(0xf4f19ba8a043336f),
+        UINT64_C(0xa8dcecc893871331), UINT64_C(0x4cab7568c7cb73d3), UINT64_C(0x10860208f40f538d),
+        UINT64_C(0x169ce903c05dac92), UINT64_C(0x4ab19e63f3998ccc), UINT64_C(0xaec607c3a7d5ec2e),
+        UINT64_C(0xf2eb70a39411cc70), UINT64_C(0xc426c3f102d4cb97), UINT64_C(0x980bb4913110ebc9),
+        UINT64_C(0x7c7c2d31655c8b2b), UINT64_C(0x20515a515698ab75), UINT64_C(0x264bb15a62ca546a),
+        UINT64_C(0x7a66c63a510e7434), UINT64_C(0x9e115f9a054214d6), UINT64_C(0xc23c28fa36863488),
+        UINT64_C(0x9224898c6de7eae8), UINT64_C(0xce09feec5e23cab6), UINT64_C(0x2a7e674c0a6faa54),
+        UINT64_C(0x7653102c39ab8a0a), UINT64_C(0x7049fb270df97515), UINT64_C(0x2c648c473e3d554b),
+        UINT64_C(0xc81315e76a7135a9), UINT64_C(0x943e628759b515f7), UINT64_C(0x6822570bdcb28969),
+        UINT64_C(0x340f206bef76a937), UINT64_C(0xd078b9cbbb3ac9d5), UINT64_C(0x8c55ceab88fee98b),
+        UINT64_C(0x8a4f25a0bcac1694), UINT64_C(0xd66252c08f6836ca), UINT64_C(0x3215cb60db245628),
+        UINT64_C(0x6e38bc00e8e07676), UINT64_C(0x3e201d76b381a816), UINT64_C(0x620d6a1680458848),
+        UINT64_C(0x867af3b6d409e8aa), UINT64_C(0xda5784d6e7cdc8f4), UINT64_C(0xdc4d6fddd39f37eb),
+        UINT64_C(0x806018bde05b17b5), UINT64_C(0x6417811db4177757), UINT64_C(0x383af67d87d35709),
+        UINT64_C(0x098ce7b8999d7899), UINT64_C(0x55a190d8aa5958c7), UINT64_C(0xb1d60978fe153825),
+        UINT64_C(0xedfb7e18cdd1187b), UINT64_C(0xebe19513f983e764), UINT64_C(0xb7cce273ca47c73a),
+        UINT64_C(0x53bb7bd39e0ba7d8), UINT64_C(0x0f960cb3adcf8786), UINT64_C(0x5f8eadc5f6ae59e6),
+        UINT64_C(0x03a3daa5c56a79b8), UINT64_C(0xe7d443059126195a), UINT64_C(0xbbf93465a2e23904),
+        UINT64_C(0xbde3df6e96b0c61b), UINT64_C(0xe1cea80ea574e645), UINT64_C(0x05b931aef13886a7),
+        UINT64_C(0x599446cec2fca6f9), UINT64_C(0xa588734247fb3a67), UINT64_C(0xf9a50422743f1a39),
+        UINT64_C(0x1dd29d8220737adb), UINT64_C(0x41ffeae213b75a85), UINT64_C(0x47e501e927e5a59a),
+        UINT64_C(0x1bc87689142185c4), UINT64_C(0xffbfef29406de526), UINT64_C(0xa392984973a9c578),
+        UINT64_C(0xf38a393f28c81b18), UINT64_C(0xafa74e5f1b0c3b46), UINT64_C(0x4bd0d7ff4f405ba4),
+        UINT64_C(0x17fda09f7c847bfa), UINT64_C(0x11e74b9448d684e5), UINT64_C(0x4dca3cf47b12a4bb),
+        UINT64_C(0xa9bda5542f5ec459), UINT64_C(0xf590d2341c9ae407), UINT64_C(0xc35d61668a5fe3e0),
+        UINT64_C(0x9f701606b99bc3be), UINT64_C(0x7b078fa6edd7a35c), UINT64_C(0x272af8c6de138302),
+        UINT64_C(0x213013cdea417c1d), UINT64_C(0x7d1d64add9855c43), UINT64_C(0x996afd0d8dc93ca1),
+        UINT64_C(0xc5478a6dbe0d1cff), UINT64_C(0x955f2b1be56cc29f), UINT64_C(0xc9725c7bd6a8e2c1),
+        UINT64_C(0x2d05c5db82e48223), UINT64_C(0x7128b2bbb120a27d), UINT64_C(0x773259b085725d62),
+        UINT64_C(0x2b1f2ed0b6b67d3c), UINT64_C(0xcf68b770e2fa1dde), UINT64_C(0x9345c010d13e3d80),
+        UINT64_C(0x6f59f59c5439a11e), UINT64_C(0x337482fc67fd8140), UINT64_C(0xd7031b5c33b1e1a2),
+        UINT64_C(0x8b2e6c3c0075c1fc), UINT64_C(0x8d34873734273ee3), UINT64_C(0xd119f05707e31ebd),
+        UINT64_C(0x356e69f753af7e5f), UINT64_C(0x69431e97606b5e01), UINT64_C(0x395bbfe13b0a8061),
+        UINT64_C(0x6576c88108cea03f), UINT64_C(0x810151215c82c0dd), UINT64_C(0xdd2c26416f46e083),
+        UINT64_C(0xdb36cd4a5b141f9c), UINT64_C(0x871bba2a68d03fc2), UINT64_C(0x636c238a3c9c5f20),
+        UINT64_C(0x3f4154ea0f587f7e)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0x6184d55f721267c6), UINT64_C(0xc309aabee424cf8c),
+        UINT64_C(0xa28d7fe19636a84a), UINT64_C(0x14cbfa566747819d), UINT64_C(0x754f2f091555e65b),
+        UINT64_C(0xd7c250e883634e11), UINT64_C(0xb64685b7f17129d7), UINT64_C(0x2997f4acce8f033a),
+        UINT64_C(0x481321f3bc9d64fc), UINT64_C(0xea9e5e122aabccb6), UINT64_C(0x8b1a8b4d58b9ab70),
+        UINT64_C(0x3d5c0efaa9c882a7), UINT64_C(0x5cd8dba5dbdae561), UINT64_C(0xfe55a4444dec4d2b),
+        UINT64_C(0x9fd1711b3ffe2aed), UINT64_C(0x532fe9599d1e0674), UINT64_C(0x32ab3c06ef0c61b2),
+        UINT64_C(0x902643e7793ac9f8), UINT64_C(0xf1a296b80b28ae3e), UINT64_C(0x47e4130ffa5987e9),
+        UINT64_C(0x2660c650884be02f), UINT64_C(0x84edb9b11e7d4865), UINT64_C(0xe5696cee6c6f2fa3),
+        UINT64_C(0x7ab81df55391054e), UINT64_C(0x1b3cc8aa21836288), UINT64_C(0xb9b1b74bb7b5cac2),
+        UINT64_C(0xd8356214c5a7ad04), UINT64_C(0x6e73e7a334d684d3), UINT64_C(0x0ff732fc46c4e315),
+        UINT64_C(0xad7a4d1dd0f24b5f), UINT64_C(0xccfe9842a2e02c99), UINT64_C(0xa65fd2b33a3c0ce8),
+        UINT64_C(0xc7db07ec482e6b2e), UINT64_C(0x6556780dde18c364), UINT64_C(0x04d2ad52ac0aa4a2),
+        UINT64_C(0xb29428e55d7b8d75), UINT64_C(0xd310fdba2f69eab3), UINT64_C(0x719d825bb95f42f9),
+        UINT64_C(0x10195704cb4d253f), UINT64_C(0x8fc8261ff4b30fd2), UINT64_C(0xee4cf34086a16814),
+        UINT64_C(0x4cc18ca11097c05e), UINT64_C(0x2d4559fe6285a798), UINT64_C(0x9b03dc4993f48e4f),
+        UINT64_C(0xfa870916e1e6e989), UINT64_C(0x580a76f777d041c3), UINT64_C(0x398ea3a805c22605),
+        UINT64_C(0xf5703beaa7220a9c), UINT64_C(0x94f4eeb5d5306d5a), UINT64_C(0x367991544306c510),
+        UINT64_C(0x57fd440b3114a2d6), UINT64_C(0xe1bbc1bcc0658b01), UINT64_C(0x803f14e3b277ecc7),
+        UINT64_C(0x22b26b022441448d), UINT64_C(0x4336be5d5653234b), UINT64_C(0xdce7cf4669ad09a6),
+        UINT64_C(0xbd631a191bbf6e60), UINT64_C(0x1fee65f88d89c62a), UINT64_C(0x7e6ab0a7ff9ba1ec),
+        UINT64_C(0xc82c35100eea883b), UINT64_C(0xa9a8e04f7cf8effd), UINT64_C(0x0b259faeeace47b7),
+        UINT64_C(0x6aa14af198dc2071), UINT64_C(0xde670a4ddb760755), UINT64_C(0xbfe3df12a9646093),
+        UINT64_C(0x1d6ea0f33f52c8d9), UINT64_C(0x7cea75ac4d40af1f), UINT64_C(0xcaacf01bbc3186c8),
+        UINT64_C(0xab282544ce23e10e), UINT64_C(0x09a55aa558154944), UINT64_C(0x68218ffa2a072e82),
+        UINT64_C(0xf7f0fee115f9046f), UINT64_C(0x96742bbe67eb63a9), UINT64_C(0x34f9545ff1ddcbe3),
+        UINT64_C(0x557d810083cfac25), UINT64_C(0xe33b04b772be85f2), UINT64_C(0x82bfd1e800ace234),
+        UINT64_C(0x2032ae09969a4a7e), UINT64_C(0x41b67b56e4882db8), UINT64_C(0x8d48e31446680121),
+        UINT64_C(0xeccc364b347a66e7), UINT64_C(0x4e4149aaa24ccead), UINT64_C(0x2fc59cf5d05ea96b),
+        UINT64_C(0x99831942212f80bc), UINT64_C(0xf807cc1d533de77a), UINT64_C(0x5a8ab3fcc50b4f30),
+        UINT64_C(0x3b0e66a3b71928f6), UINT64_C(0xa4df17b888e7021b), UINT64_C(0xc55bc2e7faf565dd),
+        UINT64_C(0x67d6bd066cc3cd97), UINT64_C(0x065268591ed1aa51), UINT64_C(0xb014edeeefa08386),
+        UINT64_C(0xd19038b19db2e440), UINT64_C(0x731d47500b844c0a), UINT64_C(0x1299920f79962bcc),
+        UINT64_C(0x7838d8fee14a0bbd), UINT64_C(0x19bc0da193586c7b), UINT64_C(0xbb317240056ec431),
+        UINT64_C(0xdab5a71f777ca3f7), UINT64_C(0x6cf322a8860d8a20), UINT64_C(0x0d77f7f7f41fede6),
+        UINT64_C(0xaffa8816622945ac), UINT64_C(0xce7e5d49103b226a), UINT64_C(0x51af2c522fc50887),
+        UINT64_C(0x302bf90d5dd76f41), UINT64_C(0x92a686eccbe1c70b), UINT64_C(0xf32253b3b9f3a0cd),
+        UINT64_C(0x4564d6044882891a), UINT64_C(0x24e0035b3a90eedc), UINT64_C(0x866d7cbaaca64696),
+        UINT64_C(0xe7e9a9e5deb42150), UINT64_C(0x2b1731a77c540dc9), UINT64_C(0x4a93e4f80e466a0f),
+        UINT64_C(0xe81e9b199870c245), UINT64_C(0x899a4e46ea62a583), UINT64_C(0x3fdccbf11b138c54),
+        UINT64_C(0x5e581eae6901eb92), UINT64_C(0xfcd5614fff3743d8), UINT64_C(0x9d51b4108d25241e),
+        UINT64_C(0x0280c50bb2db0ef3), UINT64_C(0x63041054c0c96935), UINT64_C(0xc1896fb556ffc17f),
+        UINT64_C(0xa00dbaea24eda6b9), UINT64_C(0x164b3f5dd59c8f6e), UINT64_C(0x77cfea02a78ee8a8),
+        UINT64_C(0xd54295e331b840e2), UINT64_C(0xb4c640bc43aa2724), UINT64_C(0x2e16bbb019e2102f),
+        UINT64_C(0x4f926eef6bf077e9), UINT64_C(0xed1f110efdc6dfa3), UINT64_C(0x8c9bc4518fd4b865),
+        UINT64_C(0x3add41e67ea591b2), UINT64_C(0x5b5994b90cb7f674), UINT64_C(0xf9d4eb589a815e3e),
+        UINT64_C(0x98503e07e89339f8), UINT64_C(0x07814f1cd76d1315), UINT64_C(0x66059a43a57f74d3),
+        UINT64_C(0xc488e5a23349dc99), UINT64_C(0xa50c30fd415bbb5f), UINT64_C(0x134ab54ab02a9288),
+        UINT64_C(0x72ce6015c238f54e), UINT64_C(0xd0431ff4540e5d04), UINT64_C(0xb1c7caab261c3ac2),
+        UINT64_C(0x7d3952e984fc165b), UINT64_C(0x1cbd87b6f6ee719d), UINT64_C(0xbe30f85760d8d9d7),
+        UINT64_C(0xdfb42d0812cabe11), UINT64_C(0x69f2a8bfe3bb97c6), UINT64_C(0x08767de091a9f000),
+        UINT64_C(0xaafb0201079f584a), UINT64_C(0xcb7fd75e758d3f8c), UINT64_C(0x54aea6454a731561),
+        UINT64_C(0x352a731a386172a7), UINT64_C(0x97a70cfbae57daed), UINT64_C(0xf623d9a4dc45bd2b),
+        UINT64_C(0x40655c132d3494fc), UINT64_C(0x21e1894c5f26f33a), UINT64_C(0x836cf6adc9105b70),
+        UINT64_C(0xe2e823f2bb023cb6), UINT64_C(0x8849690323de1cc7), UINT64_C(0xe9cdbc5c51cc7b01),
+        UINT64_C(0x4b40c3bdc7fad34b), UINT64_C(0x2ac416e2b5e8b48d), UINT64_C(0x9c82935544999d5a),
+        UINT64_C(0xfd06460a368bfa9c), UINT64_C(0x5f8b39eba0bd52d6), UINT64_C(0x3e0fecb4d2af3510),
+        UINT64_C(0xa1de9dafed511ffd), UINT64_C(0xc05a48f09f43783b), UINT64_C(0x62d737110975d071),
+        UINT64_C(0x0353e24e7b67b7b7), UINT64_C(0xb51567f98a169e60), UINT64_C(0xd491b2a6f804f9a6),
+        UINT64_C(0x761ccd476e3251ec), UINT64_C(0x179818181c20362a), UINT64_C(0xdb66805abec01ab3),
+        UINT64_C(0xbae25505ccd27d75), UINT64_C(0x186f2ae45ae4d53f), UINT64_C(0x79ebffbb28f6b2f9),
+        UINT64_C(0xcfad7a0cd9879b2e), UINT64_C(0xae29af53ab95fce8), UINT64_C(0x0ca4d0b23da354a2),
+        UINT64_C(0x6d2005ed4fb13364), UINT64_C(0xf2f174f6704f1989), UINT64_C(0x9375a1a9025d7e4f),
+        UINT64_C(0x31f8de48946bd605), UINT64_C(0x507c0b17e679b1c3), UINT64_C(0xe63a8ea017089814),
+        UINT64_C(0x87be5bff651affd2), UINT64_C(0x2533241ef32c5798), UINT64_C(0x44b7f141813e305e),
+        UINT64_C(0xf071b1fdc294177a), UINT64_C(0x91f564a2b08670bc), UINT64_C(0x33781b4326b0d8f6),
+        UINT64_C(0x52fcce1c54a2bf30), UINT64_C(0xe4ba4baba5d396e7), UINT64_C(0x853e9ef4d7c1f121),
+        UINT64_C(0x27b3e11541f7596b), UINT64_C(0x4637344a33e53ead), UINT64_C(0xd9e645510c1b1440),
+        UINT64_C(0xb862900e7e097386), UINT64_C(0x1aefefefe83fdbcc), UINT64_C(0x7b6b3ab09a2dbc0a),
+        UINT64_C(0xcd2dbf076b5c95dd), UINT64_C(0xaca96a58194ef21b), UINT64_C(0x0e2415b98f785a51),
+        UINT64_C(0x6fa0c0e6fd6a3d97), UINT64_C(0xa35e58a45f8a110e), UINT64_C(0xc2da8dfb2d9876c8),
+        UINT64_C(0x6057f21abbaede82), UINT64_C(0x01d32745c9bcb944), UINT64_C(0xb795a2f238cd9093),
+        UINT64_C(0xd61177ad4adff755), UINT64_C(0x749c084cdce95f1f), UINT64_C(0x1518dd13aefb38d9),
+        UINT64_C(0x8ac9ac0891051234), UINT64_C(0xeb4d7957e31775f2), UINT64_C(0x49c006b67521ddb8),
+        UINT64_C(0x2844d3e90733ba7e), UINT64_C(0x9e02565ef64293a9), UINT64_C(0xff8683018450f46f),
+        UINT64_C(0x5d0bfce012665c25), UINT64_C(0x3c8f29bf60743be3), UINT64_C(0x562e634ef8a81b92),
+        UINT64_C(0x37aab6118aba7c54), UINT64_C(0x9527c9f01c8cd41e), UINT64_C(0xf4a31caf6e9eb3d8),
+        UINT64_C(0x42e599189fef9a0f), UINT64_C(0x23614c47edfdfdc9), UINT64_C(0x81ec33a67bcb5583),
+        UINT64_C(0xe068e6f909d93245), UINT64_C(0x7fb997e2362718a8), UINT64_C(0x1e3d42bd44357f6e),
+        UINT64_C(0xbcb03d5cd203d724), UINT64_C(0xdd34e803a011b0e2), UINT64_C(0x6b726db451609935),
+        UINT64_C(0x0af6b8eb2372fef3), UINT64_C(0xa87bc70ab54456b9), UINT64_C(0xc9ff1255c756317f),
+        UINT64_C(0x05018a1765b61de6), UINT64_C(0x64855f4817a47a20), UINT64_C(0xc60820a98192d26a),
+        UINT64_C(0xa78cf5f6f380b5ac), UINT64_C(0x11ca704102f19c7b), UINT64_C(0x704ea51e70e3fbbd),
+        UINT64_C(0xd2c3daffe6d553f7), UINT64_C(0xb3470fa094c73431), UINT64_C(0x2c967ebbab391edc),
+        UINT64_C(0x4d12abe4d92b791a), UINT64_C(0xef9fd4054f1dd150), UINT64_C(0x8e1b015a3d0fb696),
+        UINT64_C(0x385d84edcc7e9f41), UINT64_C(0x59d951b2be6cf887), UINT64_C(0xfb542e53285a50cd),
+        UINT64_C(0x9ad0fb0c5a48370b)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0x22ef0d5934f964ec), UINT64_C(0x45de1ab269f2c9d8),
+        UINT64_C(0x673117eb5d0bad34), UINT64_C(0x8bbc3564d3e593b0), UINT64_C(0xa953383de71cf75c),
+        UINT64_C(0xce622fd6ba175a68), UINT64_C(0xec8d228f8eee3e84), UINT64_C(0x85a0c5e208c539e5),
+        UINT64_C(0xa74fc8bb3c3c5d09), UINT64_C(0xc07edf506137f03d), UINT64_C(0xe291d20955ce94d1),
+        UINT64_C(0x0e1cf086db20aa55), UINT64_C(0x2cf3fddfefd9ceb9), UINT64_C(0x4bc2ea34b2d2638d),
+        UINT64_C(0x692de76d862b0761), UINT64_C(0x999924efbe846d4f), UINT64_C(0xbb7629b68a7d09a3),
+        UINT64_C(0xdc473e5dd776a497), UINT64_C(0xfea83304e38fc07b), UINT64_C(0x1225118b6d61feff),
+        UINT64_C(0x30ca1cd259989a13), UINT64_C(0x57fb0b3904933727), UINT64_C(0x75140660306a53cb),
+        UINT64_C(0x1c39e10db64154aa), UINT64_C(0x3ed6ec5482b83046), UINT64_C(0x59e7fbbfdfb39d72),
+        UINT64_C(0x7b08f6e6eb4af99e), UINT64_C(0x9785d46965a4c71a), UINT64_C(0xb56ad930515da3f6),
+        UINT64_C(0xd25bcedb0c560ec2), UINT64_C(0xf0b4c38238af6a2e), UINT64_C(0xa1eae6f4d206c41b),
+        UINT64_C(0x8305ebade6ffa0f7), UINT64_C(0xe434fc46bbf40dc3), UINT64_C(0xc6dbf11f8f0d692f),
+        UINT64_C(0x2a56d39001e357ab), UINT64_C(0x08b9dec9351a3347), UINT64_C(0x6f88c92268119e73),
+        UINT64_C(0x4d67c47b5ce8fa9f), UINT64_C(0x244a2316dac3fdfe), UINT64_C(0x06a52e4fee3a9912),
+        UINT64_C(0x619439a4b3313426), UINT64_C(0x437b34fd87c850ca), UINT64_C(0xaff6167209266e4e),
+        UINT64_C(0x8d191b2b3ddf0aa2), UINT64_C(0xea280cc060d4a796), UINT64_C(0xc8c70199542dc37a),
+        UINT64_C(0x3873c21b6c82a954), UINT64_C(0x1a9ccf42587bcdb8), UINT64_C(0x7dadd8a90570608c),
+        UINT64_C(0x5f42d5f031890460), UINT64_C(0xb3cff77fbf673ae4), UINT64_C(0x9120fa268b9e5e08),
+        UINT64_C(0xf611edcdd695f33c), UINT64_C(0xd4fee094e26c97d0), UINT64_C(0xbdd307f9644790b1),
+        UINT64_C(0x9f3c0aa050bef45d), UINT64_C(0xf80d1d4b0db55969), UINT64_C(0xdae21012394c3d85),
+        UINT64_C(0x366f329db7a20301), UINT64_C(0x14803fc4835b67ed), UINT64_C(0x73b1282fde50cad9),
+        UINT64_C(0x515e2576eaa9ae35), UINT64_C(0xd10d62c20b0396b3), UINT64_C(0xf3e26f9b3ffaf25f),
+        UINT64_C(0x94d3787062f15f6b), UINT64_C(0xb63c752956083b87), UINT64_C(0x5ab157a6d8e60503),
+        UINT64_C(0x785e5affec1f61ef), UINT64_C(0x1f6f4d14b114ccdb), UINT64_C(0x3d80404d85eda837),
+        UINT64_C(0x54ada72003c6af56), UINT64_C(0x7642aa79373fcbba), UINT64_C(0x1173bd926a34668e),
+        UINT64_C(0x339cb0cb5ecd0262), UINT64_C(0xdf119244d0233ce6), UINT64_C(0xfdfe9f1de4da580a),
+        UINT64_C(0x9acf88f6b9d1f53e), UINT64_C(0xb82085af8d2891d2), UINT64_C(0x4894462db587fbfc),
+        UINT64_C(0x6a7b4b74817e9f10), UINT64_C(0x0d4a5c9fdc753224), UINT64_C(0x2fa551c6e88c56c8),
+        UINT64_C(0xc32873496662684c), UINT64_C(0xe1c77e10529b0ca0), UINT64_C(0x86f669fb0f90a194),
+        UINT64_C(0xa41964a23b69c578), UINT64_C(0xcd3483cfbd42c219), UINT64_C(0xefdb8e9689bba6f5),
+        UINT64_C(0x88ea997dd4b00bc1), UINT64_C(0xaa059424e0496f2d), UINT64_C(0x4688b6ab6ea751a9),
+        UINT64_C(0x6467bbf25a5e3545), UINT64_C(0x0356ac1907559871), UINT64_C(0x21b9a14033acfc9d),
+        UINT64_C(0x70e78436d90552a8), UINT64_C(0x5208896fedfc3644), UINT64_C(0x35399e84b0f79b70),
+        UINT64_C(0x17d693dd840eff9c), UINT64_C(0xfb5bb1520ae0c118), UINT64_C(0xd9b4bc0b3e19a5f4),
+        UINT64_C(0xbe85abe0631208c0), UINT64_C(0x9c6aa6b957eb6c2c), UINT64_C(0xf54741d4d1c06b4d),
+        UINT64_C(0xd7a84c8de5390fa1), UINT64_C(0xb0995b66b832a295), UINT64_C(0x9276563f8ccbc679),
+        UINT64_C(0x7efb74b00225f8fd), UINT64_C(0x5c1479e936dc9c11), UINT64_C(0x3b256e026bd73125),
+        UINT64_C(0x19ca635b5f2e55c9), UINT64_C(0xe97ea0d967813fe7), UINT64_C(0xcb91ad8053785b0b),
+        UINT64_C(0xaca0ba6b0e73f63f), UINT64_C(0x8e4fb7323a8a92d3), UINT64_C(0x62c295bdb464ac57),
+        UINT64_C(0x402d98e4809dc8bb), UINT64_C(0x271c8f0fdd96658f), UINT64_C(0x05f38256e96f0163),
+        UINT64_C(0x6cde653b6f440602), UINT64_C(0x4e3168625bbd62ee), UINT64_C(0x29007f8906b6cfda),
+        UINT64_C(0x0bef72d0324fab36), UINT64_C(0xe762505fbca195b2), UINT64_C(0xc58d5d068858f15e),
+        UINT64_C(0xa2bc4aedd5535c6a), UINT64_C(0x805347b4e1aa3886), UINT64_C(0x30c26aafb90933e3),
+        UINT64_C(0x122d67f68df0570f), UINT64_C(0x751c701dd0fbfa3b), UINT64_C(0x57f37d44e4029ed7),
+        UINT64_C(0xbb7e5fcb6aeca053), UINT64_C(0x999152925e15c4bf), UINT64_C(0xfea04579031e698b),
+        UINT64_C(0xdc4f482037e70d67), UINT64_C(0xb562af4db1cc0a06), UINT64_C(0x978da21485356eea),
+        UINT64_C(0xf0bcb5ffd83ec3de), UINT64_C(0xd253b8a6ecc7a732), UINT64_C(0x3ede9a29622999b6),
+        UINT64_C(0x1c31977056d0fd5a), UINT64_C(0x7b00809b0bdb506e), UINT64_C(0x59ef8dc23f223482),
+        UINT64_C(0xa95b4e40078d5eac), UINT64_C(0x8bb4431933743a40), UINT64_C(0xec8554f26e7f9774),
+        UINT64_C(0xce6a59ab5a86f398), UINT64_C(0x22e77b24d468cd1c), UINT64_C(0x0008767de091a9f0),
+        UINT64_C(0x67396196bd9a04c4), UINT64_C(0x45d66ccf89636028), UINT64_C(0x2cfb8ba20f486749),
+        UINT64_C(0x0e1486fb3bb103a5), UINT64_C(0x6925911066baae91), UINT64_C(0x4bca9c495243ca7d),
+        UINT64_C(0xa747bec6dcadf4f9), UINT64_C(0x85a8b39fe8549015), UINT64_C(0xe299a474b55f3d21),
+        UINT64_C(0xc076a92d81a659cd), UINT64_C(0x91288c5b6b0ff7f8), UINT64_C(0xb3c781025ff69314),
+        UINT64_C(0xd4f696e902fd3e20), UINT64_C(0xf6199bb036045acc), UINT64_C(0x1a94b93fb8ea6448),
+        UINT64_C(0x387bb4668c1300a4), UINT64_C(0x5f4aa38dd118ad90), UINT64_C(0x7da5aed4e5e1c97c),
+        UINT64_C(0x148849b963cace1d), UINT64_C(0x366744e05733aaf1), UINT64_C(0x5156530b0a3807c5),
+        UINT64_C(0x73b95e523ec16329), UINT64_C(0x9f347cddb02f5dad), UINT64_C(0xbddb718484d63941),
+        UINT64_C(0xdaea666fd9dd9475), UINT64_C(0xf8056b36ed24f099), UINT64_C(0x08b1a8b4d58b9ab7),
+        UINT64_C(0x2a5ea5ede172fe5b), UINT64_C(0x4d6fb206bc79536f), UINT64_C(0x6f80bf5f88803783),
+        UINT64_C(0x830d9dd0066e0907), UINT64_C(0xa1e2908932976deb), UINT64_C(0xc6d387626f9cc0df),
+        UINT64_C(0xe43c8a3b5b65a433), UINT64_C(0x8d116d56dd4ea352), UINT64_C(0xaffe600fe9b7c7be),
+        UINT64_C(0xc8cf77e4b4bc6a8a), UINT64_C(0xea207abd80450e66), UINT64_C(0x06ad58320eab30e2),
+        UINT64_C(0x2442556b3a52540e), UINT64_C(0x437342806759f93a), UINT64_C(0x619c4fd953a09dd6),
+        UINT64_C(0xe1cf086db20aa550), UINT64_C(0xc320053486f3c1bc), UINT64_C(0xa41112dfdbf86c88),
+        UINT64_C(0x86fe1f86ef010864), UINT64_C(0x6a733d0961ef36e0), UINT64_C(0x489c30505516520c),
+        UINT64_C(0x2fad27bb081dff38), UINT64_C(0x0d422ae23ce49bd4), UINT64_C(0x646fcd8fbacf9cb5),
+        UINT64_C(0x4680c0d68e36f859), UINT64_C(0x21b1d73dd33d556d), UINT64_C(0x035eda64e7c43181),
+        UINT64_C(0xefd3f8eb692a0f05), UINT64_C(0xcd3cf5b25dd36be9), UINT64_C(0xaa0de25900d8c6dd),
+        UINT64_C(0x88e2ef003421a231), UINT64_C(0x78562c820c8ec81f), UINT64_C(0x5ab921db3877acf3),
+        UINT64_C(0x3d883630657c01c7), UINT64_C(0x1f673b695185652b), UINT64_C(0xf3ea19e6df6b5baf),
+        UINT64_C(0xd10514bfeb923f43), UINT64_C(0xb6340354b6999277), UINT64_C(0x94db0e0d8260f69b),
+        UINT64_C(0xfdf6e960044bf1fa), UINT64_C(0xdf19e43930b29516), UINT64_C(0xb828f3d26db93822),
+        UINT64_C(0x9ac7fe8b59405cce), UINT64_C(0x764adc04d7ae624a), UINT64_C(0x54a5d15de35706a6),
+        UINT64_C(0x3394c6b6be5cab92), UINT64_C(0x117bcbef8aa5cf7e), UINT64_C(0x4025ee99600c614b),
+        UINT64_C(0x62cae3c054f505a7), UINT64_C(0x05fbf42b09fea893), UINT64_C(0x2714f9723d07cc7f),
+        UINT64_C(0xcb99dbfdb3e9f2fb), UINT64_C(0xe976d6a487109617), UINT64_C(0x8e47c14fda1b3b23),
+        UINT64_C(0xaca8cc16eee25fcf), UINT64_C(0xc5852b7b68c958ae), UINT64_C(0xe76a26225c303c42),
+        UINT64_C(0x805b31c9013b9176), UINT64_C(0xa2b43c9035c2f59a), UINT64_C(0x4e391e1fbb2ccb1e),
+        UINT64_C(0x6cd613468fd5aff2), UINT64_C(0x0be704add2de02c6), UINT64_C(0x290809f4e627662a),
+        UINT64_C(0xd9bcca76de880c04), UINT64_C(0xfb53c72fea7168e8), UINT64_C(0x9c62d0c4b77ac5dc),
+        UINT64_C(0xbe8ddd9d8383a130), UINT64_C(0x5200ff120d6d9fb4), UINT64_C(0x70eff24b3994fb58),
+        UINT64_C(0x17dee5a0649f566c), UINT64_C(0x3531e8f950663280), UINT64_C(0x5c1c0f94d64d35e1),
+        UINT64_C(0x7ef302cde2b4510d), UINT64_C(0x19c21526bfbffc39), UINT64_C(0x3b2d187f8b4698d5),
+        UINT64_C(0xd7a03af005a8a651), UINT64_C(0xf54f37a93151c2bd), UINT64_C(0x927e20426c5a6f89),
+        UINT64_C(0xb0912d1b58a30b65)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0xdabe95afc7875f40), UINT64_C(0x27a584742000a005),
+        UINT64_C(0xfd1b11dbe787ff45), UINT64_C(0x4f4b08e84001400a), UINT64_C(0x95f59d4787861f4a),
+        UINT64_C(0x68ee8c9c6001e00f), UINT64_C(0xb2501933a786bf4f), UINT64_C(0x9e9611d080028014),
+        UINT64_C(0x4428847f4785df54), UINT64_C(0xb93395a4a0022011), UINT64_C(0x638d000b67857f51),
+        UINT64_C(0xd1dd1938c003c01e), UINT64_C(0x0b638c9707849f5e), UINT64_C(0xf6789d4ce003601b),
+        UINT64_C(0x2cc608e327843f5b), UINT64_C(0xaff48c8aaf0b1ead), UINT64_C(0x754a1925688c41ed),
+        UINT64_C(0x885108fe8f0bbea8), UINT64_C(0x52ef9d51488ce1e8), UINT64_C(0xe0bf8462ef0a5ea7),
+        UINT64_C(0x3a0111cd288d01e7), UINT64_C(0xc71a0016cf0afea2), UINT64_C(0x1da495b9088da1e2),
+        UINT64_C(0x31629d5a2f099eb9), UINT64_C(0xebdc08f5e88ec1f9), UINT64_C(0x16c7192e0f093ebc),
+        UINT64_C(0xcc798c81c88e61fc), UINT64_C(0x7e2995b26f08deb3), UINT64_C(0xa497001da88f81f3),
+        UINT64_C(0x598c11c64f087eb6), UINT64_C(0x83328469888f21f6), UINT64_C(0xcd31b63ef11823df),
+        UINT64_C(0x178f2391369f7c9f), UINT64_C(0xea94324ad11883da), UINT64_C(0x302aa7e5169fdc9a),
+        UINT64_C(0x827abed6b11963d5), UINT64_C(0x58c42b79769e3c95), UINT64_C(0xa5df3aa29119c3d0),
+        UINT64_C(0x7f61af0d569e9c90), UINT64_C(0x53a7a7ee711aa3cb), UINT64_C(0x89193241b69dfc8b),
+        UINT64_C(0x7402239a511a03ce), UINT64_C(0xaebcb635969d5c8e), UINT64_C(0x1cecaf06311be3c1),
+        UINT64_C(0xc6523aa9f69cbc81), UINT64_C(0x3b492b72111b43c4), UINT64_C(0xe1f7beddd69c1c84),
+        UINT64_C(0x62c53ab45e133d72), UINT64_C(0xb87baf1b99946232), UINT64_C(0x4560bec07e139d77),
+        UINT64_C(0x9fde2b6fb994c237), UINT64_C(0x2d8e325c1e127d78), UINT64_C(0xf730a7f3d9952238),
+        UINT64_C(0x0a2bb6283e12dd7d), UINT64_C(0xd0952387f995823d), UINT64_C(0xfc532b64de11bd66),
+        UINT64_C(0x26edbecb1996e226), UINT64_C(0xdbf6af10fe111d63), UINT64_C(0x01483abf39964223),
+        UINT64_C(0xb318238c9e10fd6c), UINT64_C(0x69a6b6235997a22c), UINT64_C(0x94bda7f8be105d69),
+        UINT64_C(0x4e03325779970229), UINT64_C(0x08bbc3564d3e593b), UINT64_C(0xd20556f98ab9067b),
+        UINT64_C(0x2f1e47226d3ef93e), UINT64_C(0xf5a0d28daab9a67e), UINT64_C(0x47f0cbbe0d3f1931),
+        UINT64_C(0x9d4e5e11cab84671), UINT64_C(0x60554fca2d3fb934), UINT64_C(0xbaebda65eab8e674),
+        UINT64_C(0x962dd286cd3cd92f), UINT64_C(0x4c9347290abb866f), UINT64_C(0xb18856f2ed3c792a),
+        UINT64_C(0x6b36c35d2abb266a), UINT64_C(0xd966da6e8d3d9925), UINT64_C(0x03d84fc14abac665),
+        UINT64_C(0xfec35e1aad3d3920), UINT64_C(0x247dcbb56aba6660), UINT64_C(0xa74f4fdce2354796),
+        UINT64_C(0x7df1da7325b218d6), UINT64_C(0x80eacba8c235e793), UINT64_C(0x5a545e0705b2b8d3),
+        UINT64_C(0xe8044734a234079c), UINT64_C(0x32bad29b65b358dc), UINT64_C(0xcfa1c3408234a799),
+        UINT64_C(0x151f56ef45b3f8d9), UINT64_C(0x39d95e0c6237c782), UINT64_C(0xe367cba3a5b098c2),
+        UINT64_C(0x1e7cda7842376787), UINT64_C(0xc4c24fd785b038c7), UINT64_C(0x769256e422368788),
+        UINT64_C(0xac2cc34be5b1d8c8), UINT64_C(0x5137d2900236278d), UINT64_C(0x8b89473fc5b178cd),
+        UINT64_C(0xc58a7568bc267ae4), UINT64_C(0x1f34e0c77ba125a4), UINT64_C(0xe22ff11c9c26dae1),
+        UINT64_C(0x389164b35ba185a1), UINT64_C(0x8ac17d80fc273aee), UINT64_C(0x507fe82f3ba065ae),
+        UINT64_C(0xad64f9f4dc279aeb), UINT64_C(0x77da6c5b1ba0c5ab), UINT64_C(0x5b1c64b83c24faf0),
+        UINT64_C(0x81a2f117fba3a5b0), UINT64_C(0x7cb9e0cc1c245af5), UINT64_C(0xa6077563dba305b5),
+        UINT64_C(0x14576c507c25bafa), UINT64_C(0xcee9f9ffbba2e5ba), UINT64_C(0x33f2e8245c251aff),
+        UINT64_C(0xe94c7d8b9ba245bf), UINT64_C(0x6a7ef9e2132d6449), UINT64_C(0xb0c06c4dd4aa3b09),
+        UINT64_C(0x4ddb7d96332dc44c), UINT64_C(0x9765e839f4aa9b0c), UINT64_C(0x2535f10a532c2443),
+        UINT64_C(0xff8b64a594ab7b03), UINT64_C(0x0290757e732c8446), UINT64_C(0xd82ee0d1b4abdb06),
+        UINT64_C(0xf4e8e832932fe45d), UINT64_C(0x2e567d9d54a8bb1d), UINT64_C(0xd34d6c46b32f4458),
+        UINT64_C(0x09f3f9e974a81b18), UINT64_C(0xbba3e0dad32ea457), UINT64_C(0x611d757514a9fb17),
+        UINT64_C(0x9c0664aef32e0452), UINT64_C(0x46b8f10134a95b12), UINT64_C(0x117786ac9a7cb276),
+        UINT64_C(0xcbc913035dfbed36), UINT64_C(0x36d202d8ba7c1273), UINT64_C(0xec6c97777dfb4d33),
+        UINT64_C(0x5e3c8e44da7df27c), UINT64_C(0x84821beb1dfaad3c), UINT64_C(0x79990a30fa7d5279),
+        UINT64_C(0xa3279f9f3dfa0d39), UINT64_C(0x8fe1977c1a7e3262), UINT64_C(0x555f02d3ddf96d22),
+        UINT64_C(0xa84413083a7e9267), UINT64_C(0x72fa86a7fdf9cd27), UINT64_C(0xc0aa9f945a7f7268),
+        UINT64_C(0x1a140a3b9df82d28), UINT64_C(0xe70f1be07a7fd26d), UINT64_C(0x3db18e4fbdf88d2d),
+        UINT64_C(0xbe830a263577acdb), UINT64_C(0x643d9f89f2f0f39b), UINT64_C(0x99268e5215770cde),
+        UINT64_C(0x43981bfdd2f0539e), UINT64_C(0xf1c802ce7576ecd1), UINT64_C(0x2b769761b2f1b391),
+        UINT64_C(0xd66d86ba55764cd4), UINT64_C(0x0cd3131592f11394), UINT64_C(0x20151bf6b5752ccf),
+        UINT64_C(0xfaab8e5972f2738f), UINT64_C(0x07b09f8295758cca), UINT64_C(0xdd0e0a2d52f2d38a),
+        UINT64_C(0x6f5e131ef5746cc5), UINT64_C(0xb5e086b132f33385), UINT64_C(0x48fb976ad574ccc0),
+        UINT64_C(0x924502c512f39380), UINT64_C(0xdc4630926b6491a9), UINT64_C(0x06f8a53dace3cee9),
+        UINT64_C(0xfbe3b4e64b6431ac), UINT64_C(0x215d21498ce36eec), UINT64_C(0x930d387a2b65d1a3),
+        UINT64_C(0x49b3add5ece28ee3), UINT64_C(0xb4a8bc0e0b6571a6), UINT64_C(0x6e1629a1cce22ee6),
+        UINT64_C(0x42d02142eb6611bd), UINT64_C(0x986eb4ed2ce14efd), UINT64_C(0x6575a536cb66b1b8),
+        UINT64_C(0xbfcb30990ce1eef8), UINT64_C(0x0d9b29aaab6751b7), UINT64_C(0xd725bc056ce00ef7),
+        UINT64_C(0x2a3eadde8b67f1b2), UINT64_C(0xf08038714ce0aef2), UINT64_C(0x73b2bc18c46f8f04),
+        UINT64_C(0xa90c29b703e8d044), UINT64_C(0x5417386ce46f2f01), UINT64_C(0x8ea9adc323e87041),
+        UINT64_C(0x3cf9b4f0846ecf0e), UINT64_C(0xe647215f43e9904e), UINT64_C(0x1b5c3084a46e6f0b),
+        UINT64_C(0xc1e2a52b63e9304b), UINT64_C(0xed24adc8446d0f10), UINT64_C(0x379a386783ea5050),
+        UINT64_C(0xca8129bc646daf15), UINT64_C(0x103fbc13a3eaf055), UINT64_C(0xa26fa520046c4f1a),
+        UINT64_C(0x78d1308fc3eb105a), UINT64_C(0x85ca2154246cef1f), UINT64_C(0x5f74b4fbe3ebb05f),
+        UINT64_C(0x19cc45fad742eb4d), UINT64_C(0xc372d05510c5b40d), UINT64_C(0x3e69c18ef7424b48),
+        UINT64_C(0xe4d7542130c51408), UINT64_C(0x56874d129743ab47), UINT64_C(0x8c39d8bd50c4f407),
+        UINT64_C(0x7122c966b7430b42), UINT64_C(0xab9c5cc970c45402), UINT64_C(0x875a542a57406b59),
+        UINT64_C(0x5de4c18590c73419), UINT64_C(0xa0ffd05e7740cb5c), UINT64_C(0x7a4145f1b0c7941c),
+        UINT64_C(0xc8115cc217412b53), UINT64_C(0x12afc96dd0c67413), UINT64_C(0xefb4d8b637418b56),
+        UINT64_C(0x350a4d19f0c6d416), UINT64_C(0xb638c9707849f5e0), UINT64_C(0x6c865cdfbfceaaa0),
+        UINT64_C(0x919d4d04584955e5), UINT64_C(0x4b23d8ab9fce0aa5), UINT64_C(0xf973c1983848b5ea),
+        UINT64_C(0x23cd5437ffcfeaaa), UINT64_C(0xded645ec184815ef), UINT64_C(0x0468d043dfcf4aaf),
+        UINT64_C(0x28aed8a0f84b75f4), UINT64_C(0xf2104d0f3fcc2ab4), UINT64_C(0x0f0b5cd4d84bd5f1),
+        UINT64_C(0xd5b5c97b1fcc8ab1), UINT64_C(0x67e5d048b84a35fe), UINT64_C(0xbd5b45e77fcd6abe),
+        UINT64_C(0x4040543c984a95fb), UINT64_C(0x9afec1935fcdcabb), UINT64_C(0xd4fdf3c4265ac892),
+        UINT64_C(0x0e43666be1dd97d2), UINT64_C(0xf35877b0065a6897), UINT64_C(0x29e6e21fc1dd37d7),
+        UINT64_C(0x9bb6fb2c665b8898), UINT64_C(0x41086e83a1dcd7d8), UINT64_C(0xbc137f58465b289d),
+        UINT64_C(0x66adeaf781dc77dd), UINT64_C(0x4a6be214a6584886), UINT64_C(0x90d577bb61df17c6),
+        UINT64_C(0x6dce66608658e883), UINT64_C(0xb770f3cf41dfb7c3), UINT64_C(0x0520eafce659088c),
+        UINT64_C(0xdf9e7f5321de57cc), UINT64_C(0x22856e88c659a889), UINT64_C(0xf83bfb2701def7c9),
+        UINT64_C(0x7b097f4e8951d63f), UINT64_C(0xa1b7eae14ed6897f), UINT64_C(0x5cacfb3aa951763a),
+        UINT64_C(0x86126e956ed6297a), UINT64_C(0x344277a6c9509635), UINT64_C(0xeefce2090ed7c975),
+        UINT64_C(0x13e7f3d2e9503630), UINT64_C(0xc959667d2ed76970), UINT64_C(0xe59f6e9e0953562b),
+        UINT64_C(0x3f21fb31ced4096b), UINT64_C(0xc23aeaea2953f62e), UINT64_C(0x18847f45eed4a96e),
+        UINT64_C(0xaad4667649521621), UINT64_C(0x706af3d98ed54961), UINT64_C(0x8d71e2026952b624),
+        UINT64_C(0x57cf77adaed5e964)
+    }
+};
+
+static const uint64_t crc64_big_table[8][256] = {
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0x6f5fa703be4c2eb3), UINT64_C(0x5ba040a8573684f4),
+        UINT64_C(0x34ffe7abe97aaa47), UINT64_C(0x335e8fff84c3d07b), UINT64_C(0x5c0128fc3a8ffec8),
+        UINT64_C(0x68fecf57d3f5548f), UINT64_C(0x07a168546db97a3c), UINT64_C(0x66bc1eff0987a1f7),
+        UINT64_C(0x09e3b9fcb7cb8f44), UINT64_C(0x3d1c5e575eb12503), UINT64_C(0x5243f954e0fd0bb0),
+        UINT64_C(0x55e291008d44718c), UINT64_C(0x3abd360333085f3f), UINT64_C(0x0e42d1a8da72f578),
+        UINT64_C(0x611d76ab643edbcb), UINT64_C(0x4966335138a19b7d), UINT64_C(0x2639945286edb5ce),
+        UINT64_C(0x12c673f96f971f89), UINT64_C(0x7d99d4fad1db313a), UINT64_C(0x7a38bcaebc624b06),
+        UINT64_C(0x15671bad022e65b5), UINT64_C(0x2198fc06eb54cff2), UINT64_C(0x4ec75b055518e141),
+        UINT64_C(0x2fda2dae31263a8a), UINT64_C(0x40858aad8f6a1439), UINT64_C(0x747a6d066610be7e),
+        UINT64_C(0x1b25ca05d85c90cd), UINT64_C(0x1c84a251b5e5eaf1), UINT64_C(0x73db05520ba9c442),
+        UINT64_C(0x4724e2f9e2d36e05), UINT64_C(0x287b45fa5c9f40b6), UINT64_C(0x92cc66a2704237fb),
+        UINT64_C(0xfd93c1a1ce0e1948), UINT64_C(0xc96c260a2774b30f), UINT64_C(0xa633810999389dbc),
+        UINT64_C(0xa192e95df481e780), UINT64_C(0xcecd4e5e4acdc933), UINT64_C(0xfa32a9f5a3b76374),
+        UINT64_C(0x956d0ef61dfb4dc7), UINT64_C(0xf470785d79c5960c), UINT64_C(0x9b2fdf5ec789b8bf),
+        UINT64_C(0xafd038f52ef312f8), UINT64_C(0xc08f9ff690bf3c4b), UINT64_C(0xc72ef7a2fd064677),
+        UINT64_C(0xa87150a1434a68c4), UINT64_C(0x9c8eb70aaa30c283), UINT64_C(0xf3d11009147cec30),
+        UINT64_C(0xdbaa55f348e3ac86), UINT64_C(0xb4f5f2f0f6af8235), UINT64_C(0x800a155b1fd52872),
+        UINT64_C(0xef55b258a19906c1), UINT64_C(0xe8f4da0ccc207cfd), UINT64_C(0x87ab7d0f726c524e),
+        UINT64_C(0xb3549aa49b16f809), UINT64_C(0xdc0b3da7255ad6ba), UINT64_C(0xbd164b0c41640d71),
+        UINT64_C(0xd249ec0fff2823c2), UINT64_C(0xe6b60ba416528985), UINT64_C(0x89e9aca7a81ea736),
+        UINT64_C(0x8e48c4f3c5a7dd0a), UINT64_C(0xe11763f07bebf3b9), UINT64_C(0xd5e8845b929159fe),
+        UINT64_C(0xbab723582cdd774d), UINT64_C(0xa187c3ebca2bb664), UINT64_C(0xced864e8746798d7),
+        UINT64_C(0xfa2783439d1d3290), UINT64_C(0x9578244023511c23), UINT64_C(0x92d94c144ee8661f),
+        UINT64_C(0xfd86eb17f0a448ac), UINT64_C(0xc9790cbc19dee2eb), UINT64_C(0xa626abbfa792cc58),
+        UINT64_C(0xc73bdd14c3ac1793), UINT64_C(0xa8647a177de03920), UINT64_C(0x9c9b9dbc949a9367),
+        UINT64_C(0xf3c43abf2ad6bdd4), UINT64_C(0xf46552eb476fc7e8), UINT64_C(0x9b3af5e8f923e95b),
+        UINT64_C(0xafc512431059431c), UINT64_C(0xc09ab540ae156daf), UINT64_C(0xe8e1f0baf28a2d19),
+        UINT64_C(0x87be57b94cc603aa), UINT64_C(0xb341b012a5bca9ed), UINT64_C(0xdc1e17111bf0875e),
+        UINT64_C(0xdbbf7f457649fd62), UINT64_C(0xb4e0d846c805d3d1), UINT64_C(0x801f3fed217f7996),
+        UINT64_C(0xef4098ee9f335725), UINT64_C(0x8e5dee45fb0d8cee), UINT64_C(0xe10249464541a25d),
+        UINT64_C(0xd5fdaeedac3b081a), UINT64_C(0xbaa209ee127726a9), UINT64_C(0xbd0361ba7fce5c95),
+        UINT64_C(0xd25cc6b9c1827226), UINT64_C(0xe6a3211228f8d861), UINT64_C(0x89fc861196b4f6d2),
+        UINT64_C(0x334ba549ba69819f), UINT64_C(0x5c14024a0425af2c), UINT64_C(0x68ebe5e1ed5f056b),
+        UINT64_C(0x07b442e253132bd8), UINT64_C(0x00152ab63eaa51e4), UINT64_C(0x6f4a8db580e67f57),
+        UINT64_C(0x5bb56a1e699cd510), UINT64_C(0x34eacd1dd7d0fba3), UINT64_C(0x55f7bbb6b3ee2068),
+        UINT64_C(0x3aa81cb50da20edb), UINT64_C(0x0e57fb1ee4d8a49c), UINT64_C(0x61085c1d5a948a2f),
+        UINT64_C(0x66a93449372df013), UINT64_C(0x09f6934a8961dea0), UINT64_C(0x3d0974e1601b74e7),
+        UINT64_C(0x5256d3e2de575a54), UINT64_C(0x7a2d961882c81ae2), UINT64_C(0x1572311b3c843451),
+        UINT64_C(0x218dd6b0d5fe9e16), UINT64_C(0x4ed271b36bb2b0a5), UINT64_C(0x497319e7060bca99),
+        UINT64_C(0x262cbee4b847e42a), UINT64_C(0x12d3594f513d4e6d), UINT64_C(0x7d8cfe4cef7160de),
+        UINT64_C(0x1c9188e78b4fbb15), UINT64_C(0x73ce2fe4350395a6), UINT64_C(0x4731c84fdc793fe1),
+        UINT64_C(0x286e6f4c62351152), UINT64_C(0x2fcf07180f8c6b6e), UINT64_C(0x4090a01bb1c045dd),
+        UINT64_C(0x746f47b058baef9a), UINT64_C(0x1b30e0b3e6f6c129), UINT64_C(0x420f87d795576cc9),
+        UINT64_C(0x2d5020d42b1b427a), UINT64_C(0x19afc77fc261e83d), UINT64_C(0x76f0607c7c2dc68e),
+        UINT64_C(0x715108281194bcb2), UINT64_C(0x1e0eaf2bafd89201), UINT64_C(0x2af1488046a23846),
+        UINT64_C(0x45aeef83f8ee16f5), UINT64_C(0x24b399289cd0cd3e), UINT64_C(0x4bec3e2b229ce38d),
+        UINT64_C(0x7f13d980cbe649ca), UINT64_C(0x104c7e8375aa6779), UINT64_C(0x17ed16d718131d45),
+        UINT64_C(0x78b2b1d4a65f33f6), UINT64_C(0x4c4d567f4f2599b1), UINT64_C(0x2312f17cf169b702),
+        UINT64_C(0x0b69b486adf6f7b4), UINT64_C(0x6436138513bad907), UINT64_C(0x50c9f42efac07340),
+        UINT64_C(0x3f96532d448c5df3), UINT64_C(0x38373b79293527cf), UINT64_C(0x57689c7a9779097c),
+        UINT64_C(0x63977bd17e03a33b), UINT64_C(0x0cc8dcd2c04f8d88), UINT64_C(0x6dd5aa79a4715643),
+        UINT64_C(0x028a0d7a1a3d78f0), UINT64_C(0x3675ead1f347d2b7), UINT64_C(0x592a4dd24d0bfc04),
+        UINT64_C(0x5e8b258620b28638), UINT64_C(0x31d482859efea88b), UINT64_C(0x052b652e778402cc),
+        UINT64_C(0x6a74c22dc9c82c7f), UINT64_C(0xd0c3e175e5155b32), UINT64_C(0xbf9c46765b597581),
+        UINT64_C(0x8b63a1ddb223dfc6), UINT64_C(0xe43c06de0c6ff175), UINT64_C(0xe39d6e8a61d68b49),
+        UINT64_C(0x8cc2c989df9aa5fa), UINT64_C(0xb83d2e2236e00fbd), UINT64_C(0xd762892188ac210e),
+        UINT64_C(0xb67fff8aec92fac5), UINT64_C(0xd920588952ded476), UINT64_C(0xeddfbf22bba47e31),
+        UINT64_C(0x8280182105e85082), UINT64_C(0x8521707568512abe), UINT64_C(0xea7ed776d61d040d),
+        UINT64_C(0xde8130dd3f67ae4a), UINT64_C(0xb1de97de812b80f9), UINT64_C(0x99a5d224ddb4c04f),
+        UINT64_C(0xf6fa752763f8eefc), UINT64_C(0xc205928c8a8244bb), UINT64_C(0xad5a358f34ce6a08),
+        UINT64_C(0xaafb5ddb59771034), UINT64_C(0xc5a4fad8e73b3e87), UINT64_C(0xf15b1d730e4194c0),
+        UINT64_C(0x9e04ba70b00dba73), UINT64_C(0xff19ccdbd43361b8), UINT64_C(0x90466bd86a7f4f0b),
+        UINT64_C(0xa4b98c738305e54c), UINT64_C(0xcbe62b703d49cbff), UINT64_C(0xcc47432450f0b1c3),
+        UINT64_C(0xa318e427eebc9f70), UINT64_C(0x97e7038c07c63537), UINT64_C(0xf8b8a48fb98a1b84),
+        UINT64_C(0xe388443c5f7cdaad), UINT64_C(0x8cd7e33fe130f41e), UINT64_C(0xb8280494084a5e59),
+        UINT64_C(0xd777a397b60670ea), UINT64_C(0xd0d6cbc3dbbf0ad6), UINT64_C(0xbf896cc065f32465),
+        UINT64_C(0x8b768b6b8c898e22), UINT64_C(0xe4292c6832c5a091), UINT64_C(0x85345ac356fb7b5a),
+        UINT64_C(0xea6bfdc0e8b755e9), UINT64_C(0xde941a6b01cdffae), UINT64_C(0xb1cbbd68bf81d11d),
+        UINT64_C(0xb66ad53cd238ab21), UINT64_C(0xd935723f6c748592), UINT64_C(0xedca9594850e2fd5),
+        UINT64_C(0x829532973b420166), UINT64_C(0xaaee776d67dd41d0), UINT64_C(0xc5b1d06ed9916f63),
+        UINT64_C(0xf14e37c530ebc524), UINT64_C(0x9e1190c68ea7eb97), UINT64_C(0x99b0f892e31e91ab),
+        UINT64_C(0xf6ef5f915d52bf18), UINT64_C(0xc210b83ab428155f), UINT64_C(0xad4f1f390a643bec),
+        UINT64_C(0xcc5269926e5ae027), UINT64_C(0xa30dce91d016ce94), UINT64_C(0x97f2293a396c64d3),
+        UINT64_C(0xf8ad8e3987204a60), UINT64_C(0xff0ce66dea99305c), UINT64_C(0x9053416e54d51eef),
+        UINT64_C(0xa4aca6c5bdafb4a8), UINT64_C(0xcbf301c603e39a1b), UINT64_C(0x7144229e2f3eed56),
+        UINT64_C(0x1e1b859d9172c3e5), UINT64_C(0x2ae46236780869a2), UINT64_C(0x45bbc535c6444711),
+        UINT64_C(0x421aad61abfd3d2d), UINT64_C(0x2d450a6215b1139e), UINT64_C(0x19baedc9fccbb9d9),
+        UINT64_C(0x76e54aca4287976a), UINT64_C(0x17f83c6126b94ca1), UINT64_C(0x78a79b6298f56212),
+        UINT64_C(0x4c587cc9718fc855), UINT64_C(0x2307dbcacfc3e6e6), UINT64_C(0x24a6b39ea27a9cda),
+        UINT64_C(0x4bf9149d1c36b269), UINT64_C(0x7f06f336f54c182e), UINT64_C(0x105954354b00369d),
+        UINT64_C(0x382211cf179f762b), UINT64_C(0x577db6cca9d35898), UINT64_C(0x6382516740a9f2df),
+        UINT64_C(0x0cddf664fee5dc6c), UINT64_C(0x0b7c9e30935ca650), UINT64_C(0x642339332d1088e3),
+        UINT64_C(0x50dcde98c46a22a4), UINT64_C(0x3f83799b7a260c17), UINT64_C(0x5e9e0f301e18d7dc),
+        UINT64_C(0x31c1a833a054f96f), UINT64_C(0x053e4f98492e5328), UINT64_C(0x6a61e89bf7627d9b),
+        UINT64_C(0x6dc080cf9adb07a7), UINT64_C(0x029f27cc24972914), UINT64_C(0x3660c067cded8353),
+        UINT64_C(0x593f676473a1ade0)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0x0df1d05c9279e954), UINT64_C(0x1ae2a1b924f3d2a9),
+        UINT64_C(0x171371e5b68a3bfd), UINT64_C(0xb1da4ddc62497dc1), UINT64_C(0xbc2b9d80f0309495),
+        UINT64_C(0xab38ec6546baaf68), UINT64_C(0xa6c93c39d4c3463c), UINT64_C(0xe7ab9517ee3d2210),
+        UINT64_C(0xea5a454b7c44cb44), UINT64_C(0xfd4934aecacef0b9), UINT64_C(0xf0b8e4f258b719ed),
+        UINT64_C(0x5671d8cb8c745fd1), UINT64_C(0x5b8008971e0db685), UINT64_C(0x4c937972a8878d78),
+        UINT64_C(0x4162a92e3afe642c), UINT64_C(0xce572b2fdc7b4420), UINT64_C(0xc3a6fb734e02ad74),
+        UINT64_C(0xd4b58a96f8889689), UINT64_C(0xd9445aca6af17fdd), UINT64_C(0x7f8d66f3be3239e1),
+        UINT64_C(0x727cb6af2c4bd0b5), UINT64_C(0x656fc74a9ac1eb48), UINT64_C(0x689e171608b8021c),
+        UINT64_C(0x29fcbe3832466630), UINT64_C(0x240d6e64a03f8f64), UINT64_C(0x331e1f8116b5b499),
+        UINT64_C(0x3eefcfdd84cc5dcd), UINT64_C(0x9826f3e4500f1bf1), UINT64_C(0x95d723b8c276f2a5),
+        UINT64_C(0x82c4525d74fcc958), UINT64_C(0x8f358201e685200c), UINT64_C(0x9caf565eb8f78840),
+        UINT64_C(0x915e86022a8e6114), UINT64_C(0x864df7e79c045ae9), UINT64_C(0x8bbc27bb0e7db3bd),
+        UINT64_C(0x2d751b82dabef581), UINT64_C(0x2084cbde48c71cd5), UINT64_C(0x3797ba3bfe4d2728),
+        UINT64_C(0x3a666a676c34ce7c), UINT64_C(0x7b04c34956caaa50), UINT64_C(0x76f51315c4b34304),
+        UINT64_C(0x61e662f0723978f9), UINT64_C(0x6c17b2ace04091ad), UINT64_C(0xcade8e953483d791),
+        UINT64_C(0xc72f5ec9a6fa3ec5), UINT64_C(0xd03c2f2c10700538), UINT64_C(0xddcdff708209ec6c),
+        UINT64_C(0x52f87d71648ccc60), UINT64_C(0x5f09ad2df6f52534), UINT64_C(0x481adcc8407f1ec9),
+        UINT64_C(0x45eb0c94d206f79d), UINT64_C(0xe32230ad06c5b1a1), UINT64_C(0xeed3e0f194bc58f5),
+        UINT64_C(0xf9c0911422366308), UINT64_C(0xf4314148b04f8a5c), UINT64_C(0xb553e8668ab1ee70),
+        UINT64_C(0xb8a2383a18c80724), UINT64_C(0xafb149dfae423cd9), UINT64_C(0xa24099833c3bd58d),
+        UINT64_C(0x0489a5bae8f893b1), UINT64_C(0x097875e67a817ae5), UINT64_C(0x1e6b0403cc0b4118),
+        UINT64_C(0x139ad45f5e72a84c), UINT64_C(0x385fadbc70ef1181), UINT64_C(0x35ae7de0e296f8d5),
+        UINT64_C(0x22bd0c05541cc328), UINT64_C(0x2f4cdc59c6652a7c), UINT64_C(0x8985e06012a66c40),
+        UINT64_C(0x8474303c80df8514), UINT64_C(0x936741d93655bee9), UINT64_C(0x9e969185a42c57bd),
+        UINT64_C(0xdff438ab9ed23391), UINT64_C(0xd205e8f70cabdac5), UINT64_C(0xc5169912ba21e138),
+        UINT64_C(0xc8e7494e2858086c), UINT64_C(0x6e2e7577fc9b4e50), UINT64_C(0x63dfa52b6ee2a704),
+        UINT64_C(0x74ccd4ced8689cf9), UINT64_C(0x793d04924a1175ad), UINT64_C(0xf6088693ac9455a1),
+        UINT64_C(0xfbf956cf3eedbcf5), UINT64_C(0xecea272a88678708), UINT64_C(0xe11bf7761a1e6e5c),
+        UINT64_C(0x47d2cb4fcedd2860), UINT64_C(0x4a231b135ca4c134), UINT64_C(0x5d306af6ea2efac9),
+        UINT64_C(0x50c1baaa7857139d), UINT64_C(0x11a3138442a977b1), UINT64_C(0x1c52c3d8d0d09ee5),
+        UINT64_C(0x0b41b23d665aa518), UINT64_C(0x06b06261f4234c4c), UINT64_C(0xa0795e5820e00a70),
+        UINT64_C(0xad888e04b299e324), UINT64_C(0xba9bffe10413d8d9), UINT64_C(0xb76a2fbd966a318d),
+        UINT64_C(0xa4f0fbe2c81899c1), UINT64_C(0xa9012bbe5a617095), UINT64_C(0xbe125a5beceb4b68),
+        UINT64_C(0xb3e38a077e92a23c), UINT64_C(0x152ab63eaa51e400), UINT64_C(0x18db666238280d54),
+        UINT64_C(0x0fc817878ea236a9), UINT64_C(0x0239c7db1cdbdffd), UINT64_C(0x435b6ef52625bbd1),
+        UINT64_C(0x4eaabea9b45c5285), UINT64_C(0x59b9cf4c02d66978), UINT64_C(0x54481f1090af802c),
+        UINT64_C(0xf2812329446cc610), UINT64_C(0xff70f375d6152f44), UINT64_C(0xe8638290609f14b9),
+        UINT64_C(0xe59252ccf2e6fded), UINT64_C(0x6aa7d0cd1463dde1), UINT64_C(0x67560091861a34b5),
+        UINT64_C(0x7045717430900f48), UINT64_C(0x7db4a128a2e9e61c), UINT64_C(0xdb7d9d11762aa020),
+        UINT64_C(0xd68c4d4de4534974), UINT64_C(0xc19f3ca852d97289), UINT64_C(0xcc6eecf4c0a09bdd),
+        UINT64_C(0x8d0c45dafa5efff1), UINT64_C(0x80fd9586682716a5), UINT64_C(0x97eee463dead2d58),
+        UINT64_C(0x9a1f343f4cd4c40c), UINT64_C(0x3cd6080698178230), UINT64_C(0x3127d85a0a6e6b64),
+        UINT64_C(0x2634a9bfbce45099), UINT64_C(0x2bc579e32e9db9cd), UINT64_C(0xf5a054d6ca71fb90),
+        UINT64_C(0xf851848a580812c4), UINT64_C(0xef42f56fee822939), UINT64_C(0xe2b325337cfbc06d),
+        UINT64_C(0x447a190aa8388651), UINT64_C(0x498bc9563a416f05), UINT64_C(0x5e98b8b38ccb54f8),
+        UINT64_C(0x536968ef1eb2bdac), UINT64_C(0x120bc1c1244cd980), UINT64_C(0x1ffa119db63530d4),
+        UINT64_C(0x08e9607800bf0b29), UINT64_C(0x0518b02492c6e27d), UINT64_C(0xa3d18c1d4605a441),
+        UINT64_C(0xae205c41d47c4d15), UINT64_C(0xb9332da462f676e8), UINT64_C(0xb4c2fdf8f08f9fbc),
+        UINT64_C(0x3bf77ff9160abfb0), UINT64_C(0x3606afa5847356e4), UINT64_C(0x2115de4032f96d19),
+        UINT64_C(0x2ce40e1ca080844d), UINT64_C(0x8a2d32257443c271), UINT64_C(0x87dce279e63a2b25),
+        UINT64_C(0x90cf939c50b010d8), UINT64_C(0x9d3e43c0c2c9f98c), UINT64_C(0xdc5ceaeef8379da0),
+        UINT64_C(0xd1ad3ab26a4e74f4), UINT64_C(0xc6be4b57dcc44f09), UINT64_C(0xcb4f9b0b4ebda65d),
+        UINT64_C(0x6d86a7329a7ee061), UINT64_C(0x6077776e08070935), UINT64_C(0x7764068bbe8d32c8),
+        UINT64_C(0x7a95d6d72cf4db9c), UINT64_C(0x690f0288728673d0), UINT64_C(0x64fed2d4e0ff9a84),
+        UINT64_C(0x73eda3315675a179), UINT64_C(0x7e1c736dc40c482d), UINT64_C(0xd8d54f5410cf0e11),
+        UINT64_C(0xd5249f0882b6e745), UINT64_C(0xc237eeed343cdcb8), UINT64_C(0xcfc63eb1a64535ec),
+        UINT64_C(0x8ea4979f9cbb51c0), UINT64_C(0x835547c30ec2b894), UINT64_C(0x94463626b8488369),
+        UINT64_C(0x99b7e67a2a316a3d), UINT64_C(0x3f7eda43fef22c01), UINT64_C(0x328f0a1f6c8bc555),
+        UINT64_C(0x259c7bfada01fea8), UINT64_C(0x286daba6487817fc), UINT64_C(0xa75829a7aefd37f0),
+        UINT64_C(0xaaa9f9fb3c84dea4), UINT64_C(0xbdba881e8a0ee559), UINT64_C(0xb04b584218770c0d),
+        UINT64_C(0x1682647bccb44a31), UINT64_C(0x1b73b4275ecda365), UINT64_C(0x0c60c5c2e8479898),
+        UINT64_C(0x0191159e7a3e71cc), UINT64_C(0x40f3bcb040c015e0), UINT64_C(0x4d026cecd2b9fcb4),
+        UINT64_C(0x5a111d096433c749), UINT64_C(0x57e0cd55f64a2e1d), UINT64_C(0xf129f16c22896821),
+        UINT64_C(0xfcd82130b0f08175), UINT64_C(0xebcb50d5067aba88), UINT64_C(0xe63a8089940353dc),
+        UINT64_C(0xcdfff96aba9eea11), UINT64_C(0xc00e293628e70345), UINT64_C(0xd71d58d39e6d38b8),
+        UINT64_C(0xdaec888f0c14d1ec), UINT64_C(0x7c25b4b6d8d797d0), UINT64_C(0x71d464ea4aae7e84),
+        UINT64_C(0x66c7150ffc244579), UINT64_C(0x6b36c5536e5dac2d), UINT64_C(0x2a546c7d54a3c801),
+        UINT64_C(0x27a5bc21c6da2155), UINT64_C(0x30b6cdc470501aa8), UINT64_C(0x3d471d98e229f3fc),
+        UINT64_C(0x9b8e21a136eab5c0), UINT64_C(0x967ff1fda4935c94), UINT64_C(0x816c801812196769),
+        UINT64_C(0x8c9d504480608e3d), UINT64_C(0x03a8d24566e5ae31), UINT64_C(0x0e590219f49c4765),
+        UINT64_C(0x194a73fc42167c98), UINT64_C(0x14bba3a0d06f95cc), UINT64_C(0xb2729f9904acd3f0),
+        UINT64_C(0xbf834fc596d53aa4), UINT64_C(0xa8903e20205f0159), UINT64_C(0xa561ee7cb226e80d),
+        UINT64_C(0xe403475288d88c21), UINT64_C(0xe9f2970e1aa16575), UINT64_C(0xfee1e6ebac2b5e88),
+        UINT64_C(0xf31036b73e52b7dc), UINT64_C(0x55d90a8eea91f1e0), UINT64_C(0x5828dad278e818b4),
+        UINT64_C(0x4f3bab37ce622349), UINT64_C(0x42ca7b6b5c1bca1d), UINT64_C(0x5150af3402696251),
+        UINT64_C(0x5ca17f6890108b05), UINT64_C(0x4bb20e8d269ab0f8), UINT64_C(0x4643ded1b4e359ac),
+        UINT64_C(0xe08ae2e860201f90), UINT64_C(0xed7b32b4f259f6c4), UINT64_C(0xfa68435144d3cd39),
+        UINT64_C(0xf799930dd6aa246d), UINT64_C(0xb6fb3a23ec544041), UINT64_C(0xbb0aea7f7e2da915),
+        UINT64_C(0xac199b9ac8a792e8), UINT64_C(0xa1e84bc65ade7bbc), UINT64_C(0x072177ff8e1d3d80),
+        UINT64_C(0x0ad0a7a31c64d4d4), UINT64_C(0x1dc3d646aaeeef29), UINT64_C(0x1032061a3897067d),
+        UINT64_C(0x9f07841bde122671), UINT64_C(0x92f654474c6bcf25), UINT64_C(0x85e525a2fae1f4d8),
+        UINT64_C(0x8814f5fe68981d8c), UINT64_C(0x2eddc9c7bc5b5bb0), UINT64_C(0x232c199b2e22b2e4),
+        UINT64_C(0x343f687e98a88919), UINT64_C(0x39ceb8220ad1604d), UINT64_C(0x78ac110c302f0461),
+        UINT64_C(0x755dc150a256ed35), UINT64_C(0x624eb0b514dcd6c8), UINT64_C(0x6fbf60e986a53f9c),
+        UINT64_C(0xc9765cd0526679a0), UINT64_C(0xc4878c8cc01f90f4), UINT64_C(0xd394fd697695ab09),
+        UINT64_C(0xde652d35e4ec425d)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0xcb6d6a914ae10b3f), UINT64_C(0x96dbd42295c2177e),
+        UINT64_C(0x5db6beb3df231c41), UINT64_C(0x2cb7a9452a852ffc), UINT64_C(0xe7dac3d4606424c3),
+        UINT64_C(0xba6c7d67bf473882), UINT64_C(0x710117f6f5a633bd), UINT64_C(0xdd705d247fa5876a),
+        UINT64_C(0x161d37b535448c55), UINT64_C(0x4bab8906ea679014), UINT64_C(0x80c6e397a0869b2b),
+        UINT64_C(0xf1c7f4615520a896), UINT64_C(0x3aaa9ef01fc1a3a9), UINT64_C(0x671c2043c0e2bfe8),
+        UINT64_C(0xac714ad28a03b4d7), UINT64_C(0xbae1ba48fe4a0fd5), UINT64_C(0x718cd0d9b4ab04ea),
+        UINT64_C(0x2c3a6e6a6b8818ab), UINT64_C(0xe75704fb21691394), UINT64_C(0x9656130dd4cf2029),
+        UINT64_C(0x5d3b799c9e2e2b16), UINT64_C(0x008dc72f410d3757), UINT64_C(0xcbe0adbe0bec3c68),
+        UINT64_C(0x6791e76c81ef88bf), UINT64_C(0xacfc8dfdcb0e8380), UINT64_C(0xf14a334e142d9fc1),
+        UINT64_C(0x3a2759df5ecc94fe), UINT64_C(0x4b264e29ab6aa743), UINT64_C(0x804b24b8e18bac7c),
+        UINT64_C(0xddfd9a0b3ea8b03d), UINT64_C(0x1690f09a7449bb02), UINT64_C(0xf1dd7b3ed73ac638),
+        UINT64_C(0x3ab011af9ddbcd07), UINT64_C(0x6706af1c42f8d146), UINT64_C(0xac6bc58d0819da79),
+        UINT64_C(0xdd6ad27bfdbfe9c4), UINT64_C(0x1607b8eab75ee2fb), UINT64_C(0x4bb10659687dfeba),
+        UINT64_C(0x80dc6cc8229cf585), UINT64_C(0x2cad261aa89f4152), UINT64_C(0xe7c04c8be27e4a6d),
+        UINT64_C(0xba76f2383d5d562c), UINT64_C(0x711b98a977bc5d13), UINT64_C(0x001a8f5f821a6eae),
+        UINT64_C(0xcb77e5cec8fb6591), UINT64_C(0x96c15b7d17d879d0), UINT64_C(0x5dac31ec5d3972ef),
+        UINT64_C(0x4b3cc1762970c9ed), UINT64_C(0x8051abe76391c2d2), UINT64_C(0xdde71554bcb2de93),
+        UINT64_C(0x168a7fc5f653d5ac), UINT64_C(0x678b683303f5e611), UINT64_C(0xace602a24914ed2e),
+        UINT64_C(0xf150bc119637f16f), UINT64_C(0x3a3dd680dcd6fa50), UINT64_C(0x964c9c5256d54e87),
+        UINT64_C(0x5d21f6c31c3445b8), UINT64_C(0x00974870c31759f9), UINT64_C(0xcbfa22e189f652c6),
+        UINT64_C(0xbafb35177c50617b), UINT64_C(0x71965f8636b16a44), UINT64_C(0x2c20e135e9927605),
+        UINT64_C(0xe74d8ba4a3737d3a), UINT64_C(0xe2bbf77cae758c71), UINT64_C(0x29d69dede494874e),
+        UINT64_C(0x7460235e3bb79b0f), UINT64_C(0xbf0d49cf71569030), UINT64_C(0xce0c5e3984f0a38d),
+        UINT64_C(0x056134a8ce11a8b2), UINT64_C(0x58d78a1b1132b4f3), UINT64_C(0x93bae08a5bd3bfcc),
+        UINT64_C(0x3fcbaa58d1d00b1b), UINT64_C(0xf4a6c0c99b310024), UINT64_C(0xa9107e7a44121c65),
+        UINT64_C(0x627d14eb0ef3175a), UINT64_C(0x137c031dfb5524e7), UINT64_C(0xd811698cb1b42fd8),
+        UINT64_C(0x85a7d73f6e973399), UINT64_C(0x4ecabdae247638a6), UINT64_C(0x585a4d34503f83a4),
+        UINT64_C(0x933727a51ade889b), UINT64_C(0xce819916c5fd94da), UINT64_C(0x05ecf3878f1c9fe5),
+        UINT64_C(0x74ede4717abaac58), UINT64_C(0xbf808ee0305ba767), UINT64_C(0xe2363053ef78bb26),
+        UINT64_C(0x295b5ac2a599b019), UINT64_C(0x852a10102f9a04ce), UINT64_C(0x4e477a81657b0ff1),
+        UINT64_C(0x13f1c432ba5813b0), UINT64_C(0xd89caea3f0b9188f), UINT64_C(0xa99db955051f2b32),
+        UINT64_C(0x62f0d3c44ffe200d), UINT64_C(0x3f466d7790dd3c4c), UINT64_C(0xf42b07e6da3c3773),
+        UINT64_C(0x13668c42794f4a49), UINT64_C(0xd80be6d333ae4176), UINT64_C(0x85bd5860ec8d5d37),
+        UINT64_C(0x4ed032f1a66c5608), UINT64_C(0x3fd1250753ca65b5), UINT64_C(0xf4bc4f96192b6e8a),
+        UINT64_C(0xa90af125c60872cb), UINT64_C(0x62679bb48ce979f4), UINT64_C(0xce16d16606eacd23),
+        UINT64_C(0x057bbbf74c0bc61c), UINT64_C(0x58cd05449328da5d), UINT64_C(0x93a06fd5d9c9d162),
+        UINT64_C(0xe2a178232c6fe2df), UINT64_C(0x29cc12b2668ee9e0), UINT64_C(0x747aac01b9adf5a1),
+        UINT64_C(0xbf17c690f34cfe9e), UINT64_C(0xa987360a8705459c), UINT64_C(0x62ea5c9bcde44ea3),
+        UINT64_C(0x3f5ce22812c752e2), UINT64_C(0xf43188b9582659dd), UINT64_C(0x85309f4fad806a60),
+        UINT64_C(0x4e5df5dee761615f), UINT64_C(0x13eb4b6d38427d1e), UINT64_C(0xd88621fc72a37621),
+        UINT64_C(0x74f76b2ef8a0c2f6), UINT64_C(0xbf9a01bfb241c9c9), UINT64_C(0xe22cbf0c6d62d588),
+        UINT64_C(0x2941d59d2783deb7), UINT64_C(0x5840c26bd225ed0a), UINT64_C(0x932da8fa98c4e635),
+        UINT64_C(0xce9b164947e7fa74), UINT64_C(0x05f67cd80d06f14b), UINT64_C(0xc477eff95ceb18e3),
+        UINT64_C(0x0f1a8568160a13dc), UINT64_C(0x52ac3bdbc9290f9d), UINT64_C(0x99c1514a83c804a2),
+        UINT64_C(0xe8c046bc766e371f), UINT64_C(0x23ad2c2d3c8f3c20), UINT64_C(0x7e1b929ee3ac2061),
+        UINT64_C(0xb576f80fa94d2b5e), UINT64_C(0x1907b2dd234e9f89), UINT64_C(0xd26ad84c69af94b6),
+        UINT64_C(0x8fdc66ffb68c88f7), UINT64_C(0x44b10c6efc6d83c8), UINT64_C(0x35b01b9809cbb075),
+        UINT64_C(0xfedd7109432abb4a), UINT64_C(0xa36bcfba9c09a70b), UINT64_C(0x6806a52bd6e8ac34),
+        UINT64_C(0x7e9655b1a2a11736), UINT64_C(0xb5fb3f20e8401c09), UINT64_C(0xe84d819337630048),
+        UINT64_C(0x2320eb027d820b77), UINT64_C(0x5221fcf4882438ca), UINT64_C(0x994c9665c2c533f5),
+        UINT64_C(0xc4fa28d61de62fb4), UINT64_C(0x0f9742475707248b), UINT64_C(0xa3e60895dd04905c),
+        UINT64_C(0x688b620497e59b63), UINT64_C(0x353ddcb748c68722), UINT64_C(0xfe50b62602278c1d),
+        UINT64_C(0x8f51a1d0f781bfa0), UINT64_C(0x443ccb41bd60b49f), UINT64_C(0x198a75f26243a8de),
+        UINT64_C(0xd2e71f6328a2a3e1), UINT64_C(0x35aa94c78bd1dedb), UINT64_C(0xfec7fe56c130d5e4),
+        UINT64_C(0xa37140e51e13c9a5), UINT64_C(0x681c2a7454f2c29a), UINT64_C(0x191d3d82a154f127),
+        UINT64_C(0xd2705713ebb5fa18), UINT64_C(0x8fc6e9a03496e659), UINT64_C(0x44ab83317e77ed66),
+        UINT64_C(0xe8dac9e3f47459b1), UINT64_C(0x23b7a372be95528e), UINT64_C(0x7e011dc161b64ecf),
+        UINT64_C(0xb56c77502b5745f0), UINT64_C(0xc46d60a6def1764d), UINT64_C(0x0f000a3794107d72),
+        UINT64_C(0x52b6b4844b336133), UINT64_C(0x99dbde1501d26a0c), UINT64_C(0x8f4b2e8f759bd10e),
+        UINT64_C(0x4426441e3f7ada31), UINT64_C(0x1990faade059c670), UINT64_C(0xd2fd903caab8cd4f),
+        UINT64_C(0xa3fc87ca5f1efef2), UINT64_C(0x6891ed5b15fff5cd), UINT64_C(0x352753e8cadce98c),
+        UINT64_C(0xfe4a3979803de2b3), UINT64_C(0x523b73ab0a3e5664), UINT64_C(0x9956193a40df5d5b),
+        UINT64_C(0xc4e0a7899ffc411a), UINT64_C(0x0f8dcd18d51d4a25), UINT64_C(0x7e8cdaee20bb7998),
+        UINT64_C(0xb5e1b07f6a5a72a7), UINT64_C(0xe8570eccb5796ee6), UINT64_C(0x233a645dff9865d9),
+        UINT64_C(0x26cc1885f29e9492), UINT64_C(0xeda17214b87f9fad), UINT64_C(0xb017cca7675c83ec),
+        UINT64_C(0x7b7aa6362dbd88d3), UINT64_C(0x0a7bb1c0d81bbb6e), UINT64_C(0xc116db5192fab051),
+        UINT64_C(0x9ca065e24dd9ac10), UINT64_C(0x57cd0f730738a72f), UINT64_C(0xfbbc45a18d3b13f8),
+        UINT64_C(0x30d12f30c7da18c7), UINT64_C(0x6d67918318f90486), UINT64_C(0xa60afb1252180fb9),
+        UINT64_C(0xd70bece4a7be3c04), UINT64_C(0x1c668675ed5f373b), UINT64_C(0x41d038c6327c2b7a),
+        UINT64_C(0x8abd5257789d2045), UINT64_C(0x9c2da2cd0cd49b47), UINT64_C(0x5740c85c46359078),
+        UINT64_C(0x0af676ef99168c39), UINT64_C(0xc19b1c7ed3f78706), UINT64_C(0xb09a0b882651b4bb),
+        UINT64_C(0x7bf761196cb0bf84), UINT64_C(0x2641dfaab393a3c5), UINT64_C(0xed2cb53bf972a8fa),
+        UINT64_C(0x415dffe973711c2d), UINT64_C(0x8a30957839901712), UINT64_C(0xd7862bcbe6b30b53),
+        UINT64_C(0x1ceb415aac52006c), UINT64_C(0x6dea56ac59f433d1), UINT64_C(0xa6873c3d131538ee),
+        UINT64_C(0xfb31828ecc3624af), UINT64_C(0x305ce81f86d72f90), UINT64_C(0xd71163bb25a452aa),
+        UINT64_C(0x1c7c092a6f455995), UINT64_C(0x41cab799b06645d4), UINT64_C(0x8aa7dd08fa874eeb),
+        UINT64_C(0xfba6cafe0f217d56), UINT64_C(0x30cba06f45c07669), UINT64_C(0x6d7d1edc9ae36a28),
+        UINT64_C(0xa610744dd0026117), UINT64_C(0x0a613e9f5a01d5c0), UINT64_C(0xc10c540e10e0deff),
+        UINT64_C(0x9cbaeabdcfc3c2be), UINT64_C(0x57d7802c8522c981), UINT64_C(0x26d697da7084fa3c),
+        UINT64_C(0xedbbfd4b3a65f103), UINT64_C(0xb00d43f8e546ed42), UINT64_C(0x7b602969afa7e67d),
+        UINT64_C(0x6df0d9f3dbee5d7f), UINT64_C(0xa69db362910f5640), UINT64_C(0xfb2b0dd14e2c4a01),
+        UINT64_C(0x3046674004cd413e), UINT64_C(0x414770b6f16b7283), UINT64_C(0x8a2a1a27bb8a79bc),
+        UINT64_C(0xd79ca49464a965fd), UINT64_C(0x1cf1ce052e486ec2), UINT64_C(0xb08084d7a44bda15),
+        UINT64_C(0x7bedee46eeaad12a), UINT64_C(0x265b50f53189cd6b), UINT64_C(0xed363a647b68c654),
+        UINT64_C(0x9c372d928ecef5e9), UINT64_C(0x575a4703c42ffed6), UINT64_C(0x0aecf9b01b0ce297),
+        UINT64_C(0xc181932151ede9a8)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0xdca12c225e8aee1d), UINT64_C(0xb8435944bc14dd3b),
+        UINT64_C(0x64e27566e29e3326), UINT64_C(0x7087b2887829ba77), UINT64_C(0xac269eaa26a3546a),
+        UINT64_C(0xc8c4ebccc43d674c), UINT64_C(0x1465c7ee9ab78951), UINT64_C(0xe00e6511f15274ef),
+        UINT64_C(0x3caf4933afd89af2), UINT64_C(0x584d3c554d46a9d4), UINT64_C(0x84ec107713cc47c9),
+        UINT64_C(0x9089d799897bce98), UINT64_C(0x4c28fbbbd7f12085), UINT64_C(0x28ca8edd356f13a3),
+        UINT64_C(0xf46ba2ff6be5fdbe), UINT64_C(0x4503c48dc90a304c), UINT64_C(0x99a2e8af9780de51),
+        UINT64_C(0xfd409dc9751eed77), UINT64_C(0x21e1b1eb2b94036a), UINT64_C(0x35847605b1238a3b),
+        UINT64_C(0xe9255a27efa96426), UINT64_C(0x8dc72f410d375700), UINT64_C(0x5166036353bdb91d),
+        UINT64_C(0xa50da19c385844a3), UINT64_C(0x79ac8dbe66d2aabe), UINT64_C(0x1d4ef8d8844c9998),
+        UINT64_C(0xc1efd4fadac67785), UINT64_C(0xd58a13144071fed4), UINT64_C(0x092b3f361efb10c9),
+        UINT64_C(0x6dc94a50fc6523ef), UINT64_C(0xb1686672a2efcdf2), UINT64_C(0x8a06881b93156098),
+        UINT64_C(0x56a7a439cd9f8e85), UINT64_C(0x3245d15f2f01bda3), UINT64_C(0xeee4fd7d718b53be),
+        UINT64_C(0xfa813a93eb3cdaef), UINT64_C(0x262016b1b5b634f2), UINT64_C(0x42c263d7572807d4),
+        UINT64_C(0x9e634ff509a2e9c9), UINT64_C(0x6a08ed0a62471477), UINT64_C(0xb6a9c1283ccdfa6a),
+        UINT64_C(0xd24bb44ede53c94c), UINT64_C(0x0eea986c80d92751), UINT64_C(0x1a8f5f821a6eae00),
+        UINT64_C(0xc62e73a044e4401d), UINT64_C(0xa2cc06c6a67a733b), UINT64_C(0x7e6d2ae4f8f09d26),
+        UINT64_C(0xcf054c965a1f50d4), UINT64_C(0x13a460b40495bec9), UINT64_C(0x774615d2e60b8def),
+        UINT64_C(0xabe739f0b88163f2), UINT64_C(0xbf82fe1e2236eaa3), UINT64_C(0x6323d23c7cbc04be),
+        UINT64_C(0x07c1a75a9e223798), UINT64_C(0xdb608b78c0a8d985), UINT64_C(0x2f0b2987ab4d243b),
+        UINT64_C(0xf3aa05a5f5c7ca26), UINT64_C(0x974870c31759f900), UINT64_C(0x4be95ce149d3171d),
+        UINT64_C(0x5f8c9b0fd3649e4c), UINT64_C(0x832db72d8dee7051), UINT64_C(0xe7cfc24b6f704377),
+        UINT64_C(0x3b6eee6931faad6a), UINT64_C(0x91131e980d8418a2), UINT64_C(0x4db232ba530ef6bf),
+        UINT64_C(0x295047dcb190c599), UINT64_C(0xf5f16bfeef1a2b84), UINT64_C(0xe194ac1075ada2d5),
+        UINT64_C(0x3d3580322b274cc8), UINT64_C(0x59d7f554c9b97fee), UINT64_C(0x8576d976973391f3),
+        UINT64_C(0x711d7b89fcd66c4d), UINT64_C(0xadbc57aba25c8250), UINT64_C(0xc95e22cd40c2b176),
+        UINT64_C(0x15ff0eef1e485f6b), UINT64_C(0x019ac90184ffd63a), UINT64_C(0xdd3be523da753827),
+        UINT64_C(0xb9d9904538eb0b01), UINT64_C(0x6578bc676661e51c), UINT64_C(0xd410da15c48e28ee),
+        UINT64_C(0x08b1f6379a04c6f3), UINT64_C(0x6c538351789af5d5), UINT64_C(0xb0f2af7326101bc8),
+        UINT64_C(0xa497689dbca79299), UINT64_C(0x783644bfe22d7c84), UINT64_C(0x1cd431d900b34fa2),
+        UINT64_C(0xc0751dfb5e39a1bf), UINT64_C(0x341ebf0435dc5c01), UINT64_C(0xe8bf93266b56b21c),
+        UINT64_C(0x8c5de64089c8813a), UINT64_C(0x50fcca62d7426f27), UINT64_C(0x44990d8c4df5e676),
+        UINT64_C(0x983821ae137f086b), UINT64_C(0xfcda54c8f1e13b4d), UINT64_C(0x207b78eaaf6bd550),
+        UINT64_C(0x1b1596839e91783a), UINT64_C(0xc7b4baa1c01b9627), UINT64_C(0xa356cfc72285a501),
+        UINT64_C(0x7ff7e3e57c0f4b1c), UINT64_C(0x6b92240be6b8c24d), UINT64_C(0xb7330829b8322c50),
+        UINT64_C(0xd3d17d4f5aac1f76), UINT64_C(0x0f70516d0426f16b), UINT64_C(0xfb1bf3926fc30cd5),
+        UINT64_C(0x27badfb03149e2c8), UINT64_C(0x4358aad6d3d7d1ee), UINT64_C(0x9ff986f48d5d3ff3),
+        UINT64_C(0x8b9c411a17eab6a2), UINT64_C(0x573d6d38496058bf), UINT64_C(0x33df185eabfe6b99),
+        UINT64_C(0xef7e347cf5748584), UINT64_C(0x5e16520e579b4876), UINT64_C(0x82b77e2c0911a66b),
+        UINT64_C(0xe6550b4aeb8f954d), UINT64_C(0x3af42768b5057b50), UINT64_C(0x2e91e0862fb2f201),
+        UINT64_C(0xf230cca471381c1c), UINT64_C(0x96d2b9c293a62f3a), UINT64_C(0x4a7395e0cd2cc127),
+        UINT64_C(0xbe18371fa6c93c99), UINT64_C(0x62b91b3df843d284), UINT64_C(0x065b6e5b1adde1a2),
+        UINT64_C(0xdafa427944570fbf), UINT64_C(0xce9f8597dee086ee), UINT64_C(0x123ea9b5806a68f3),
+        UINT64_C(0x76dcdcd362f45bd5), UINT64_C(0xaa7df0f13c7eb5c8), UINT64_C(0xa739329f30a7e9d6),
+        UINT64_C(0x7b981ebd6e2d07cb), UINT64_C(0x1f7a6bdb8cb334ed), UINT64_C(0xc3db47f9d239daf0),
+        UINT64_C(0xd7be8017488e53a1), UINT64_C(0x0b1fac351604bdbc), UINT64_C(0x6ffdd953f49a8e9a),
+        UINT64_C(0xb35cf571aa106087), UINT64_C(0x4737578ec1f59d39), UINT64_C(0x9b967bac9f7f7324),
+        UINT64_C(0xff740eca7de14002), UINT64_C(0x23d522e8236bae1f), UINT64_C(0x37b0e506b9dc274e),
+        UINT64_C(0xeb11c924e756c953), UINT64_C(0x8ff3bc4205c8fa75), UINT64_C(0x535290605b421468),
+        UINT64_C(0xe23af612f9add99a), UINT64_C(0x3e9bda30a7273787), UINT64_C(0x5a79af5645b904a1),
+        UINT64_C(0x86d883741b33eabc), UINT64_C(0x92bd449a818463ed), UINT64_C(0x4e1c68b8df0e8df0),
+        UINT64_C(0x2afe1dde3d90bed6), UINT64_C(0xf65f31fc631a50cb), UINT64_C(0x0234930308ffad75),
+        UINT64_C(0xde95bf2156754368), UINT64_C(0xba77ca47b4eb704e), UINT64_C(0x66d6e665ea619e53),
+        UINT64_C(0x72b3218b70d61702), UINT64_C(0xae120da92e5cf91f), UINT64_C(0xcaf078cfccc2ca39),
+        UINT64_C(0x165154ed92482424), UINT64_C(0x2d3fba84a3b2894e), UINT64_C(0xf19e96a6fd386753),
+        UINT64_C(0x957ce3c01fa65475), UINT64_C(0x49ddcfe2412cba68), UINT64_C(0x5db8080cdb9b3339),
+        UINT64_C(0x8119242e8511dd24), UINT64_C(0xe5fb5148678fee02), UINT64_C(0x395a7d6a3905001f),
+        UINT64_C(0xcd31df9552e0fda1), UINT64_C(0x1190f3b70c6a13bc), UINT64_C(0x757286d1eef4209a),
+        UINT64_C(0xa9d3aaf3b07ece87), UINT64_C(0xbdb66d1d2ac947d6), UINT64_C(0x6117413f7443a9cb),
+        UINT64_C(0x05f5345996dd9aed), UINT64_C(0xd954187bc85774f0), UINT64_C(0x683c7e096ab8b902),
+        UINT64_C(0xb49d522b3432571f), UINT64_C(0xd07f274dd6ac6439), UINT64_C(0x0cde0b6f88268a24),
+        UINT64_C(0x18bbcc8112910375), UINT64_C(0xc41ae0a34c1bed68), UINT64_C(0xa0f895c5ae85de4e),
+        UINT64_C(0x7c59b9e7f00f3053), UINT64_C(0x88321b189beacded), UINT64_C(0x5493373ac56023f0),
+        UINT64_C(0x3071425c27fe10d6), UINT64_C(0xecd06e7e7974fecb), UINT64_C(0xf8b5a990e3c3779a),
+        UINT64_C(0x241485b2bd499987), UINT64_C(0x40f6f0d45fd7aaa1), UINT64_C(0x9c57dcf6015d44bc),
+        UINT64_C(0x362a2c073d23f174), UINT64_C(0xea8b002563a91f69), UINT64_C(0x8e69754381372c4f),
+        UINT64_C(0x52c85961dfbdc252), UINT64_C(0x46ad9e8f450a4b03), UINT64_C(0x9a0cb2ad1b80a51e),
+        UINT64_C(0xfeeec7cbf91e9638), UINT64_C(0x224febe9a7947825), UINT64_C(0xd6244916cc71859b),
+        UINT64_C(0x0a85653492fb6b86), UINT64_C(0x6e671052706558a0), UINT64_C(0xb2c63c702eefb6bd),
+        UINT64_C(0xa6a3fb9eb4583fec), UINT64_C(0x7a02d7bcead2d1f1), UINT64_C(0x1ee0a2da084ce2d7),
+        UINT64_C(0xc2418ef856c60cca), UINT64_C(0x7329e88af429c138), UINT64_C(0xaf88c4a8aaa32f25),
+        UINT64_C(0xcb6ab1ce483d1c03), UINT64_C(0x17cb9dec16b7f21e), UINT64_C(0x03ae5a028c007b4f),
+        UINT64_C(0xdf0f7620d28a9552), UINT64_C(0xbbed03463014a674), UINT64_C(0x674c2f646e9e4869),
+        UINT64_C(0x93278d9b057bb5d7), UINT64_C(0x4f86a1b95bf15bca), UINT64_C(0x2b64d4dfb96f68ec),
+        UINT64_C(0xf7c5f8fde7e586f1), UINT64_C(0xe3a03f137d520fa0), UINT64_C(0x3f01133123d8e1bd),
+        UINT64_C(0x5be36657c146d29b), UINT64_C(0x87424a759fcc3c86), UINT64_C(0xbc2ca41cae3691ec),
+        UINT64_C(0x608d883ef0bc7ff1), UINT64_C(0x046ffd5812224cd7), UINT64_C(0xd8ced17a4ca8a2ca),
+        UINT64_C(0xccab1694d61f2b9b), UINT64_C(0x100a3ab68895c586), UINT64_C(0x74e84fd06a0bf6a0),
+        UINT64_C(0xa84963f2348118bd), UINT64_C(0x5c22c10d5f64e503), UINT64_C(0x8083ed2f01ee0b1e),
+        UINT64_C(0xe4619849e3703838), UINT64_C(0x38c0b46bbdfad625), UINT64_C(0x2ca57385274d5f74),
+        UINT64_C(0xf0045fa779c7b169), UINT64_C(0x94e62ac19b59824f), UINT64_C(0x484706e3c5d36c52),
+        UINT64_C(0xf92f6091673ca1a0), UINT64_C(0x258e4cb339b64fbd), UINT64_C(0x416c39d5db287c9b),
+        UINT64_C(0x9dcd15f785a29286), UINT64_C(0x89a8d2191f151bd7), UINT64_C(0x5509fe3b419ff5ca),
+        UINT64_C(0x31eb8b5da301c6ec), UINT64_C(0xed4aa77ffd8b28f1), UINT64_C(0x19210580966ed54f),
+        UINT64_C(0xc58029a2c8e43b52), UINT64_C(0xa1625cc42a7a0874), UINT64_C(0x7dc370e674f0e669),
+        UINT64_C(0x69a6b708ee476f38), UINT64_C(0xb5079b2ab0cd8125), UINT64_C(0xd1e5ee4c5253b203),
+        UINT64_C(0x0d44c26e0cd95c1e)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0x5e20c43360772d5c), UINT64_C(0xbc408867c0ee5ab8),
+        UINT64_C(0xe2604c54a09977e4), UINT64_C(0xfd9f1e60ab726de2), UINT64_C(0xa3bfda53cb0540be),
+        UINT64_C(0x41df96076b9c375a), UINT64_C(0x1fff52340beb1a06), UINT64_C(0x7f21336f7d4a0256),
+        UINT64_C(0x2101f75c1d3d2f0a), UINT64_C(0xc361bb08bda458ee), UINT64_C(0x9d417f3bddd375b2),
+        UINT64_C(0x82be2d0fd6386fb4), UINT64_C(0xdc9ee93cb64f42e8), UINT64_C(0x3efea56816d6350c),
+        UINT64_C(0x60de615b76a11850), UINT64_C(0xfe4266defa9404ac), UINT64_C(0xa062a2ed9ae329f0),
+        UINT64_C(0x4202eeb93a7a5e14), UINT64_C(0x1c222a8a5a0d7348), UINT64_C(0x03dd78be51e6694e),
+        UINT64_C(0x5dfdbc8d31914412), UINT64_C(0xbf9df0d9910833f6), UINT64_C(0xe1bd34eaf17f1eaa),
+        UINT64_C(0x816355b187de06fa), UINT64_C(0xdf439182e7a92ba6), UINT64_C(0x3d23ddd647305c42),
+        UINT64_C(0x630319e52747711e), UINT64_C(0x7cfc4bd12cac6b18), UINT64_C(0x22dc8fe24cdb4644),
+        UINT64_C(0xc0bcc3b6ec4231a0), UINT64_C(0x9e9c07858c351cfc), UINT64_C(0x799bc213de86d1ca),
+        UINT64_C(0x27bb0620bef1fc96), UINT64_C(0xc5db4a741e688b72), UINT64_C(0x9bfb8e477e1fa62e),
+        UINT64_C(0x8404dc7375f4bc28), UINT64_C(0xda24184015839174), UINT64_C(0x38445414b51ae690),
+        UINT64_C(0x66649027d56dcbcc), UINT64_C(0x06baf17ca3ccd39c), UINT64_C(0x589a354fc3bbfec0),
+        UINT64_C(0xbafa791b63228924), UINT64_C(0xe4dabd280355a478), UINT64_C(0xfb25ef1c08bebe7e),
+        UINT64_C(0xa5052b2f68c99322), UINT64_C(0x4765677bc850e4c6), UINT64_C(0x1945a348a827c99a),
+        UINT64_C(0x87d9a4cd2412d566), UINT64_C(0xd9f960fe4465f83a), UINT64_C(0x3b992caae4fc8fde),
+        UINT64_C(0x65b9e899848ba282), UINT64_C(0x7a46baad8f60b884), UINT64_C(0x24667e9eef1795d8),
+        UINT64_C(0xc60632ca4f8ee23c), UINT64_C(0x9826f6f92ff9cf60), UINT64_C(0xf8f897a25958d730),
+        UINT64_C(0xa6d85391392ffa6c), UINT64_C(0x44b81fc599b68d88), UINT64_C(0x1a98dbf6f9c1a0d4),
+        UINT64_C(0x056789c2f22abad2), UINT64_C(0x5b474df1925d978e), UINT64_C(0xb92701a532c4e06a),
+        UINT64_C(0xe707c59652b3cd36), UINT64_C(0x77288b8897a27b07), UINT64_C(0x29084fbbf7d5565b),
+        UINT64_C(0xcb6803ef574c21bf), UINT64_C(0x9548c7dc373b0ce3), UINT64_C(0x8ab795e83cd016e5),
+        UINT64_C(0xd49751db5ca73bb9), UINT64_C(0x36f71d8ffc3e4c5d), UINT64_C(0x68d7d9bc9c496101),
+        UINT64_C(0x0809b8e7eae87951), UINT64_C(0x56297cd48a9f540d), UINT64_C(0xb44930802a0623e9),
+        UINT64_C(0xea69f4b34a710eb5), UINT64_C(0xf596a687419a14b3), UINT64_C(0xabb662b421ed39ef),
+        UINT64_C(0x49d62ee081744e0b), UINT64_C(0x17f6ead3e1036357), UINT64_C(0x896aed566d367fab),
+        UINT64_C(0xd74a29650d4152f7), UINT64_C(0x352a6531add82513), UINT64_C(0x6b0aa102cdaf084f),
+        UINT64_C(0x74f5f336c6441249), UINT64_C(0x2ad53705a6333f15), UINT64_C(0xc8b57b5106aa48f1),
+        UINT64_C(0x9695bf6266dd65ad), UINT64_C(0xf64bde39107c7dfd), UINT64_C(0xa86b1a0a700b50a1),
+        UINT64_C(0x4a0b565ed0922745), UINT64_C(0x142b926db0e50a19), UINT64_C(0x0bd4c059bb0e101f),
+        UINT64_C(0x55f4046adb793d43), UINT64_C(0xb794483e7be04aa7), UINT64_C(0xe9b48c0d1b9767fb),
+        UINT64_C(0x0eb3499b4924aacd), UINT64_C(0x50938da829538791), UINT64_C(0xb2f3c1fc89caf075),
+        UINT64_C(0xecd305cfe9bddd29), UINT64_C(0xf32c57fbe256c72f), UINT64_C(0xad0c93c88221ea73),
+        UINT64_C(0x4f6cdf9c22b89d97), UINT64_C(0x114c1baf42cfb0cb), UINT64_C(0x71927af4346ea89b),
+        UINT64_C(0x2fb2bec7541985c7), UINT64_C(0xcdd2f293f480f223), UINT64_C(0x93f236a094f7df7f),
+        UINT64_C(0x8c0d64949f1cc579), UINT64_C(0xd22da0a7ff6be825), UINT64_C(0x304decf35ff29fc1),
+        UINT64_C(0x6e6d28c03f85b29d), UINT64_C(0xf0f12f45b3b0ae61), UINT64_C(0xaed1eb76d3c7833d),
+        UINT64_C(0x4cb1a722735ef4d9), UINT64_C(0x129163111329d985), UINT64_C(0x0d6e312518c2c383),
+        UINT64_C(0x534ef51678b5eedf), UINT64_C(0xb12eb942d82c993b), UINT64_C(0xef0e7d71b85bb467),
+        UINT64_C(0x8fd01c2acefaac37), UINT64_C(0xd1f0d819ae8d816b), UINT64_C(0x3390944d0e14f68f),
+        UINT64_C(0x6db0507e6e63dbd3), UINT64_C(0x724f024a6588c1d5), UINT64_C(0x2c6fc67905ffec89),
+        UINT64_C(0xce0f8a2da5669b6d), UINT64_C(0x902f4e1ec511b631), UINT64_C(0xee5016112f45f70e),
+        UINT64_C(0xb070d2224f32da52), UINT64_C(0x52109e76efabadb6), UINT64_C(0x0c305a458fdc80ea),
+        UINT64_C(0x13cf087184379aec), UINT64_C(0x4defcc42e440b7b0), UINT64_C(0xaf8f801644d9c054),
+        UINT64_C(0xf1af442524aeed08), UINT64_C(0x9171257e520ff558), UINT64_C(0xcf51e14d3278d804),
+        UINT64_C(0x2d31ad1992e1afe0), UINT64_C(0x7311692af29682bc), UINT64_C(0x6cee3b1ef97d98ba),
+        UINT64_C(0x32ceff2d990ab5e6), UINT64_C(0xd0aeb3793993c202), UINT64_C(0x8e8e774a59e4ef5e),
+        UINT64_C(0x101270cfd5d1f3a2), UINT64_C(0x4e32b4fcb5a6defe), UINT64_C(0xac52f8a8153fa91a),
+        UINT64_C(0xf2723c9b75488446), UINT64_C(0xed8d6eaf7ea39e40), UINT64_C(0xb3adaa9c1ed4b31c),
+        UINT64_C(0x51cde6c8be4dc4f8), UINT64_C(0x0fed22fbde3ae9a4), UINT64_C(0x6f3343a0a89bf1f4),
+        UINT64_C(0x31138793c8ecdca8), UINT64_C(0xd373cbc76875ab4c), UINT64_C(0x8d530ff408028610),
+        UINT64_C(0x92ac5dc003e99c16), UINT64_C(0xcc8c99f3639eb14a), UINT64_C(0x2eecd5a7c307c6ae),
+        UINT64_C(0x70cc1194a370ebf2), UINT64_C(0x97cbd402f1c326c4), UINT64_C(0xc9eb103191b40b98),
+        UINT64_C(0x2b8b5c65312d7c7c), UINT64_C(0x75ab9856515a5120), UINT64_C(0x6a54ca625ab14b26),
+        UINT64_C(0x34740e513ac6667a), UINT64_C(0xd61442059a5f119e), UINT64_C(0x88348636fa283cc2),
+        UINT64_C(0xe8eae76d8c892492), UINT64_C(0xb6ca235eecfe09ce), UINT64_C(0x54aa6f0a4c677e2a),
+        UINT64_C(0x0a8aab392c105376), UINT64_C(0x1575f90d27fb4970), UINT64_C(0x4b553d3e478c642c),
+        UINT64_C(0xa935716ae71513c8), UINT64_C(0xf715b55987623e94), UINT64_C(0x6989b2dc0b572268),
+        UINT64_C(0x37a976ef6b200f34), UINT64_C(0xd5c93abbcbb978d0), UINT64_C(0x8be9fe88abce558c),
+        UINT64_C(0x9416acbca0254f8a), UINT64_C(0xca36688fc05262d6), UINT64_C(0x285624db60cb1532),
+        UINT64_C(0x7676e0e800bc386e), UINT64_C(0x16a881b3761d203e), UINT64_C(0x48884580166a0d62),
+        UINT64_C(0xaae809d4b6f37a86), UINT64_C(0xf4c8cde7d68457da), UINT64_C(0xeb379fd3dd6f4ddc),
+        UINT64_C(0xb5175be0bd186080), UINT64_C(0x577717b41d811764), UINT64_C(0x0957d3877df63a38),
+        UINT64_C(0x99789d99b8e78c09), UINT64_C(0xc75859aad890a155), UINT64_C(0x253815fe7809d6b1),
+        UINT64_C(0x7b18d1cd187efbed), UINT64_C(0x64e783f91395e1eb), UINT64_C(0x3ac747ca73e2ccb7),
+        UINT64_C(0xd8a70b9ed37bbb53), UINT64_C(0x8687cfadb30c960f), UINT64_C(0xe659aef6c5ad8e5f),
+        UINT64_C(0xb8796ac5a5daa303), UINT64_C(0x5a1926910543d4e7), UINT64_C(0x0439e2a26534f9bb),
+        UINT64_C(0x1bc6b0966edfe3bd), UINT64_C(0x45e674a50ea8cee1), UINT64_C(0xa78638f1ae31b905),
+        UINT64_C(0xf9a6fcc2ce469459), UINT64_C(0x673afb47427388a5), UINT64_C(0x391a3f742204a5f9),
+        UINT64_C(0xdb7a7320829dd21d), UINT64_C(0x855ab713e2eaff41), UINT64_C(0x9aa5e527e901e547),
+        UINT64_C(0xc48521148976c81b), UINT64_C(0x26e56d4029efbfff), UINT64_C(0x78c5a973499892a3),
+        UINT64_C(0x181bc8283f398af3), UINT64_C(0x463b0c1b5f4ea7af), UINT64_C(0xa45b404fffd7d04b),
+        UINT64_C(0xfa7b847c9fa0fd17), UINT64_C(0xe584d648944be711), UINT64_C(0xbba4127bf43cca4d),
+        UINT64_C(0x59c45e2f54a5bda9), UINT64_C(0x07e49a1c34d290f5), UINT64_C(0xe0e35f8a66615dc3),
+        UINT64_C(0xbec39bb90616709f), UINT64_C(0x5ca3d7eda68f077b), UINT64_C(0x028313dec6f82a27),
+        UINT64_C(0x1d7c41eacd133021), UINT64_C(0x435c85d9ad641d7d), UINT64_C(0xa13cc98d0dfd6a99),
+        UINT64_C(0xff1c0dbe6d8a47c5), UINT64_C(0x9fc26ce51b2b5f95), UINT64_C(0xc1e2a8d67b5c72c9),
+        UINT64_C(0x2382e482dbc5052d), UINT64_C(0x7da220b1bbb22871), UINT64_C(0x625d7285b0593277),
+        UINT64_C(0x3c7db6b6d02e1f2b), UINT64_C(0xde1dfae270b768cf), UINT64_C(0x803d3ed110c04593),
+        UINT64_C(0x1ea139549cf5596f), UINT64_C(0x4081fd67fc827433), UINT64_C(0xa2e1b1335c1b03d7),
+        UINT64_C(0xfcc175003c6c2e8b), UINT64_C(0xe33e27343787348d), UINT64_C(0xbd1ee30757f019d1),
+        UINT64_C(0x5f7eaf53f7696e35), UINT64_C(0x015e6b60971e4369), UINT64_C(0x61800a3be1bf5b39),
+        UINT64_C(0x3fa0ce0881c87665), UINT64_C(0xddc0825c21510181), UINT64_C(0x83e0466f41262cdd),
+        UINT64_C(0x9c1f145b4acd36db), UINT64_C(0xc23fd0682aba1b87), UINT64_C(0x205f9c3c8a236c63),
+        UINT64_C(0x7e7f580fea54413f)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0xc66712725fd58461), UINT64_C(0x8ccf24e4beaa09c3),
+        UINT64_C(0x4aa83696e17f8da2), UINT64_C(0x9d81476756facb14), UINT64_C(0x5be65515092f4f75),
+        UINT64_C(0x114e6383e850c2d7), UINT64_C(0xd72971f1b78546b6), UINT64_C(0x3a038fceacf49729),
+        UINT64_C(0xfc649dbcf3211348), UINT64_C(0xb6ccab2a125e9eea), UINT64_C(0x70abb9584d8b1a8b),
+        UINT64_C(0xa782c8a9fa0e5c3d), UINT64_C(0x61e5dadba5dbd85c), UINT64_C(0x2b4dec4d44a455fe),
+        UINT64_C(0xed2afe3f1b71d19f), UINT64_C(0x74061e9d59e92f53), UINT64_C(0xb2610cef063cab32),
+        UINT64_C(0xf8c93a79e7432690), UINT64_C(0x3eae280bb896a2f1), UINT64_C(0xe98759fa0f13e447),
+        UINT64_C(0x2fe04b8850c66026), UINT64_C(0x65487d1eb1b9ed84), UINT64_C(0xa32f6f6cee6c69e5),
+        UINT64_C(0x4e059153f51db87a), UINT64_C(0x88628321aac83c1b), UINT64_C(0xc2cab5b74bb7b1b9),
+        UINT64_C(0x04ada7c5146235d8), UINT64_C(0xd384d634a3e7736e), UINT64_C(0x15e3c446fc32f70f),
+        UINT64_C(0x5f4bf2d01d4d7aad), UINT64_C(0x992ce0a24298fecc), UINT64_C(0xe80c3c3ab3d25fa6),
+        UINT64_C(0x2e6b2e48ec07dbc7), UINT64_C(0x64c318de0d785665), UINT64_C(0xa2a40aac52add204),
+        UINT64_C(0x758d7b5de52894b2), UINT64_C(0xb3ea692fbafd10d3), UINT64_C(0xf9425fb95b829d71),
+        UINT64_C(0x3f254dcb04571910), UINT64_C(0xd20fb3f41f26c88f), UINT64_C(0x1468a18640f34cee),
+        UINT64_C(0x5ec09710a18cc14c), UINT64_C(0x98a78562fe59452d), UINT64_C(0x4f8ef49349dc039b),
+        UINT64_C(0x89e9e6e1160987fa), UINT64_C(0xc341d077f7760a58), UINT64_C(0x0526c205a8a38e39),
+        UINT64_C(0x9c0a22a7ea3b70f5), UINT64_C(0x5a6d30d5b5eef494), UINT64_C(0x10c5064354917936),
+        UINT64_C(0xd6a214310b44fd57), UINT64_C(0x018b65c0bcc1bbe1), UINT64_C(0xc7ec77b2e3143f80),
+        UINT64_C(0x8d444124026bb222), UINT64_C(0x4b2353565dbe3643), UINT64_C(0xa609ad6946cfe7dc),
+        UINT64_C(0x606ebf1b191a63bd), UINT64_C(0x2ac6898df865ee1f), UINT64_C(0xeca19bffa7b06a7e),
+        UINT64_C(0x3b88ea0e10352cc8), UINT64_C(0xfdeff87c4fe0a8a9), UINT64_C(0xb747ceeaae9f250b),
+        UINT64_C(0x7120dc98f14aa16a), UINT64_C(0x550776db4d0a67de), UINT64_C(0x936064a912dfe3bf),
+        UINT64_C(0xd9c8523ff3a06e1d), UINT64_C(0x1faf404dac75ea7c), UINT64_C(0xc88631bc1bf0acca),
+        UINT64_C(0x0ee123ce442528ab), UINT64_C(0x44491558a55aa509), UINT64_C(0x822e072afa8f2168),
+        UINT64_C(0x6f04f915e1fef0f7), UINT64_C(0xa963eb67be2b7496), UINT64_C(0xe3cbddf15f54f934),
+        UINT64_C(0x25accf8300817d55), UINT64_C(0xf285be72b7043be3), UINT64_C(0x34e2ac00e8d1bf82),
+        UINT64_C(0x7e4a9a9609ae3220), UINT64_C(0xb82d88e4567bb641), UINT64_C(0x2101684614e3488d),
+        UINT64_C(0xe7667a344b36ccec), UINT64_C(0xadce4ca2aa49414e), UINT64_C(0x6ba95ed0f59cc52f),
+        UINT64_C(0xbc802f2142198399), UINT64_C(0x7ae73d531dcc07f8), UINT64_C(0x304f0bc5fcb38a5a),
+        UINT64_C(0xf62819b7a3660e3b), UINT64_C(0x1b02e788b817dfa4), UINT64_C(0xdd65f5fae7c25bc5),
+        UINT64_C(0x97cdc36c06bdd667), UINT64_C(0x51aad11e59685206), UINT64_C(0x8683a0efeeed14b0),
+        UINT64_C(0x40e4b29db13890d1), UINT64_C(0x0a4c840b50471d73), UINT64_C(0xcc2b96790f929912),
+        UINT64_C(0xbd0b4ae1fed83878), UINT64_C(0x7b6c5893a10dbc19), UINT64_C(0x31c46e05407231bb),
+        UINT64_C(0xf7a37c771fa7b5da), UINT64_C(0x208a0d86a822f36c), UINT64_C(0xe6ed1ff4f7f7770d),
+        UINT64_C(0xac4529621688faaf), UINT64_C(0x6a223b10495d7ece), UINT64_C(0x8708c52f522caf51),
+        UINT64_C(0x416fd75d0df92b30), UINT64_C(0x0bc7e1cbec86a692), UINT64_C(0xcda0f3b9b35322f3),
+        UINT64_C(0x1a89824804d66445), UINT64_C(0xdcee903a5b03e024), UINT64_C(0x9646a6acba7c6d86),
+        UINT64_C(0x5021b4dee5a9e9e7), UINT64_C(0xc90d547ca731172b), UINT64_C(0x0f6a460ef8e4934a),
+        UINT64_C(0x45c27098199b1ee8), UINT64_C(0x83a562ea464e9a89), UINT64_C(0x548c131bf1cbdc3f),
+        UINT64_C(0x92eb0169ae1e585e), UINT64_C(0xd84337ff4f61d5fc), UINT64_C(0x1e24258d10b4519d),
+        UINT64_C(0xf30edbb20bc58002), UINT64_C(0x3569c9c054100463), UINT64_C(0x7fc1ff56b56f89c1),
+        UINT64_C(0xb9a6ed24eaba0da0), UINT64_C(0x6e8f9cd55d3f4b16), UINT64_C(0xa8e88ea702eacf77),
+        UINT64_C(0xe240b831e39542d5), UINT64_C(0x2427aa43bc40c6b4), UINT64_C(0x2f10e219b0bb162e),
+        UINT64_C(0xe977f06bef6e924f), UINT64_C(0xa3dfc6fd0e111fed), UINT64_C(0x65b8d48f51c49b8c),
+        UINT64_C(0xb291a57ee641dd3a), UINT64_C(0x74f6b70cb994595b), UINT64_C(0x3e5e819a58ebd4f9),
+        UINT64_C(0xf83993e8073e5098), UINT64_C(0x15136dd71c4f8107), UINT64_C(0xd3747fa5439a0566),
+        UINT64_C(0x99dc4933a2e588c4), UINT64_C(0x5fbb5b41fd300ca5), UINT64_C(0x88922ab04ab54a13),
+        UINT64_C(0x4ef538c21560ce72), UINT64_C(0x045d0e54f41f43d0), UINT64_C(0xc23a1c26abcac7b1),
+        UINT64_C(0x5b16fc84e952397d), UINT64_C(0x9d71eef6b687bd1c), UINT64_C(0xd7d9d86057f830be),
+        UINT64_C(0x11beca12082db4df), UINT64_C(0xc697bbe3bfa8f269), UINT64_C(0x00f0a991e07d7608),
+        UINT64_C(0x4a589f070102fbaa), UINT64_C(0x8c3f8d755ed77fcb), UINT64_C(0x6115734a45a6ae54),
+        UINT64_C(0xa77261381a732a35), UINT64_C(0xedda57aefb0ca797), UINT64_C(0x2bbd45dca4d923f6),
+        UINT64_C(0xfc94342d135c6540), UINT64_C(0x3af3265f4c89e121), UINT64_C(0x705b10c9adf66c83),
+        UINT64_C(0xb63c02bbf223e8e2), UINT64_C(0xc71cde2303694988), UINT64_C(0x017bcc515cbccde9),
+        UINT64_C(0x4bd3fac7bdc3404b), UINT64_C(0x8db4e8b5e216c42a), UINT64_C(0x5a9d99445593829c),
+        UINT64_C(0x9cfa8b360a4606fd), UINT64_C(0xd652bda0eb398b5f), UINT64_C(0x1035afd2b4ec0f3e),
+        UINT64_C(0xfd1f51edaf9ddea1), UINT64_C(0x3b78439ff0485ac0), UINT64_C(0x71d075091137d762),
+        UINT64_C(0xb7b7677b4ee25303), UINT64_C(0x609e168af96715b5), UINT64_C(0xa6f904f8a6b291d4),
+        UINT64_C(0xec51326e47cd1c76), UINT64_C(0x2a36201c18189817), UINT64_C(0xb31ac0be5a8066db),
+        UINT64_C(0x757dd2cc0555e2ba), UINT64_C(0x3fd5e45ae42a6f18), UINT64_C(0xf9b2f628bbffeb79),
+        UINT64_C(0x2e9b87d90c7aadcf), UINT64_C(0xe8fc95ab53af29ae), UINT64_C(0xa254a33db2d0a40c),
+        UINT64_C(0x6433b14fed05206d), UINT64_C(0x89194f70f674f1f2), UINT64_C(0x4f7e5d02a9a17593),
+        UINT64_C(0x05d66b9448def831), UINT64_C(0xc3b179e6170b7c50), UINT64_C(0x14980817a08e3ae6),
+        UINT64_C(0xd2ff1a65ff5bbe87), UINT64_C(0x98572cf31e243325), UINT64_C(0x5e303e8141f1b744),
+        UINT64_C(0x7a1794c2fdb171f0), UINT64_C(0xbc7086b0a264f591), UINT64_C(0xf6d8b026431b7833),
+        UINT64_C(0x30bfa2541ccefc52), UINT64_C(0xe796d3a5ab4bbae4), UINT64_C(0x21f1c1d7f49e3e85),
+        UINT64_C(0x6b59f74115e1b327), UINT64_C(0xad3ee5334a343746), UINT64_C(0x40141b0c5145e6d9),
+        UINT64_C(0x8673097e0e9062b8), UINT64_C(0xccdb3fe8efefef1a), UINT64_C(0x0abc2d9ab03a6b7b),
+        UINT64_C(0xdd955c6b07bf2dcd), UINT64_C(0x1bf24e19586aa9ac), UINT64_C(0x515a788fb915240e),
+        UINT64_C(0x973d6afde6c0a06f), UINT64_C(0x0e118a5fa4585ea3), UINT64_C(0xc876982dfb8ddac2),
+        UINT64_C(0x82deaebb1af25760), UINT64_C(0x44b9bcc94527d301), UINT64_C(0x9390cd38f2a295b7),
+        UINT64_C(0x55f7df4aad7711d6), UINT64_C(0x1f5fe9dc4c089c74), UINT64_C(0xd938fbae13dd1815),
+        UINT64_C(0x3412059108acc98a), UINT64_C(0xf27517e357794deb), UINT64_C(0xb8dd2175b606c049),
+        UINT64_C(0x7eba3307e9d34428), UINT64_C(0xa99342f65e56029e), UINT64_C(0x6ff45084018386ff),
+        UINT64_C(0x255c6612e0fc0b5d), UINT64_C(0xe33b7460bf298f3c), UINT64_C(0x921ba8f84e632e56),
+        UINT64_C(0x547cba8a11b6aa37), UINT64_C(0x1ed48c1cf0c92795), UINT64_C(0xd8b39e6eaf1ca3f4),
+        UINT64_C(0x0f9aef9f1899e542), UINT64_C(0xc9fdfded474c6123), UINT64_C(0x8355cb7ba633ec81),
+        UINT64_C(0x4532d909f9e668e0), UINT64_C(0xa8182736e297b97f), UINT64_C(0x6e7f3544bd423d1e),
+        UINT64_C(0x24d703d25c3db0bc), UINT64_C(0xe2b011a003e834dd), UINT64_C(0x35996051b46d726b),
+        UINT64_C(0xf3fe7223ebb8f60a), UINT64_C(0xb95644b50ac77ba8), UINT64_C(0x7f3156c75512ffc9),
+        UINT64_C(0xe61db665178a0105), UINT64_C(0x207aa417485f8564), UINT64_C(0x6ad29281a92008c6),
+        UINT64_C(0xacb580f3f6f58ca7), UINT64_C(0x7b9cf1024170ca11), UINT64_C(0xbdfbe3701ea54e70),
+        UINT64_C(0xf753d5e6ffdac3d2), UINT64_C(0x3134c794a00f47b3), UINT64_C(0xdc1e39abbb7e962c),
+        UINT64_C(0x1a792bd9e4ab124d), UINT64_C(0x50d11d4f05d49fef), UINT64_C(0x96b60f3d5a011b8e),
+        UINT64_C(0x419f7ecced845d38), UINT64_C(0x87f86cbeb251d959), UINT64_C(0xcd505a28532e54fb),
+        UINT64_C(0x0b37485a0cfbd09a)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0xec64f934590def22), UINT64_C(0xd8c9f269b21ade45),
+        UINT64_C(0x34ad0b5deb173167), UINT64_C(0xb093e5d36435bc8b), UINT64_C(0x5cf71ce73d3853a9),
+        UINT64_C(0x685a17bad62f62ce), UINT64_C(0x843eee8e8f228dec), UINT64_C(0xe539c508e2c5a085),
+        UINT64_C(0x095d3c3cbbc84fa7), UINT64_C(0x3df0376150df7ec0), UINT64_C(0xd194ce5509d291e2),
+        UINT64_C(0x55aa20db86f01c0e), UINT64_C(0xb9ced9efdffdf32c), UINT64_C(0x8d63d2b234eac24b),
+        UINT64_C(0x61072b866de72d69), UINT64_C(0x4f6d84beef249999), UINT64_C(0xa3097d8ab62976bb),
+        UINT64_C(0x97a476d75d3e47dc), UINT64_C(0x7bc08fe30433a8fe), UINT64_C(0xfffe616d8b112512),
+        UINT64_C(0x139a9859d21cca30), UINT64_C(0x27379304390bfb57), UINT64_C(0xcb536a3060061475),
+        UINT64_C(0xaa5441b60de1391c), UINT64_C(0x4630b88254ecd63e), UINT64_C(0x729db3dfbffbe759),
+        UINT64_C(0x9ef94aebe6f6087b), UINT64_C(0x1ac7a46569d48597), UINT64_C(0xf6a35d5130d96ab5),
+        UINT64_C(0xc20e560cdbce5bd2), UINT64_C(0x2e6aaf3882c3b4f0), UINT64_C(0x1bc406d2f4e6eaa1),
+        UINT64_C(0xf7a0ffe6adeb0583), UINT64_C(0xc30df4bb46fc34e4), UINT64_C(0x2f690d8f1ff1dbc6),
+        UINT64_C(0xab57e30190d3562a), UINT64_C(0x47331a35c9deb908), UINT64_C(0x739e116822c9886f),
+        UINT64_C(0x9ffae85c7bc4674d), UINT64_C(0xfefdc3da16234a24), UINT64_C(0x12993aee4f2ea506),
+        UINT64_C(0x263431b3a4399461), UINT64_C(0xca50c887fd347b43), UINT64_C(0x4e6e26097216f6af),
+        UINT64_C(0xa20adf3d2b1b198d), UINT64_C(0x96a7d460c00c28ea), UINT64_C(0x7ac32d549901c7c8),
+        UINT64_C(0x54a9826c1bc27338), UINT64_C(0xb8cd7b5842cf9c1a), UINT64_C(0x8c607005a9d8ad7d),
+        UINT64_C(0x60048931f0d5425f), UINT64_C(0xe43a67bf7ff7cfb3), UINT64_C(0x085e9e8b26fa2091),
+        UINT64_C(0x3cf395d6cded11f6), UINT64_C(0xd0976ce294e0fed4), UINT64_C(0xb1904764f907d3bd),
+        UINT64_C(0x5df4be50a00a3c9f), UINT64_C(0x6959b50d4b1d0df8), UINT64_C(0x853d4c391210e2da),
+        UINT64_C(0x0103a2b79d326f36), UINT64_C(0xed675b83c43f8014), UINT64_C(0xd9ca50de2f28b173),
+        UINT64_C(0x35aea9ea76255e51), UINT64_C(0xb396030bc2620dd1), UINT64_C(0x5ff2fa3f9b6fe2f3),
+        UINT64_C(0x6b5ff1627078d394), UINT64_C(0x873b085629753cb6), UINT64_C(0x0305e6d8a657b15a),
+        UINT64_C(0xef611fecff5a5e78), UINT64_C(0xdbcc14b1144d6f1f), UINT64_C(0x37a8ed854d40803d),
+        UINT64_C(0x56afc60320a7ad54), UINT64_C(0xbacb3f3779aa4276), UINT64_C(0x8e66346a92bd7311),
+        UINT64_C(0x6202cd5ecbb09c33), UINT64_C(0xe63c23d0449211df), UINT64_C(0x0a58dae41d9ffefd),
+        UINT64_C(0x3ef5d1b9f688cf9a), UINT64_C(0xd291288daf8520b8), UINT64_C(0xfcfb87b52d469448),
+        UINT64_C(0x109f7e81744b7b6a), UINT64_C(0x243275dc9f5c4a0d), UINT64_C(0xc8568ce8c651a52f),
+        UINT64_C(0x4c686266497328c3), UINT64_C(0xa00c9b52107ec7e1), UINT64_C(0x94a1900ffb69f686),
+        UINT64_C(0x78c5693ba26419a4), UINT64_C(0x19c242bdcf8334cd), UINT64_C(0xf5a6bb89968edbef),
+        UINT64_C(0xc10bb0d47d99ea88), UINT64_C(0x2d6f49e0249405aa), UINT64_C(0xa951a76eabb68846),
+        UINT64_C(0x45355e5af2bb6764), UINT64_C(0x7198550719ac5603), UINT64_C(0x9dfcac3340a1b921),
+        UINT64_C(0xa85205d93684e770), UINT64_C(0x4436fced6f890852), UINT64_C(0x709bf7b0849e3935),
+        UINT64_C(0x9cff0e84dd93d617), UINT64_C(0x18c1e00a52b15bfb), UINT64_C(0xf4a5193e0bbcb4d9),
+        UINT64_C(0xc0081263e0ab85be), UINT64_C(0x2c6ceb57b9a66a9c), UINT64_C(0x4d6bc0d1d44147f5),
+        UINT64_C(0xa10f39e58d4ca8d7), UINT64_C(0x95a232b8665b99b0), UINT64_C(0x79c6cb8c3f567692),
+        UINT64_C(0xfdf82502b074fb7e), UINT64_C(0x119cdc36e979145c), UINT64_C(0x2531d76b026e253b),
+        UINT64_C(0xc9552e5f5b63ca19), UINT64_C(0xe73f8167d9a07ee9), UINT64_C(0x0b5b785380ad91cb),
+        UINT64_C(0x3ff6730e6bbaa0ac), UINT64_C(0xd3928a3a32b74f8e), UINT64_C(0x57ac64b4bd95c262),
+        UINT64_C(0xbbc89d80e4982d40), UINT64_C(0x8f6596dd0f8f1c27), UINT64_C(0x63016fe95682f305),
+        UINT64_C(0x0206446f3b65de6c), UINT64_C(0xee62bd5b6268314e), UINT64_C(0xdacfb606897f0029),
+        UINT64_C(0x36ab4f32d072ef0b), UINT64_C(0xb295a1bc5f5062e7), UINT64_C(0x5ef15888065d8dc5),
+        UINT64_C(0x6a5c53d5ed4abca2), UINT64_C(0x8638aae1b4475380), UINT64_C(0xe33309b9af6ac230),
+        UINT64_C(0x0f57f08df6672d12), UINT64_C(0x3bfafbd01d701c75), UINT64_C(0xd79e02e4447df357),
+        UINT64_C(0x53a0ec6acb5f7ebb), UINT64_C(0xbfc4155e92529199), UINT64_C(0x8b691e037945a0fe),
+        UINT64_C(0x670de73720484fdc), UINT64_C(0x060accb14daf62b5), UINT64_C(0xea6e358514a28d97),
+        UINT64_C(0xdec33ed8ffb5bcf0), UINT64_C(0x32a7c7eca6b853d2), UINT64_C(0xb6992962299ade3e),
+        UINT64_C(0x5afdd0567097311c), UINT64_C(0x6e50db0b9b80007b), UINT64_C(0x8234223fc28def59),
+        UINT64_C(0xac5e8d07404e5ba9), UINT64_C(0x403a74331943b48b), UINT64_C(0x74977f6ef25485ec),
+        UINT64_C(0x98f3865aab596ace), UINT64_C(0x1ccd68d4247be722), UINT64_C(0xf0a991e07d760800),
+        UINT64_C(0xc4049abd96613967), UINT64_C(0x28606389cf6cd645), UINT64_C(0x4967480fa28bfb2c),
+        UINT64_C(0xa503b13bfb86140e), UINT64_C(0x91aeba6610912569), UINT64_C(0x7dca4352499cca4b),
+        UINT64_C(0xf9f4addcc6be47a7), UINT64_C(0x159054e89fb3a885), UINT64_C(0x213d5fb574a499e2),
+        UINT64_C(0xcd59a6812da976c0), UINT64_C(0xf8f70f6b5b8c2891), UINT64_C(0x1493f65f0281c7b3),
+        UINT64_C(0x203efd02e996f6d4), UINT64_C(0xcc5a0436b09b19f6), UINT64_C(0x4864eab83fb9941a),
+        UINT64_C(0xa400138c66b47b38), UINT64_C(0x90ad18d18da34a5f), UINT64_C(0x7cc9e1e5d4aea57d),
+        UINT64_C(0x1dceca63b9498814), UINT64_C(0xf1aa3357e0446736), UINT64_C(0xc507380a0b535651),
+        UINT64_C(0x2963c13e525eb973), UINT64_C(0xad5d2fb0dd7c349f), UINT64_C(0x4139d6848471dbbd),
+        UINT64_C(0x7594ddd96f66eada), UINT64_C(0x99f024ed366b05f8), UINT64_C(0xb79a8bd5b4a8b108),
+        UINT64_C(0x5bfe72e1eda55e2a), UINT64_C(0x6f5379bc06b26f4d), UINT64_C(0x833780885fbf806f),
+        UINT64_C(0x07096e06d09d0d83), UINT64_C(0xeb6d97328990e2a1), UINT64_C(0xdfc09c6f6287d3c6),
+        UINT64_C(0x33a4655b3b8a3ce4), UINT64_C(0x52a34edd566d118d), UINT64_C(0xbec7b7e90f60feaf),
+        UINT64_C(0x8a6abcb4e477cfc8), UINT64_C(0x660e4580bd7a20ea), UINT64_C(0xe230ab0e3258ad06),
+        UINT64_C(0x0e54523a6b554224), UINT64_C(0x3af9596780427343), UINT64_C(0xd69da053d94f9c61),
+        UINT64_C(0x50a50ab26d08cfe1), UINT64_C(0xbcc1f386340520c3), UINT64_C(0x886cf8dbdf1211a4),
+        UINT64_C(0x640801ef861ffe86), UINT64_C(0xe036ef61093d736a), UINT64_C(0x0c52165550309c48),
+        UINT64_C(0x38ff1d08bb27ad2f), UINT64_C(0xd49be43ce22a420d), UINT64_C(0xb59ccfba8fcd6f64),
+        UINT64_C(0x59f8368ed6c08046), UINT64_C(0x6d553dd33dd7b121), UINT64_C(0x8131c4e764da5e03),
+        UINT64_C(0x050f2a69ebf8d3ef), UINT64_C(0xe96bd35db2f53ccd), UINT64_C(0xddc6d80059e20daa),
+        UINT64_C(0x31a2213400efe288), UINT64_C(0x1fc88e0c822c5678), UINT64_C(0xf3ac7738db21b95a),
+        UINT64_C(0xc7017c653036883d), UINT64_C(0x2b658551693b671f), UINT64_C(0xaf5b6bdfe619eaf3),
+        UINT64_C(0x433f92ebbf1405d1), UINT64_C(0x779299b6540334b6), UINT64_C(0x9bf660820d0edb94),
+        UINT64_C(0xfaf14b0460e9f6fd), UINT64_C(0x1695b23039e419df), UINT64_C(0x2238b96dd2f328b8),
+        UINT64_C(0xce5c40598bfec79a), UINT64_C(0x4a62aed704dc4a76), UINT64_C(0xa60657e35dd1a554),
+        UINT64_C(0x92ab5cbeb6c69433), UINT64_C(0x7ecfa58aefcb7b11), UINT64_C(0x4b610c6099ee2540),
+        UINT64_C(0xa705f554c0e3ca62), UINT64_C(0x93a8fe092bf4fb05), UINT64_C(0x7fcc073d72f91427),
+        UINT64_C(0xfbf2e9b3fddb99cb), UINT64_C(0x17961087a4d676e9), UINT64_C(0x233b1bda4fc1478e),
+        UINT64_C(0xcf5fe2ee16cca8ac), UINT64_C(0xae58c9687b2b85c5), UINT64_C(0x423c305c22266ae7),
+        UINT64_C(0x76913b01c9315b80), UINT64_C(0x9af5c235903cb4a2), UINT64_C(0x1ecb2cbb1f1e394e),
+        UINT64_C(0xf2afd58f4613d66c), UINT64_C(0xc602ded2ad04e70b), UINT64_C(0x2a6627e6f4090829),
+        UINT64_C(0x040c88de76cabcd9), UINT64_C(0xe86871ea2fc753fb), UINT64_C(0xdcc57ab7c4d0629c),
+        UINT64_C(0x30a183839ddd8dbe), UINT64_C(0xb49f6d0d12ff0052), UINT64_C(0x58fb94394bf2ef70),
+        UINT64_C(0x6c569f64a0e5de17), UINT64_C(0x80326650f9e83135), UINT64_C(0xe1354dd6940f1c5c),
+        UINT64_C(0x0d51b4e2cd02f37e), UINT64_C(0x39fcbfbf2615c219), UINT64_C(0xd598468b7f182d3b),
+        UINT64_C(0x51a6a805f03aa0d7), UINT64_C(0xbdc25131a9374ff5), UINT64_C(0x896f5a6c42207e92),
+        UINT64_C(0x650ba3581b2d91b0)
+    },
+    {
+        UINT64_C(0x0000000000000000), UINT64_C(0x405f87c7af95beda), UINT64_C(0x05a000207484a527),
+        UINT64_C(0x45ff87e7db111bfd), UINT64_C(0x0a400140e8084b4f), UINT64_C(0x4a1f8687479df595),
+        UINT64_C(0x0fe001609c8cee68), UINT64_C(0x4fbf86a7331950b2), UINT64_C(0x14800280d011969e),
+        UINT64_C(0x54df85477f842844), UINT64_C(0x112002a0a49533b9), UINT64_C(0x517f85670b008d63),
+        UINT64_C(0x1ec003c03819ddd1), UINT64_C(0x5e9f8407978c630b), UINT64_C(0x1b6003e04c9d78f6),
+        UINT64_C(0x5b3f8427e308c62c), UINT64_C(0xad1e0baf8a8cf4af), UINT64_C(0xed418c6825194a75),
+        UINT64_C(0xa8be0b8ffe085188), UINT64_C(0xe8e18c48519def52), UINT64_C(0xa75e0aef6284bfe0),
+        UINT64_C(0xe7018d28cd11013a), UINT64_C(0xa2fe0acf16001ac7), UINT64_C(0xe2a18d08b995a41d),
+        UINT64_C(0xb99e092f5a9d6231), UINT64_C(0xf9c18ee8f508dceb), UINT64_C(0xbc3e090f2e19c716),
+        UINT64_C(0xfc618ec8818c79cc), UINT64_C(0xb3de086fb295297e), UINT64_C(0xf3818fa81d0097a4),
+        UINT64_C(0xb67e084fc6118c59), UINT64_C(0xf6218f8869843283), UINT64_C(0xdf2318f13eb631cd),
+        UINT64_C(0x9f7c9f3691238f17), UINT64_C(0xda8318d14a3294ea), UINT64_C(0x9adc9f16e5a72a30),
+        UINT64_C(0xd56319b1d6be7a82), UINT64_C(0x953c9e76792bc458), UINT64_C(0xd0c31991a23adfa5),
+        UINT64_C(0x909c9e560daf617f), UINT64_C(0xcba31a71eea7a753), UINT64_C(0x8bfc9db641321989),
+        UINT64_C(0xce031a519a230274), UINT64_C(0x8e5c9d9635b6bcae), UINT64_C(0xc1e31b3106afec1c),
+        UINT64_C(0x81bc9cf6a93a52c6), UINT64_C(0xc4431b11722b493b), UINT64_C(0x841c9cd6ddbef7e1),
+        UINT64_C(0x723d135eb43ac562), UINT64_C(0x326294991baf7bb8), UINT64_C(0x779d137ec0be6045),
+        UINT64_C(0x37c294b96f2bde9f), UINT64_C(0x787d121e5c328e2d), UINT64_C(0x382295d9f3a730f7),
+        UINT64_C(0x7ddd123e28b62b0a), UINT64_C(0x3d8295f9872395d0), UINT64_C(0x66bd11de642b53fc),
+        UINT64_C(0x26e29619cbbeed26), UINT64_C(0x631d11fe10aff6db), UINT64_C(0x23429639bf3a4801),
+        UINT64_C(0x6cfd109e8c2318b3), UINT64_C(0x2ca2975923b6a669), UINT64_C(0x695d10bef8a7bd94),
+        UINT64_C(0x290297795732034e), UINT64_C(0x3b593e4d56c3bb08), UINT64_C(0x7b06b98af95605d2),
+        UINT64_C(0x3ef93e6d22471e2f), UINT64_C(0x7ea6b9aa8dd2a0f5), UINT64_C(0x31193f0dbecbf047),
+        UINT64_C(0x7146b8ca115e4e9d), UINT64_C(0x34b93f2dca4f5560), UINT64_C(0x74e6b8ea65daebba),
+        UINT64_C(0x2fd93ccd86d22d96), UINT64_C(0x6f86bb0a2947934c), UINT64_C(0x2a793cedf25688b1),
+        UINT64_C(0x6a26bb2a5dc3366b), UINT64_C(0x25993d8d6eda66d9), UINT64_C(0x65c6ba4ac14fd803),
+        UINT64_C(0x20393dad1a5ec3fe), UINT64_C(0x6066ba6ab5cb7d24), UINT64_C(0x964735e2dc4f4fa7),
+        UINT64_C(0xd618b22573daf17d), UINT64_C(0x93e735c2a8cbea80), UINT64_C(0xd3b8b205075e545a),
+        UINT64_C(0x9c0734a2344704e8), UINT64_C(0xdc58b3659bd2ba32), UINT64_C(0x99a7348240c3a1cf),
+        UINT64_C(0xd9f8b345ef561f15), UINT64_C(0x82c737620c5ed939), UINT64_C(0xc298b0a5a3cb67e3),
+        UINT64_C(0x8767374278da7c1e), UINT64_C(0xc738b085d74fc2c4), UINT64_C(0x88873622e4569276),
+        UINT64_C(0xc8d8b1e54bc32cac), UINT64_C(0x8d27360290d23751), UINT64_C(0xcd78b1c53f47898b),
+        UINT64_C(0xe47a26bc68758ac5), UINT64_C(0xa425a17bc7e0341f), UINT64_C(0xe1da269c1cf12fe2),
+        UINT64_C(0xa185a15bb3649138), UINT64_C(0xee3a27fc807dc18a), UINT64_C(0xae65a03b2fe87f50),
+        UINT64_C(0xeb9a27dcf4f964ad), UINT64_C(0xabc5a01b5b6cda77), UINT64_C(0xf0fa243cb8641c5b),
+        UINT64_C(0xb0a5a3fb17f1a281), UINT64_C(0xf55a241ccce0b97c), UINT64_C(0xb505a3db637507a6),
+        UINT64_C(0xfaba257c506c5714), UINT64_C(0xbae5a2bbfff9e9ce), UINT64_C(0xff1a255c24e8f233),
+        UINT64_C(0xbf45a29b8b7d4ce9), UINT64_C(0x49642d13e2f97e6a), UINT64_C(0x093baad44d6cc0b0),
+        UINT64_C(0x4cc42d33967ddb4d), UINT64_C(0x0c9baaf439e86597), UINT64_C(0x43242c530af13525),
+        UINT64_C(0x037bab94a5648bff), UINT64_C(0x46842c737e759002), UINT64_C(0x06dbabb4d1e02ed8),
+        UINT64_C(0x5de42f9332e8e8f4), UINT64_C(0x1dbba8549d7d562e), UINT64_C(0x58442fb3466c4dd3),
+        UINT64_C(0x181ba874e9f9f309), UINT64_C(0x57a42ed3dae0a3bb), UINT64_C(0x17fba91475751d61),
+        UINT64_C(0x52042ef3ae64069c), UINT64_C(0x125ba93401f1b846), UINT64_C(0x76b27c9aac867711),
+        UINT64_C(0x36edfb5d0313c9cb), UINT64_C(0x73127cbad802d236), UINT64_C(0x334dfb7d77976cec),
+        UINT64_C(0x7cf27dda448e3c5e), UINT64_C(0x3cadfa1deb1b8284), UINT64_C(0x79527dfa300a9979),
+        UINT64_C(0x390dfa3d9f9f27a3), UINT64_C(0x62327e1a7c97e18f), UINT64_C(0x226df9ddd3025f55),
+        UINT64_C(0x67927e3a081344a8), UINT64_C(0x27cdf9fda786fa72), UINT64_C(0x68727f5a949faac0),
+        UINT64_C(0x282df89d3b0a141a), UINT64_C(0x6dd27f7ae01b0fe7), UINT64_C(0x2d8df8bd4f8eb13d),
+        UINT64_C(0xdbac7735260a83be), UINT64_C(0x9bf3f0f2899f3d64), UINT64_C(0xde0c7715528e2699),
+        UINT64_C(0x9e53f0d2fd1b9843), UINT64_C(0xd1ec7675ce02c8f1), UINT64_C(0x91b3f1b26197762b),
+        UINT64_C(0xd44c7655ba866dd6), UINT64_C(0x9413f1921513d30c), UINT64_C(0xcf2c75b5f61b1520),
+        UINT64_C(0x8f73f272598eabfa), UINT64_C(0xca8c7595829fb007), UINT64_C(0x8ad3f2522d0a0edd),
+        UINT64_C(0xc56c74f51e135e6f), UINT64_C(0x8533f332b186e0b5), UINT64_C(0xc0cc74d56a97fb48),
+        UINT64_C(0x8093f312c5024592), UINT64_C(0xa991646b923046dc), UINT64_C(0xe9cee3ac3da5f806),
+        UINT64_C(0xac31644be6b4e3fb), UINT64_C(0xec6ee38c49215d21), UINT64_C(0xa3d1652b7a380d93),
+        UINT64_C(0xe38ee2ecd5adb349), UINT64_C(0xa671650b0ebca8b4), UINT64_C(0xe62ee2cca129166e),
+        UINT64_C(0xbd1166eb4221d042), UINT64_C(0xfd4ee12cedb46e98), UINT64_C(0xb8b166cb36a57565),
+        UINT64_C(0xf8eee10c9930cbbf), UINT64_C(0xb75167abaa299b0d), UINT64_C(0xf70ee06c05bc25d7),
+        UINT64_C(0xb2f1678bdead3e2a), UINT64_C(0xf2aee04c713880f0), UINT64_C(0x048f6fc418bcb273),
+        UINT64_C(0x44d0e803b7290ca9), UINT64_C(0x012f6fe46c381754), UINT64_C(0x4170e823c3ada98e),
+        UINT64_C(0x0ecf6e84f0b4f93c), UINT64_C(0x4e90e9435f2147e6), UINT64_C(0x0b6f6ea484305c1b),
+        UINT64_C(0x4b30e9632ba5e2c1), UINT64_C(0x100f6d44c8ad24ed), UINT64_C(0x5050ea8367389a37),
+        UINT64_C(0x15af6d64bc2981ca), UINT64_C(0x55f0eaa313bc3f10), UINT64_C(0x1a4f6c0420a56fa2),
+        UINT64_C(0x5a10ebc38f30d178), UINT64_C(0x1fef6c245421ca85), UINT64_C(0x5fb0ebe3fbb4745f),
+        UINT64_C(0x4deb42d7fa45cc19), UINT64_C(0x0db4c51055d072c3), UINT64_C(0x484b42f78ec1693e),
+        UINT64_C(0x0814c5302154d7e4), UINT64_C(0x47ab4397124d8756), UINT64_C(0x07f4c450bdd8398c),
+        UINT64_C(0x420b43b766c92271), UINT64_C(0x0254c470c95c9cab), UINT64_C(0x596b40572a545a87),
+        UINT64_C(0x1934c79085c1e45d), UINT64_C(0x5ccb40775ed0ffa0), UINT64_C(0x1c94c7b0f145417a),
+        UINT64_C(0x532b4117c25c11c8), UINT64_C(0x1374c6d06dc9af12), UINT64_C(0x568b4137b6d8b4ef),
+        UINT64_C(0x16d4c6f0194d0a35), UINT64_C(0xe0f5497870c938b6), UINT64_C(0xa0aacebfdf5c866c),
+        UINT64_C(0xe5554958044d9d91), UINT64_C(0xa50ace9fabd8234b), UINT64_C(0xeab5483898c173f9),
+        UINT64_C(0xaaeacfff3754cd23), UINT64_C(0xef154818ec45d6de), UINT64_C(0xaf4acfdf43d06804),
+        UINT64_C(0xf4754bf8a0d8ae28), UINT64_C(0xb42acc3f0f4d10f2), UINT64_C(0xf1d54bd8d45c0b0f),
+        UINT64_C(0xb18acc1f7bc9b5d5), UINT64_C(0xfe354ab848d0e567), UINT64_C(0xbe6acd7fe7455bbd),
+        UINT64_C(0xfb954a983c544040), UINT64_C(0xbbcacd5f93c1fe9a), UINT64_C(0x92c85a26c4f3fdd4),
+        UINT64_C(0xd297dde16b66430e), UINT64_C(0x97685a06b07758f3), UINT64_C(0xd737ddc11fe2e629),
+        UINT64_C(0x98885b662cfbb69b), UINT64_C(0xd8d7dca1836e0841), UINT64_C(0x9d285b46587f13bc),
+        UINT64_C(0xdd77dc81f7eaad66), UINT64_C(0x864858a614e26b4a), UINT64_C(0xc617df61bb77d590),
+        UINT64_C(0x83e858866066ce6d), UINT64_C(0xc3b7df41cff370b7), UINT64_C(0x8c0859e6fcea2005),
+        UINT64_C(0xcc57de21537f9edf), UINT64_C(0x89a859c6886e8522), UINT64_C(0xc9f7de0127fb3bf8),
+        UINT64_C(0x3fd651894e7f097b), UINT64_C(0x7f89d64ee1eab7a1), UINT64_C(0x3a7651a93afbac5c),
+        UINT64_C(0x7a29d66e956e1286), UINT64_C(0x359650c9a6774234), UINT64_C(0x75c9d70e09e2fcee),
+        UINT64_C(0x303650e9d2f3e713), UINT64_C(0x7069d72e7d6659c9), UINT64_C(0x2b5653099e6e9fe5),
+        UINT64_C(0x6b09d4ce31fb213f), UINT64_C(0x2ef65329eaea3ac2), UINT64_C(0x6ea9d4ee457f8418),
+        UINT64_C(0x211652497666d4aa), UINT64_C(0x6149d58ed9f36a70), UINT64_C(0x24b6526902e2718d),
+        UINT64_C(0x64e9d5aead77cf57)
+    }
+};
+
+#endif
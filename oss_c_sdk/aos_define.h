@@ -112,6 +112,21 @@ typedef apr_array_header_t aos_array_header_t;
 #define AOS_DEFAULT_PART_SIZE 1024*1024L
 
 #define AOS_REQUEST_STACK_SIZE 32
+#define AOS_CURL_PROFILE_NUM 4
+
+#define AOS_CRC64_CHUNK_SIZE (128*1024)
+#define AOS_CRC64_CHUNK_NUM 4
+#define AOS_CRC64_THREAD_NUM 4
+
+#define AOS_MEMORY_BUDGET_UNIT (256*1024)
+
+#define AOS_HMAC_KEY_CACHE_NUM 4
+
+#if defined(_MSC_VER)
+#define AOS_THREAD_LOCAL __declspec(thread)
+#else
+#define AOS_THREAD_LOCAL __thread
+#endif
 
 #define aos_abs(value)       (((value) >= 0) ? (value) : - (value))
 #define aos_max(val1, val2)  (((val1) < (val2)) ? (val2) : (val1))
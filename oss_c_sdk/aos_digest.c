@@ -0,0 +1,568 @@
+#include "aos_digest.h"
+#include "aos_log.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#  define DIGEST_X86
+#  include <emmintrin.h>
+#  include <tmmintrin.h>
+#  include <smmintrin.h>
+#  include <immintrin.h>
+#  ifdef _MSC_VER
+#    include <intrin.h>
+#    define SHA1_NI_TARGET
+#  else
+#    include <cpuid.h>
+#    define SHA1_NI_TARGET __attribute__((target("sha,ssse3,sse4.1")))
+#  endif
+#endif
+
+#define SHA1_KERNEL_UNKNOWN -1
+#define SHA1_KERNEL_APR 0
+#define SHA1_KERNEL_NI 1
+
+/* apr_sha1_update takes an unsigned int length */
+#define SHA1_APR_MAX_UPDATE (1 << 30)
+
+#ifdef DIGEST_X86
+
+/* Check SHA, SSSE3 and SSE4.1, the SHA extensions need all three. */
+static int sha1_ni_supported(void)
+{
+#ifdef _MSC_VER
+    int info[4];
+    int ecx;
+
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return 0;
+    __cpuid(info, 1);
+    ecx = info[2];
+    if ((ecx & (1 << 9)) == 0 || (ecx & (1 << 19)) == 0)
+        return 0;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 29)) != 0;
+#else
+    unsigned int eax, ebx, ecx, edx;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        return 0;
+    if ((ecx & bit_SSSE3) == 0 || (ecx & bit_SSE4_1) == 0)
+        return 0;
+    if (__get_cpuid_max(0, NULL) < 7)
+        return 0;
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    return (ebx & (1 << 29)) != 0;
+#endif
+}
+
+/* Four rounds of group g (0 < g < 20) with function f, w is the ring of the
+   last four message schedule groups. */
+#define SHA1_NI_ROUNDS(g, f) \
+    do { \
+        if ((g) >= 4) \
+            w[(g) & 3] = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(w[(g) & 3], \
+                         w[((g) + 1) & 3]), w[((g) + 2) & 3]), w[((g) + 3) & 3]); \
+        e = _mm_sha1nexte_epu32(prev, w[(g) & 3]); \
+        prev = abcd; \
+        abcd = _mm_sha1rnds4_epu32(abcd, e, f); \
+    } while (0)
+
+SHA1_NI_TARGET
+static void sha1_ni_blocks(uint32_t state[5], const unsigned char *data, apr_size_t blocks)
+{
+    __m128i abcd, abcd_save, e, e_save, prev;
+    __m128i w[4];
+    const __m128i mask = _mm_set_epi64x(0x0001020304050607LL, 0x08090a0b0c0d0e0fLL);
+
+    abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)state), 0x1B);
+    e_save = _mm_set_epi32((int)state[4], 0, 0, 0);
+
+    while (blocks--) {
+        abcd_save = abcd;
+        w[0] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)data), mask);
+        w[1] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16)), mask);
+        w[2] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 32)), mask);
+        w[3] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 48)), mask);
+
+        e = _mm_add_epi32(e_save, w[0]);
+        prev = abcd;
+        abcd = _mm_sha1rnds4_epu32(abcd, e, 0);
+        SHA1_NI_ROUNDS(1, 0);
+        SHA1_NI_ROUNDS(2, 0);
+        SHA1_NI_ROUNDS(3, 0);
+        SHA1_NI_ROUNDS(4, 0);
+        SHA1_NI_ROUNDS(5, 1);
+        SHA1_NI_ROUNDS(6, 1);
+        SHA1_NI_ROUNDS(7, 1);
+        SHA1_NI_ROUNDS(8, 1);
+        SHA1_NI_ROUNDS(9, 1);
+        SHA1_NI_ROUNDS(10, 2);
+        SHA1_NI_ROUNDS(11, 2);
+        SHA1_NI_ROUNDS(12, 2);
+        SHA1_NI_ROUNDS(13, 2);
+        SHA1_NI_ROUNDS(14, 2);
+        SHA1_NI_ROUNDS(15, 3);
+        SHA1_NI_ROUNDS(16, 3);
+        SHA1_NI_ROUNDS(17, 3);
+        SHA1_NI_ROUNDS(18, 3);
+        SHA1_NI_ROUNDS(19, 3);
+
+        e_save = _mm_sha1nexte_epu32(prev, e_save);
+        abcd = _mm_add_epi32(abcd, abcd_save);
+        data += 64;
+    }
+
+    _mm_storeu_si128((__m128i *)state, _mm_shuffle_epi32(abcd, 0x1B));
+    state[4] = (uint32_t)_mm_extract_epi32(e_save, 3);
+}
+
+#endif
+
+/* SHA1_KERNEL_UNKNOWN until the first update, sha1_select always picks the same kernel. */
+static volatile int sha1_kernel = SHA1_KERNEL_UNKNOWN;
+
+static int sha1_select(void)
+{
+#ifdef DIGEST_X86
+    if (sha1_ni_supported()) {
+        sha1_kernel = SHA1_KERNEL_NI;
+        return sha1_kernel;
+    }
+#endif
+    sha1_kernel = SHA1_KERNEL_APR;
+    return sha1_kernel;
+}
+
+static int sha1_get_kernel(void)
+{
+    int kernel = sha1_kernel;
+
+    if (kernel == SHA1_KERNEL_UNKNOWN)
+        kernel = sha1_select();
+    return kernel;
+}
+
+const char *aos_sha1_kernel(void)
+{
+    return sha1_get_kernel() == SHA1_KERNEL_NI ? "sha-ni" : "apr";
+}
+
+void aos_sha1_init(aos_sha1_ctx_t *ctx)
+{
+    if (sha1_get_kernel() == SHA1_KERNEL_APR) {
+        apr_sha1_init(&ctx->apr);
+        return;
+    }
+    ctx->state[0] = 0x67452301;
+    ctx->state[1] = 0xefcdab89;
+    ctx->state[2] = 0x98badcfe;
+    ctx->state[3] = 0x10325476;
+    ctx->state[4] = 0xc3d2e1f0;
+    ctx->len = 0;
+}
+
+void aos_sha1_update(aos_sha1_ctx_t *ctx, const void *data, apr_size_t len)
+{
+    const unsigned char *p = (const unsigned char *)data;
+    apr_size_t used;
+    apr_size_t n;
+
+    if (sha1_get_kernel() == SHA1_KERNEL_APR) {
+        while (len > 0) {
+            n = len > SHA1_APR_MAX_UPDATE ? SHA1_APR_MAX_UPDATE : len;
+            apr_sha1_update_binary(&ctx->apr, p, (unsigned int)n);
+            p += n;
+            len -= n;
+        }
+        return;
+    }
+
+#ifdef DIGEST_X86
+    used = (apr_size_t)(ctx->len & 63);
+    ctx->len += len;
+    if (used > 0) {
+        n = 64 - used;
+        if (len < n) {
+            memcpy(ctx->buf + used, p, len);
+            return;
+        }
+        memcpy(ctx->buf + used, p, n);
+        sha1_ni_blocks(ctx->state, ctx->buf, 1);
+        p += n;
+        len -= n;
+    }
+    if (len >= 64) {
+        sha1_ni_blocks(ctx->state, p, len / 64);
+        p += len & ~(apr_size_t)63;
+        len &= 63;
+    }
+    if (len > 0) {
+        memcpy(ctx->buf, p, len);
+    }
+#else
+    (void)used;
+#endif
+}
+
+void aos_sha1_final(unsigned char digest[APR_SHA1_DIGESTSIZE], aos_sha1_ctx_t *ctx)
+{
+    unsigned char pad[72];
+    uint64_t bits;
+    apr_size_t used;
+    apr_size_t padlen;
+    int i;
+
+    if (sha1_get_kernel() == SHA1_KERNEL_APR) {
+        apr_sha1_final(digest, &ctx->apr);
+        return;
+    }
+
+    bits = ctx->len << 3;
+    used = (apr_size_t)(ctx->len & 63);
+    padlen = (used < 56 ? 56 : 120) - used;
+    memset(pad, 0, sizeof(pad));
+    pad[0] = 0x80;
+    for (i = 0; i < 8; i++) {
+        pad[padlen + i] = (unsigned char)(bits >> (56 - 8 * i));
+    }
+    aos_sha1_update(ctx, pad, padlen + 8);
+
+    for (i = 0; i < 5; i++) {
+        digest[4 * i] = (unsigned char)(ctx->state[i] >> 24);
+        digest[4 * i + 1] = (unsigned char)(ctx->state[i] >> 16);
+        digest[4 * i + 2] = (unsigned char)(ctx->state[i] >> 8);
+        digest[4 * i + 3] = (unsigned char)ctx->state[i];
+    }
+}
+
+void aos_md5_init(aos_md5_ctx_t *ctx)
+{
+    apr_md5_init(ctx);
+}
+
+void aos_md5_update(aos_md5_ctx_t *ctx, const void *data, apr_size_t len)
+{
+    apr_md5_update(ctx, data, len);
+}
+
+void aos_md5_final(unsigned char digest[APR_MD5_DIGESTSIZE], aos_md5_ctx_t *ctx)
+{
+    apr_md5_final(digest, ctx);
+}
+
+#ifdef DIGEST_X86
+
+#define MD5_X4_F(b, c, d) _mm_xor_si128(d, _mm_and_si128(b, _mm_xor_si128(c, d)))
+#define MD5_X4_G(b, c, d) _mm_xor_si128(c, _mm_and_si128(d, _mm_xor_si128(b, c)))
+#define MD5_X4_H(b, c, d) _mm_xor_si128(_mm_xor_si128(b, c), d)
+#define MD5_X4_I(b, c, d) _mm_xor_si128(c, _mm_or_si128(b, _mm_xor_si128(d, ones)))
+
+#define MD5_X4_STEP(f, a, b, c, d, x, k, s) \
+    do { \
+        a = _mm_add_epi32(a, _mm_add_epi32(MD5_X4_##f(b, c, d), \
+                          _mm_add_epi32(x, _mm_set1_epi32((int)(k))))); \
+        a = _mm_add_epi32(b, _mm_or_si128(_mm_slli_epi32(a, s), _mm_srli_epi32(a, 32 - (s)))); \
+    } while (0)
+
+/* Load one block of each lane and transpose, w[j] holds word j of the four blocks. */
+static void md5_x4_load(__m128i w[16], const unsigned char *in[4], apr_size_t off)
+{
+    __m128i r0, r1, r2, r3, t0, t1, t2, t3;
+    int q;
+
+    for (q = 0; q < 4; q++) {
+        r0 = _mm_loadu_si128((const __m128i *)(in[0] + off + 16 * q));
+        r1 = _mm_loadu_si128((const __m128i *)(in[1] + off + 16 * q));
+        r2 = _mm_loadu_si128((const __m128i *)(in[2] + off + 16 * q));
+        r3 = _mm_loadu_si128((const __m128i *)(in[3] + off + 16 * q));
+        t0 = _mm_unpacklo_epi32(r0, r1);
+        t1 = _mm_unpacklo_epi32(r2, r3);
+        t2 = _mm_unpackhi_epi32(r0, r1);
+        t3 = _mm_unpackhi_epi32(r2, r3);
+        w[4 * q] = _mm_unpacklo_epi64(t0, t1);
+        w[4 * q + 1] = _mm_unpackhi_epi64(t0, t1);
+        w[4 * q + 2] = _mm_unpacklo_epi64(t2, t3);
+        w[4 * q + 3] = _mm_unpackhi_epi64(t2, t3);
+    }
+}
+
+/* Hash blocks 64-byte blocks of in[k] into the state of ctx[k], four lanes
+   of SSE2. The byte counts are left to the caller. */
+static void md5_x4_blocks(aos_md5_ctx_t *ctx[4], const unsigned char *in[4], apr_size_t blocks)
+{
+    __m128i a, b, c, d, aa, bb, cc, dd;
+    __m128i w[16];
+    const __m128i ones = _mm_set1_epi32(-1);
+    uint32_t out[4][4];
+    apr_size_t n;
+    int k;
+
+    a = _mm_set_epi32((int)ctx[3]->state[0], (int)ctx[2]->state[0], (int)ctx[1]->state[0], (int)ctx[0]->state[0]);
+    b = _mm_set_epi32((int)ctx[3]->state[1], (int)ctx[2]->state[1], (int)ctx[1]->state[1], (int)ctx[0]->state[1]);
+    c = _mm_set_epi32((int)ctx[3]->state[2], (int)ctx[2]->state[2], (int)ctx[1]->state[2], (int)ctx[0]->state[2]);
+    d = _mm_set_epi32((int)ctx[3]->state[3], (int)ctx[2]->state[3], (int)ctx[1]->state[3], (int)ctx[0]->state[3]);
+
+    for (n = 0; n < blocks; n++) {
+        md5_x4_load(w, in, n * 64);
+        aa = a;
+        bb = b;
+        cc = c;
+        dd = d;
+
+        MD5_X4_STEP(F, a, b, c, d, w[ 0], 0xd76aa478,  7);
+        MD5_X4_STEP(F, d, a, b, c, w[ 1], 0xe8c7b756, 12);
+        MD5_X4_STEP(F, c, d, a, b, w[ 2], 0x242070db, 17);
+        MD5_X4_STEP(F, b, c, d, a, w[ 3], 0xc1bdceee, 22);
+        MD5_X4_STEP(F, a, b, c, d, w[ 4], 0xf57c0faf,  7);
+        MD5_X4_STEP(F, d, a, b, c, w[ 5], 0x4787c62a, 12);
+        MD5_X4_STEP(F, c, d, a, b, w[ 6], 0xa8304613, 17);
+        MD5_X4_STEP(F, b, c, d, a, w[ 7], 0xfd469501, 22);
+        MD5_X4_STEP(F, a, b, c, d, w[ 8], 0x698098d8,  7);
+        MD5_X4_STEP(F, d, a, b, c, w[ 9], 0x8b44f7af, 12);
+        MD5_X4_STEP(F, c, d, a, b, w[10], 0xffff5bb1, 17);
+        MD5_X4_STEP(F, b, c, d, a, w[11], 0x895cd7be, 22);
+        MD5_X4_STEP(F, a, b, c, d, w[12], 0x6b901122,  7);
+        MD5_X4_STEP(F, d, a, b, c, w[13], 0xfd987193, 12);
+        MD5_X4_STEP(F, c, d, a, b, w[14], 0xa679438e, 17);
+        MD5_X4_STEP(F, b, c, d, a, w[15], 0x49b40821, 22);
+        MD5_X4_STEP(G, a, b, c, d, w[ 1], 0xf61e2562,  5);
+        MD5_X4_STEP(G, d, a, b, c, w[ 6], 0xc040b340,  9);
+        MD5_X4_STEP(G, c, d, a, b, w[11], 0x265e5a51, 14);
+        MD5_X4_STEP(G, b, c, d, a, w[ 0], 0xe9b6c7aa, 20);
+        MD5_X4_STEP(G, a, b, c, d, w[ 5], 0xd62f105d,  5);
+        MD5_X4_STEP(G, d, a, b, c, w[10], 0x02441453,  9);
+        MD5_X4_STEP(G, c, d, a, b, w[15], 0xd8a1e681, 14);
+        MD5_X4_STEP(G, b, c, d, a, w[ 4], 0xe7d3fbc8, 20);
+        MD5_X4_STEP(G, a, b, c, d, w[ 9], 0x21e1cde6,  5);
+        MD5_X4_STEP(G, d, a, b, c, w[14], 0xc33707d6,  9);
+        MD5_X4_STEP(G, c, d, a, b, w[ 3], 0xf4d50d87, 14);
+        MD5_X4_STEP(G, b, c, d, a, w[ 8], 0x455a14ed, 20);
+        MD5_X4_STEP(G, a, b, c, d, w[13], 0xa9e3e905,  5);
+        MD5_X4_STEP(G, d, a, b, c, w[ 2], 0xfcefa3f8,  9);
+        MD5_X4_STEP(G, c, d, a, b, w[ 7], 0x676f02d9, 14);
+        MD5_X4_STEP(G, b, c, d, a, w[12], 0x8d2a4c8a, 20);
+        MD5_X4_STEP(H, a, b, c, d, w[ 5], 0xfffa3942,  4);
+        MD5_X4_STEP(H, d, a, b, c, w[ 8], 0x8771f681, 11);
+        MD5_X4_STEP(H, c, d, a, b, w[11], 0x6d9d6122, 16);
+        MD5_X4_STEP(H, b, c, d, a, w[14], 0xfde5380c, 23);
+        MD5_X4_STEP(H, a, b, c, d, w[ 1], 0xa4beea44,  4);
+        MD5_X4_STEP(H, d, a, b, c, w[ 4], 0x4bdecfa9, 11);
+        MD5_X4_STEP(H, c, d, a, b, w[ 7], 0xf6bb4b60, 16);
+        MD5_X4_STEP(H, b, c, d, a, w[10], 0xbebfbc70, 23);
+        MD5_X4_STEP(H, a, b, c, d, w[13], 0x289b7ec6,  4);
+        MD5_X4_STEP(H, d, a, b, c, w[ 0], 0xeaa127fa, 11);
+        MD5_X4_STEP(H, c, d, a, b, w[ 3], 0xd4ef3085, 16);
+        MD5_X4_STEP(H, b, c, d, a, w[ 6], 0x04881d05, 23);
+        MD5_X4_STEP(H, a, b, c, d, w[ 9], 0xd9d4d039,  4);
+        MD5_X4_STEP(H, d, a, b, c, w[12], 0xe6db99e5, 11);
+        MD5_X4_STEP(H, c, d, a, b, w[15], 0x1fa27cf8, 16);
+        MD5_X4_STEP(H, b, c, d, a, w[ 2], 0xc4ac5665, 23);
+        MD5_X4_STEP(I, a, b, c, d, w[ 0], 0xf4292244,  6);
+        MD5_X4_STEP(I, d, a, b, c, w[ 7], 0x432aff97, 10);
+        MD5_X4_STEP(I, c, d, a, b, w[14], 0xab9423a7, 15);
+        MD5_X4_STEP(I, b, c, d, a, w[ 5], 0xfc93a039, 21);
+        MD5_X4_STEP(I, a, b, c, d, w[12], 0x655b59c3,  6);
+        MD5_X4_STEP(I, d, a, b, c, w[ 3], 0x8f0ccc92, 10);
+        MD5_X4_STEP(I, c, d, a, b, w[10], 0xffeff47d, 15);
+        MD5_X4_STEP(I, b, c, d, a, w[ 1], 0x85845dd1, 21);
+        MD5_X4_STEP(I, a, b, c, d, w[ 8], 0x6fa87e4f,  6);
+        MD5_X4_STEP(I, d, a, b, c, w[15], 0xfe2ce6e0, 10);
+        MD5_X4_STEP(I, c, d, a, b, w[ 6], 0xa3014314, 15);
+        MD5_X4_STEP(I, b, c, d, a, w[13], 0x4e0811a1, 21);
+        MD5_X4_STEP(I, a, b, c, d, w[ 4], 0xf7537e82,  6);
+        MD5_X4_STEP(I, d, a, b, c, w[11], 0xbd3af235, 10);
+        MD5_X4_STEP(I, c, d, a, b, w[ 2], 0x2ad7d2bb, 15);
+        MD5_X4_STEP(I, b, c, d, a, w[ 9], 0xeb86d391, 21);
+
+        a = _mm_add_epi32(a, aa);
+        b = _mm_add_epi32(b, bb);
+        c = _mm_add_epi32(c, cc);
+        d = _mm_add_epi32(d, dd);
+    }
+
+    _mm_storeu_si128((__m128i *)out[0], a);
+    _mm_storeu_si128((__m128i *)out[1], b);
+    _mm_storeu_si128((__m128i *)out[2], c);
+    _mm_storeu_si128((__m128i *)out[3], d);
+    for (k = 0; k < 4; k++) {
+        ctx[k]->state[0] = out[0][k];
+        ctx[k]->state[1] = out[1][k];
+        ctx[k]->state[2] = out[2][k];
+        ctx[k]->state[3] = out[3][k];
+    }
+}
+
+#define MD5_KERNEL_NAME "sse2"
+
+#else
+
+#define MD5_KERNEL_NAME "apr"
+
+#endif
+
+const char *aos_md5_kernel(void)
+{
+    return MD5_KERNEL_NAME;
+}
+
+/* The apr_md5_ctx_t bit count, as apr_md5_update keeps it. */
+static void md5_add_count(aos_md5_ctx_t *ctx, apr_size_t len)
+{
+    uint64_t bits = ((uint64_t)ctx->count[1] << 32) | ctx->count[0];
+
+    bits += (uint64_t)len << 3;
+    ctx->count[0] = (apr_uint32_t)bits;
+    ctx->count[1] = (apr_uint32_t)(bits >> 32);
+}
+
+static void md5_update_lanes(aos_md5_ctx_t *ctx[], const unsigned char *data[],
+                             const apr_size_t len[], int num)
+{
+    const unsigned char *in[AOS_MD5_LANES];
+    apr_size_t left[AOS_MD5_LANES];
+    apr_size_t blocks = 0;
+    apr_size_t head;
+    int k;
+
+    for (k = 0; k < num; k++) {
+        in[k] = data[k];
+        left[k] = len[k];
+
+        /* fill up a partial block first, the lanes start block aligned */
+        head = (64 - ((ctx[k]->count[0] >> 3) & 63)) & 63;
+        if (head > left[k]) {
+            head = left[k];
+        }
+        if (head > 0) {
+            apr_md5_update(ctx[k], in[k], head);
+            in[k] += head;
+            left[k] -= head;
+        }
+        if (k == 0 || left[k] / 64 < blocks) {
+            blocks = left[k] / 64;
+        }
+    }
+
+#ifdef DIGEST_X86
+    if (num > 1 && blocks > 0) {
+        aos_md5_ctx_t *lane[AOS_MD5_LANES];
+        aos_md5_ctx_t spare;
+
+        /* idle lanes hash the first lane's data into a scratch state */
+        spare = *ctx[0];
+        for (k = 0; k < AOS_MD5_LANES; k++) {
+            lane[k] = k < num ? ctx[k] : &spare;
+            if (k >= num) {
+                in[k] = in[0];
+            }
+        }
+        md5_x4_blocks(lane, in, blocks);
+        for (k = 0; k < num; k++) {
+            md5_add_count(ctx[k], blocks * 64);
+            in[k] += blocks * 64;
+            left[k] -= blocks * 64;
+        }
+    }
+#endif
+
+    for (k = 0; k < num; k++) {
+        if (left[k] > 0) {
+            apr_md5_update(ctx[k], in[k], left[k]);
+        }
+    }
+}
+
+void aos_md5_multi_update(aos_md5_ctx_t *ctx[], const unsigned char *data[],
+                          const apr_size_t len[], int num)
+{
+    int i;
+    int n;
+
+    for (i = 0; i < num; i += n) {
+        n = num - i < AOS_MD5_LANES ? num - i : AOS_MD5_LANES;
+        md5_update_lanes(ctx + i, data + i, len + i, n);
+    }
+}
+
+int aos_md5_file_parts(aos_pool_t *pool, const char *path, const int64_t offsets[],
+                       const int64_t sizes[], int num, unsigned char (*digests)[APR_MD5_DIGESTSIZE])
+{
+    aos_pool_t *subpool;
+    apr_file_t *file;
+    aos_md5_ctx_t ctx[AOS_MD5_LANES];
+    aos_md5_ctx_t *lane[AOS_MD5_LANES];
+    unsigned char *buf[AOS_MD5_LANES];
+    const unsigned char *data[AOS_MD5_LANES];
+    apr_size_t len[AOS_MD5_LANES];
+    int64_t pos[AOS_MD5_LANES];
+    int64_t left[AOS_MD5_LANES];
+    apr_off_t off;
+    apr_status_t s;
+    char errbuf[256];
+    int res = AOSE_OK;
+    int more;
+    int i;
+    int k;
+    int n;
+
+    aos_pool_create(&subpool, pool);
+    s = apr_file_open(&file, path, APR_READ, APR_UREAD | APR_GREAD, subpool);
+    if (s != APR_SUCCESS) {
+        aos_error_log("apr_file_open failure, code:%d %s.", s, apr_strerror(s, errbuf, sizeof(errbuf)));
+        aos_pool_destroy(subpool);
+        return AOSE_OPEN_FILE_ERROR;
+    }
+    for (k = 0; k < AOS_MD5_LANES; k++) {
+        buf[k] = aos_palloc(subpool, AOS_MD5_FILE_BUFFER_SIZE);
+    }
+
+    for (i = 0; i < num && res == AOSE_OK; i += n) {
+        n = num - i < AOS_MD5_LANES ? num - i : AOS_MD5_LANES;
+        for (k = 0; k < n; k++) {
+            aos_md5_init(&ctx[k]);
+            lane[k] = &ctx[k];
+            pos[k] = offsets[i + k];
+            left[k] = sizes[i + k];
+        }
+
+        do {
+            more = 0;
+            for (k = 0; k < n; k++) {
+                len[k] = (apr_size_t)(left[k] < AOS_MD5_FILE_BUFFER_SIZE ? left[k] : AOS_MD5_FILE_BUFFER_SIZE);
+                data[k] = buf[k];
+                if (len[k] == 0) {
+                    continue;
+                }
+                off = (apr_off_t)pos[k];
+                s = apr_file_seek(file, APR_SET, &off);
+                if (s != APR_SUCCESS) {
+                    aos_error_log("apr_file_seek failure, code:%d %s.", s, apr_strerror(s, errbuf, sizeof(errbuf)));
+                    res = AOSE_FILE_SEEK_ERROR;
+                    break;
+                }
+                s = apr_file_read_full(file, buf[k], len[k], NULL);
+                if (s != APR_SUCCESS) {
+                    aos_error_log("apr_file_read_full failure, code:%d %s.", s, apr_strerror(s, errbuf, sizeof(errbuf)));
+                    res = AOSE_FILE_READ_ERROR;
+                    break;
+                }
+                pos[k] += len[k];
+                left[k] -= len[k];
+                more |= left[k] > 0;
+            }
+            if (res != AOSE_OK) {
+                break;
+            }
+            aos_md5_multi_update(lane, data, len, n);
+        } while (more);
+
+        if (res == AOSE_OK) {
+            for (k = 0; k < n; k++) {
+                aos_md5_final(digests[i + k], &ctx[k]);
+            }
+        }
+    }
+
+    aos_pool_destroy(subpool);
+    return res;
+}
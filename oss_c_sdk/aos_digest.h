@@ -0,0 +1,67 @@
+#ifndef LIBAOS_DIGEST_H
+#define LIBAOS_DIGEST_H
+
+#include "aos_define.h"
+
+#include <apr_md5.h>
+#include <apr_sha1.h>
+
+AOS_CPP_START
+
+#define AOS_MD5_LANES 4
+#define AOS_MD5_FILE_BUFFER_SIZE (64 * 1024)
+
+/**
+ * SHA-1 computed with the x86 SHA extensions when the cpu has them, the
+ * apr_sha1 code is the fallback. The context can be copied, the HMAC key
+ * state is a pair of contexts.
+ */
+typedef struct {
+    apr_sha1_ctx_t apr;
+    uint32_t state[5];
+    uint64_t len;
+    unsigned char buf[64];
+} aos_sha1_ctx_t;
+
+void aos_sha1_init(aos_sha1_ctx_t *ctx);
+void aos_sha1_update(aos_sha1_ctx_t *ctx, const void *data, apr_size_t len);
+void aos_sha1_final(unsigned char digest[APR_SHA1_DIGESTSIZE], aos_sha1_ctx_t *ctx);
+
+/**
+ * The name of the kernel used by aos_sha1_update: sha-ni or apr.
+ */
+const char *aos_sha1_kernel(void);
+
+/**
+ * A single MD5 stream is the apr_md5 code, aos_md5 and so the Content-MD5
+ * of delete objects use it. aos_md5_multi_update feeds num streams at
+ * once, the blocks all lanes have in common are hashed four streams
+ * abreast with SSE2 on x86-64, what is left of each stream goes through
+ * apr_md5_update.
+ */
+typedef apr_md5_ctx_t aos_md5_ctx_t;
+
+void aos_md5_init(aos_md5_ctx_t *ctx);
+void aos_md5_update(aos_md5_ctx_t *ctx, const void *data, apr_size_t len);
+void aos_md5_final(unsigned char digest[APR_MD5_DIGESTSIZE], aos_md5_ctx_t *ctx);
+void aos_md5_multi_update(aos_md5_ctx_t *ctx[], const unsigned char *data[],
+                          const apr_size_t len[], int num);
+
+/**
+ * The name of the kernel used by aos_md5_multi_update: sse2 or apr.
+ */
+const char *aos_md5_kernel(void);
+
+/**
+ * The MD5 of num parts of a file, part i is sizes[i] bytes at offsets[i].
+ * The parts are read in AOS_MD5_FILE_BUFFER_SIZE chunks and hashed
+ * AOS_MD5_LANES parts at a time. Return AOSE_OK or an AOSE_* error.
+ * The multipart uploads of the sdk do not send Content-MD5 with the parts,
+ * it is for callers that add the header to the parts themselves.
+ */
+int aos_md5_file_parts(aos_pool_t *pool, const char *path, const int64_t offsets[],
+                       const int64_t sizes[], int num, unsigned char (*digests)[APR_MD5_DIGESTSIZE]);
+
+AOS_CPP_END
+
+#endif
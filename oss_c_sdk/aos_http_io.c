@@ -1,7 +1,10 @@
 #include "aos_log.h"
 #include "aos_http_io.h"
 #include "aos_define.h"
+#include "aos_pool_cache.h"
+#include "aos_util.h"
 #include <apr_thread_mutex.h>
+#include <apr_thread_cond.h>
 #include <apr_file_io.h>
 
 aos_pool_t *aos_global_pool = NULL;
@@ -13,6 +16,11 @@ aos_http_transport_options_t *aos_default_http_transport_options = NULL;
 aos_http_transport_create_pt aos_http_transport_create = aos_curl_http_transport_create;
 aos_http_transport_perform_pt aos_http_transport_perform = aos_curl_http_transport_perform;
 
+static apr_thread_mutex_t *aos_memory_budget_mutex = NULL;
+static apr_thread_cond_t *aos_memory_budget_cond = NULL;
+static apr_interval_time_t aos_memory_budget_wait = 0;
+static aos_memory_budget_stats_t aos_memory_budget;
+
 static apr_thread_mutex_t* requestStackMutexG = NULL;
 static CURL *requestStackG[AOS_REQUEST_STACK_SIZE];
 static int requestStackCountG;
@@ -61,6 +69,146 @@ void request_release(CURL *request)
     }
 }
 
+void aos_memory_budget_set(int64_t limit, apr_interval_time_t wait_timeout)
+{
+    if (aos_memory_budget_mutex == NULL) {
+        aos_memory_budget.limit = limit;
+        aos_memory_budget_wait = wait_timeout;
+        return;
+    }
+
+    apr_thread_mutex_lock(aos_memory_budget_mutex);
+    aos_memory_budget.limit = limit;
+    aos_memory_budget_wait = wait_timeout;
+    apr_thread_cond_broadcast(aos_memory_budget_cond);
+    apr_thread_mutex_unlock(aos_memory_budget_mutex);
+}
+
+void aos_memory_budget_get_stats(aos_memory_budget_stats_t *stats)
+{
+    if (aos_memory_budget_mutex == NULL) {
+        *stats = aos_memory_budget;
+        return;
+    }
+
+    apr_thread_mutex_lock(aos_memory_budget_mutex);
+    *stats = aos_memory_budget;
+    apr_thread_mutex_unlock(aos_memory_budget_mutex);
+}
+
+static int aos_memory_budget_exceeded(int64_t size)
+{
+    return aos_memory_budget.limit > 0 && aos_memory_budget.used + size > aos_memory_budget.limit;
+}
+
+/* unit bytes when they fit, else size bytes, 0 when neither fits */
+static int64_t aos_memory_budget_take(int64_t size, int64_t unit, int wait)
+{
+    apr_time_t now;
+    apr_time_t deadline;
+
+    if (aos_memory_budget_mutex == NULL) {
+        return unit;
+    }
+
+    apr_thread_mutex_lock(aos_memory_budget_mutex);
+    if (!aos_memory_budget_exceeded(unit)) {
+        size = unit;
+    } else if (aos_memory_budget_exceeded(size)) {
+        // a size over the limit never fits, it does not wait
+        if (wait && aos_memory_budget_wait > 0 && size <= aos_memory_budget.limit) {
+            aos_memory_budget.waited++;
+            deadline = apr_time_now() + aos_memory_budget_wait;
+            while (aos_memory_budget_exceeded(size) && (now = apr_time_now()) < deadline) {
+                apr_thread_cond_timedwait(aos_memory_budget_cond, aos_memory_budget_mutex, deadline - now);
+            }
+        }
+        if (aos_memory_budget_exceeded(size)) {
+            aos_memory_budget.rejected++;
+            apr_thread_mutex_unlock(aos_memory_budget_mutex);
+            return 0;
+        }
+    }
+    aos_memory_budget.used += size;
+    if (aos_memory_budget.used > aos_memory_budget.peak) {
+        aos_memory_budget.peak = aos_memory_budget.used;
+    }
+    apr_thread_mutex_unlock(aos_memory_budget_mutex);
+
+    return size;
+}
+
+int aos_memory_budget_acquire(int64_t size, int wait)
+{
+    return aos_memory_budget_take(size, size, wait) > 0 ? AOSE_OK : AOSE_OVER_MEMORY;
+}
+
+void aos_memory_budget_release(int64_t size)
+{
+    if (aos_memory_budget_mutex == NULL) {
+        return;
+    }
+
+    apr_thread_mutex_lock(aos_memory_budget_mutex);
+    aos_memory_budget.used -= size;
+    apr_thread_cond_broadcast(aos_memory_budget_cond);
+    apr_thread_mutex_unlock(aos_memory_budget_mutex);
+}
+
+static apr_status_t aos_memory_hold_cleanup(void *data)
+{
+    aos_memory_hold_t *hold = (aos_memory_hold_t *)data;
+
+    if (hold->size > 0) {
+        aos_memory_budget_release(hold->size);
+    }
+    hold->size = 0;
+    hold->used = 0;
+
+    return APR_SUCCESS;
+}
+
+aos_memory_hold_t *aos_memory_hold_create(aos_pool_t *p)
+{
+    aos_memory_hold_t *hold;
+
+    hold = (aos_memory_hold_t *)aos_pcalloc(p, sizeof(aos_memory_hold_t));
+    apr_pool_cleanup_register(p, hold, aos_memory_hold_cleanup, apr_pool_cleanup_null);
+
+    return hold;
+}
+
+int aos_memory_hold_use(aos_memory_hold_t *hold, int64_t size, int wait)
+{
+    int64_t got;
+    int64_t need = hold->used + size - hold->size;
+
+    // by units, the exact bytes when a whole unit does not fit
+    if (need > 0) {
+        if ((got = aos_memory_budget_take(need, aos_max(need, AOS_MEMORY_BUDGET_UNIT), wait)) == 0) {
+            return AOSE_OVER_MEMORY;
+        }
+        hold->size += got;
+    }
+    hold->used += size;
+
+    return AOSE_OK;
+}
+
+int aos_memory_hold_reserve(aos_memory_hold_t *hold, int64_t size, int wait)
+{
+    int64_t need = size - hold->size;
+
+    if (need > 0) {
+        if (aos_memory_budget_take(need, need, wait) == 0) {
+            return AOSE_OVER_MEMORY;
+        }
+        hold->size += need;
+    }
+
+    return AOSE_OK;
+}
+
 void aos_set_default_request_options(aos_http_request_options_t *op)
 {
     aos_default_http_request_options = op;
@@ -82,6 +230,7 @@ aos_http_request_options_t *aos_http_request_options_create(aos_pool_t *p)
     options->dns_cache_timeout = AOS_DNS_CACHE_TIMOUT;
     options->max_memory_size = AOS_MAX_MEMORY_SIZE;
     options->enable_crc = AOS_TRUE;
+    options->enable_crc_offload = AOS_FALSE;
     options->proxy_auth = NULL;
     options->proxy_host = NULL;
 
@@ -113,39 +262,203 @@ aos_http_controller_t *aos_http_controller_create(aos_pool_t *p, int owner)
     return ctl;
 }
 
-aos_http_request_t *aos_http_request_create(aos_pool_t *p)
+static void aos_http_request_init(aos_http_request_t *req, aos_pool_t *p)
 {
-    aos_http_request_t *req;
-
-    req = (aos_http_request_t *)aos_pcalloc(p, sizeof(aos_http_request_t));
+    memset(req, 0, sizeof(aos_http_request_t));
     req->method = HTTP_GET;
-    req->headers = aos_table_make(p, 5);
-    req->query_params = aos_table_make(p, 3);
     aos_list_init(&req->body);
     req->type = BODY_IN_MEMORY;
     req->body_len = 0;
     req->pool = p;
     req->read_body = aos_read_http_body_memory;
-
-    return req;
 }
 
-aos_http_response_t *aos_http_response_create(aos_pool_t *p)
+static void aos_http_response_init(aos_http_response_t *resp, aos_pool_t *p)
 {
-    aos_http_response_t *resp;
-
-    resp = (aos_http_response_t *)aos_pcalloc(p, sizeof(aos_http_response_t));
+    memset(resp, 0, sizeof(aos_http_response_t));
     resp->status = -1;
-    resp->headers = aos_table_make(p, 10);
     aos_list_init(&resp->body);
     resp->type = BODY_IN_MEMORY;
     resp->body_len = 0;
     resp->pool = p;
     resp->write_body = aos_write_http_body_memory;
+}
+
+aos_http_request_t *aos_http_request_create(aos_pool_t *p)
+{
+    aos_http_request_t *req;
+
+    req = (aos_http_request_t *)aos_palloc(p, sizeof(aos_http_request_t));
+    aos_http_request_init(req, p);
+    req->headers = aos_table_make(p, 5);
+    req->query_params = aos_table_make(p, 3);
+
+    return req;
+}
+
+aos_http_response_t *aos_http_response_create(aos_pool_t *p)
+{
+    aos_http_response_t *resp;
+
+    resp = (aos_http_response_t *)aos_palloc(p, sizeof(aos_http_response_t));
+    aos_http_response_init(resp, p);
+    resp->headers = aos_table_make(p, 10);
 
     return resp;
 }
 
+aos_table_t *aos_http_response_headers(aos_http_response_t *resp)
+{
+    int i;
+    aos_http_header_t *lines;
+
+    if (resp->header_lines != NULL) {
+        lines = (aos_http_header_t *)resp->header_lines->elts;
+        for (i = 0; i < resp->header_lines->nelts; i++) {
+            apr_table_addn(resp->headers, lines[i].key, lines[i].value);
+        }
+        resp->header_lines->nelts = 0;
+    }
+
+    return resp->headers;
+}
+
+const char *aos_http_response_header(const aos_http_response_t *resp, const char *key)
+{
+    int i;
+    const char *value;
+    const aos_http_header_t *lines;
+
+    if ((value = apr_table_get(resp->headers, key)) != NULL || resp->header_lines == NULL) {
+        return value;
+    }
+
+    lines = (const aos_http_header_t *)resp->header_lines->elts;
+    for (i = 0; i < resp->header_lines->nelts; i++) {
+        if (strcasecmp(lines[i].key, key) == 0) {
+            return lines[i].value;
+        }
+    }
+
+    return NULL;
+}
+
+static apr_status_t aos_http_request_context_cleanup(void *data)
+{
+    aos_http_request_context_t *ctx = (aos_http_request_context_t *)data;
+
+    free(ctx->header_nodes);
+    ctx->header_nodes = NULL;
+    ctx->header_node_num = 0;
+
+    return APR_SUCCESS;
+}
+
+aos_http_request_context_t *aos_http_request_context_create(aos_pool_t *p)
+{
+    int s;
+    char buf[256];
+    aos_http_request_context_t *ctx;
+
+    ctx = (aos_http_request_context_t *)aos_pcalloc(p, sizeof(aos_http_request_context_t));
+    if ((s = aos_pool_create(&ctx->pool, p)) != APR_SUCCESS) {
+        aos_error_log("aos_pool_create failure, code:%d %s.", s, apr_strerror(s, buf, sizeof(buf)));
+        return NULL;
+    }
+
+    apr_pool_cleanup_register(p, ctx, aos_http_request_context_cleanup, apr_pool_cleanup_null);
+
+    aos_http_request_context_reset(ctx);
+
+    return ctx;
+}
+
+void aos_http_request_context_reset(aos_http_request_context_t *ctx)
+{
+    int i;
+
+    apr_pool_clear(ctx->pool);
+
+    // the tables copy what is set into their pool, they must live in the call pool
+    ctx->req_headers = aos_table_make(ctx->pool, 5);
+    ctx->req_params = aos_table_make(ctx->pool, 3);
+    ctx->resp_headers = aos_table_make(ctx->pool, 10);
+    for (i = 0; i < AOS_HTTP_CONTEXT_TABLE_NUM; i++) {
+        ctx->tables[i] = aos_table_make(ctx->pool, 5);
+    }
+    ctx->table_num = 0;
+
+    aos_http_request_init(&ctx->req, ctx->pool);
+    ctx->req.headers = ctx->req_headers;
+    ctx->req.query_params = ctx->req_params;
+    aos_http_response_init(&ctx->resp, ctx->pool);
+    ctx->resp.headers = ctx->resp_headers;
+    memset(&ctx->status, 0, sizeof(aos_status_t));
+
+    ctx->req_used = 0;
+    ctx->resp_used = 0;
+    ctx->status_used = 0;
+}
+
+aos_http_request_t *aos_http_request_context_request(aos_http_request_context_t *ctx)
+{
+    if (ctx->req_used) {
+        return aos_http_request_create(ctx->pool);
+    }
+    ctx->req_used = 1;
+    return &ctx->req;
+}
+
+aos_http_response_t *aos_http_request_context_response(aos_http_request_context_t *ctx)
+{
+    if (ctx->resp_used) {
+        return aos_http_response_create(ctx->pool);
+    }
+    ctx->resp_used = 1;
+    return &ctx->resp;
+}
+
+aos_status_t *aos_http_request_context_status(aos_http_request_context_t *ctx)
+{
+    if (ctx->status_used) {
+        return aos_status_create(ctx->pool);
+    }
+    ctx->status_used = 1;
+    return &ctx->status;
+}
+
+aos_table_t *aos_http_request_context_table(aos_http_request_context_t *ctx, int nelts)
+{
+    if (ctx->table_num == AOS_HTTP_CONTEXT_TABLE_NUM) {
+        return aos_table_make(ctx->pool, nelts);
+    }
+    return ctx->tables[ctx->table_num++];
+}
+
+struct curl_slist *aos_http_request_context_header_nodes(aos_http_request_context_t *ctx, int num)
+{
+    int i;
+    int node_num;
+    struct curl_slist *nodes;
+
+    if (num > ctx->header_node_num) {
+        node_num = aos_max(num, 2 * ctx->header_node_num);
+        nodes = (struct curl_slist *)realloc(ctx->header_nodes, node_num * sizeof(struct curl_slist));
+        if (nodes == NULL) {
+            return NULL;
+        }
+        ctx->header_nodes = nodes;
+        ctx->header_node_num = node_num;
+    }
+
+    for (i = 0; i < num; i++) {
+        ctx->header_nodes[i].data = NULL;
+        ctx->header_nodes[i].next = i + 1 < num ? &ctx->header_nodes[i + 1] : NULL;
+    }
+
+    return num > 0 ? ctx->header_nodes : NULL;
+}
+
 int aos_read_http_body_memory(aos_http_request_t *req, char *buffer, int len)
 {
     int wsize;
@@ -286,6 +599,34 @@ int aos_http_io_initialize(const char *user_agent_info, int flags)
     }
     requestStackCountG = 0;
 
+    if ((s = apr_thread_mutex_create(&aos_memory_budget_mutex, APR_THREAD_MUTEX_DEFAULT, aos_global_pool)) != APR_SUCCESS ||
+        (s = apr_thread_cond_create(&aos_memory_budget_cond, aos_global_pool)) != APR_SUCCESS)
+    {
+        aos_error_log("memory budget create failure, code:%d %s.\n", s, apr_strerror(s, buf, sizeof(buf)));
+        aos_memory_budget_mutex = NULL;
+        return AOSE_INTERNAL_ERROR;
+    }
+
+    if ((s = aos_curl_profile_initialize(aos_global_pool)) != AOSE_OK) {
+        aos_error_log("aos_curl_profile_initialize failure, code:%d.\n", s);
+        return AOSE_INTERNAL_ERROR;
+    }
+
+    if ((s = aos_crc64_stage_initialize(aos_global_pool)) != AOSE_OK) {
+        aos_error_log("aos_crc64_stage_initialize failure, code:%d.\n", s);
+        return AOSE_INTERNAL_ERROR;
+    }
+
+    if ((s = aos_pool_cache_initialize(aos_global_pool)) != AOSE_OK) {
+        aos_error_log("aos_pool_cache_initialize failure, code:%d.\n", s);
+        return AOSE_INTERNAL_ERROR;
+    }
+
+    if ((s = aos_hmac_sha1_key_cache_initialize(aos_global_pool)) != AOSE_OK) {
+        aos_error_log("aos_hmac_sha1_key_cache_initialize failure, code:%d.\n", s);
+        return AOSE_INTERNAL_ERROR;
+    }
+
     apr_snprintf(aos_user_agent, sizeof(aos_user_agent)-1, "%s(Compatible %s)", 
                  AOS_VER, user_agent_info);
 
@@ -301,7 +642,13 @@ int aos_http_io_initialize(const char *user_agent_info, int flags)
 
 void aos_http_io_deinitialize()
 {
+    aos_crc64_stage_deinitialize();
+    aos_curl_profile_deinitialize();
+    aos_pool_cache_deinitialize();
+    aos_hmac_sha1_key_cache_deinitialize();
     apr_thread_mutex_destroy(requestStackMutexG);
+    aos_memory_budget_mutex = NULL;
+    aos_memory_budget_cond = NULL;
 
     while (requestStackCountG--) {
         curl_easy_cleanup(requestStackG[requestStackCountG]);
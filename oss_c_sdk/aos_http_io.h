@@ -31,12 +31,94 @@ aos_http_request_options_t *aos_http_request_options_create(aos_pool_t *p);
 aos_http_request_t *aos_http_request_create(aos_pool_t *p);
 aos_http_response_t *aos_http_response_create(aos_pool_t *p);
 
+/* the headers table of the response with the parsed header lines added */
+aos_table_t *aos_http_response_headers(aos_http_response_t *resp);
+
+/* a header of the response, looked up without building the table */
+const char *aos_http_response_header(const aos_http_response_t *resp, const char *key);
+
+#define AOS_HTTP_CONTEXT_TABLE_NUM 4
+
+/*
+ * A request context is created once and reset between calls. The request,
+ * the response, the status, AOS_HTTP_CONTEXT_TABLE_NUM tables and the curl
+ * header list nodes of a call are taken from it, the tables live in the
+ * call pool with everything else a call allocates, a subpool cleared by
+ * the reset so its memory is kept and the parent pool does not grow. A
+ * second request or status of one call, or more tables, are allocated
+ * from the call pool. Everything a call returned is invalid after the
+ * reset.
+ */
+struct aos_http_request_context_s {
+    aos_pool_t *pool;
+    aos_http_request_t req;
+    aos_http_response_t resp;
+    aos_status_t status;
+    aos_table_t *req_headers;
+    aos_table_t *req_params;
+    aos_table_t *resp_headers;
+    aos_table_t *tables[AOS_HTTP_CONTEXT_TABLE_NUM];
+    int table_num;
+    struct curl_slist *header_nodes;
+    int header_node_num;
+    uint32_t req_used:1;
+    uint32_t resp_used:1;
+    uint32_t status_used:1;
+};
+
+aos_http_request_context_t *aos_http_request_context_create(aos_pool_t *p);
+void aos_http_request_context_reset(aos_http_request_context_t *ctx);
+
+aos_http_request_t *aos_http_request_context_request(aos_http_request_context_t *ctx);
+aos_http_response_t *aos_http_request_context_response(aos_http_request_context_t *ctx);
+aos_status_t *aos_http_request_context_status(aos_http_request_context_t *ctx);
+aos_table_t *aos_http_request_context_table(aos_http_request_context_t *ctx, int nelts);
+
+/* num linked curl header nodes, NULL if they can't be allocated */
+struct curl_slist *aos_http_request_context_header_nodes(aos_http_request_context_t *ctx, int num);
+
 int aos_read_http_body_memory(aos_http_request_t *req, char *buffer, int len);
 int aos_write_http_body_memory(aos_http_response_t *resp, const char *buffer, int len);
 
 int aos_read_http_body_file(aos_http_request_t *req, char *buffer, int len);
 int aos_write_http_body_file(aos_http_response_t *resp, const char *buffer, int len);
 
+/*
+ * A process-wide budget for the bytes the transports buffer, the in-memory
+ * response bodies and the chunks of the crc64 stages. A limit of 0 is no
+ * limit, the usage is counted all the same. When the budget is exhausted a
+ * response waits up to wait_timeout for other transfers to release theirs,
+ * 0 rejects it at once, and fails with AOSE_OVER_MEMORY. A crc64 stage
+ * that does not fit hashes inline.
+ */
+typedef struct {
+    int64_t limit;
+    int64_t used;
+    int64_t peak;
+    int64_t waited;     // acquires which waited for the budget
+    int64_t rejected;   // acquires which failed
+} aos_memory_budget_stats_t;
+
+void aos_memory_budget_set(int64_t limit, apr_interval_time_t wait_timeout);
+void aos_memory_budget_get_stats(aos_memory_budget_stats_t *stats);
+int aos_memory_budget_acquire(int64_t size, int wait);
+void aos_memory_budget_release(int64_t size);
+
+/*
+ * The bytes of a response charged to the budget, acquired by
+ * AOS_MEMORY_BUDGET_UNIT and released when the pool is cleared or destroyed.
+ * aos_memory_hold_reserve acquires a known size at once, a transfer which
+ * waits for the budget then holds none of it, the uses within it are free.
+ */
+struct aos_memory_hold_s {
+    int64_t size;
+    int64_t used;
+};
+
+aos_memory_hold_t *aos_memory_hold_create(aos_pool_t *p);
+int aos_memory_hold_use(aos_memory_hold_t *hold, int64_t size, int wait);
+int aos_memory_hold_reserve(aos_memory_hold_t *hold, int64_t size, int wait);
+
 typedef aos_http_transport_t *(*aos_http_transport_create_pt)(aos_pool_t *p);
 typedef int (*aos_http_transport_perform_pt)(aos_http_transport_t *t);
 
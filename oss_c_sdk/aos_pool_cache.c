@@ -0,0 +1,207 @@
+#include "aos_log.h"
+#include "aos_pool_cache.h"
+#include <apr_atomic.h>
+#include <apr_allocator.h>
+#include <apr_thread_proc.h>
+#include <apr_thread_mutex.h>
+
+typedef struct {
+    aos_pool_t *pools[AOS_POOL_CACHE_SIZE];
+    int pool_num;
+    aos_pool_stats_t stats;
+} aos_pool_cache_t;
+
+static AOS_THREAD_LOCAL aos_pool_cache_t *g_s_aos_pool_cache = NULL;
+static apr_threadkey_t *aos_pool_cache_key = NULL;
+static aos_pool_stats_t aos_pool_stats;
+
+static void aos_pool_cache_destroy(void *data)
+{
+    aos_pool_cache_t *cache = (aos_pool_cache_t *)data;
+
+    while (cache->pool_num > 0) {
+        aos_pool_destroy(cache->pools[--cache->pool_num]);
+    }
+    free(cache);
+}
+
+static aos_pool_cache_t *aos_pool_cache_get()
+{
+    aos_pool_cache_t *cache = g_s_aos_pool_cache;
+
+    if (cache != NULL) {
+        return cache;
+    }
+
+    if ((cache = (aos_pool_cache_t *)calloc(1, sizeof(aos_pool_cache_t))) == NULL) {
+        return NULL;
+    }
+    if (aos_pool_cache_key != NULL) {
+        apr_threadkey_private_set(cache, aos_pool_cache_key);
+    }
+    g_s_aos_pool_cache = cache;
+
+    return cache;
+}
+
+/* the mutex lives in the pool, it is created again after every clear */
+static int aos_pool_set_mutex(aos_pool_t *p)
+{
+    int s;
+    apr_thread_mutex_t *mutex;
+
+    if ((s = apr_thread_mutex_create(&mutex, APR_THREAD_MUTEX_DEFAULT, p)) != APR_SUCCESS) {
+        return s;
+    }
+    apr_allocator_mutex_set(apr_pool_allocator_get(p), mutex);
+
+    return APR_SUCCESS;
+}
+
+static int aos_pool_create_owner(aos_pool_t **p)
+{
+    int s;
+    char buf[256];
+    apr_allocator_t *allocator;
+
+    if ((s = apr_allocator_create(&allocator)) != APR_SUCCESS) {
+        aos_error_log("apr_allocator_create failure, code:%d %s.", s, apr_strerror(s, buf, sizeof(buf)));
+        return s;
+    }
+    apr_allocator_max_free_set(allocator, AOS_POOL_CACHE_MAX_FREE);
+
+    if ((s = apr_pool_create_unmanaged_ex(p, NULL, allocator)) != APR_SUCCESS) {
+        aos_error_log("apr_pool_create_unmanaged_ex failure, code:%d %s.", s, apr_strerror(s, buf, sizeof(buf)));
+        apr_allocator_destroy(allocator);
+        return s;
+    }
+    apr_allocator_owner_set(allocator, *p);
+
+    if ((s = aos_pool_set_mutex(*p)) != APR_SUCCESS) {
+        aos_error_log("apr_thread_mutex_create failure, code:%d %s.", s, apr_strerror(s, buf, sizeof(buf)));
+        aos_pool_destroy(*p);
+        return s;
+    }
+
+    return APR_SUCCESS;
+}
+
+int aos_pool_acquire(aos_pool_t **p)
+{
+    int s;
+    apr_uint32_t in_use;
+    apr_uint32_t peak;
+    aos_pool_cache_t *cache = aos_pool_cache_get();
+
+    if (cache != NULL && cache->pool_num > 0) {
+        *p = cache->pools[--cache->pool_num];
+    } else {
+        if ((s = aos_pool_create_owner(p)) != APR_SUCCESS) {
+            return s;
+        }
+        apr_atomic_inc32(&aos_pool_stats.created);
+        if (cache != NULL) {
+            cache->stats.created++;
+        }
+    }
+
+    apr_atomic_inc32(&aos_pool_stats.acquired);
+    in_use = apr_atomic_inc32(&aos_pool_stats.in_use) + 1;
+    while ((peak = apr_atomic_read32(&aos_pool_stats.peak_in_use)) < in_use) {
+        if (apr_atomic_cas32(&aos_pool_stats.peak_in_use, in_use, peak) == peak) {
+            break;
+        }
+    }
+
+    if (cache != NULL) {
+        // pools released by other threads are not counted by this one
+        cache->stats.acquired++;
+        in_use = cache->stats.acquired > cache->stats.released ? cache->stats.acquired - cache->stats.released : 0;
+        if (in_use > cache->stats.peak_in_use) {
+            cache->stats.peak_in_use = in_use;
+        }
+    }
+
+    return APR_SUCCESS;
+}
+
+void aos_pool_release(aos_pool_t *p)
+{
+    aos_pool_cache_t *cache = aos_pool_cache_get();
+
+    apr_atomic_inc32(&aos_pool_stats.released);
+    apr_atomic_dec32(&aos_pool_stats.in_use);
+    if (cache != NULL) {
+        cache->stats.released++;
+    }
+
+    if (cache == NULL || cache->pool_num == AOS_POOL_CACHE_SIZE) {
+        apr_atomic_inc32(&aos_pool_stats.destroyed);
+        if (cache != NULL) {
+            cache->stats.destroyed++;
+        }
+        aos_pool_destroy(p);
+        return;
+    }
+
+    // the mutex is destroyed by the clear, the allocator must not use it meanwhile
+    apr_allocator_mutex_set(apr_pool_allocator_get(p), NULL);
+    apr_pool_clear(p);
+    if (aos_pool_set_mutex(p) != APR_SUCCESS) {
+        apr_atomic_inc32(&aos_pool_stats.destroyed);
+        cache->stats.destroyed++;
+        aos_pool_destroy(p);
+        return;
+    }
+    cache->pools[cache->pool_num++] = p;
+}
+
+void aos_pool_get_thread_stats(aos_pool_stats_t *stats)
+{
+    aos_pool_cache_t *cache = g_s_aos_pool_cache;
+
+    memset(stats, 0, sizeof(aos_pool_stats_t));
+    if (cache == NULL) {
+        return;
+    }
+    *stats = cache->stats;
+    stats->in_use = stats->acquired > stats->released ? stats->acquired - stats->released : 0;
+}
+
+void aos_pool_get_stats(aos_pool_stats_t *stats)
+{
+    stats->acquired = apr_atomic_read32(&aos_pool_stats.acquired);
+    stats->created = apr_atomic_read32(&aos_pool_stats.created);
+    stats->released = apr_atomic_read32(&aos_pool_stats.released);
+    stats->destroyed = apr_atomic_read32(&aos_pool_stats.destroyed);
+    stats->in_use = apr_atomic_read32(&aos_pool_stats.in_use);
+    stats->peak_in_use = apr_atomic_read32(&aos_pool_stats.peak_in_use);
+}
+
+int aos_pool_cache_initialize(aos_pool_t *p)
+{
+    int s;
+
+    if ((s = apr_threadkey_private_create(&aos_pool_cache_key, aos_pool_cache_destroy, p)) != APR_SUCCESS) {
+        aos_pool_cache_key = NULL;
+        return s;
+    }
+    if (g_s_aos_pool_cache != NULL) {
+        apr_threadkey_private_set(g_s_aos_pool_cache, aos_pool_cache_key);
+    }
+
+    return AOSE_OK;
+}
+
+void aos_pool_cache_deinitialize()
+{
+    if (aos_pool_cache_key != NULL) {
+        apr_threadkey_private_set(NULL, aos_pool_cache_key);
+        apr_threadkey_private_delete(aos_pool_cache_key);
+        aos_pool_cache_key = NULL;
+    }
+    if (g_s_aos_pool_cache != NULL) {
+        aos_pool_cache_destroy(g_s_aos_pool_cache);
+        g_s_aos_pool_cache = NULL;
+    }
+}
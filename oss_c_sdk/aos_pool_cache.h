@@ -0,0 +1,45 @@
+#ifndef LIBAOS_POOL_CACHE_H
+#define LIBAOS_POOL_CACHE_H
+
+#include "aos_define.h"
+
+AOS_CPP_START
+
+#define AOS_POOL_CACHE_SIZE 8
+#define AOS_POOL_CACHE_MAX_FREE (256 * 1024)
+
+/*
+ * Pools for short-lived operations, kept by the thread that released them.
+ * Every pool owns its allocator, so creating subpools and allocating never
+ * takes the lock of the global allocator, the allocator mutex is only
+ * shared with the subpools. aos_pool_release clears the pool and keeps up
+ * to AOS_POOL_CACHE_SIZE of them per thread, each keeping at most
+ * AOS_POOL_CACHE_MAX_FREE bytes of free memory besides its first block.
+ * A pool may be released by another thread than the one which acquired it.
+ * The caches of the threads are destroyed when they exit, if
+ * aos_http_io_initialize was called before.
+ */
+int aos_pool_acquire(aos_pool_t **p);
+void aos_pool_release(aos_pool_t *p);
+
+typedef struct {
+    apr_uint32_t acquired;      // pools handed out by aos_pool_acquire
+    apr_uint32_t created;       // of them created because the cache was empty
+    apr_uint32_t released;      // pools given back by aos_pool_release
+    apr_uint32_t destroyed;     // of them destroyed because the cache was full
+    apr_uint32_t in_use;        // pools acquired and not released yet
+    apr_uint32_t peak_in_use;
+} aos_pool_stats_t;
+
+/**
+ * The counters of the calling thread, or of the whole process.
+ */
+void aos_pool_get_thread_stats(aos_pool_stats_t *stats);
+void aos_pool_get_stats(aos_pool_stats_t *stats);
+
+int aos_pool_cache_initialize(aos_pool_t *p);
+void aos_pool_cache_deinitialize();
+
+AOS_CPP_END
+
+#endif
@@ -13,6 +13,7 @@ const char AOS_URL_ENCODE_ERROR_CODE[] = "UrlEncodeFail";
 const char AOS_INCONSISTENT_ERROR_CODE[] = "InconsistentError";
 const char AOS_CREATE_QUEUE_ERROR_CODE[] = "CreateQueueFail";
 const char AOS_CREATE_THREAD_POOL_ERROR_CODE[] = "CreateThreadPoolFail";
+const char AOS_CREATE_THREAD_ERROR_CODE[] = "CreateThreadFail";
 
 aos_status_t *aos_status_create(aos_pool_t *p)
 {
@@ -39,6 +40,12 @@ int aos_should_retry(aos_status_t *s) {
         return AOS_TRUE;
     }
 
+    // transport failures keep the aos error code in code
+    if (s->code == AOSE_CONNECTION_FAILED || s->code == AOSE_REQUEST_TIMEOUT || 
+        s->code == AOSE_FAILED_CONNECT || s->code == AOSE_SERVICE_ERROR) {
+        return AOS_TRUE;
+    }
+
     if (s->error_code != NULL) {
         aos_error_code = atoi(s->error_code);
         if (aos_error_code == AOSE_CONNECTION_FAILED || aos_error_code == AOSE_REQUEST_TIMEOUT || 
@@ -52,6 +52,7 @@ extern const char AOS_URL_ENCODE_ERROR_CODE[];
 extern const char AOS_INCONSISTENT_ERROR_CODE[];
 extern const char AOS_CREATE_QUEUE_ERROR_CODE[];
 extern const char AOS_CREATE_THREAD_POOL_ERROR_CODE[];
+extern const char AOS_CREATE_THREAD_ERROR_CODE[];
 
 AOS_CPP_END
 
@@ -4,8 +4,64 @@
 #include "aos_http_io.h"
 #include "aos_transport.h"
 #include "aos_crc64.h"
+#include <apr_thread_mutex.h>
+#include <apr_thread_cond.h>
+#include <apr_thread_pool.h>
+
+typedef enum {
+    AOS_CRC64_CHUNK_FREE,
+    AOS_CRC64_CHUNK_HASHING,
+    AOS_CRC64_CHUNK_DONE
+} aos_crc64_chunk_state_e;
+
+typedef struct {
+    char *buf;
+    size_t len;
+    uint64_t crc64;
+    aos_crc64_chunk_state_e state;
+    aos_crc64_stage_t *stage;
+} aos_crc64_chunk_t;
+
+struct aos_crc64_stage_s {
+    apr_thread_mutex_t *mutex;
+    apr_thread_cond_t *cond;
+    char *bufs;
+    uint64_t crc64;
+    int head;
+    int pending_num;
+    aos_crc64_chunk_t chunks[AOS_CRC64_CHUNK_NUM];
+};
+
+typedef struct {
+    curl_read_callback header_callback;
+    curl_read_callback read_callback;
+    curl_write_callback write_callback;
+    char *user_agent;
+    int dns_cache_timeout;
+    int connect_timeout;
+    int speed_limit;
+    int speed_time;
+    char *proxy_host;
+    char *proxy_auth;
+} aos_curl_profile_key_t;
+
+struct aos_curl_profile_s {
+    aos_curl_profile_key_t key;
+    CURL *curl_template;
+    CURL *handles[AOS_REQUEST_STACK_SIZE];
+    int handle_num;
+};
+
+static apr_thread_mutex_t *aos_curl_profile_mutex = NULL;
+static aos_pool_t *aos_curl_profile_pool = NULL;
+static aos_curl_profile_t aos_curl_profiles[AOS_CURL_PROFILE_NUM];
+static int aos_curl_profile_num = 0;
+
+static apr_thread_pool_t *aos_crc64_thread_pool = NULL;
+static aos_crc64_zeros_t aos_crc64_chunk_zeros;
 
 static int aos_curl_code_to_status(CURLcode code);
+static int aos_init_curl_context_headers(aos_curl_http_transport_t *t, aos_http_request_context_t *ctx);
 static void aos_init_curl_headers(aos_curl_http_transport_t *t);
 static void aos_transport_cleanup(aos_http_transport_t *t);
 static int aos_init_curl_url(aos_curl_http_transport_t *t);
@@ -13,11 +69,52 @@ static void aos_curl_transport_headers_done(aos_curl_http_transport_t *t);
 static int aos_curl_transport_setup(aos_curl_http_transport_t *t);
 static void aos_curl_transport_finish(aos_curl_http_transport_t *t);
 static void aos_move_transport_state(aos_curl_http_transport_t *t, aos_transport_state_e s);
+static int aos_curl_transport_init_handle(aos_curl_http_transport_t *t);
+static void aos_curl_transport_release_handle(aos_curl_http_transport_t *t);
 
 static size_t aos_curl_default_header_callback(char *buffer, size_t size, size_t nitems, void *userdata);
 static size_t aos_curl_default_write_callback(char *ptr, size_t size, size_t nmemb, void *userdata);
 static size_t aos_curl_default_read_callback(char *buffer, size_t size, size_t nitems, void *instream);
 
+static void * APR_THREAD_FUNC aos_crc64_stage_hash(apr_thread_t *thd, void *data);
+static void aos_crc64_stage_reap(aos_crc64_stage_t *stage, int max_pending_num);
+static apr_status_t aos_crc64_stage_cleanup(void *data);
+
+static int aos_init_curl_context_headers(aos_curl_http_transport_t *t, aos_http_request_context_t *ctx)
+{
+    int pos;
+    int num;
+    int has_length;
+    struct curl_slist *node;
+    const aos_array_header_t *tarr;
+    const aos_table_entry_t *telts;
+
+    has_length = t->req->method == HTTP_PUT || t->req->method == HTTP_POST;
+    tarr = aos_table_elts(t->req->headers);
+    telts = (aos_table_entry_t*)tarr->elts;
+    num = tarr->nelts + has_length;
+    if (num == 0) {
+        return AOSE_OK;
+    }
+
+    // the nodes are kept by the context, curl only reads them
+    if ((node = aos_http_request_context_header_nodes(ctx, num)) == NULL) {
+        return AOSE_OUT_MEMORY;
+    }
+    t->headers = node;
+
+    if (has_length) {
+        node->data = apr_psprintf(t->pool, "Content-Length: %" APR_INT64_T_FMT, t->req->body_len);
+        node = node->next;
+    }
+    for (pos = 0; pos < tarr->nelts; ++pos) {
+        node->data = apr_pstrcat(t->pool, telts[pos].key, ": ", telts[pos].val, NULL);
+        node = node->next;
+    }
+
+    return AOSE_OK;
+}
+
 static void aos_init_curl_headers(aos_curl_http_transport_t *t)
 {
     int pos;
@@ -26,6 +123,12 @@ static void aos_init_curl_headers(aos_curl_http_transport_t *t)
     const aos_table_entry_t *telts;
     union aos_func_u func;
 
+    if (t->controller->context != NULL && 
+        aos_init_curl_context_headers(t, t->controller->context) == AOSE_OK)
+    {
+        return;
+    }
+
     if (t->req->method == HTTP_PUT || t->req->method == HTTP_POST) {
         header = apr_psprintf(t->pool, "Content-Length: %" APR_INT64_T_FMT, t->req->body_len);
         t->headers = curl_slist_append(t->headers, header);
@@ -47,17 +150,9 @@ static int aos_init_curl_url(aos_curl_http_transport_t *t)
     int rs;
     const char *proto;
     aos_string_t querystr;
-    char uristr[3*AOS_MAX_URI_LEN+1];
 
-    uristr[0] = '\0';
     aos_str_null(&querystr);
     
-    if ((rs = aos_url_encode(uristr, t->req->uri, AOS_MAX_URI_LEN)) != AOSE_OK) {
-        t->controller->error_code = rs;
-        t->controller->reason = "uri invalid argument.";
-        return rs;
-    }
-
     if ((rs = aos_query_params_to_string(t->pool, t->req->query_params, &querystr)) != AOSE_OK) {
         t->controller->error_code = rs;
         t->controller->reason = "query params invalid argument.";
@@ -65,18 +160,10 @@ static int aos_init_curl_url(aos_curl_http_transport_t *t)
     }
 
     proto = strlen(t->req->proto) != 0 ? t->req->proto : AOS_HTTP_PREFIX;
-    if (querystr.len == 0) {
-        t->url = apr_psprintf(t->pool, "%s%s/%s",
-                              proto,
-                              t->req->host,
-                              uristr);
-    } else {
-        t->url = apr_psprintf(t->pool, "%s%s/%s%.*s",
-                              proto,
-                              t->req->host,
-                              uristr,
-                              querystr.len,
-                              querystr.data);
+    if ((rs = aos_build_url(t->pool, proto, t->req->host, t->req->uri, &querystr, &t->url)) != AOSE_OK) {
+        t->controller->error_code = rs;
+        t->controller->reason = "uri invalid argument.";
+        return rs;
     }
     aos_debug_log("url:%s.", t->url);
 
@@ -118,10 +205,6 @@ aos_http_transport_t *aos_curl_http_transport_create(aos_pool_t *p)
 
     func.func1 = (aos_func1_pt)aos_transport_cleanup;
     aos_fstack_push(t->cleanup, t, func, 1);
-    
-    t->curl = aos_request_get();
-    func.func1 = (aos_func1_pt)request_release;
-    aos_fstack_push(t->cleanup, t->curl, func, 1);
 
     t->header_callback = aos_curl_default_header_callback;
     t->read_callback = aos_curl_default_read_callback;
@@ -164,6 +247,77 @@ void aos_curl_response_headers_parse(aos_pool_t *p, aos_table_t *headers, char *
     apr_table_addn(headers, aos_pstrdup(p, &key), aos_pstrdup(p, &value));
 }
 
+void aos_http_response_parse_header(aos_http_response_t *resp, const char *buffer, int len)
+{
+    char *pos;
+    char *line;
+    aos_string_t str;
+    aos_string_t key;
+    aos_string_t value;
+    aos_http_header_t *header;
+
+    str.data = (char *)buffer;
+    str.len = len;
+
+    aos_trip_space_and_cntrl(&str);
+
+    pos = aos_strlchr(str.data, str.data + str.len, ':');
+    if (pos == NULL) {
+        return;
+    }
+    key.data = str.data;
+    key.len = pos - str.data;
+
+    pos += 1;
+    value.len = str.data + str.len - pos;
+    value.data = pos;
+    aos_strip_space(&value);
+
+    // the key and the value in one block
+    line = (char *)aos_palloc(resp->pool, key.len + value.len + 2);
+    memcpy(line, key.data, key.len);
+    line[key.len] = '\0';
+    memcpy(line + key.len + 1, value.data, value.len);
+    line[key.len + 1 + value.len] = '\0';
+    key.data = line;
+    value.data = line + key.len + 1;
+
+    if (resp->header_lines == NULL) {
+        resp->header_lines = apr_array_make(resp->pool, 16, sizeof(aos_http_header_t));
+    }
+    header = (aos_http_header_t *)apr_array_push(resp->header_lines);
+    header->key = key.data;
+    header->value = value.data;
+
+    switch (key.len) {
+        case sizeof("ETag") - 1:
+            if (strcasecmp(key.data, "ETag") == 0) {
+                resp->etag = value;
+            }
+            break;
+        case sizeof("Content-Length") - 1:
+            if (strcasecmp(key.data, "Content-Length") == 0) {
+                resp->content_length = aos_atoi64(value.data);
+            }
+            break;
+        case sizeof("x-oss-request-id") - 1:
+            if (strcasecmp(key.data, "x-oss-request-id") == 0) {
+                resp->req_id = value.data;
+            } else if (resp->req_id == NULL && strcasecmp(key.data, "x-img-request-id") == 0) {
+                resp->req_id = value.data;
+            }
+            break;
+        case sizeof("x-oss-hash-crc64ecma") - 1:
+            if (strcasecmp(key.data, OSS_HASH_CRC64_ECMA) == 0) {
+                resp->hash_crc64 = aos_atoui64(value.data);
+                resp->has_hash_crc64 = 1;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
 size_t aos_curl_default_header_callback(char *buffer, size_t size, size_t nitems, void *userdata)
 {
     int len;
@@ -176,7 +330,7 @@ size_t aos_curl_default_header_callback(char *buffer, size_t size, size_t nitems
         t->controller->first_byte_time = apr_time_now();
     }
 
-    aos_curl_response_headers_parse(t->pool, t->resp->headers, buffer, len);
+    aos_http_response_parse_header(t->resp, buffer, len);
 
     aos_move_transport_state(t, TRANS_STATE_HEADER);
 
@@ -187,7 +341,6 @@ static void aos_curl_transport_headers_done(aos_curl_http_transport_t *t)
 {
     long http_code;
     CURLcode code;
-    const char *value;
 
     if (t->controller->error_code != AOSE_OK) {
         aos_debug_log("has error %d.", t->controller->error_code);
@@ -207,17 +360,13 @@ static void aos_curl_transport_headers_done(aos_curl_http_transport_t *t)
     } else {
         t->resp->status = http_code;
     }
-
-    value = apr_table_get(t->resp->headers, "Content-Length");
-    if (value != NULL) {
-        t->resp->content_length = aos_atoi64(value);
-    }
 }
 
 size_t aos_curl_default_write_callback(char *ptr, size_t size, size_t nmemb, void *userdata)
 {
     int len;
     int bytes;
+    int rv;
     aos_curl_http_transport_t *t;
 
     t = (aos_curl_http_transport_t *)(userdata);
@@ -251,6 +400,27 @@ size_t aos_curl_default_write_callback(char *ptr, size_t size, size_t nmemb, voi
         return 0;
     }
 
+    if (t->resp->type == BODY_IN_MEMORY) {
+        rv = AOSE_OK;
+        if (t->resp_memory == NULL) {
+            // a known length is reserved before the first write, the only place the transfer waits
+            t->resp_memory = aos_memory_hold_create(t->resp->pool);
+            if (t->resp->content_length > 0) {
+                rv = aos_memory_hold_reserve(t->resp_memory, t->resp->content_length, 1);
+            }
+        }
+        if (rv == AOSE_OK) {
+            rv = aos_memory_hold_use(t->resp_memory, len, t->resp->content_length <= 0);
+        }
+        if (rv != AOSE_OK) {
+            t->controller->reason = apr_psprintf(t->pool, 
+                 "memory budget exhausted, current body size: %" APR_INT64_T_FMT, t->resp->body_len);
+            t->controller->error_code = AOSE_OVER_MEMORY;
+            aos_error_log("error reason:%s, ", t->controller->reason);
+            return 0;
+        }
+    }
+
     if ((bytes = t->resp->write_body(t->resp, ptr, len)) < 0) {
         aos_debug_log("write body failure, %d.", bytes);
         t->controller->error_code = AOSE_WRITE_BODY_ERROR;
@@ -266,7 +436,14 @@ size_t aos_curl_default_write_callback(char *ptr, size_t size, size_t nmemb, voi
 
         // crc
         if (t->controller->options->enable_crc) {
-            t->resp->crc64 = aos_crc64(t->resp->crc64, ptr, bytes);
+            if (t->controller->options->enable_crc_offload && t->resp_crc_stage == NULL) {
+                t->resp_crc_stage = aos_crc64_stage_create(t->pool, t->resp->crc64, t->resp->content_length);
+            }
+            if (t->resp_crc_stage != NULL) {
+                aos_crc64_stage_feed(t->resp_crc_stage, ptr, bytes);
+            } else {
+                t->resp->crc64 = aos_crc64(t->resp->crc64, ptr, bytes);
+            }
         }
     }
     
@@ -305,7 +482,14 @@ size_t aos_curl_default_read_callback(char *buffer, size_t size, size_t nitems,
 
         // crc
         if (t->controller->options->enable_crc) {
-            t->req->crc64 = aos_crc64(t->req->crc64, buffer, bytes);
+            if (t->controller->options->enable_crc_offload && t->req_crc_stage == NULL) {
+                t->req_crc_stage = aos_crc64_stage_create(t->pool, t->req->crc64, t->req->body_len);
+            }
+            if (t->req_crc_stage != NULL) {
+                aos_crc64_stage_feed(t->req_crc_stage, buffer, bytes);
+            } else {
+                t->req->crc64 = aos_crc64(t->req->crc64, buffer, bytes);
+            }
         }
     }
 
@@ -336,6 +520,186 @@ static int aos_curl_code_to_status(CURLcode code)
     }
 }
 
+int aos_crc64_stage_initialize(aos_pool_t *p)
+{
+    int s;
+
+    aos_crc64_zeros_init(&aos_crc64_chunk_zeros, AOS_CRC64_CHUNK_SIZE);
+    if ((s = apr_thread_pool_create(&aos_crc64_thread_pool, 0, AOS_CRC64_THREAD_NUM, p)) != APR_SUCCESS) {
+        aos_crc64_thread_pool = NULL;
+        return s;
+    }
+
+    return AOSE_OK;
+}
+
+void aos_crc64_stage_deinitialize()
+{
+    if (aos_crc64_thread_pool != NULL) {
+        apr_thread_pool_destroy(aos_crc64_thread_pool);
+        aos_crc64_thread_pool = NULL;
+    }
+}
+
+aos_crc64_stage_t *aos_crc64_stage_create(aos_pool_t *p, uint64_t crc64, int64_t size)
+{
+    int i;
+    aos_crc64_stage_t *stage;
+
+    // a body of one chunk would be hashed by finish on the transfer thread anyway
+    if (size <= AOS_CRC64_CHUNK_SIZE) {
+        return NULL;
+    }
+
+    stage = (aos_crc64_stage_t *)aos_pcalloc(p, sizeof(aos_crc64_stage_t));
+    stage->crc64 = crc64;
+
+    if (aos_crc64_thread_pool == NULL) {
+        return stage;
+    }
+
+    if (aos_memory_budget_acquire(AOS_CRC64_CHUNK_NUM * AOS_CRC64_CHUNK_SIZE, 0) != AOSE_OK) {
+        aos_debug_log("crc64 stage over the memory budget, hash inline.");
+        return stage;
+    }
+
+    if (apr_thread_mutex_create(&stage->mutex, APR_THREAD_MUTEX_DEFAULT, p) != APR_SUCCESS ||
+        apr_thread_cond_create(&stage->cond, p) != APR_SUCCESS ||
+        (stage->bufs = (char *)malloc(AOS_CRC64_CHUNK_NUM * AOS_CRC64_CHUNK_SIZE)) == NULL)
+    {
+        aos_warn_log("crc64 stage create failure, hash inline.");
+        aos_memory_budget_release(AOS_CRC64_CHUNK_NUM * AOS_CRC64_CHUNK_SIZE);
+        stage->mutex = NULL;
+        return stage;
+    }
+
+    for (i = 0; i < AOS_CRC64_CHUNK_NUM; i++) {
+        stage->chunks[i].buf = stage->bufs + (size_t)i * AOS_CRC64_CHUNK_SIZE;
+        stage->chunks[i].stage = stage;
+    }
+    apr_pool_cleanup_register(p, stage, aos_crc64_stage_cleanup, apr_pool_cleanup_null);
+
+    return stage;
+}
+
+static apr_status_t aos_crc64_stage_cleanup(void *data)
+{
+    aos_crc64_stage_t *stage = (aos_crc64_stage_t *)data;
+
+    aos_crc64_stage_reap(stage, 0);
+    free(stage->bufs);
+    aos_memory_budget_release(AOS_CRC64_CHUNK_NUM * AOS_CRC64_CHUNK_SIZE);
+    stage->bufs = NULL;
+    stage->mutex = NULL;
+
+    return APR_SUCCESS;
+}
+
+static void * APR_THREAD_FUNC aos_crc64_stage_hash(apr_thread_t *thd, void *data)
+{
+    uint64_t crc64;
+    aos_crc64_chunk_t *chunk = (aos_crc64_chunk_t *)data;
+
+    crc64 = aos_crc64(0, chunk->buf, chunk->len);
+
+    apr_thread_mutex_lock(chunk->stage->mutex);
+    chunk->crc64 = crc64;
+    chunk->state = AOS_CRC64_CHUNK_DONE;
+    apr_thread_cond_signal(chunk->stage->cond);
+    apr_thread_mutex_unlock(chunk->stage->mutex);
+
+    return NULL;
+}
+
+static void aos_crc64_stage_reap(aos_crc64_stage_t *stage, int max_pending_num)
+{
+    aos_crc64_chunk_t *chunk;
+
+    apr_thread_mutex_lock(stage->mutex);
+    while (stage->pending_num > 0) {
+        chunk = &stage->chunks[stage->head];
+        if (chunk->state != AOS_CRC64_CHUNK_DONE) {
+            if (stage->pending_num <= max_pending_num) {
+                break;
+            }
+            apr_thread_cond_wait(stage->cond, stage->mutex);
+            continue;
+        }
+
+        if (chunk->len == AOS_CRC64_CHUNK_SIZE) {
+            stage->crc64 = aos_crc64_combine_zeros(&aos_crc64_chunk_zeros, stage->crc64, chunk->crc64);
+        } else {
+            stage->crc64 = aos_crc64_combine(stage->crc64, chunk->crc64, chunk->len);
+        }
+        chunk->len = 0;
+        chunk->state = AOS_CRC64_CHUNK_FREE;
+        stage->head = (stage->head + 1) % AOS_CRC64_CHUNK_NUM;
+        stage->pending_num--;
+    }
+    apr_thread_mutex_unlock(stage->mutex);
+}
+
+static void aos_crc64_stage_submit(aos_crc64_stage_t *stage, aos_crc64_chunk_t *chunk)
+{
+    apr_thread_mutex_lock(stage->mutex);
+    chunk->state = AOS_CRC64_CHUNK_HASHING;
+    stage->pending_num++;
+    apr_thread_mutex_unlock(stage->mutex);
+
+    if (apr_thread_pool_push(aos_crc64_thread_pool, aos_crc64_stage_hash, chunk, 
+                             APR_THREAD_TASK_PRIORITY_NORMAL, NULL) != APR_SUCCESS)
+    {
+        aos_crc64_stage_hash(NULL, chunk);
+    }
+}
+
+void aos_crc64_stage_feed(aos_crc64_stage_t *stage, const char *buf, size_t len)
+{
+    size_t n;
+    aos_crc64_chunk_t *chunk;
+
+    if (stage->mutex == NULL) {
+        stage->crc64 = aos_crc64(stage->crc64, (void *)buf, len);
+        return;
+    }
+
+    while (len > 0) {
+        // wait for the oldest chunk when all of them are hashing
+        aos_crc64_stage_reap(stage, AOS_CRC64_CHUNK_NUM - 1);
+
+        chunk = &stage->chunks[(stage->head + stage->pending_num) % AOS_CRC64_CHUNK_NUM];
+        n = aos_min(len, AOS_CRC64_CHUNK_SIZE - chunk->len);
+        memcpy(chunk->buf + chunk->len, buf, n);
+        chunk->len += n;
+        buf += n;
+        len -= n;
+
+        if (chunk->len == AOS_CRC64_CHUNK_SIZE) {
+            aos_crc64_stage_submit(stage, chunk);
+        }
+    }
+}
+
+uint64_t aos_crc64_stage_finish(aos_crc64_stage_t *stage)
+{
+    aos_crc64_chunk_t *chunk;
+
+    if (stage->mutex == NULL) {
+        return stage->crc64;
+    }
+
+    aos_crc64_stage_reap(stage, 0);
+
+    // the tail is hashed here, the pipeline is drained already
+    chunk = &stage->chunks[stage->head];
+    if (chunk->len > 0) {
+        stage->crc64 = aos_crc64(stage->crc64, chunk->buf, chunk->len);
+        chunk->len = 0;
+    }
+
+    return stage->crc64;
+}
+
 static void aos_curl_transport_finish(aos_curl_http_transport_t *t)
 {
     aos_curl_transport_headers_done(t);
@@ -346,28 +710,55 @@ static void aos_curl_transport_finish(aos_curl_http_transport_t *t)
     }
 }
 
-int aos_curl_transport_setup(aos_curl_http_transport_t *t)
+static int aos_curl_profile_str_equal(const char *a, const char *b)
+{
+    if (a == NULL || b == NULL) {
+        return a == b;
+    }
+    return a == b || strcmp(a, b) == 0;
+}
+
+static int aos_curl_profile_key_equal(const aos_curl_profile_key_t *a, const aos_curl_profile_key_t *b)
+{
+    return a->header_callback == b->header_callback &&
+        a->read_callback == b->read_callback &&
+        a->write_callback == b->write_callback &&
+        a->dns_cache_timeout == b->dns_cache_timeout &&
+        a->connect_timeout == b->connect_timeout &&
+        a->speed_limit == b->speed_limit &&
+        a->speed_time == b->speed_time &&
+        aos_curl_profile_str_equal(a->user_agent, b->user_agent) &&
+        aos_curl_profile_str_equal(a->proxy_host, b->proxy_host) &&
+        aos_curl_profile_str_equal(a->proxy_auth, b->proxy_auth);
+}
+
+static void aos_curl_profile_key_init(aos_curl_http_transport_t *t, aos_curl_profile_key_t *key)
+{
+    key->header_callback = t->header_callback;
+    key->read_callback = t->read_callback;
+    key->write_callback = t->write_callback;
+    key->user_agent = t->options->user_agent;
+    key->dns_cache_timeout = t->controller->options->dns_cache_timeout;
+    key->connect_timeout = t->controller->options->connect_timeout;
+    key->speed_limit = t->controller->options->speed_limit;
+    key->speed_time = t->controller->options->speed_time;
+    key->proxy_host = t->controller->options->proxy_host;
+    key->proxy_auth = t->controller->options->proxy_auth;
+}
+
+/* the options of the profile, the same for every request */
+static CURLcode aos_curl_profile_setup(CURL *curl, const aos_curl_profile_key_t *key)
 {
     CURLcode code;
 
 #define curl_easy_setopt_safe(opt, val)                                 \
-    if ((code = curl_easy_setopt(t->curl, opt, val)) != CURLE_OK) {    \
-            t->controller->reason = apr_pstrdup(t->pool, curl_easy_strerror(code)); \
-            t->controller->error_code = AOSE_FAILED_INITIALIZE;         \
-            aos_error_log("curl_easy_setopt failed, code:%d %s.", code, t->controller->reason); \
-            return AOSE_FAILED_INITIALIZE;                              \
+    if ((code = curl_easy_setopt(curl, opt, val)) != CURLE_OK) {       \
+            return code;                                                \
     }
 
-    curl_easy_setopt_safe(CURLOPT_PRIVATE, t);
-
-    curl_easy_setopt_safe(CURLOPT_HEADERDATA, t);
-    curl_easy_setopt_safe(CURLOPT_HEADERFUNCTION, t->header_callback);
-    
-    curl_easy_setopt_safe(CURLOPT_READDATA, t);
-    curl_easy_setopt_safe(CURLOPT_READFUNCTION, t->read_callback);
-    
-    curl_easy_setopt_safe(CURLOPT_WRITEDATA, t);    
-    curl_easy_setopt_safe(CURLOPT_WRITEFUNCTION, t->write_callback);
+    curl_easy_setopt_safe(CURLOPT_HEADERFUNCTION, key->header_callback);
+    curl_easy_setopt_safe(CURLOPT_READFUNCTION, key->read_callback);
+    curl_easy_setopt_safe(CURLOPT_WRITEFUNCTION, key->write_callback);
 
     curl_easy_setopt_safe(CURLOPT_FILETIME, 1);
     curl_easy_setopt_safe(CURLOPT_NOSIGNAL, 1);
@@ -377,28 +768,195 @@ int aos_curl_transport_setup(aos_curl_http_transport_t *t)
 
     // transport options
     curl_easy_setopt_safe(CURLOPT_SSL_VERIFYPEER, 0);
-    curl_easy_setopt_safe(CURLOPT_USERAGENT, t->options->user_agent);
+    curl_easy_setopt_safe(CURLOPT_USERAGENT, key->user_agent);
 
     // request options
-    curl_easy_setopt_safe(CURLOPT_DNS_CACHE_TIMEOUT, t->controller->options->dns_cache_timeout);
-    curl_easy_setopt_safe(CURLOPT_CONNECTTIMEOUT, t->controller->options->connect_timeout);
-    curl_easy_setopt_safe(CURLOPT_LOW_SPEED_LIMIT, t->controller->options->speed_limit);
-    curl_easy_setopt_safe(CURLOPT_LOW_SPEED_TIME, t->controller->options->speed_time);
-
-    aos_init_curl_headers(t);
-    curl_easy_setopt_safe(CURLOPT_HTTPHEADER, t->headers);
+    curl_easy_setopt_safe(CURLOPT_DNS_CACHE_TIMEOUT, key->dns_cache_timeout);
+    curl_easy_setopt_safe(CURLOPT_CONNECTTIMEOUT, key->connect_timeout);
+    curl_easy_setopt_safe(CURLOPT_LOW_SPEED_LIMIT, key->speed_limit);
+    curl_easy_setopt_safe(CURLOPT_LOW_SPEED_TIME, key->speed_time);
 
-    if (t->controller->options->proxy_host != NULL) {
+    if (key->proxy_host != NULL) {
         // proxy
         curl_easy_setopt_safe(CURLOPT_PROXYTYPE, CURLPROXY_HTTP);
-        curl_easy_setopt_safe(CURLOPT_PROXY, t->controller->options->proxy_host);
+        curl_easy_setopt_safe(CURLOPT_PROXY, key->proxy_host);
         // authorize
-        if (t->controller->options->proxy_auth != NULL) {
+        if (key->proxy_auth != NULL) {
             curl_easy_setopt_safe(CURLOPT_PROXYAUTH, CURLAUTH_BASIC);
-            curl_easy_setopt_safe(CURLOPT_PROXYUSERPWD, t->controller->options->proxy_auth);
+            curl_easy_setopt_safe(CURLOPT_PROXYUSERPWD, key->proxy_auth);
+        }
+    }
+
+#undef curl_easy_setopt_safe
+
+    return CURLE_OK;
+}
+
+/* the profile matching the key, added while there is room, NULL otherwise */
+static aos_curl_profile_t *aos_curl_profile_get(const aos_curl_profile_key_t *key)
+{
+    int i;
+    CURL *curl_template;
+    aos_curl_profile_t *profile = NULL;
+
+    if (aos_curl_profile_mutex == NULL) {
+        return NULL;
+    }
+
+    apr_thread_mutex_lock(aos_curl_profile_mutex);
+    for (i = 0; i < aos_curl_profile_num; i++) {
+        if (aos_curl_profile_key_equal(&aos_curl_profiles[i].key, key)) {
+            profile = &aos_curl_profiles[i];
+            break;
+        }
+    }
+
+    if (profile == NULL && aos_curl_profile_num < AOS_CURL_PROFILE_NUM) {
+        if ((curl_template = curl_easy_init()) != NULL && aos_curl_profile_setup(curl_template, key) == CURLE_OK) {
+            profile = &aos_curl_profiles[aos_curl_profile_num++];
+            profile->curl_template = curl_template;
+            profile->handle_num = 0;
+            profile->key = *key;
+            // the strings of the options may not outlive them
+            profile->key.user_agent = apr_pstrdup(aos_curl_profile_pool, key->user_agent);
+            profile->key.proxy_host = apr_pstrdup(aos_curl_profile_pool, key->proxy_host);
+            profile->key.proxy_auth = apr_pstrdup(aos_curl_profile_pool, key->proxy_auth);
+        } else if (curl_template != NULL) {
+            curl_easy_cleanup(curl_template);
+        }
+    }
+    apr_thread_mutex_unlock(aos_curl_profile_mutex);
+
+    return profile;
+}
+
+static CURL *aos_curl_profile_request_get(aos_curl_profile_t *profile)
+{
+    CURL *request = NULL;
+
+    apr_thread_mutex_lock(aos_curl_profile_mutex);
+    if (profile->handle_num > 0) {
+        request = profile->handles[--profile->handle_num];
+    }
+    apr_thread_mutex_unlock(aos_curl_profile_mutex);
+
+    if (request == NULL) {
+        request = curl_easy_duphandle(profile->curl_template);
+    }
+
+    return request;
+}
+
+static void aos_curl_profile_request_release(aos_curl_profile_t *profile, CURL *request)
+{
+    apr_thread_mutex_lock(aos_curl_profile_mutex);
+
+    // the most-recently-used handle is reused first, as by request_release
+    if (profile->handle_num == AOS_REQUEST_STACK_SIZE) {
+        apr_thread_mutex_unlock(aos_curl_profile_mutex);
+        curl_easy_cleanup(request);
+    } else {
+        profile->handles[profile->handle_num++] = request;
+        apr_thread_mutex_unlock(aos_curl_profile_mutex);
+    }
+}
+
+int aos_curl_profile_initialize(aos_pool_t *p)
+{
+    int s;
+
+    if ((s = apr_thread_mutex_create(&aos_curl_profile_mutex, APR_THREAD_MUTEX_DEFAULT, p)) != APR_SUCCESS) {
+        aos_curl_profile_mutex = NULL;
+        return s;
+    }
+    aos_curl_profile_pool = p;
+    aos_curl_profile_num = 0;
+
+    return AOSE_OK;
+}
+
+void aos_curl_profile_deinitialize()
+{
+    aos_curl_profile_t *profile;
+
+    while (aos_curl_profile_num > 0) {
+        profile = &aos_curl_profiles[--aos_curl_profile_num];
+        while (profile->handle_num > 0) {
+            curl_easy_cleanup(profile->handles[--profile->handle_num]);
         }
+        curl_easy_cleanup(profile->curl_template);
+        profile->curl_template = NULL;
+    }
+    aos_curl_profile_mutex = NULL;
+    aos_curl_profile_pool = NULL;
+}
+
+static void aos_curl_transport_release_handle(aos_curl_http_transport_t *t)
+{
+    if (t->profile != NULL) {
+        aos_curl_profile_request_release(t->profile, t->curl);
+    } else {
+        request_release(t->curl);
+    }
+    t->curl = NULL;
+}
+
+static int aos_curl_transport_init_handle(aos_curl_http_transport_t *t)
+{
+    CURLcode code;
+    aos_func_u func;
+    aos_curl_profile_key_t key;
+
+    aos_curl_profile_key_init(t, &key);
+    t->profile = aos_curl_profile_get(&key);
+
+    if (t->profile != NULL) {
+        t->curl = aos_curl_profile_request_get(t->profile);
+        code = t->curl != NULL ? CURLE_OK : CURLE_OUT_OF_MEMORY;
+    } else {
+        t->curl = aos_request_get();
+        code = t->curl != NULL ? aos_curl_profile_setup(t->curl, &key) : CURLE_OUT_OF_MEMORY;
+    }
+
+    if (t->curl != NULL) {
+        func.func1 = (aos_func1_pt)aos_curl_transport_release_handle;
+        aos_fstack_push(t->cleanup, t, func, 1);
+    }
+
+    if (code != CURLE_OK) {
+        t->controller->reason = apr_pstrdup(t->pool, curl_easy_strerror(code));
+        t->controller->error_code = AOSE_FAILED_INITIALIZE;
+        aos_error_log("curl handle init failed, code:%d %s.", code, t->controller->reason);
+        return AOSE_FAILED_INITIALIZE;
+    }
+
+    return AOSE_OK;
+}
+
+int aos_curl_transport_setup(aos_curl_http_transport_t *t)
+{
+    CURLcode code;
+
+    if (aos_curl_transport_init_handle(t) != AOSE_OK) {
+        return AOSE_FAILED_INITIALIZE;
+    }
+
+#define curl_easy_setopt_safe(opt, val)                                 \
+    if ((code = curl_easy_setopt(t->curl, opt, val)) != CURLE_OK) {    \
+            t->controller->reason = apr_pstrdup(t->pool, curl_easy_strerror(code)); \
+            t->controller->error_code = AOSE_FAILED_INITIALIZE;         \
+            aos_error_log("curl_easy_setopt failed, code:%d %s.", code, t->controller->reason); \
+            return AOSE_FAILED_INITIALIZE;                              \
     }
 
+    curl_easy_setopt_safe(CURLOPT_PRIVATE, t);
+    curl_easy_setopt_safe(CURLOPT_HEADERDATA, t);
+    curl_easy_setopt_safe(CURLOPT_READDATA, t);
+    curl_easy_setopt_safe(CURLOPT_WRITEDATA, t);    
+
+    aos_init_curl_headers(t);
+    curl_easy_setopt_safe(CURLOPT_HTTPHEADER, t->headers);
+
     if (NULL == t->req->signed_url) {
         if (aos_init_curl_url(t) != AOSE_OK) {
             return t->controller->error_code;
@@ -409,6 +967,9 @@ int aos_curl_transport_setup(aos_curl_http_transport_t *t)
     }
     curl_easy_setopt_safe(CURLOPT_URL, t->url);
 
+    // a pooled handle keeps the method of its last request
+    curl_easy_setopt_safe(CURLOPT_HTTPGET, 1);
+    curl_easy_setopt_safe(CURLOPT_CUSTOMREQUEST, (char *)NULL);
     switch (t->req->method) {
         case HTTP_HEAD:
             curl_easy_setopt_safe(CURLOPT_NOBODY, 1);
@@ -440,6 +1001,7 @@ int aos_curl_http_transport_perform(aos_http_transport_t *t_)
     aos_curl_http_transport_t *t = (aos_curl_http_transport_t *)(t_);
     ecode = aos_curl_transport_setup(t);
     if (ecode != AOSE_OK) {
+        aos_curl_transport_finish(t);
         return ecode;
     }
 
@@ -447,6 +1009,14 @@ int aos_curl_http_transport_perform(aos_http_transport_t *t_)
     code = curl_easy_perform(t->curl);
     t->controller->finish_time = apr_time_now();
     aos_move_transport_state(t, TRANS_STATE_DONE);
+
+    // drain the crc64 stages before the callers check the crc
+    if (t->req_crc_stage != NULL) {
+        t->req->crc64 = aos_crc64_stage_finish(t->req_crc_stage);
+    }
+    if (t->resp_crc_stage != NULL) {
+        t->resp->crc64 = aos_crc64_stage_finish(t->resp_crc_stage);
+    }
     
     if ((code != CURLE_OK) && (t->controller->error_code == AOSE_OK)) {
         ecode = aos_curl_code_to_status(code);
@@ -3,6 +3,7 @@
 
 #include "aos_define.h"
 #include "aos_buf.h"
+#include "aos_string.h"
 
 
 AOS_CPP_START
@@ -15,6 +16,10 @@ typedef struct aos_http_controller_s aos_http_controller_t;
 typedef struct aos_http_request_options_s aos_http_request_options_t;
 typedef struct aos_http_transport_options_s aos_http_transport_options_t;
 typedef struct aos_curl_http_transport_s aos_curl_http_transport_t;
+typedef struct aos_crc64_stage_s aos_crc64_stage_t;
+typedef struct aos_http_request_context_s aos_http_request_context_t;
+typedef struct aos_memory_hold_s aos_memory_hold_t;
+typedef struct aos_curl_profile_s aos_curl_profile_t;
 
 typedef int (*aos_read_http_body_pt)(aos_http_request_t *req, char *buffer, int len);
 typedef int (*aos_write_http_body_pt)(aos_http_response_t *resp, const char *buffer, int len);
@@ -22,9 +27,46 @@ typedef int (*aos_write_http_body_pt)(aos_http_response_t *resp, const char *buf
 typedef void (*oss_progress_callback)(int64_t consumed_bytes, int64_t total_bytes);
 
 void aos_curl_response_headers_parse(aos_pool_t *p, aos_table_t *headers, char *buffer, int len);
+
+/*
+ * Parse a header line of the response. Content-Length, ETag, the crc64 and
+ * the request id are kept in their fields of the response, every header is
+ * kept in header_lines until aos_http_response_headers adds them to the
+ * headers table.
+ */
+void aos_http_response_parse_header(aos_http_response_t *resp, const char *buffer, int len);
 aos_http_transport_t *aos_curl_http_transport_create(aos_pool_t *p);
 int aos_curl_http_transport_perform(aos_http_transport_t *t);
 
+/*
+ * The curl options a transport sets the same way for every request, the
+ * callbacks, the timeouts, the user agent and the proxy, make a profile.
+ * Each of the first AOS_CURL_PROFILE_NUM profiles gets a template handle
+ * configured once, its handles are duplicated from the template and
+ * released to the stack of the profile, a request only sets the url, the
+ * headers, the method and the callback data. The transports of other
+ * profiles reset and configure a handle of the shared request stack.
+ */
+int aos_curl_profile_initialize(aos_pool_t *p);
+void aos_curl_profile_deinitialize();
+
+/*
+ * The crc64 hashing stage. The transfer thread copies body bytes into
+ * AOS_CRC64_CHUNK_SIZE chunks, full chunks are hashed on a shared thread
+ * pool and the partial crcs are combined in order with aos_crc64_combine.
+ * At most AOS_CRC64_CHUNK_NUM chunks are in flight per transfer, feed
+ * blocks on the oldest one when all of them are busy. finish hashes the
+ * last partial chunk, waits for the stage to drain and returns the crc.
+ * Without the thread pool the stage hashes inline. create returns NULL
+ * for a body of unknown size or of one chunk at most, the caller hashes
+ * such a body inline with aos_crc64.
+ */
+int aos_crc64_stage_initialize(aos_pool_t *p);
+void aos_crc64_stage_deinitialize();
+aos_crc64_stage_t *aos_crc64_stage_create(aos_pool_t *p, uint64_t crc64, int64_t size);
+void aos_crc64_stage_feed(aos_crc64_stage_t *stage, const char *buf, size_t len);
+uint64_t aos_crc64_stage_finish(aos_crc64_stage_t *stage);
+
 struct aos_http_request_options_s {
     int speed_limit;
     int speed_time;
@@ -32,6 +74,7 @@ struct aos_http_request_options_s {
     int connect_timeout;
     int64_t max_memory_size;
     int enable_crc;
+    int enable_crc_offload;
     char *proxy_host;
     char *proxy_auth;
 };
@@ -49,7 +92,8 @@ struct aos_http_transport_options_s {
     int64_t first_byte_time;                    \
     int64_t finish_time;                        \
     uint32_t owner:1;                           \
-    void *user_data;
+    void *user_data;                            \
+    aos_http_request_context_t *context;
 
 struct aos_http_controller_s {
     AOS_HTTP_BASE_CONTROLLER_DEFINE
@@ -62,6 +106,11 @@ typedef struct aos_http_controller_ex_s {
     char *reason; // can't modify
 } aos_http_controller_ex_t;
 
+typedef struct {
+    char *key;
+    char *value;
+} aos_http_header_t;
+
 typedef enum {
     BODY_IN_MEMORY = 0,
     BODY_IN_FILE,
@@ -113,6 +162,13 @@ struct aos_http_response_s {
 
     oss_progress_callback progress_callback;
     uint64_t crc64;
+
+    // the well-known headers, set as the headers are parsed
+    uint64_t hash_crc64;
+    aos_string_t etag;
+    char *req_id;
+    uint32_t has_hash_crc64:1;
+    aos_array_header_t *header_lines;
 };
 
 typedef enum {
@@ -145,6 +201,10 @@ struct aos_curl_http_transport_s {
     curl_read_callback header_callback;
     curl_read_callback read_callback;
     curl_write_callback write_callback;
+    aos_crc64_stage_t *req_crc_stage;
+    aos_crc64_stage_t *resp_crc_stage;
+    aos_memory_hold_t *resp_memory;
+    aos_curl_profile_t *profile;
 };
 
 AOS_CPP_END
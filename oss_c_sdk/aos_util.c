@@ -1,5 +1,6 @@
 #include "aos_util.h"
 #include "aos_log.h"
+#include <apr_thread_proc.h>
 
 static const char *g_s_wday[] = {
     "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"
@@ -48,6 +49,54 @@ int aos_convert_to_gmt_time(char* date, const char* format, apr_time_exp_t *tm)
     }
 }
 
+static int aos_parse_digits(const char *str, int num)
+{
+    int value = 0;
+    int i;
+
+    for (i = 0; i < num; i++) {
+        if (str[i] < '0' || str[i] > '9') {
+            return -1;
+        }
+        value = value * 10 + (str[i] - '0');
+    }
+    return value;
+}
+
+int aos_parse_iso8601_gmt_time(const char *str, int len, int64_t *t)
+{
+    apr_time_exp_t tm;
+    apr_time_t result;
+
+    // YYYY-MM-DDTHH:MM:SS, the fraction and the zone designator Z are optional
+    if (len < 19 || str[4] != '-' || str[7] != '-' || (str[10] != 'T' && str[10] != ' ') ||
+        str[13] != ':' || str[16] != ':') {
+        return AOSE_INVALID_ARGUMENT;
+    }
+
+    memset(&tm, 0, sizeof(tm));
+    tm.tm_year = aos_parse_digits(str, 4) - 1900;
+    tm.tm_mon = aos_parse_digits(str + 5, 2) - 1;
+    tm.tm_mday = aos_parse_digits(str + 8, 2);
+    tm.tm_hour = aos_parse_digits(str + 11, 2);
+    tm.tm_min = aos_parse_digits(str + 14, 2);
+    tm.tm_sec = aos_parse_digits(str + 17, 2);
+    if (tm.tm_year < 70 || tm.tm_mon < 0 || tm.tm_mon > 11 || tm.tm_mday < 1 || tm.tm_mday > 31 ||
+        tm.tm_hour < 0 || tm.tm_hour > 23 || tm.tm_min < 0 || tm.tm_min > 59 || tm.tm_sec < 0 || tm.tm_sec > 60) {
+        return AOSE_INVALID_ARGUMENT;
+    }
+
+    if (apr_time_exp_gmt_get(&result, &tm) != APR_SUCCESS) {
+        return AOSE_INVALID_ARGUMENT;
+    }
+    *t = apr_time_sec(result);
+    return AOSE_OK;
+}
+
+// the date of the last second formatted by this thread
+static AOS_THREAD_LOCAL apr_time_t g_s_gmt_sec = -1;
+static AOS_THREAD_LOCAL char g_s_gmt_str[AOS_MAX_GMT_TIME_LEN];
+
 int aos_get_gmt_str_time(char datestr[AOS_MAX_GMT_TIME_LEN])
 {
     int s;
@@ -56,6 +105,11 @@ int aos_get_gmt_str_time(char datestr[AOS_MAX_GMT_TIME_LEN])
     apr_time_exp_t result;
 
     now = apr_time_now();
+    if (apr_time_sec(now) == g_s_gmt_sec) {
+        memcpy(datestr, g_s_gmt_str, AOS_MAX_GMT_TIME_LEN);
+        return AOSE_OK;
+    }
+
     if ((s = apr_time_exp_gmt(&result, now)) != APR_SUCCESS) {
         aos_error_log("apr_time_exp_gmt fialure, code:%d %s.", s, apr_strerror(s, buf, sizeof(buf)));
         return AOSE_INTERNAL_ERROR;
@@ -64,95 +118,122 @@ int aos_get_gmt_str_time(char datestr[AOS_MAX_GMT_TIME_LEN])
     if ((s = aos_convert_to_gmt_time(datestr, g_s_gmt_format, &result))
         != AOSE_OK) {
         aos_error_log("aos_convert_to_GMT failure, code:%d.", s);
+        return s;
     }
 
+    memcpy(g_s_gmt_str, datestr, AOS_MAX_GMT_TIME_LEN);
+    g_s_gmt_sec = apr_time_sec(now);
+
     return s;
 }
 
 int aos_url_encode(char *dest, const char *src, int maxSrcSize)
 {
-    static const char *hex = "0123456789ABCDEF";
+    apr_size_t len = strlen(src);
 
-    int len = 0;
-    unsigned char c;
-
-    while (*src) {
-        if (++len > maxSrcSize) {
-            *dest = 0;
-            return AOSE_INVALID_ARGUMENT;
-        }
-        c = *src;
-        if (isalnum(c) || (c == '-') || (c == '_') || (c == '.') || (c == '~')) {
-            *dest++ = c;
-        } else if (*src == ' ') {
-            *dest++ = '%';
-            *dest++ = '2';
-            *dest++ = '0';
-        } else {
-            *dest++ = '%';
-            *dest++ = hex[c >> 4];
-            *dest++ = hex[c & 15];
-        }
-        src++;
+    if (len > (apr_size_t)maxSrcSize) {
+        *dest = 0;
+        return AOSE_INVALID_ARGUMENT;
     }
 
-    *dest = 0;
+    dest[aos_url_encode_buf(dest, src, len)] = 0;
 
     return AOSE_OK;
 }
 
 int aos_query_params_to_string(aos_pool_t *p, aos_table_t *query_params, aos_string_t *querystr)
 {
-    int rs;
     int pos;
-    int len;
+    apr_size_t len;
+    apr_size_t total = 0;
+    apr_size_t key_len;
+    apr_size_t val_len;
     char sep = '?';
-    char ebuf[AOS_MAX_QUERY_ARG_LEN*3+1];
-    char abuf[AOS_MAX_QUERY_ARG_LEN*6+128];
-    int max_len;
+    char *out;
     const aos_array_header_t *tarr;
     const aos_table_entry_t *telts;
-    aos_buf_t *querybuf;
 
     if (apr_is_empty_table(query_params)) {
         return AOSE_OK;
     }
 
-    max_len = sizeof(abuf)-1;
-    querybuf = aos_create_buf(p, 256);
     aos_str_null(querystr);
 
     tarr = aos_table_elts(query_params);
     telts = (aos_table_entry_t*)tarr->elts;
-    
+
+    // the exact length first, the args are checked as they were encoded one by one
     for (pos = 0; pos < tarr->nelts; ++pos) {
-        if ((rs = aos_url_encode(ebuf, telts[pos].key, AOS_MAX_QUERY_ARG_LEN)) != AOSE_OK) {
+        key_len = strlen(telts[pos].key);
+        if (key_len > AOS_MAX_QUERY_ARG_LEN) {
             aos_error_log("query params args too big, key:%s.", telts[pos].key);
             return AOSE_INVALID_ARGUMENT;
         }
-        len = apr_snprintf(abuf, max_len, "%c%s", sep, ebuf);
+        len = 1 + aos_url_encode_len(telts[pos].key, key_len);
         if (telts[pos].val != NULL && *telts[pos].val != '\0') {
-            if ((rs = aos_url_encode(ebuf, telts[pos].val, AOS_MAX_QUERY_ARG_LEN)) != AOSE_OK) {
+            val_len = strlen(telts[pos].val);
+            if (val_len > AOS_MAX_QUERY_ARG_LEN) {
                 aos_error_log("query params args too big, value:%s.", telts[pos].val);
                 return AOSE_INVALID_ARGUMENT;
             }
-            len += apr_snprintf(abuf+len, max_len-len, "=%s", ebuf);
+            len += 1 + aos_url_encode_len(telts[pos].val, val_len);
             if (len >= AOS_MAX_QUERY_ARG_LEN) {
-                aos_error_log("query params args too big, %s.", abuf);
+                aos_error_log("query params args too big, %s=%s.", telts[pos].key, telts[pos].val);
                 return AOSE_INVALID_ARGUMENT;
             }
         }
-        aos_buf_append_string(p, querybuf, abuf, len);
+        total += len;
+    }
+
+    out = aos_palloc(p, total + 1);
+    querystr->data = out;
+    for (pos = 0; pos < tarr->nelts; ++pos) {
+        *out++ = sep;
+        out += aos_url_encode_buf(out, telts[pos].key, strlen(telts[pos].key));
+        if (telts[pos].val != NULL && *telts[pos].val != '\0') {
+            *out++ = '=';
+            out += aos_url_encode_buf(out, telts[pos].val, strlen(telts[pos].val));
+        }
         sep = '&';
     }
+    *out = '\0';
 
     // result
-    querystr->data = (char *)querybuf->pos;
-    querystr->len = aos_buf_size(querybuf);
+    querystr->len = (int)total;
     
     return AOSE_OK;
 }
 
+int aos_build_url(aos_pool_t *p, const char *proto, const char *host, const char *uri, 
+                  const aos_string_t *querystr, char **url)
+{
+    apr_size_t proto_len = strlen(proto);
+    apr_size_t host_len = strlen(host);
+    apr_size_t uri_len = strlen(uri);
+    apr_size_t query_len = querystr->len > 0 ? (apr_size_t)querystr->len : 0;
+    char *out;
+
+    if (uri_len > AOS_MAX_URI_LEN) {
+        return AOSE_INVALID_ARGUMENT;
+    }
+
+    out = aos_palloc(p, proto_len + host_len + 1 + aos_url_encode_len(uri, uri_len) + query_len + 1);
+    *url = out;
+    memcpy(out, proto, proto_len);
+    out += proto_len;
+    memcpy(out, host, host_len);
+    out += host_len;
+    *out++ = '/';
+    out += aos_url_encode_buf(out, uri, uri_len);
+    if (query_len > 0) {
+        memcpy(out, querystr->data, query_len);
+        out += query_len;
+    }
+    *out = '\0';
+
+    return AOSE_OK;
+}
+
 void aos_gnome_sort(const char **headers, int size)
 {
     const char *tmp;
@@ -189,39 +270,7 @@ const char* aos_http_method_to_string(http_method_e method)
 
 int aos_base64_encode(const unsigned char *in, int inLen, char *out)
 {
-    static const char *ENC = 
-        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-
-    char *original_out = out;
-
-    while (inLen) {
-        // first 6 bits of char 1
-        *out++ = ENC[*in >> 2];
-        if (!--inLen) {
-            // last 2 bits of char 1, 4 bits of 0
-            *out++ = ENC[(*in & 0x3) << 4];
-            *out++ = '=';
-            *out++ = '=';
-            break;
-        }
-        // last 2 bits of char 1, first 4 bits of char 2
-        *out++ = ENC[((*in & 0x3) << 4) | (*(in + 1) >> 4)];
-        in++;
-        if (!--inLen) {
-            // last 4 bits of char 2, 2 bits of 0
-            *out++ = ENC[(*in & 0xF) << 2];
-            *out++ = '=';
-            break;
-        }
-        // last 4 bits of char 2, first 2 bits of char 3
-        *out++ = ENC[((*in & 0xF) << 2) | (*(in + 1) >> 6)];
-        in++;
-        // last 6 bits of char 3
-        *out++ = ENC[*in & 0x3F];
-        in++, inLen--;
-    }
-
-    return (out - original_out);
+    return (int)aos_base64_encode_buf(in, (apr_size_t)inLen, out);
 }
 
 // HMAC-SHA-1:
@@ -234,19 +283,25 @@ int aos_base64_encode(const unsigned char *in, int inLen, char *out)
 // HMAC(K,m) = SHA1((K ^ OPAD) . SHA1((K ^ IPAD) . m))
 void HMAC_SHA1(unsigned char hmac[20], const unsigned char *key, int key_len,
                const unsigned char *message, int message_len)
+{
+    aos_hmac_sha1_key_t hmac_key;
+
+    aos_hmac_sha1_key_init(&hmac_key, key, key_len);
+    aos_hmac_sha1(hmac, &hmac_key, message, message_len);
+}
+
+void aos_hmac_sha1_key_init(aos_hmac_sha1_key_t *key, const unsigned char *secret, int secret_len)
 {
     unsigned char kopad[64], kipad[64];
     int i;
-    unsigned char digest[APR_SHA1_DIGESTSIZE];
-    apr_sha1_ctx_t context;
     
-    if (key_len > 64) {
-        key_len = 64;
+    if (secret_len > 64) {
+        secret_len = 64;
     }
 
-    for (i = 0; i < key_len; i++) {
-        kopad[i] = key[i] ^ 0x5c;
-        kipad[i] = key[i] ^ 0x36;
+    for (i = 0; i < secret_len; i++) {
+        kopad[i] = secret[i] ^ 0x5c;
+        kipad[i] = secret[i] ^ 0x36;
     }
 
     for ( ; i < 64; i++) {
@@ -254,38 +309,159 @@ void HMAC_SHA1(unsigned char hmac[20], const unsigned char *key, int key_len,
         kipad[i] = 0 ^ 0x36;
     }
 
-    apr_sha1_init(&context);
-    apr_sha1_update(&context, (const char *)kipad, 64);
-    apr_sha1_update(&context, (const char *)message, (unsigned int)message_len);
-    apr_sha1_final(digest, &context);
+    aos_sha1_init(&key->inner);
+    aos_sha1_update(&key->inner, kipad, 64);
+
+    aos_sha1_init(&key->outer);
+    aos_sha1_update(&key->outer, kopad, 64);
 
-    apr_sha1_init(&context);
-    apr_sha1_update(&context, (const char *)kopad, 64);
-    apr_sha1_update(&context, (const char *)digest, 20);
-    apr_sha1_final(hmac, &context);
+    aos_secure_zero(kopad, sizeof(kopad));
+    aos_secure_zero(kipad, sizeof(kipad));
 }
 
-unsigned char* aos_md5(aos_pool_t* pool, const char *in, apr_size_t in_len) {
-    unsigned char* out;
-    apr_md5_ctx_t context;
+void aos_secure_zero(void *p, apr_size_t len)
+{
+    volatile unsigned char *v = (volatile unsigned char *)p;
 
-    //APR_MD5_DIGESTSIZE: The MD5 digest size, value is 16
-    out = aos_palloc(pool, APR_MD5_DIGESTSIZE + 1);
-    if (!out) {
-        return NULL;
+    while (len--) {
+        *v++ = 0;
     }
+}
 
-    if (0 != apr_md5_init(&context)) {
-        return NULL;
+typedef struct {
+    int secret_len;
+    unsigned char secret[64];
+    aos_hmac_sha1_key_t key;
+} aos_hmac_sha1_key_slot_t;
+
+typedef struct {
+    aos_hmac_sha1_key_slot_t slots[AOS_HMAC_KEY_CACHE_NUM];
+    int num;
+    int next;
+} aos_hmac_sha1_key_cache_t;
+
+static AOS_THREAD_LOCAL aos_hmac_sha1_key_cache_t *g_s_aos_hmac_key_cache = NULL;
+// the key state when the cache can not be allocated, the secret is not kept
+static AOS_THREAD_LOCAL aos_hmac_sha1_key_t g_s_aos_hmac_key_uncached;
+static apr_threadkey_t *aos_hmac_key_cache_key = NULL;
+
+static void aos_hmac_sha1_key_cache_destroy(void *data)
+{
+    aos_secure_zero(data, sizeof(aos_hmac_sha1_key_cache_t));
+    free(data);
+}
+
+static aos_hmac_sha1_key_cache_t *aos_hmac_sha1_key_cache_get()
+{
+    aos_hmac_sha1_key_cache_t *cache = g_s_aos_hmac_key_cache;
+
+    if (cache != NULL) {
+        return cache;
     }
 
-    if (0 != apr_md5_update(&context, in, in_len)) {
+    if ((cache = (aos_hmac_sha1_key_cache_t *)calloc(1, sizeof(aos_hmac_sha1_key_cache_t))) == NULL) {
         return NULL;
     }
+    if (aos_hmac_key_cache_key != NULL) {
+        apr_threadkey_private_set(cache, aos_hmac_key_cache_key);
+    }
+    g_s_aos_hmac_key_cache = cache;
+
+    return cache;
+}
+
+const aos_hmac_sha1_key_t *aos_hmac_sha1_key_get(const unsigned char *secret, int secret_len)
+{
+    int i;
+    aos_hmac_sha1_key_slot_t *slot;
+    aos_hmac_sha1_key_cache_t *cache = aos_hmac_sha1_key_cache_get();
+
+    // the key init only reads the first 64 bytes as well
+    secret_len = aos_min(secret_len, 64);
+
+    if (cache == NULL) {
+        aos_hmac_sha1_key_init(&g_s_aos_hmac_key_uncached, secret, secret_len);
+        return &g_s_aos_hmac_key_uncached;
+    }
+
+    for (i = 0; i < cache->num; i++) {
+        slot = &cache->slots[i];
+        if (slot->secret_len == secret_len && memcmp(slot->secret, secret, secret_len) == 0) {
+            return &slot->key;
+        }
+    }
+
+    if (cache->num < AOS_HMAC_KEY_CACHE_NUM) {
+        slot = &cache->slots[cache->num++];
+    } else {
+        slot = &cache->slots[cache->next];
+        cache->next = (cache->next + 1) % AOS_HMAC_KEY_CACHE_NUM;
+        aos_secure_zero(slot, sizeof(aos_hmac_sha1_key_slot_t));
+    }
+    slot->secret_len = secret_len;
+    memcpy(slot->secret, secret, secret_len);
+    aos_hmac_sha1_key_init(&slot->key, secret, secret_len);
+
+    return &slot->key;
+}
+
+int aos_hmac_sha1_key_cache_initialize(aos_pool_t *p)
+{
+    int s;
+
+    if ((s = apr_threadkey_private_create(&aos_hmac_key_cache_key, aos_hmac_sha1_key_cache_destroy, p)) != APR_SUCCESS) {
+        aos_hmac_key_cache_key = NULL;
+        return s;
+    }
+    if (g_s_aos_hmac_key_cache != NULL) {
+        apr_threadkey_private_set(g_s_aos_hmac_key_cache, aos_hmac_key_cache_key);
+    }
+
+    return AOSE_OK;
+}
+
+void aos_hmac_sha1_key_cache_deinitialize()
+{
+    if (aos_hmac_key_cache_key != NULL) {
+        apr_threadkey_private_set(NULL, aos_hmac_key_cache_key);
+        apr_threadkey_private_delete(aos_hmac_key_cache_key);
+        aos_hmac_key_cache_key = NULL;
+    }
+    if (g_s_aos_hmac_key_cache != NULL) {
+        aos_hmac_sha1_key_cache_destroy(g_s_aos_hmac_key_cache);
+        g_s_aos_hmac_key_cache = NULL;
+    }
+    aos_secure_zero(&g_s_aos_hmac_key_uncached, sizeof(aos_hmac_sha1_key_t));
+}
+
+void aos_hmac_sha1(unsigned char hmac[20], const aos_hmac_sha1_key_t *key,
+                   const unsigned char *message, int message_len)
+{
+    unsigned char digest[APR_SHA1_DIGESTSIZE];
+    aos_sha1_ctx_t context;
+
+    context = key->inner;
+    aos_sha1_update(&context, message, (apr_size_t)message_len);
+    aos_sha1_final(digest, &context);
+
+    context = key->outer;
+    aos_sha1_update(&context, digest, 20);
+    aos_sha1_final(hmac, &context);
+}
 
-    if (0 != apr_md5_final(out, &context)) {
+unsigned char* aos_md5(aos_pool_t* pool, const char *in, apr_size_t in_len) {
+    unsigned char* out;
+    aos_md5_ctx_t context;
+
+    //APR_MD5_DIGESTSIZE: The MD5 digest size, value is 16
+    out = aos_palloc(pool, APR_MD5_DIGESTSIZE + 1);
+    if (!out) {
         return NULL;
     }
+
+    aos_md5_init(&context);
+    aos_md5_update(&context, in, in_len);
+    aos_md5_final(out, &context);
     out[APR_MD5_DIGESTSIZE] = '\0';
     return out;
 };
@@ -5,6 +5,8 @@
 #include "aos_string.h"
 #include "aos_define.h"
 #include "aos_fstack.h"
+#include "aos_digest.h"
+#include "aos_codec.h"
 
 #include <mxml.h>
 #include <apr_md5.h>
@@ -19,11 +21,19 @@ void aos_gnome_sort(const char **headers, int size);
 int aos_convert_to_gmt_time(char* date, const char* format, apr_time_exp_t *tm);
 int aos_get_gmt_str_time(char datestr[AOS_MAX_GMT_TIME_LEN]);
 
+/**
+ * @brief parse the iso8601 gmt time like 2012-02-24T08:42:32.000Z
+ * @param[out] t  the seconds since epoch
+ * @return AOSE_OK success, AOSE_INVALID_ARGUMENT if the time is malformed
+ **/
+int aos_parse_iso8601_gmt_time(const char *str, int len, int64_t *t);
+
 /**
  * URL-encodes a string from [src] into [dest]. [dest] must have at least
- * 3x the number of characters that [source] has. At most [maxSrcSize] bytes
- * from [src] are encoded; if more are present in [src], 0 is returned from
- * urlEncode, else nonzero is returned.
+ * aos_url_encode_len(src, strlen(src)) + 1 bytes, 3x the number of
+ * characters that [src] has is always enough. At most [maxSrcSize] bytes
+ * from [src] are encoded; if more are present in [src],
+ * AOSE_INVALID_ARGUMENT is returned, else AOSE_OK is returned.
  */
 int aos_url_encode(char *dest, const char *src, int maxSrcSize);
 
@@ -35,10 +45,17 @@ const char* aos_http_method_to_string(http_method_e method);
  */
 int aos_query_params_to_string(aos_pool_t *p, aos_table_t *query_params, aos_string_t *querystr);
 
+/**
+ * build "proto host/uri querystr" into one string of the exact length, the
+ * uri is url-encoded and checked against AOS_MAX_URI_LEN
+ */
+int aos_build_url(aos_pool_t *p, const char *proto, const char *host, const char *uri, 
+                  const aos_string_t *querystr, char **url);
+
 /**
  * base64 encode bytes. The output buffer must have at least
- * ((4 * (inLen + 1)) / 3) bytes in it.  Returns the number of bytes written
- * to [out].
+ * AOS_BASE64_ENCODE_LEN(inLen) bytes in it.  Returns the number of bytes
+ * written to [out].
  */
 int aos_base64_encode(const unsigned char *in, int inLen, char *out);
 
@@ -49,6 +66,37 @@ int aos_base64_encode(const unsigned char *in, int inLen, char *out);
 void HMAC_SHA1(unsigned char hmac[20], const unsigned char *key, int key_len,
                const unsigned char *message, int message_len);
 
+/**
+ * The SHA-1 states after the inner and the outer padded key blocks of
+ * HMAC-SHA-1, computed once by aos_hmac_sha1_key_init and copied for
+ * every message signed with the key by aos_hmac_sha1.
+ */
+typedef struct {
+    aos_sha1_ctx_t inner;
+    aos_sha1_ctx_t outer;
+} aos_hmac_sha1_key_t;
+
+void aos_hmac_sha1_key_init(aos_hmac_sha1_key_t *key, const unsigned char *secret, int secret_len);
+void aos_hmac_sha1(unsigned char hmac[20], const aos_hmac_sha1_key_t *key,
+                   const unsigned char *message, int message_len);
+
+/**
+ * The key state of secret from the cache of the calling thread, which
+ * keeps the last AOS_HMAC_KEY_CACHE_NUM secrets. A slot is wiped when it
+ * is evicted, the cache when the thread exits if aos_http_io_initialize
+ * was called before, or by aos_http_io_deinitialize for the calling
+ * thread. The key is valid until the next call on the same thread.
+ */
+const aos_hmac_sha1_key_t *aos_hmac_sha1_key_get(const unsigned char *secret, int secret_len);
+
+int aos_hmac_sha1_key_cache_initialize(aos_pool_t *p);
+void aos_hmac_sha1_key_cache_deinitialize();
+
+/**
+ * Zero len bytes at p, a store the compiler can not drop as dead.
+ */
+void aos_secure_zero(void *p, apr_size_t len);
+
 unsigned char* aos_md5(aos_pool_t* pool, const char* in, apr_size_t in_len);
 
 int aos_url_decode(const char *in, char *out);
@@ -112,6 +112,58 @@ aos_status_t *oss_list_object(const oss_request_options_t *options,
                               oss_list_object_params_t *params, 
                               aos_table_t **resp_headers);
 
+/*
+ * @brief  list oss objects into compact results, the objects of the page are 
+ *         appended to compact, so the pages of a listing can share the results
+ * @param[in]   options       the oss request options
+ * @param[in]   bucket        the oss bucket name
+ * @param[in]   params        input params for list object request,
+                              including prefix, marker, delimiter, max_ret
+ * @param[out]  params        output params for list object response,
+                              including truncated, next_marker, common prefix list
+ * @param[out]  compact       the objects with packed keys, sizes, times and etags
+ * @param[out]  resp_headers  oss server response headers
+ * @return  aos_status_t, code is 2xx success, other failure
+ */
+aos_status_t *oss_list_object_compact(const oss_request_options_t *options,
+                                      const aos_string_t *bucket, 
+                                      oss_list_object_params_t *params, 
+                                      oss_list_object_compact_t *compact,
+                                      aos_table_t **resp_headers);
+
+/*
+ * @brief  create an iterator over the pages of list objects, the next page
+ *         is listed in the background while the caller processes the current one
+ * @param[in]   options       the oss request options
+ * @param[in]   bucket        the oss bucket name
+ * @param[in]   params        input params for list object request,
+                              including prefix, marker, delimiter, max_ret
+ * @param[in]   page_num      the number of pages buffered by the iterator, at least 2,
+                              0 for default 3
+ * @param[out]  iter          the iterator, destroy it by oss_list_iterator_destroy
+ * @return  aos_status_t, code is 2xx success, other failure
+ */
+aos_status_t *oss_create_list_iterator(const oss_request_options_t *options,
+                                       const aos_string_t *bucket,
+                                       const oss_list_object_params_t *params,
+                                       int page_num,
+                                       oss_list_iterator_t **iter);
+
+/*
+ * @brief  get the next page of list objects, the former page is recycled
+ * @param[in]   iter          the list iterator
+ * @param[out]  page          the page, valid until the next call, NULL at the end or on failure
+ * @return  aos_status_t, code is 2xx success, other failure of the list request
+ */
+aos_status_t *oss_list_iterator_next(oss_list_iterator_t *iter, 
+                                     oss_list_object_page_t **page);
+
+/*
+ * @brief  stop the list thread and release the pages of the iterator
+ * @param[in]   iter          the list iterator
+ */
+void oss_list_iterator_destroy(oss_list_iterator_t *iter);
+
 /*
  * @brief  put oss object from buffer
  * @param[in]   options             the oss request options
@@ -272,6 +324,58 @@ aos_status_t *oss_do_get_object_to_file(const oss_request_options_t *options,
                                         oss_progress_callback progress_callback,
                                         aos_table_t **resp_headers);
 
+/*
+ * @brief  get a range of oss object to buffer and check the crc64 of the ranges
+ * @param[in]   options             the oss request options
+ * @param[in]   bucket              the oss bucket name
+ * @param[in]   object              the oss object name
+ * @param[in]   offset              the offset of the range
+ * @param[in]   size                the size of the range, -1 to the end of object
+ * @param[in]   headers             the headers for request
+ * @param[in]   params              the params for request
+ * @param[in]   range_crc           the crc64 of ranges fetched, shared by the ranges of the object,
+ *                                  checked once the ranges cover the object, NULL not to check
+ * @param[out]  buffer              the buffer containing the range content
+ * @param[out]  resp_headers        oss server response headers
+ * @return  aos_status_t, code is 2xx success, other failure
+ */
+aos_status_t *oss_get_object_range_to_buffer(const oss_request_options_t *options, 
+                                             const aos_string_t *bucket, 
+                                             const aos_string_t *object,
+                                             int64_t offset,
+                                             int64_t size,
+                                             aos_table_t *headers, 
+                                             aos_table_t *params,
+                                             oss_range_crc64_t *range_crc,
+                                             aos_list_t *buffer, 
+                                             aos_table_t **resp_headers);
+
+/*
+ * @brief  get a range of oss object to file and check the crc64 of the ranges
+ * @param[in]   options             the oss request options
+ * @param[in]   bucket              the oss bucket name
+ * @param[in]   object              the oss object name
+ * @param[in]   offset              the offset of the range
+ * @param[in]   size                the size of the range, -1 to the end of object
+ * @param[in]   headers             the headers for request
+ * @param[in]   params              the params for request
+ * @param[in]   range_crc           the crc64 of ranges fetched, shared by the ranges of the object,
+ *                                  checked once the ranges cover the object, NULL not to check
+ * @param[in]   filename            the filename storing the range content
+ * @param[out]  resp_headers        oss server response headers
+ * @return  aos_status_t, code is 2xx success, other failure
+ */
+aos_status_t *oss_get_object_range_to_file(const oss_request_options_t *options, 
+                                           const aos_string_t *bucket, 
+                                           const aos_string_t *object,
+                                           int64_t offset,
+                                           int64_t size,
+                                           aos_table_t *headers, 
+                                           aos_table_t *params,
+                                           oss_range_crc64_t *range_crc,
+                                           aos_string_t *filename, 
+                                           aos_table_t **resp_headers);
+
 /*
  * @brief  head oss object
  * @param[in]   options          the oss request options
@@ -328,6 +432,41 @@ aos_status_t *oss_delete_objects_by_prefix(oss_request_options_t *options,
                                            const aos_string_t *bucket, 
                                            const aos_string_t *prefix);
 
+/*
+ * @brief  delete oss objects by prefix, the listing runs ahead of the deletes 
+ *         and the batches of keys are deleted concurrently
+ * @param[in]   options             the oss request options
+ * @param[in]   bucket              the oss bucket name
+ * @param[in]   prefix              prefix of delete objects
+ * @param[in]   params              the thread_num and queue_num of delete, NULL for default
+ * @param[out]  params              the deleted_num, failed_num and failed_object_list
+ * @param[in]   progress_callback   called with the number of processed keys and listed keys
+ * @return  aos_status_t, code is 2xx success, otherwise the first failure of list or delete,
+ *          the keys of a failed delete are recorded and the other batches go on
+ */
+aos_status_t *oss_do_delete_objects_by_prefix(oss_request_options_t *options,
+                                              const aos_string_t *bucket, 
+                                              const aos_string_t *prefix,
+                                              oss_delete_objects_by_prefix_params_t *params,
+                                              oss_progress_callback progress_callback);
+
+/*
+ * @brief  walk the objects under a prefix, the sub prefixes discovered by the 
+ *         delimiter are listed concurrently and recursively
+ * @param[in]   options             the oss request options
+ * @param[in]   bucket              the oss bucket name
+ * @param[in]   prefix              the prefix to walk
+ * @param[in]   params              the thread_num, delimiter, max_depth, visitor and aggregate 
+ *                                  of the walk, NULL for default
+ * @param[out]  params              the object_num, total_size and prefix_stat_list
+ * @return  aos_status_t, code is 2xx success, otherwise the first failure of list,
+ *          AOSE_ABORT_CALLBACK if the visitor aborts the walk
+ */
+aos_status_t *oss_parallel_walk(oss_request_options_t *options,
+                                const aos_string_t *bucket,
+                                const aos_string_t *prefix,
+                                oss_parallel_walk_params_t *params);
+
 /*
  * @brief  copy oss objects
  * @param[in]   options             the oss request options
@@ -745,6 +884,21 @@ aos_status_t *oss_upload_part_copy(const oss_request_options_t *options,
                                    aos_table_t *headers, 
                                    aos_table_t **resp_headers);
 
+/*
+ * @brief  oss copy large object using upload part copy
+ * @param[in]   options             the oss request options
+ * @param[in]   params              the upload part copy parameters
+ * @param[in]   headers             the headers for request
+ * @param[out]  resp_headers        oss server response headers
+ * @param[out]  resp_body           oss server response body, including the etag of the part
+ * @return  aos_status_t, code is 2xx success, other failure
+ */
+aos_status_t *oss_do_upload_part_copy(const oss_request_options_t *options,
+                                      oss_upload_part_copy_params_t *params, 
+                                      aos_table_t *headers, 
+                                      aos_table_t **resp_headers,
+                                      aos_list_t *resp_body);
+
 /*
  * @brief  oss upload file using multipart upload
  * @param[in]   options             the oss request options
@@ -764,6 +918,45 @@ aos_status_t *oss_upload_file(oss_request_options_t *options,
                               int64_t part_size,
                               aos_table_t *headers);
 
+/*
+ * @brief  oss upload file using multipart upload, parts are uploaded concurrently
+ * @param[in]   options             the oss request options
+ * @param[in]   bucket              the oss bucket name
+ * @param[in]   object              the oss object name
+ * @param[in]   upload_id           the upload id to upload if has
+ * @param[in]   filename            the filename containing object content
+ * @param[in]   part_size           the part size for multipart upload
+ * @param[in]   thread_num          the number of threads uploading parts
+ * @param[in]   headers             the headers for request
+ * @return  aos_status_t, code is 2xx success, other failure
+ */
+aos_status_t *oss_do_upload_file(oss_request_options_t *options,
+                                 const aos_string_t *bucket, 
+                                 const aos_string_t *object, 
+                                 aos_string_t *upload_id,
+                                 aos_string_t *filename, 
+                                 int64_t part_size,
+                                 int32_t thread_num,
+                                 aos_table_t *headers);
+
+/*
+ * @brief  oss get the uploaded parts of a multipart upload
+ * @param[in]   options             the oss request options
+ * @param[in]   bucket              the oss bucket name
+ * @param[in]   object              the oss object name
+ * @param[in]   upload_id           the upload id
+ * @param[in]   part_num            the number of parts
+ * @param[in,out] parts             the parts, a part is marked completed with its etag 
+ *                                  if it is uploaded with the same size
+ * @return  aos_status_t, code is 2xx success, other failure
+ */
+aos_status_t *oss_get_uploaded_parts(oss_request_options_t *options,
+                                     const aos_string_t *bucket, 
+                                     const aos_string_t *object, 
+                                     const aos_string_t *upload_id,
+                                     int part_num,
+                                     oss_checkpoint_part_t *parts);
+
 /*
  * @brief  oss upload file with mulit-thread and resumable
  * @param[in]   options             the oss request options
@@ -789,6 +982,32 @@ aos_status_t *oss_resumable_upload_file(oss_request_options_t *options,
                                         aos_table_t **resp_headers,
                                         aos_list_t *resp_body);
 
+/*
+ * @brief  oss copy large object with upload part copy, the parts are copied concurrently 
+ *         and the copy is resumable if checkpoint is enabled, every part requires the etag 
+ *         of the source head, the copy starts over if the source object is overwritten
+ * @param[in]   options             the oss request options
+ * @param[in]   source_bucket       the source bucket name
+ * @param[in]   source_object       the source object name
+ * @param[in]   dest_bucket         the dest bucket name
+ * @param[in]   dest_object         the dest object name
+ * @param[in]   headers             the headers for init multipart upload
+ * @param[in]   clt_params          the control params of copy, the checkpoint path defaults to 
+ *                                  ./dest_bucket.dest_object.cp
+ * @param[out]  resp_headers        oss server response headers
+ * @param[out]  resp_body           oss server response body
+ * @return  aos_status_t, code is 2xx success, other failure
+ */
+aos_status_t *oss_parallel_copy_object(oss_request_options_t *options,
+                                       aos_string_t *source_bucket, 
+                                       aos_string_t *source_object, 
+                                       aos_string_t *dest_bucket, 
+                                       aos_string_t *dest_object, 
+                                       aos_table_t *headers,
+                                       oss_resumable_clt_params_t *clt_params, 
+                                       aos_table_t **resp_headers,
+                                       aos_list_t *resp_body);
+
 /*
  * @brief  oss create live channel
  * @param[in]   options             the oss request options
@@ -2,50 +2,105 @@
 #include "aos_log.h"
 #include "oss_util.h"
 
+// the sub resources in the order of the canonicalized resource
 static const char *g_s_oss_sub_resource_list[] = {
     "acl",
-    "uploadId",
-    "uploads",
+    "append",
+    "comp",
+    "delete",
+    "endTime",
+    "lifecycle",
+    "live",
     "partNumber",
-    "response-content-type",
-    "response-content-language",
-    "response-expires",
+    "position",
     "response-cache-control",
     "response-content-disposition",
     "response-content-encoding",
-    "append",
-    "position",
-    "lifecycle",
-    "delete",
-    "live",
+    "response-content-language",
+    "response-content-type",
+    "response-expires",
+    "security-token",
+    "startTime",
     "status",
-    "comp",
+    "uploadId",
+    "uploads",
     "vod",
-    "startTime",
-    "endTime",
     "x-oss-process",
-    "security-token",
     NULL,
 };
 
-static int is_oss_sub_resource(const char *str);
+#define OSS_SUB_RESOURCE_NUM 22
+
+// the index of sub resource by oss_sub_resource_hash, -1 if none
+static const signed char g_s_oss_sub_resource_index[64] = {
+     6, -1, 12, 16, -1, -1, -1,  0,  8, -1, -1,  1, -1, -1, -1, -1,
+    -1, -1, 11, -1, -1, 15,  3, 18,  9, -1,  5, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 14, -1, -1, -1, -1, -1,  7, 19, -1, -1, -1, -1,
+    21, -1, -1, 17, 20,  4, -1, -1, 13, -1, -1, -1, -1,  2, 10, -1,
+};
+
+typedef struct {
+    aos_pool_t *pool;
+    char *data;
+    int len;
+    int size;
+} oss_sign_buf_t;
+
 static int is_oss_canonicalized_header(const char *str);
 static int oss_get_canonicalized_headers(aos_pool_t *p, 
-        const aos_table_t *headers, aos_buf_t *signbuf);
+        const aos_table_t *headers, oss_sign_buf_t *signbuf);
 static int oss_get_canonicalized_resource(aos_pool_t *p, 
-        const aos_table_t *params, aos_buf_t *signbuf);
+        const aos_table_t *params, oss_sign_buf_t *signbuf);
 static int oss_get_canonicalized_params(aos_pool_t *p,
-    const aos_table_t *params, aos_buf_t *signbuf);
+    const aos_table_t *params, oss_sign_buf_t *signbuf);
+static int oss_build_string_to_sign(aos_pool_t *p, http_method_e method, const aos_string_t *canon_res,
+        const aos_table_t *headers, const aos_table_t *params, oss_sign_buf_t *signbuf);
+static int oss_build_rtmp_string_to_sign(aos_pool_t *p, const aos_string_t *expires,
+        const aos_string_t *canon_res, const aos_table_t *params, oss_sign_buf_t *signbuf);
 
-static int is_oss_sub_resource(const char *str)
+static void oss_sign_buf_init(oss_sign_buf_t *signbuf, aos_pool_t *p, char *data, int size)
 {
-    int i = 0;
-    for ( ; g_s_oss_sub_resource_list[i]; i++) {
-        if (apr_strnatcmp(g_s_oss_sub_resource_list[i], str) == 0) {
-            return 1;
-        }
+    signbuf->pool = p;
+    signbuf->data = data;
+    signbuf->len = 0;
+    signbuf->size = size;
+}
+
+static void oss_sign_buf_append(oss_sign_buf_t *signbuf, const char *str, int len)
+{
+    char *data;
+
+    // the stack buffer is only outgrown by huge user metas or resources
+    if (signbuf->len + len > signbuf->size) {
+        signbuf->size = aos_max(signbuf->size * 2, signbuf->len + len);
+        data = (char *)aos_palloc(signbuf->pool, signbuf->size);
+        memcpy(data, signbuf->data, signbuf->len);
+        signbuf->data = data;
+    }
+    memcpy(signbuf->data + signbuf->len, str, len);
+    signbuf->len += len;
+}
+
+static APR_INLINE int oss_sub_resource_hash(const char *str, size_t len)
+{
+    return ((unsigned char)str[0] + 8 * (unsigned char)str[len - 1] + 
+            ((unsigned char)str[len / 2] << 1)) & 63;
+}
+
+// return the index of sub resource, -1 if str is not a sub resource
+static int oss_get_sub_resource_index(const char *str)
+{
+    size_t len = strlen(str);
+    int i;
+
+    if (len == 0) {
+        return -1;
     }
-    return 0;
+    i = g_s_oss_sub_resource_index[oss_sub_resource_hash(str, len)];
+    if (i < 0 || strcmp(g_s_oss_sub_resource_list[i], str) != 0) {
+        return -1;
+    }
+    return i;
 }
 
 static int is_oss_canonicalized_header(const char *str)
@@ -54,149 +109,151 @@ static int is_oss_canonicalized_header(const char *str)
     return strncasecmp(str, OSS_CANNONICALIZED_HEADER_PREFIX, len) == 0;
 }
 
+static int oss_table_entry_cmp(const void *a, const void *b)
+{
+    return apr_strnatcasecmp((*(const aos_table_entry_t **)a)->key, (*(const aos_table_entry_t **)b)->key);
+}
+
+// append the sorted "key:value\n" lines of entries, the values are stripped
+static int oss_append_sorted_entries(aos_pool_t *p, const aos_table_entry_t **entries, int count, 
+                                     oss_sign_buf_t *signbuf, const char *what)
+{
+    int i;
+    int len;
+    aos_string_t key;
+    aos_string_t value;
+
+    qsort(entries, count, sizeof(aos_table_entry_t *), oss_table_entry_cmp);
+
+    for (i = 0; i < count; ++i) {
+        aos_str_set(&key, entries[i]->key);
+        aos_str_set(&value, entries[i]->val);
+        aos_strip_space(&value);
+        len = key.len + 1 + value.len;
+        if (len > AOS_MAX_HEADER_LEN) {
+            aos_error_log("%s too many, %d > %d.", what, len, AOS_MAX_HEADER_LEN);
+            return AOSE_INVALID_ARGUMENT;
+        }
+        oss_sign_buf_append(signbuf, key.data, key.len);
+        oss_sign_buf_append(signbuf, ":", 1);
+        oss_sign_buf_append(signbuf, value.data, value.len);
+        oss_sign_buf_append(signbuf, "\n", 1);
+    }
+
+    return AOSE_OK;
+}
+
 static int oss_get_canonicalized_headers(aos_pool_t *p, 
                                          const aos_table_t *headers, 
-                                         aos_buf_t *signbuf)
+                                         oss_sign_buf_t *signbuf)
 {
     int pos;
     int meta_count = 0;
-    int i;
-    int len;
     const aos_array_header_t *tarr;
     const aos_table_entry_t *telts;
-    char **meta_headers;
-    const char *value;
-    aos_string_t tmp_str;
-    char *tmpbuf = (char*)malloc(AOS_MAX_HEADER_LEN + 1);
-    if (NULL == tmpbuf) {
-        aos_error_log("malloc %d memory failed.", AOS_MAX_HEADER_LEN + 1);
-        return AOSE_OVER_MEMORY;
-    }
+    const aos_table_entry_t *stack_headers[OSS_SIGN_SORT_NUM];
+    const aos_table_entry_t **meta_headers = stack_headers;
 
     if (apr_is_empty_table(headers)) {
-        free(tmpbuf);
         return AOSE_OK;
     }
 
     // sort user meta header
     tarr = aos_table_elts(headers);
     telts = (aos_table_entry_t*)tarr->elts;
-    meta_headers = aos_pcalloc(p, tarr->nelts * sizeof(char*));
+    if (tarr->nelts > OSS_SIGN_SORT_NUM) {
+        meta_headers = aos_palloc(p, tarr->nelts * sizeof(aos_table_entry_t *));
+    }
     for (pos = 0; pos < tarr->nelts; ++pos) {
         if (is_oss_canonicalized_header(telts[pos].key)) {
-            aos_string_t key = aos_string(telts[pos].key);
+            aos_string_t key;
+            aos_str_set(&key, telts[pos].key);
             aos_string_tolower(&key);
-            meta_headers[meta_count++] = key.data;
+            meta_headers[meta_count++] = &telts[pos];
         }
     }
     if (meta_count == 0) {
-        free(tmpbuf);
         return AOSE_OK;
     }
-    aos_gnome_sort((const char **)meta_headers, meta_count);
 
-    // sign string
-    for (i = 0; i < meta_count; ++i) {
-        value = apr_table_get(headers, meta_headers[i]);
-        aos_str_set(&tmp_str, value);
-        aos_strip_space(&tmp_str);
-        len = apr_snprintf(tmpbuf, AOS_MAX_HEADER_LEN + 1, "%s:%.*s", 
-                           meta_headers[i], tmp_str.len, tmp_str.data);
-        if (len > AOS_MAX_HEADER_LEN) {
-            free(tmpbuf);
-            aos_error_log("user meta header too many, %d > %d.", 
-                          len, AOS_MAX_HEADER_LEN);
-            return AOSE_INVALID_ARGUMENT;
-        }
-        tmp_str.data = tmpbuf;
-        tmp_str.len = len;
-        aos_buf_append_string(p, signbuf, tmpbuf, len);
-        aos_buf_append_string(p, signbuf, "\n", sizeof("\n")-1);
-    }
-
-    free(tmpbuf);
-    return AOSE_OK;
+    return oss_append_sorted_entries(p, meta_headers, meta_count, signbuf, "user meta header");
 }
 
 static int oss_get_canonicalized_resource(aos_pool_t *p, 
                                           const aos_table_t *params, 
-                                          aos_buf_t *signbuf)
+                                          oss_sign_buf_t *signbuf)
 {
     int pos;
-    int subres_count = 0;
     int i;
     int len;
+    int key_len;
+    int value_len;
     char sep;
     const char *value;
-    char tmpbuf[AOS_MAX_QUERY_ARG_LEN+1];
-    char **subres_headers;
     const aos_array_header_t *tarr;
     const aos_table_entry_t *telts;
+    const char *subres[OSS_SUB_RESOURCE_NUM];
 
     if (apr_is_empty_table(params)) {
         return AOSE_OK;
     }
 
-    // sort sub resource param
+    // the sub resources are picked in the canonicalized order, no sort
+    memset(subres, 0, sizeof(subres));
     tarr = aos_table_elts(params);
     telts = (aos_table_entry_t*)tarr->elts;
-    subres_headers = aos_pcalloc(p, tarr->nelts * sizeof(char*));
     for (pos = 0; pos < tarr->nelts; ++pos) {
-        if (is_oss_sub_resource(telts[pos].key)) {
-            subres_headers[subres_count++] = telts[pos].key;
+        i = oss_get_sub_resource_index(telts[pos].key);
+        if (i >= 0 && subres[i] == NULL) {
+            subres[i] = telts[pos].val != NULL ? telts[pos].val : "";
         }
     }
-    if (subres_count == 0) {
-        return AOSE_OK;
-    }
-    aos_gnome_sort((const char **)subres_headers, subres_count);
 
     // sign string
     sep = '?';
-    for (i = 0; i < subres_count; ++i) {
-        value = apr_table_get(params, subres_headers[i]);
-        if (value != NULL && *value != '\0') {
-            len = apr_snprintf(tmpbuf, sizeof(tmpbuf), "%c%s=%s", 
-                    sep, subres_headers[i], value);
-        } else {
-            len = apr_snprintf(tmpbuf, sizeof(tmpbuf), "%c%s", 
-                    sep, subres_headers[i]);
+    for (i = 0; i < OSS_SUB_RESOURCE_NUM; ++i) {
+        if ((value = subres[i]) == NULL) {
+            continue;
         }
+        key_len = strlen(g_s_oss_sub_resource_list[i]);
+        value_len = strlen(value);
+        len = 1 + key_len + (value_len > 0 ? 1 + value_len : 0);
         if (len >= AOS_MAX_QUERY_ARG_LEN) {
-            aos_error_log("http query params too long, %s.", tmpbuf);
+            aos_error_log("http query params too long, %s=%s.", g_s_oss_sub_resource_list[i], value);
             return AOSE_INVALID_ARGUMENT;
         }
-        aos_buf_append_string(p, signbuf, tmpbuf, len);
+        oss_sign_buf_append(signbuf, &sep, 1);
+        oss_sign_buf_append(signbuf, g_s_oss_sub_resource_list[i], key_len);
+        if (value_len > 0) {
+            oss_sign_buf_append(signbuf, "=", 1);
+            oss_sign_buf_append(signbuf, value, value_len);
+        }
         sep = '&';
     }
 
     return AOSE_OK;
 }    
 
-int oss_get_string_to_sign(aos_pool_t *p, 
-                           http_method_e method, 
-                           const aos_string_t *canon_res,
-                           const aos_table_t *headers, 
-                           const aos_table_t *params, 
-                           aos_string_t *signstr)
+static int oss_build_string_to_sign(aos_pool_t *p, 
+                                    http_method_e method, 
+                                    const aos_string_t *canon_res,
+                                    const aos_table_t *headers, 
+                                    const aos_table_t *params, 
+                                    oss_sign_buf_t *signbuf)
 {
     int res;
-    aos_buf_t *signbuf;
     const char *value;
-    aos_str_null(signstr);
-
-    signbuf = aos_create_buf(p, 1024);
 
 #define signbuf_append_from_headers(KEY) do {                            \
         if ((value = apr_table_get(headers, KEY)) != NULL) {            \
-            aos_buf_append_string(p, signbuf, value, strlen(value));    \
+            oss_sign_buf_append(signbuf, value, strlen(value));         \
         }                                                               \
-        aos_buf_append_string(p, signbuf, "\n", sizeof("\n")-1);        \
+        oss_sign_buf_append(signbuf, "\n", 1);                          \
     } while (0)
 
 #define signbuf_append(VALUE, LEN) do {                                 \
-        aos_buf_append_string(p, signbuf, VALUE, LEN);                  \
-        aos_buf_append_string(p, signbuf, "\n", sizeof("\n")-1);        \
+        oss_sign_buf_append(signbuf, VALUE, LEN);                       \
+        oss_sign_buf_append(signbuf, "\n", 1);                          \
     } while (0)
     
     value = aos_http_method_to_string(method);
@@ -215,78 +272,142 @@ int oss_get_string_to_sign(aos_pool_t *p,
     }
     signbuf_append(value, strlen(value));
 
+#undef signbuf_append_from_headers
+#undef signbuf_append
+
     // user meta headers
     if ((res = oss_get_canonicalized_headers(p, headers, signbuf)) != AOSE_OK) {
         return res;
     }
 
     // canonicalized resource
-    aos_buf_append_string(p, signbuf, canon_res->data, canon_res->len);
+    oss_sign_buf_append(signbuf, canon_res->data, canon_res->len);
     
     if (params != NULL && (res = oss_get_canonicalized_resource(p, params, signbuf)) != AOSE_OK) {
         return res;
     }
 
+    return AOSE_OK;
+}
+
+int oss_get_string_to_sign(aos_pool_t *p, 
+                           http_method_e method, 
+                           const aos_string_t *canon_res,
+                           const aos_table_t *headers, 
+                           const aos_table_t *params, 
+                           aos_string_t *signstr)
+{
+    int res;
+    char buf[OSS_SIGN_BUFFER_SIZE];
+    oss_sign_buf_t signbuf;
+    aos_str_null(signstr);
+
+    oss_sign_buf_init(&signbuf, p, buf, sizeof(buf));
+    if ((res = oss_build_string_to_sign(p, method, canon_res, headers, params, &signbuf)) != AOSE_OK) {
+        return res;
+    }
+
     // result
-    signstr->data = (char *)signbuf->pos;
-    signstr->len = aos_buf_size(signbuf);
+    signstr->data = apr_pstrmemdup(p, signbuf.data, signbuf.len);
+    signstr->len = signbuf.len;
 
     return AOSE_OK;
 }
 
-void oss_sign_headers(aos_pool_t *p, 
-                      const aos_string_t *signstr, 
-                      const aos_string_t *access_key_id,
-                      const aos_string_t *access_key_secret, 
-                      aos_table_t *headers)
+// the hmac key state of access_key_secret, built once per thread and access key
+static const aos_hmac_sha1_key_t *oss_get_sign_key(const aos_string_t *access_key_secret)
+{
+    return aos_hmac_sha1_key_get((const unsigned char *)access_key_secret->data, access_key_secret->len);
+}
+
+static int oss_sign_string(const aos_hmac_sha1_key_t *key, const char *signstr, int len, 
+                           char b64[OSS_SIGNATURE_BASE64_LEN])
 {
-    int b64Len;
-    char *value;
     unsigned char hmac[20];
-    char b64[((20 + 1) * 4) / 3];
 
-    HMAC_SHA1(hmac, (unsigned char *)access_key_secret->data, access_key_secret->len,
-              (unsigned char *)signstr->data, signstr->len);
+    aos_hmac_sha1(hmac, key, (const unsigned char *)signstr, len);
+    return aos_base64_encode(hmac, 20, b64);
+}
+
+// the key state of the client when the options carry one for their config
+static const aos_hmac_sha1_key_t *oss_options_sign_key(const oss_request_options_t *options)
+{
+    if (options->client != NULL && options->client->config == options->config) {
+        return &options->client->sign_key;
+    }
+    return oss_get_sign_key(&options->config->access_key_secret);
+}
 
-    // Now base-64 encode the results
-    b64Len = aos_base64_encode(hmac, 20, b64);
+static void oss_sign_headers_with_key(aos_pool_t *p, 
+                                      const aos_string_t *signstr, 
+                                      const aos_string_t *access_key_id,
+                                      const aos_hmac_sha1_key_t *key, 
+                                      aos_table_t *headers)
+{
+    int b64Len;
+    char *value;
+    char b64[OSS_SIGNATURE_BASE64_LEN];
+
+    b64Len = oss_sign_string(key, signstr->data, signstr->len, b64);
     value = apr_psprintf(p, "OSS %.*s:%.*s", access_key_id->len, access_key_id->data, b64Len, b64);
     apr_table_addn(headers, OSS_AUTHORIZATION, value);
+}
 
-    return;
+void oss_sign_headers(aos_pool_t *p, 
+                      const aos_string_t *signstr, 
+                      const aos_string_t *access_key_id,
+                      const aos_string_t *access_key_secret, 
+                      aos_table_t *headers)
+{
+    oss_sign_headers_with_key(p, signstr, access_key_id, oss_get_sign_key(access_key_secret), headers);
 }
 
-int oss_get_signed_headers(aos_pool_t *p, 
-                           const aos_string_t *access_key_id, 
-                           const aos_string_t *access_key_secret,
-                           const aos_string_t* canon_res, 
-                           aos_http_request_t *req)
+static int oss_get_signed_headers_with_key(aos_pool_t *p, 
+                                           const aos_string_t *access_key_id, 
+                                           const aos_hmac_sha1_key_t *key,
+                                           const aos_string_t* canon_res, 
+                                           aos_http_request_t *req)
 {
     int res;
+    char buf[OSS_SIGN_BUFFER_SIZE];
+    oss_sign_buf_t signbuf;
     aos_string_t signstr;
 
-    res = oss_get_string_to_sign(p, req->method, canon_res, 
-                                 req->headers, req->query_params, &signstr);
+    oss_sign_buf_init(&signbuf, p, buf, sizeof(buf));
+    res = oss_build_string_to_sign(p, req->method, canon_res, 
+                                   req->headers, req->query_params, &signbuf);
     
     if (res != AOSE_OK) {
         return res;
     }
     
-    aos_debug_log("signstr:%.*s.", signstr.len, signstr.data);
+    aos_debug_log("signstr:%.*s.", signbuf.len, signbuf.data);
 
-    oss_sign_headers(p, &signstr, access_key_id, access_key_secret, req->headers);
+    signstr.data = signbuf.data;
+    signstr.len = signbuf.len;
+    oss_sign_headers_with_key(p, &signstr, access_key_id, key, req->headers);
 
     return AOSE_OK;
 }
 
-int oss_sign_request(aos_http_request_t *req, 
-                     const oss_config_t *config)
+int oss_get_signed_headers(aos_pool_t *p, 
+                           const aos_string_t *access_key_id, 
+                           const aos_string_t *access_key_secret,
+                           const aos_string_t* canon_res, 
+                           aos_http_request_t *req)
+{
+    return oss_get_signed_headers_with_key(p, access_key_id, oss_get_sign_key(access_key_secret), 
+                                           canon_res, req);
+}
+
+static int oss_sign_request_with_key(aos_http_request_t *req, 
+                                     const aos_string_t *access_key_id,
+                                     const aos_hmac_sha1_key_t *key)
 {
     aos_string_t canon_res;
     char canon_buf[AOS_MAX_URI_LEN];
     char datestr[AOS_MAX_GMT_TIME_LEN];
     const char *value;
-    int res = AOSE_OK;
     int len = 0;
     
     len = strlen(req->resource);
@@ -303,9 +424,20 @@ int oss_sign_request(aos_http_request_t *req,
         apr_table_set(req->headers, OSS_DATE, datestr);
     }
 
-    res = oss_get_signed_headers(req->pool, &config->access_key_id, 
-                                 &config->access_key_secret, &canon_res, req);
-    return res;
+    return oss_get_signed_headers_with_key(req->pool, access_key_id, key, &canon_res, req);
+}
+
+int oss_sign_request(aos_http_request_t *req, 
+                     const oss_config_t *config)
+{
+    return oss_sign_request_with_key(req, &config->access_key_id, 
+                                     oss_get_sign_key(&config->access_key_secret));
+}
+
+int oss_client_sign_request(aos_http_request_t *req, 
+                            const oss_client_t *client)
+{
+    return oss_sign_request_with_key(req, &client->config->access_key_id, &client->sign_key);
 }
 
 int get_oss_request_signature(const oss_request_options_t *options, 
@@ -315,30 +447,26 @@ int get_oss_request_signature(const oss_request_options_t *options,
 {
     aos_string_t canon_res;
     char canon_buf[AOS_MAX_URI_LEN];
-    const char *value;
-    aos_string_t signstr;
+    char buf[OSS_SIGN_BUFFER_SIZE];
+    oss_sign_buf_t signbuf;
     int res = AOSE_OK;
     int b64Len;
-    unsigned char hmac[20];
-    char b64[((20 + 1) * 4) / 3];
+    char b64[OSS_SIGNATURE_BASE64_LEN];
 
     canon_res.data = canon_buf;
     canon_res.len = apr_snprintf(canon_buf, sizeof(canon_buf), "/%s", req->resource);
 
     apr_table_set(req->headers, OSS_DATE, expires->data);
 
-    if ((res = oss_get_string_to_sign(options->pool, req->method, &canon_res, 
-        req->headers, req->query_params, &signstr))!= AOSE_OK) {
+    oss_sign_buf_init(&signbuf, options->pool, buf, sizeof(buf));
+    if ((res = oss_build_string_to_sign(options->pool, req->method, &canon_res, 
+        req->headers, req->query_params, &signbuf))!= AOSE_OK) {
         return res;
     }
 
-    HMAC_SHA1(hmac, (unsigned char *)options->config->access_key_secret.data, 
-              options->config->access_key_secret.len,
-              (unsigned char *)signstr.data, signstr.len);
-
-    b64Len = aos_base64_encode(hmac, 20, b64);
-    value = apr_psprintf(options->pool, "%.*s", b64Len, b64);
-    aos_str_set(signature, value);
+    b64Len = oss_sign_string(oss_options_sign_key(options), signbuf.data, signbuf.len, b64);
+    signature->data = apr_pstrmemdup(options->pool, b64, b64Len);
+    signature->len = b64Len;
 
     return res;
 }
@@ -350,7 +478,6 @@ int oss_get_signed_url(const oss_request_options_t *options,
 {
     char *signed_url_str;
     aos_string_t querystr;
-    char uristr[3*AOS_MAX_URI_LEN+1];
     int res = AOSE_OK;
     aos_string_t signature;
     const char *proto;
@@ -368,22 +495,17 @@ int oss_get_signed_url(const oss_request_options_t *options,
     apr_table_set(req->query_params, OSS_EXPIRES, expires->data);
     apr_table_set(req->query_params, OSS_SIGNATURE, signature.data);
 
-    uristr[0] = '\0';
     aos_str_null(&querystr);
-    res = aos_url_encode(uristr, req->uri, AOS_MAX_URI_LEN);
+    res = aos_query_params_to_string(options->pool, req->query_params, &querystr);
     if (res != AOSE_OK) {
         return res;
     }
 
-    res = aos_query_params_to_string(options->pool, req->query_params, &querystr);
+    proto = strlen(req->proto) != 0 ? req->proto : AOS_HTTP_PREFIX;
+    res = aos_build_url(options->pool, proto, req->host, req->uri, &querystr, &signed_url_str);
     if (res != AOSE_OK) {
         return res;
     }
-
-    proto = strlen(req->proto) != 0 ? req->proto : AOS_HTTP_PREFIX;
-    signed_url_str = apr_psprintf(options->pool, "%s%s/%s%.*s",
-                                  proto, req->host, uristr,
-                                  querystr.len, querystr.data);
     aos_str_set(signed_url, signed_url_str);
 
     return res;
@@ -398,7 +520,6 @@ int oss_get_rtmp_signed_url(const oss_request_options_t *options,
 {
     char *signed_url_str;
     aos_string_t querystr;
-    char uristr[3*AOS_MAX_URI_LEN+1];
     int res = AOSE_OK;
     aos_string_t signature;
     int pos = 0;
@@ -424,21 +545,16 @@ int oss_get_rtmp_signed_url(const oss_request_options_t *options,
     apr_table_set(req->query_params, OSS_EXPIRES, expires->data);
     apr_table_set(req->query_params, OSS_SIGNATURE, signature.data);
 
-    uristr[0] = '\0';
     aos_str_null(&querystr);
-    res = aos_url_encode(uristr, req->uri, AOS_MAX_URI_LEN);
+    res = aos_query_params_to_string(options->pool, req->query_params, &querystr);
     if (res != AOSE_OK) {
         return res;
     }
 
-    res = aos_query_params_to_string(options->pool, req->query_params, &querystr);
+    res = aos_build_url(options->pool, req->proto, req->host, req->uri, &querystr, &signed_url_str);
     if (res != AOSE_OK) {
         return res;
     }
-
-    signed_url_str = apr_psprintf(options->pool, "%s%s/%s%.*s",
-                                  req->proto, req->host, uristr,
-                                  querystr.len, querystr.data);
     aos_str_set(signed_url, signed_url_str);
 
     return res;
@@ -451,47 +567,39 @@ int get_oss_rtmp_request_signature(const oss_request_options_t *options,
 {
     aos_string_t canon_res;
     char canon_buf[AOS_MAX_URI_LEN];
-    const char *value;
-    aos_string_t signstr;
+    char buf[OSS_SIGN_BUFFER_SIZE];
+    oss_sign_buf_t signbuf;
     int res = AOSE_OK;
     int b64Len;
-    unsigned char hmac[20];
-    char b64[((20 + 1) * 4) / 3];
+    char b64[OSS_SIGNATURE_BASE64_LEN];
 
     canon_res.data = canon_buf;
     canon_res.len = apr_snprintf(canon_buf, sizeof(canon_buf), "/%s", req->resource);
 
-    if ((res = oss_get_rtmp_string_to_sign(options->pool, expires, &canon_res,
-        req->query_params, &signstr))!= AOSE_OK) {
+    oss_sign_buf_init(&signbuf, options->pool, buf, sizeof(buf));
+    if ((res = oss_build_rtmp_string_to_sign(options->pool, expires, &canon_res,
+        req->query_params, &signbuf))!= AOSE_OK) {
         return res;
     }
 
-    HMAC_SHA1(hmac, (unsigned char *)options->config->access_key_secret.data,
-              options->config->access_key_secret.len,
-              (unsigned char *)signstr.data, signstr.len);
-
-    b64Len = aos_base64_encode(hmac, 20, b64);
-    value = apr_psprintf(options->pool, "%.*s", b64Len, b64);
-    aos_str_set(signature, value);
+    b64Len = oss_sign_string(oss_options_sign_key(options), signbuf.data, signbuf.len, b64);
+    signature->data = apr_pstrmemdup(options->pool, b64, b64Len);
+    signature->len = b64Len;
 
     return res;
 }
 
-int oss_get_rtmp_string_to_sign(aos_pool_t *p,
-                                const aos_string_t *expires,
-                                const aos_string_t *canon_res,
-                                const aos_table_t *params,
-                                aos_string_t *signstr)
+static int oss_build_rtmp_string_to_sign(aos_pool_t *p,
+                                         const aos_string_t *expires,
+                                         const aos_string_t *canon_res,
+                                         const aos_table_t *params,
+                                         oss_sign_buf_t *signbuf)
 {
     int res;
-    aos_buf_t *signbuf;
-    aos_str_null(signstr);
-
-    signbuf = aos_create_buf(p, 1024);
 
     // expires
-    aos_buf_append_string(p, signbuf, expires->data, expires->len);
-    aos_buf_append_string(p, signbuf, "\n", sizeof("\n")-1);
+    oss_sign_buf_append(signbuf, expires->data, expires->len);
+    oss_sign_buf_append(signbuf, "\n", 1);
 
     // canonicalized params
     if ((res = oss_get_canonicalized_params(p, params, signbuf)) != AOSE_OK) {
@@ -499,72 +607,57 @@ int oss_get_rtmp_string_to_sign(aos_pool_t *p,
     }
 
     // canonicalized resource
-    aos_buf_append_string(p, signbuf, canon_res->data, canon_res->len);
+    oss_sign_buf_append(signbuf, canon_res->data, canon_res->len);
+
+    return AOSE_OK;
+}
+
+int oss_get_rtmp_string_to_sign(aos_pool_t *p,
+                                const aos_string_t *expires,
+                                const aos_string_t *canon_res,
+                                const aos_table_t *params,
+                                aos_string_t *signstr)
+{
+    int res;
+    char buf[OSS_SIGN_BUFFER_SIZE];
+    oss_sign_buf_t signbuf;
+    aos_str_null(signstr);
+
+    oss_sign_buf_init(&signbuf, p, buf, sizeof(buf));
+    if ((res = oss_build_rtmp_string_to_sign(p, expires, canon_res, params, &signbuf)) != AOSE_OK) {
+        return res;
+    }
 
     // result
-    signstr->data = (char *)signbuf->pos;
-    signstr->len = aos_buf_size(signbuf);
+    signstr->data = apr_pstrmemdup(p, signbuf.data, signbuf.len);
+    signstr->len = signbuf.len;
 
     return AOSE_OK;
 }
 
 static int oss_get_canonicalized_params(aos_pool_t *p,
                                         const aos_table_t *params,
-                                        aos_buf_t *signbuf)
+                                        oss_sign_buf_t *signbuf)
 {
     int pos;
-    int meta_count = 0;
-    int i;
-    int len;
     const aos_array_header_t *tarr;
     const aos_table_entry_t *telts;
-    char **meta_headers;
-    const char *value;
-    aos_string_t tmp_str;
-    char *tmpbuf = (char*)malloc(AOS_MAX_HEADER_LEN + 1);
-    if (NULL == tmpbuf) {
-        aos_error_log("malloc %d memory failed.", AOS_MAX_HEADER_LEN + 1);
-        return AOSE_OVER_MEMORY;
-    }
+    const aos_table_entry_t *stack_params[OSS_SIGN_SORT_NUM];
+    const aos_table_entry_t **sorted_params = stack_params;
 
     if (apr_is_empty_table(params)) {
-        free(tmpbuf);
         return AOSE_OK;
     }
 
-    // sort user meta header
+    // sort params
     tarr = aos_table_elts(params);
     telts = (aos_table_entry_t*)tarr->elts;
-    meta_headers = aos_pcalloc(p, tarr->nelts * sizeof(char*));
-    for (pos = 0; pos < tarr->nelts; ++pos) {
-        aos_string_t key = aos_string(telts[pos].key);
-        meta_headers[meta_count++] = key.data;
+    if (tarr->nelts > OSS_SIGN_SORT_NUM) {
+        sorted_params = aos_palloc(p, tarr->nelts * sizeof(aos_table_entry_t *));
     }
-    if (meta_count == 0) {
-        free(tmpbuf);
-        return AOSE_OK;
-    }
-    aos_gnome_sort((const char **)meta_headers, meta_count);
-
-    // sign string
-    for (i = 0; i < meta_count; ++i) {
-        value = apr_table_get(params, meta_headers[i]);
-        aos_str_set(&tmp_str, value);
-        aos_strip_space(&tmp_str);
-        len = apr_snprintf(tmpbuf, AOS_MAX_HEADER_LEN + 1, "%s:%.*s",
-                           meta_headers[i], tmp_str.len, tmp_str.data);
-        if (len > AOS_MAX_HEADER_LEN) {
-            free(tmpbuf);
-            aos_error_log("rtmp parameters too many, %d > %d.",
-                          len, AOS_MAX_HEADER_LEN);
-            return AOSE_INVALID_ARGUMENT;
-        }
-        tmp_str.data = tmpbuf;
-        tmp_str.len = len;
-        aos_buf_append_string(p, signbuf, tmpbuf, len);
-        aos_buf_append_string(p, signbuf, "\n", sizeof("\n")-1);
+    for (pos = 0; pos < tarr->nelts; ++pos) {
+        sorted_params[pos] = &telts[pos];
     }
 
-    free(tmpbuf);
-    return AOSE_OK;
+    return oss_append_sorted_entries(p, sorted_params, tarr->nelts, signbuf, "rtmp parameters");
 }
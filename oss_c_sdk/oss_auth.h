@@ -8,6 +8,10 @@
 
 OSS_CPP_START
 
+#define OSS_SIGN_BUFFER_SIZE        4096  // the string to sign is built on the stack up to this size
+#define OSS_SIGN_SORT_NUM           64    // the headers or params sorted on the stack
+#define OSS_SIGNATURE_BASE64_LEN    ((20 + 1) * 4 / 3)
+
 /**
   * @brief  sign oss headers 
 **/
@@ -39,6 +43,11 @@ int oss_get_signed_headers(aos_pool_t *p, const aos_string_t *access_key_id,
 **/
 int oss_sign_request(aos_http_request_t *req, const oss_config_t *config);
 
+/**
+  * @brief  sign oss request with the key state of the client
+**/
+int oss_client_sign_request(aos_http_request_t *req, const oss_client_t *client);
+
 /**
   * @brief  generate oss request Signature
 **/
@@ -7,6 +7,7 @@
 #include "oss_util.h"
 #include "oss_xml.h"
 #include "oss_api.h"
+#include "apr_hash.h"
 
 aos_status_t *oss_create_bucket(const oss_request_options_t *options, 
                                 const aos_string_t *bucket, 
@@ -124,10 +125,11 @@ aos_status_t *oss_get_bucket_acl(const oss_request_options_t *options,
     return s;
 }
 
-aos_status_t *oss_list_object(const oss_request_options_t *options,
-                              const aos_string_t *bucket, 
-                              oss_list_object_params_t *params, 
-                              aos_table_t **resp_headers)
+static aos_status_t *oss_do_list_object(const oss_request_options_t *options,
+                                       const aos_string_t *bucket, 
+                                       oss_list_object_params_t *params, 
+                                       oss_list_objects_parser_t *parser,
+                                       aos_table_t **resp_headers)
 {
     int res;
     aos_status_t *s = NULL;
@@ -149,15 +151,19 @@ aos_status_t *oss_list_object(const oss_request_options_t *options,
     oss_init_bucket_request(options, bucket, HTTP_GET, &req, 
                             query_params, headers, &resp);
 
+    // parse the contents as the body arrives
+    resp->type = BODY_IN_CALLBACK;
+    resp->user_data = parser;
+    resp->write_body = oss_write_list_objects_body;
+
     s = oss_process_request(options, req, resp);
     oss_fill_read_response_header(resp, resp_headers);
     if (!aos_status_is_ok(s)) {
+        oss_list_objects_parser_rollback(parser);
         return s;
     }
 
-    res = oss_list_objects_parse_from_body(options->pool, &resp->body, 
-            &params->object_list, &params->common_prefix_list, 
-            &params->next_marker, &params->truncated);
+    res = oss_list_objects_parser_finish(parser);
     if (res != AOSE_OK) {
         aos_xml_error_status_set(s, res);
     }
@@ -165,6 +171,31 @@ aos_status_t *oss_list_object(const oss_request_options_t *options,
     return s;
 }
 
+aos_status_t *oss_list_object(const oss_request_options_t *options,
+                              const aos_string_t *bucket, 
+                              oss_list_object_params_t *params, 
+                              aos_table_t **resp_headers)
+{
+    oss_list_objects_parser_t *parser = NULL;
+
+    parser = oss_create_list_objects_parser(options->pool, &params->object_list, 
+            &params->common_prefix_list, &params->next_marker, &params->truncated);
+    return oss_do_list_object(options, bucket, params, parser, resp_headers);
+}
+
+aos_status_t *oss_list_object_compact(const oss_request_options_t *options,
+                                      const aos_string_t *bucket, 
+                                      oss_list_object_params_t *params, 
+                                      oss_list_object_compact_t *compact,
+                                      aos_table_t **resp_headers)
+{
+    oss_list_objects_parser_t *parser = NULL;
+
+    parser = oss_create_list_objects_compact_parser(options->pool, compact, 
+            &params->common_prefix_list, &params->next_marker, &params->truncated);
+    return oss_do_list_object(options, bucket, params, parser, resp_headers);
+}
+
 aos_status_t *oss_put_bucket_lifecycle(const oss_request_options_t *options,
                                        const aos_string_t *bucket, 
                                        aos_list_t *lifecycle_rule_list, 
@@ -276,7 +307,7 @@ aos_status_t *oss_delete_objects(const oss_request_options_t *options,
     char *buf = NULL;
     int64_t body_len;
     char *b64_value = NULL;
-    int b64_buf_len = (20 + 1) * 4 / 3;
+    int b64_buf_len = AOS_BASE64_ENCODE_LEN(APR_MD5_DIGESTSIZE) + 1;
     int b64_len;
 
     //init query_params
@@ -297,7 +328,7 @@ aos_status_t *oss_delete_objects(const oss_request_options_t *options,
     buf = aos_buf_list_content(options->pool, &body);
     md5 = aos_md5(options->pool, buf, (apr_size_t)body_len);
     b64_value = aos_pcalloc(options->pool, b64_buf_len);
-    b64_len = aos_base64_encode(md5, 20, b64_value);
+    b64_len = aos_base64_encode(md5, APR_MD5_DIGESTSIZE, b64_value);
     b64_value[b64_len] = '\0';
     apr_table_addn(headers, OSS_CONTENT_MD5, b64_value);
 
@@ -326,81 +357,682 @@ aos_status_t *oss_delete_objects(const oss_request_options_t *options,
 aos_status_t *oss_delete_objects_by_prefix(oss_request_options_t *options,
                                            const aos_string_t *bucket, 
                                            const aos_string_t *prefix)
+{
+    return oss_do_delete_objects_by_prefix(options, bucket, prefix, NULL, NULL);
+}
+
+typedef struct {
+    oss_request_options_t options;
+    aos_string_t *bucket;
+    aos_list_t object_list;          // the keys of the batch, oss_object_key_t
+    int key_num;                     // the number of keys of the batch
+    aos_list_t deleted_object_list;  // the keys deleted by the batch
+    aos_status_t *s;
+    apr_queue_t *completed_batches;  // the queue of completed batches, thread safe
+} oss_delete_thread_params_t;
+
+static void * APR_THREAD_FUNC delete_objects_batch(apr_thread_t *thd, void *data)
+{
+    oss_delete_thread_params_t *params = NULL;
+    aos_table_t *resp_headers = NULL;
+    int is_quiet = 0;
+    int retry;
+
+    params = (oss_delete_thread_params_t *)data;
+    for (retry = 0; ; retry++) {
+        aos_list_init(&params->deleted_object_list);
+        params->s = oss_delete_objects(&params->options, params->bucket, &params->object_list, 
+            is_quiet, &resp_headers, &params->deleted_object_list);
+        if (aos_status_is_ok(params->s) || retry >= OSS_PART_RETRY_NUM || !aos_should_retry(params->s)) {
+            break;
+        }
+        aos_warn_log("delete objects failure, code:%d, retry:%d.\n", params->s->code, retry + 1);
+        apr_sleep(OSS_PART_RETRY_BACKOFF << retry);
+    }
+
+    apr_queue_push(params->completed_batches, params);
+    return NULL;
+}
+
+static void oss_add_delete_failed_object(aos_pool_t *pool, oss_delete_objects_by_prefix_params_t *params,
+                                         const aos_string_t *key, const aos_status_t *s)
+{
+    oss_delete_failed_object_t *failed_object;
+
+    failed_object = oss_create_delete_failed_object(pool);
+    aos_str_set(&failed_object->key, aos_pstrdup(pool, key));
+    failed_object->code = s->code;
+    aos_str_set(&failed_object->error_code, apr_pstrdup(pool, s->error_code == NULL ? "" : s->error_code));
+    aos_list_add_tail(&failed_object->node, &params->failed_object_list);
+    params->failed_num++;
+}
+
+static aos_status_t *oss_complete_delete_batch(aos_pool_t *pool, oss_delete_objects_by_prefix_params_t *params,
+                                               oss_delete_thread_params_t *batch, aos_status_t *ret)
+{
+    apr_hash_t *deleted;
+    oss_object_key_t *object_key;
+
+    if (!aos_status_is_ok(batch->s)) {
+        aos_error_log("delete objects failure, code:%d, keys:%d.\n", batch->s->code, batch->key_num);
+        aos_list_for_each_entry(oss_object_key_t, object_key, &batch->object_list, node) {
+            oss_add_delete_failed_object(pool, params, &object_key->key, batch->s);
+        }
+        if (NULL == ret) {
+            ret = aos_status_dup(pool, batch->s);
+        }
+    } else {
+        // a key missing in the verbose result is not deleted
+        deleted = apr_hash_make(batch->options.pool);
+        aos_list_for_each_entry(oss_object_key_t, object_key, &batch->deleted_object_list, node) {
+            apr_hash_set(deleted, object_key->key.data, object_key->key.len, object_key);
+        }
+        aos_list_for_each_entry(oss_object_key_t, object_key, &batch->object_list, node) {
+            if (NULL == apr_hash_get(deleted, object_key->key.data, object_key->key.len)) {
+                oss_add_delete_failed_object(pool, params, &object_key->key, batch->s);
+            } else {
+                params->deleted_num++;
+            }
+        }
+    }
+
+    aos_pool_destroy(batch->options.pool);
+    return ret;
+}
+
+aos_status_t *oss_do_delete_objects_by_prefix(oss_request_options_t *options,
+                                              const aos_string_t *bucket, 
+                                              const aos_string_t *prefix,
+                                              oss_delete_objects_by_prefix_params_t *params,
+                                              oss_progress_callback progress_callback)
 {
     aos_pool_t *subpool = NULL;
+    aos_pool_t *list_pool = NULL;
     aos_pool_t *parent_pool = NULL;
-    int is_quiet = 1;
     aos_status_t *s = NULL;
     aos_status_t *ret = NULL;
-    oss_list_object_params_t *params = NULL;
-    int list_object_count = 0;
-    
+    aos_status_t *failed_ret = NULL;
+    oss_list_object_params_t *list_params = NULL;
+    oss_list_object_content_t *list_content = NULL;
+    oss_object_key_t *object_key = NULL;
+    oss_delete_thread_params_t *batch = NULL;
+    apr_thread_pool_t *thrp;
+    apr_queue_t *completed_batches;
+    int32_t thread_num;
+    int32_t queue_num;
+    int in_flight = 0;
+    int64_t listed_num = 0;
+    void *task_result;
+    int rv;
+
     parent_pool = options->pool;
-    params = oss_create_list_object_params(parent_pool);
-    if (prefix->data == NULL) {
-        aos_str_set(&params->prefix, "");
-    } else {
-        aos_str_set(&params->prefix, prefix->data);
+    ret = aos_status_create(parent_pool);
+    if (NULL == params) {
+        params = oss_create_delete_objects_by_prefix_params(parent_pool);
     }
-    while (params->truncated) {
-        aos_table_t *list_object_resp_headers = NULL;
-        aos_list_t object_list;
-        aos_list_t deleted_object_list;
-        oss_list_object_content_t *list_content = NULL;
-        aos_table_t *delete_objects_resp_headers = NULL;
-        char *key = NULL;
+    thread_num = params->thread_num > 0 ? params->thread_num : OSS_DEFAULT_THREAD_NUM;
+    queue_num = params->queue_num > 0 ? params->queue_num : 2 * thread_num;
+
+    rv = apr_thread_pool_create(&thrp, 0, thread_num, parent_pool);
+    if (APR_SUCCESS != rv) {
+        aos_status_set(ret, rv, AOS_CREATE_THREAD_POOL_ERROR_CODE, NULL); 
+        return ret;
+    }
+
+    rv = apr_queue_create(&completed_batches, thread_num + queue_num, parent_pool);
+    if (APR_SUCCESS != rv) {
+        aos_status_set(ret, rv, AOS_CREATE_QUEUE_ERROR_CODE, NULL); 
+        return ret;
+    }
+
+    list_params = oss_create_list_object_params(parent_pool);
+    if (prefix->data != NULL) {
+        aos_str_set(&list_params->prefix, prefix->data);
+    }
+    if (params->batch_size > 0 && params->batch_size < OSS_PER_RET_NUM) {
+        list_params->max_ret = params->batch_size;
+    }
+
+    while (list_params->truncated) {
+        // at most thread_num batches are deleting and queue_num batches are waiting
+        while (in_flight >= thread_num + queue_num) {
+            apr_queue_pop(completed_batches, &task_result);
+            failed_ret = oss_complete_delete_batch(parent_pool, params, 
+                (oss_delete_thread_params_t *)task_result, failed_ret);
+            in_flight--;
+            if (NULL != progress_callback) {
+                progress_callback(params->deleted_num + params->failed_num, listed_num);
+            }
+        }
 
+        // the marker of the former page is kept until the next page is listed
         aos_pool_create(&subpool, parent_pool);
         options->pool = subpool;
-        list_object_count = 0;
-        aos_list_init(&object_list);
-        s = oss_list_object(options, bucket, params, &list_object_resp_headers);
+        aos_list_init(&list_params->object_list);
+        aos_list_init(&list_params->common_prefix_list);
+        s = oss_list_object(options, bucket, list_params, NULL);
+        options->pool = parent_pool;
+        if (NULL != list_pool) {
+            aos_pool_destroy(list_pool);
+        }
+        list_pool = subpool;
         if (!aos_status_is_ok(s)) {
-            ret = aos_status_dup(parent_pool, s);
-            aos_pool_destroy(subpool);
-            options->pool = parent_pool;
-            return ret;
+            break;
         }
-
-        aos_list_for_each_entry(oss_list_object_content_t, list_content, &params->object_list, node) {
-            oss_object_key_t *object_key = oss_create_oss_object_key(parent_pool);
-            key = apr_psprintf(parent_pool, "%.*s", list_content->key.len, 
-                               list_content->key.data);
-            aos_str_set(&object_key->key, key);
-            aos_list_add_tail(&object_key->node, &object_list);
-            list_object_count += 1;
+        if (list_params->next_marker.data) {
+            aos_str_set(&list_params->marker, list_params->next_marker.data);
         }
-        if (list_object_count == 0)
-        {
-            ret = aos_status_dup(parent_pool, s);
-            aos_pool_destroy(subpool);
-            options->pool = parent_pool;
-            return ret;
+
+        if (aos_list_empty(&list_params->object_list)) {
+            continue;
         }
-        aos_pool_destroy(subpool);
 
-        aos_list_init(&deleted_object_list);
         aos_pool_create(&subpool, parent_pool);
-        options->pool = subpool;
-        s = oss_delete_objects(options, bucket, &object_list, is_quiet,
-                               &delete_objects_resp_headers, &deleted_object_list);
+        batch = (oss_delete_thread_params_t *)aos_pcalloc(subpool, sizeof(oss_delete_thread_params_t));
+        batch->options.config = options->config;
+        batch->options.ctl = aos_http_controller_create(subpool, 0);
+        batch->options.client = options->client;
+        batch->options.pool = subpool;
+        batch->bucket = (aos_string_t *)bucket;
+        batch->completed_batches = completed_batches;
+        aos_list_init(&batch->object_list);
+        aos_list_for_each_entry(oss_list_object_content_t, list_content, &list_params->object_list, node) {
+            object_key = oss_create_oss_object_key(subpool);
+            aos_str_set(&object_key->key, aos_pstrdup(subpool, &list_content->key));
+            aos_list_add_tail(&object_key->node, &batch->object_list);
+            batch->key_num++;
+        }
+        listed_num += batch->key_num;
+
+        in_flight++;
+        apr_thread_pool_push(thrp, delete_objects_batch, batch, 0, NULL);
+
+        while (APR_SUCCESS == apr_queue_trypop(completed_batches, &task_result)) {
+            failed_ret = oss_complete_delete_batch(parent_pool, params, 
+                (oss_delete_thread_params_t *)task_result, failed_ret);
+            in_flight--;
+            if (NULL != progress_callback) {
+                progress_callback(params->deleted_num + params->failed_num, listed_num);
+            }
+        }
+    }
+
+    // wait until all batches are done
+    while (in_flight > 0) {
+        apr_queue_pop(completed_batches, &task_result);
+        failed_ret = oss_complete_delete_batch(parent_pool, params, 
+            (oss_delete_thread_params_t *)task_result, failed_ret);
+        in_flight--;
+        if (NULL != progress_callback) {
+            progress_callback(params->deleted_num + params->failed_num, listed_num);
+        }
+    }
+    apr_thread_pool_destroy(thrp);
+
+    if (aos_status_is_ok(s) && NULL != failed_ret) {
+        ret = failed_ret;
+    } else {
+        ret = aos_status_dup(parent_pool, s);
+    }
+    aos_pool_destroy(list_pool);
+
+    return ret;
+}
+
+struct oss_list_iterator_s {
+    aos_pool_t *pool;                // the pool of the caller
+    oss_request_options_t options;   // the options of the list thread
+    aos_http_request_options_t *http_options;
+    aos_string_t bucket;
+    oss_list_object_params_t params; // prefix, delimiter, max_ret and the marker of the next page
+    int page_num;                    // the number of pages, the ready pages at most page_num - 1
+    oss_list_object_page_t *pages;
+    oss_list_object_page_t *current; // the page returned to the caller
+    apr_queue_t *free_pages;         // the pages to fill, thread safe
+    apr_queue_t *ready_pages;        // the listed pages in order, thread safe
+    aos_pool_t *marker_pool;         // the marker outlives the page it comes from
+    apr_thread_t *thread;
+    int done;                        // the last page has been returned
+    aos_status_t *s;                 // the status of the last page
+};
+
+static void oss_copy_string(aos_pool_t *pool, aos_string_t *dst, const aos_string_t *src)
+{
+    if (NULL == src->data) {
+        aos_str_set(dst, "");
+    } else {
+        dst->data = apr_pstrmemdup(pool, src->data, src->len);
+        dst->len = src->len;
+    }
+}
+
+static void * APR_THREAD_FUNC list_objects_prefetch(apr_thread_t *thd, void *data)
+{
+    oss_list_iterator_t *iter = NULL;
+    oss_list_object_page_t *page = NULL;
+    void *task_result;
+    int truncated = 1;
+
+    iter = (oss_list_iterator_t *)data;
+    while (truncated) {
+        // blocks while all the pages are in use, fails once the iterator is destroyed
+        if (APR_SUCCESS != apr_queue_pop(iter->free_pages, &task_result)) {
+            break;
+        }
+        page = (oss_list_object_page_t *)task_result;
+        apr_pool_clear(page->pool);
+
+        iter->options.pool = page->pool;
+        iter->options.ctl = aos_http_controller_create(page->pool, 0);
+        iter->options.ctl->options = iter->http_options;
+        aos_list_init(&iter->params.object_list);
+        aos_list_init(&iter->params.common_prefix_list);
+        aos_str_null(&iter->params.next_marker);
+        page->s = oss_list_object(&iter->options, &iter->bucket, &iter->params, NULL);
+
+        aos_list_movelist(&iter->params.object_list, &page->object_list);
+        aos_list_movelist(&iter->params.common_prefix_list, &page->common_prefix_list);
+        page->next_marker = iter->params.next_marker;
+        page->truncated = aos_status_is_ok(page->s) ? iter->params.truncated : 0;
+        truncated = page->truncated;
+
+        // the page may be recycled before the next page is listed
+        if (truncated && NULL != page->next_marker.data) {
+            apr_pool_clear(iter->marker_pool);
+            oss_copy_string(iter->marker_pool, &iter->params.marker, &page->next_marker);
+        }
+
+        if (APR_SUCCESS != apr_queue_push(iter->ready_pages, page)) {
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+aos_status_t *oss_create_list_iterator(const oss_request_options_t *options,
+                                       const aos_string_t *bucket,
+                                       const oss_list_object_params_t *params,
+                                       int page_num,
+                                       oss_list_iterator_t **iter)
+{
+    aos_status_t *s = NULL;
+    oss_list_iterator_t *it = NULL;
+    int i;
+    int rv;
+
+    *iter = NULL;
+    s = aos_status_create(options->pool);
+    page_num = page_num >= 2 ? page_num : OSS_LIST_ITERATOR_PAGE_NUM;
+
+    it = (oss_list_iterator_t *)aos_pcalloc(options->pool, sizeof(oss_list_iterator_t));
+    it->pool = options->pool;
+    it->options.config = options->config;
+    it->options.client = options->client;
+    it->http_options = options->ctl->options;
+    oss_copy_string(options->pool, &it->bucket, bucket);
+    oss_copy_string(options->pool, &it->params.prefix, &params->prefix);
+    oss_copy_string(options->pool, &it->params.marker, &params->marker);
+    oss_copy_string(options->pool, &it->params.delimiter, &params->delimiter);
+    it->params.max_ret = params->max_ret > 0 ? params->max_ret : OSS_PER_RET_NUM;
+    it->params.truncated = 1;
+    it->page_num = page_num;
+
+    rv = apr_queue_create(&it->free_pages, page_num, options->pool);
+    if (APR_SUCCESS == rv) {
+        rv = apr_queue_create(&it->ready_pages, page_num, options->pool);
+    }
+    if (APR_SUCCESS != rv) {
+        aos_status_set(s, rv, AOS_CREATE_QUEUE_ERROR_CODE, NULL);
+        return s;
+    }
+
+    // the pages are filled by the list thread, so they do not share a pool with the caller
+    aos_pool_create(&it->marker_pool, NULL);
+    it->pages = (oss_list_object_page_t *)aos_pcalloc(options->pool, page_num * sizeof(oss_list_object_page_t));
+    for (i = 0; i < page_num; i++) {
+        aos_pool_create(&it->pages[i].pool, NULL);
+        aos_list_init(&it->pages[i].object_list);
+        aos_list_init(&it->pages[i].common_prefix_list);
+        apr_queue_push(it->free_pages, &it->pages[i]);
+    }
+
+    rv = apr_thread_create(&it->thread, NULL, list_objects_prefetch, it, options->pool);
+    if (APR_SUCCESS != rv) {
+        it->thread = NULL;
+        oss_list_iterator_destroy(it);
+        aos_status_set(s, rv, AOS_CREATE_THREAD_ERROR_CODE, NULL);
+        return s;
+    }
+
+    *iter = it;
+    s->code = 200;
+    return s;
+}
+
+aos_status_t *oss_list_iterator_next(oss_list_iterator_t *iter, oss_list_object_page_t **page)
+{
+    oss_list_object_page_t *current = NULL;
+    void *task_result;
+    int rv;
+
+    *page = NULL;
+    current = iter->current;
+    if (NULL != current) {
+        // hand the former page back, the list thread refills it in the background
+        iter->current = NULL;
+        iter->done = !current->truncated;
+        apr_queue_push(iter->free_pages, current);
+    }
+    if (iter->done) {
+        return iter->s;
+    }
+
+    rv = apr_queue_pop(iter->ready_pages, &task_result);
+    if (APR_SUCCESS != rv) {
+        iter->done = 1;
+        iter->s = aos_status_create(iter->pool);
+        aos_status_set(iter->s, rv, AOS_CLIENT_ERROR_CODE, "list iterator is terminated");
+        return iter->s;
+    }
+
+    iter->current = (oss_list_object_page_t *)task_result;
+    if (!aos_status_is_ok(iter->current->s)) {
+        iter->s = aos_status_dup(iter->pool, iter->current->s);
+        return iter->s;
+    }
+    if (!iter->current->truncated) {
+        iter->s = aos_status_dup(iter->pool, iter->current->s);
+    }
+
+    *page = iter->current;
+    return iter->current->s;
+}
+
+void oss_list_iterator_destroy(oss_list_iterator_t *iter)
+{
+    apr_status_t rv;
+    int i;
+
+    // wakes the list thread up, a running list request is finished first
+    apr_queue_term(iter->free_pages);
+    apr_queue_term(iter->ready_pages);
+    if (NULL != iter->thread) {
+        apr_thread_join(&rv, iter->thread);
+    }
+
+    for (i = 0; i < iter->page_num; i++) {
+        aos_pool_destroy(iter->pages[i].pool);
+    }
+    aos_pool_destroy(iter->marker_pool);
+}
+
+typedef struct {
+    oss_request_options_t *options;  // the config and http options shared by the walk threads
+    aos_string_t *bucket;
+    oss_parallel_walk_params_t *params;
+    apr_thread_pool_t *thrp;
+    apr_queue_t *completed_tasks;    // the queue of completed prefixes, thread safe
+    apr_uint32_t pending;            // the number of unfinished prefixes, use atomic
+    apr_uint32_t aborted;            // set by a failure or the visitor, use atomic
+} oss_walk_context_t;
+
+typedef struct {
+    aos_pool_t *pool;                // the pool of the task, released by the walk caller
+    oss_walk_context_t *walk;
+    aos_string_t prefix;
+    int32_t depth;
+    int64_t object_num;              // the objects directly listed by the task
+    int64_t total_size;
+    aos_status_t *s;
+} oss_walk_task_t;
+
+static void * APR_THREAD_FUNC walk_prefix(apr_thread_t *thd, void *data);
+
+static oss_walk_task_t *oss_create_walk_task(oss_walk_context_t *walk, const aos_string_t *prefix, int32_t depth)
+{
+    aos_pool_t *pool = NULL;
+    oss_walk_task_t *task = NULL;
+
+    // the tasks are created by the walk threads, so they do not share a pool with the caller
+    aos_pool_create(&pool, NULL);
+    task = (oss_walk_task_t *)aos_pcalloc(pool, sizeof(oss_walk_task_t));
+    task->pool = pool;
+    task->walk = walk;
+    task->depth = depth;
+    oss_copy_string(pool, &task->prefix, prefix);
+    return task;
+}
+
+static void oss_push_walk_task(oss_walk_task_t *task)
+{
+    apr_atomic_inc32(&task->walk->pending);
+    apr_thread_pool_push(task->walk->thrp, walk_prefix, task, 0, NULL);
+}
+
+static void * APR_THREAD_FUNC walk_prefix(apr_thread_t *thd, void *data)
+{
+    oss_walk_task_t *task = NULL;
+    oss_walk_context_t *walk = NULL;
+    oss_parallel_walk_params_t *params = NULL;
+    oss_request_options_t options;
+    oss_list_object_params_t *list_params = NULL;
+    oss_list_object_content_t *content = NULL;
+    oss_list_object_common_prefix_t *common_prefix = NULL;
+    aos_pool_t *subpool = NULL;
+    aos_pool_t *list_pool = NULL;
+    aos_status_t *s = NULL;
+    int retry;
+
+    task = (oss_walk_task_t *)data;
+    walk = task->walk;
+    params = walk->params;
+
+    list_params = oss_create_list_object_params(task->pool);
+    list_params->prefix = task->prefix;
+    if (params->max_depth <= 0 || task->depth < params->max_depth) {
+        list_params->delimiter = params->delimiter;
+    }
+    options.config = walk->options->config;
+    options.client = walk->options->client;
+
+    while (list_params->truncated && NULL == task->s && !apr_atomic_read32(&walk->aborted)) {
+        // the marker of the former page is kept until the next page is listed
+        aos_pool_create(&subpool, task->pool);
+        options.pool = subpool;
+        for (retry = 0; ; retry++) {
+            options.ctl = aos_http_controller_create(subpool, 0);
+            options.ctl->options = walk->options->ctl->options;
+            aos_list_init(&list_params->object_list);
+            aos_list_init(&list_params->common_prefix_list);
+            s = oss_list_object(&options, walk->bucket, list_params, NULL);
+            if (aos_status_is_ok(s) || retry >= OSS_PART_RETRY_NUM || !aos_should_retry(s)) {
+                break;
+            }
+            aos_warn_log("list objects failure, code:%d, retry:%d.\n", s->code, retry + 1);
+            apr_sleep(OSS_PART_RETRY_BACKOFF << retry);
+        }
+        if (NULL != list_pool) {
+            aos_pool_destroy(list_pool);
+        }
+        list_pool = subpool;
         if (!aos_status_is_ok(s)) {
-            ret = aos_status_dup(parent_pool, s);
-            aos_pool_destroy(subpool);
-            options->pool = parent_pool;
-            return ret;
+            task->s = aos_status_dup(task->pool, s);
+            break;
+        }
+        if (list_params->next_marker.data) {
+            aos_str_set(&list_params->marker, list_params->next_marker.data);
         }
-        if (!params->truncated) {
-            ret = aos_status_dup(parent_pool, s);
+
+        aos_list_for_each_entry(oss_list_object_common_prefix_t, common_prefix, &list_params->common_prefix_list, node) {
+            oss_push_walk_task(oss_create_walk_task(walk, &common_prefix->prefix, task->depth + 1));
+        }
+
+        aos_list_for_each_entry(oss_list_object_content_t, content, &list_params->object_list, node) {
+            task->object_num++;
+            if (NULL != content->size.data) {
+                task->total_size += aos_atoi64(content->size.data);
+            }
+            if (NULL != params->visitor && AOSE_OK != params->visitor(content, params->user_data)) {
+                task->s = aos_status_create(task->pool);
+                aos_status_set(task->s, AOSE_ABORT_CALLBACK, AOS_CLIENT_ERROR_CODE, "walk is aborted by visitor");
+                break;
+            }
+        }
+    }
+    if (NULL != list_pool) {
+        aos_pool_destroy(list_pool);
+    }
+
+    apr_queue_push(walk->completed_tasks, task);
+    return NULL;
+}
+
+static int oss_walk_prefix_stat_cmp(const void *a, const void *b)
+{
+    const oss_walk_prefix_stat_t *stat_a = *(oss_walk_prefix_stat_t * const *)a;
+    const oss_walk_prefix_stat_t *stat_b = *(oss_walk_prefix_stat_t * const *)b;
+    return strcmp(stat_a->prefix.data, stat_b->prefix.data);
+}
+
+/**
+ * the parent of a prefix at depth 1 is the walked prefix, a deeper one ends
+ * at the delimiter before its own trailing delimiter
+ **/
+static int oss_walk_parent_prefix_len(const aos_string_t *prefix, int len, int32_t depth,
+                                      int root_len, const aos_string_t *delimiter)
+{
+    int pos;
+
+    if (depth > 1) {
+        for (pos = len - 2 * delimiter->len; pos >= root_len; pos--) {
+            if (memcmp(prefix->data + pos, delimiter->data, delimiter->len) == 0) {
+                return pos + delimiter->len;
+            }
+        }
+    }
+    return root_len;
+}
+
+static void oss_aggregate_walk_prefix_stats(aos_pool_t *pool, oss_parallel_walk_params_t *params, 
+                                            apr_array_header_t *stats, int root_len)
+{
+    apr_hash_t *index = NULL;
+    oss_walk_prefix_stat_t **items = NULL;
+    oss_walk_prefix_stat_t *parent = NULL;
+    int64_t *direct = NULL;
+    int32_t depth;
+    int len;
+    int i;
+
+    items = (oss_walk_prefix_stat_t **)stats->elts;
+    index = apr_hash_make(pool);
+    direct = (int64_t *)aos_palloc(pool, 2 * (stats->nelts + 1) * sizeof(int64_t));
+    for (i = 0; i < stats->nelts; i++) {
+        apr_hash_set(index, items[i]->prefix.data, items[i]->prefix.len, items[i]);
+        direct[2 * i] = items[i]->object_num;
+        direct[2 * i + 1] = items[i]->total_size;
+    }
+
+    // add the objects directly under each prefix to all of its ancestors
+    for (i = 0; i < stats->nelts; i++) {
+        len = items[i]->prefix.len;
+        for (depth = items[i]->depth; depth > 0; depth--) {
+            len = oss_walk_parent_prefix_len(&items[i]->prefix, len, depth, root_len, &params->delimiter);
+            parent = (oss_walk_prefix_stat_t *)apr_hash_get(index, items[i]->prefix.data, len);
+            if (NULL == parent) {
+                break;
+            }
+            parent->object_num += direct[2 * i];
+            parent->total_size += direct[2 * i + 1];
         }
+    }
 
-        aos_pool_destroy(subpool);
+    qsort(items, stats->nelts, sizeof(oss_walk_prefix_stat_t *), oss_walk_prefix_stat_cmp);
+    for (i = 0; i < stats->nelts; i++) {
+        aos_list_add_tail(&items[i]->node, &params->prefix_stat_list);
+    }
+}
 
-        aos_list_init(&params->object_list);
-        if (params->next_marker.data) {
-            aos_str_set(&params->marker, params->next_marker.data);
+aos_status_t *oss_parallel_walk(oss_request_options_t *options,
+                                const aos_string_t *bucket,
+                                const aos_string_t *prefix,
+                                oss_parallel_walk_params_t *params)
+{
+    aos_pool_t *parent_pool = NULL;
+    aos_status_t *ret = NULL;
+    aos_status_t *failed_ret = NULL;
+    oss_walk_context_t *walk = NULL;
+    oss_walk_task_t *task = NULL;
+    oss_walk_prefix_stat_t *stat = NULL;
+    apr_array_header_t *stats = NULL;
+    int32_t thread_num;
+    void *task_result;
+    int rv;
+
+    parent_pool = options->pool;
+    ret = aos_status_create(parent_pool);
+    if (NULL == params) {
+        params = oss_create_parallel_walk_params(parent_pool);
+    }
+    if (NULL == params->delimiter.data) {
+        aos_str_set(&params->delimiter, "");
+    }
+    thread_num = params->thread_num > 0 ? params->thread_num : OSS_DEFAULT_THREAD_NUM;
+    params->object_num = 0;
+    params->total_size = 0;
+    aos_list_init(&params->prefix_stat_list);
+
+    walk = (oss_walk_context_t *)aos_pcalloc(parent_pool, sizeof(oss_walk_context_t));
+    walk->options = options;
+    walk->bucket = (aos_string_t *)bucket;
+    walk->params = params;
+
+    rv = apr_thread_pool_create(&walk->thrp, 0, thread_num, parent_pool);
+    if (APR_SUCCESS != rv) {
+        aos_status_set(ret, rv, AOS_CREATE_THREAD_POOL_ERROR_CODE, NULL); 
+        return ret;
+    }
+
+    rv = apr_queue_create(&walk->completed_tasks, 2 * thread_num, parent_pool);
+    if (APR_SUCCESS != rv) {
+        apr_thread_pool_destroy(walk->thrp);
+        aos_status_set(ret, rv, AOS_CREATE_QUEUE_ERROR_CODE, NULL); 
+        return ret;
+    }
+
+    stats = apr_array_make(parent_pool, 64, sizeof(oss_walk_prefix_stat_t *));
+    oss_push_walk_task(oss_create_walk_task(walk, prefix, 0));
+
+    // a prefix is pending until it is listed, its sub prefixes are pushed before it completes
+    do {
+        apr_queue_pop(walk->completed_tasks, &task_result);
+        task = (oss_walk_task_t *)task_result;
+        params->object_num += task->object_num;
+        params->total_size += task->total_size;
+        if (params->aggregate) {
+            stat = oss_create_walk_prefix_stat(parent_pool);
+            aos_str_set(&stat->prefix, aos_pstrdup(parent_pool, &task->prefix));
+            stat->depth = task->depth;
+            stat->object_num = task->object_num;
+            stat->total_size = task->total_size;
+            *(oss_walk_prefix_stat_t **)apr_array_push(stats) = stat;
+        }
+        if (NULL != task->s && NULL == failed_ret) {
+            failed_ret = aos_status_dup(parent_pool, task->s);
+            apr_atomic_set32(&walk->aborted, 1);
         }
+        aos_pool_destroy(task->pool);
+    } while (0 != apr_atomic_dec32(&walk->pending));
+    apr_thread_pool_destroy(walk->thrp);
+
+    if (params->aggregate) {
+        oss_aggregate_walk_prefix_stats(parent_pool, params, stats, prefix->data == NULL ? 0 : prefix->len);
+    }
+
+    if (NULL != failed_ret) {
+        return failed_ret;
     }
-    options->pool = parent_pool;
+    ret->code = 200;
     return ret;
 }
@@ -7,6 +7,8 @@ const char OSS_CANNONICALIZED_HEADER_COPY_SOURCE[] = "x-oss-copy-source";
 const char OSS_CONTENT_MD5[] = "Content-MD5";
 const char OSS_CONTENT_TYPE[] = "Content-Type";
 const char OSS_CONTENT_LENGTH[] = "Content-Length";
+const char OSS_CONTENT_RANGE[] = "Content-Range";
+const char OSS_RANGE[] = "Range";
 const char OSS_DATE[] = "Date";
 const char OSS_AUTHORIZATION[] = "Authorization";
 const char OSS_ACCESSKEYID[] = "OSSAccessKeyId";
@@ -31,6 +33,7 @@ const char OSS_POSITION[] = "position";
 const char OSS_MULTIPART_CONTENT_TYPE[] = "application/x-www-form-urlencoded";
 const char OSS_COPY_SOURCE[] = "x-oss-copy-source";
 const char OSS_COPY_SOURCE_RANGE[] = "x-oss-copy-source-range";
+const char OSS_COPY_SOURCE_IF_MATCH[] = "x-oss-copy-source-if-match";
 const char OSS_SECURITY_TOKEN[] = "security-token";
 const char OSS_STS_SECURITY_TOKEN[] = "x-oss-security-token";
 const char OSS_REPLACE_OBJECT_META[] = "x-oss-replace-object-meta";
@@ -64,4 +67,5 @@ const int  LIVE_CHANNEL_DEFAULT_FRAG_DURATION = 5;
 const int  LIVE_CHANNEL_DEFAULT_FRAG_COUNT = 3;
 const int OSS_MAX_PART_NUM = 10000;
 const int OSS_PER_RET_NUM = 1000;
+const int OSS_DEFAULT_THREAD_NUM = 4;
 const int MAX_SUFFIX_LEN = 1024;
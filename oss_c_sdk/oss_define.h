@@ -4,6 +4,7 @@
 #include "aos_string.h"
 #include "aos_list.h"
 #include "aos_transport.h"
+#include "aos_status.h"
 
 #ifdef __cplusplus
 # define OSS_CPP_START extern "C" {
@@ -33,6 +34,8 @@ extern const char OSS_CANNONICALIZED_HEADER_COPY_SOURCE[];
 extern const char OSS_CONTENT_MD5[];
 extern const char OSS_CONTENT_TYPE[];
 extern const char OSS_CONTENT_LENGTH[];
+extern const char OSS_CONTENT_RANGE[];
+extern const char OSS_RANGE[];
 extern const char OSS_DATE[];
 extern const char OSS_AUTHORIZATION[];
 extern const char OSS_ACCESSKEYID[];
@@ -57,6 +60,7 @@ extern const char OSS_POSITION[];
 extern const char OSS_MULTIPART_CONTENT_TYPE[];
 extern const char OSS_COPY_SOURCE[];
 extern const char OSS_COPY_SOURCE_RANGE[];
+extern const char OSS_COPY_SOURCE_IF_MATCH[];
 extern const char OSS_SECURITY_TOKEN[];
 extern const char OSS_STS_SECURITY_TOKEN[];
 extern const char OSS_REPLACE_OBJECT_META[];
@@ -90,6 +94,7 @@ extern const int  LIVE_CHANNEL_DEFAULT_FRAG_DURATION;
 extern const int  LIVE_CHANNEL_DEFAULT_FRAG_COUNT;
 extern const int OSS_MAX_PART_NUM;
 extern const int OSS_PER_RET_NUM;
+extern const int OSS_DEFAULT_THREAD_NUM;
 extern const int MAX_SUFFIX_LEN;
 
 typedef struct oss_lib_curl_initializer_s oss_lib_curl_initializer_t;
@@ -123,10 +128,13 @@ typedef struct {
     aos_string_t proxy_passwd;
 } oss_config_t;
 
+typedef struct oss_client_s oss_client_t;
+
 typedef struct {
     oss_config_t *config;
     aos_http_controller_t *ctl; /*< aos http controller, more see aos_transport.h */
     aos_pool_t *pool;
+    oss_client_t *client;       /*< the state precomputed from config, may be NULL, more see oss_util.h */
 } oss_request_options_t;
 
 typedef struct {
@@ -144,6 +152,27 @@ typedef struct {
     aos_string_t prefix;
 } oss_list_object_common_prefix_t;
 
+#define OSS_ETAG_DIGEST_LEN  16  // the binary md5 in an etag
+#define OSS_ETAG_STRING_LEN  48  // the buffer for a quoted etag "md5-N"
+
+/**
+ * the objects of list results packed in struct of arrays, object i has the key
+ * keys + key_offsets[i], sizes[i], last_modified[i] and the etag of 
+ * etags + i * OSS_ETAG_DIGEST_LEN, the owner of the objects is not kept
+ **/
+typedef struct {
+    int count;                 // the number of objects
+    int capacity;
+    char *keys;                // the keys packed one after another, each ends with '\0'
+    int64_t keys_len;
+    int64_t keys_cap;
+    int64_t *key_offsets;      // the offset of the key of each object in keys
+    int64_t *sizes;            // the size of each object
+    int64_t *last_modified;    // the last modified time, seconds since epoch, -1 if unknown
+    unsigned char *etags;      // the binary md5 of the etag of each object
+    int32_t *etag_part_nums;   // N of a multipart etag "md5-N", 0 of a plain etag, -1 if not a md5 etag
+} oss_list_object_compact_t;
+
 typedef struct {
     aos_list_t node;
     aos_string_t key;
@@ -181,6 +210,17 @@ typedef struct {
     aos_list_t common_prefix_list;
 } oss_list_object_params_t;
 
+typedef struct oss_list_iterator_s oss_list_iterator_t;
+
+typedef struct {
+    aos_pool_t *pool;              // the pool of the page, owned and recycled by the iterator
+    aos_list_t object_list;        // oss_list_object_content_t
+    aos_list_t common_prefix_list; // oss_list_object_common_prefix_t
+    aos_string_t next_marker;
+    int truncated;
+    aos_status_t *s;               // the status of the list request of the page
+} oss_list_object_page_t;
+
 typedef struct {
     aos_string_t part_number_marker;
     int max_ret;
@@ -232,16 +272,68 @@ typedef struct {
     aos_string_t key;
 } oss_object_key_t;
 
+typedef struct {
+    aos_list_t node;
+    aos_string_t key;
+    int code;                // the code of the DeleteObjects request, 2xx if the key is missing in the result
+    aos_string_t error_code; // the error code of the DeleteObjects request
+} oss_delete_failed_object_t;
+
+typedef struct {
+    int32_t thread_num;      // the number of concurrent DeleteObjects requests, default 4
+    int32_t queue_num;       // the number of listed batches waiting for a thread, default twice of thread_num
+    int32_t batch_size;      // the number of keys of a DeleteObjects request, default and at most 1000
+    int64_t deleted_num;     // out, the number of deleted keys
+    int64_t failed_num;      // out, the number of keys failed to delete
+    aos_list_t failed_object_list; // out, the keys failed to delete, oss_delete_failed_object_t
+} oss_delete_objects_by_prefix_params_t;
+
+/**
+ * the visitor of oss_parallel_walk, called concurrently from the walk threads,
+ * returns AOSE_OK to go on, other value to abort the walk
+ **/
+typedef int (*oss_walk_visitor_pt)(const oss_list_object_content_t *content, void *user_data);
+
+typedef struct {
+    aos_list_t node;
+    aos_string_t prefix;
+    int32_t depth;           // the number of delimiters below the walked prefix, 0 for the walked prefix
+    int64_t object_num;      // the number of objects under the prefix, including the sub prefixes
+    int64_t total_size;      // the bytes of objects under the prefix, including the sub prefixes
+} oss_walk_prefix_stat_t;
+
+typedef struct {
+    int32_t thread_num;      // the number of concurrent ListObjects requests, default 4
+    aos_string_t delimiter;  // the delimiter to discover the sub prefixes, default "/"
+    int32_t max_depth;       // the sub prefixes deeper than max_depth are not fanned out, 0 for unlimited
+    oss_walk_visitor_pt visitor; // called for each object, NULL for none
+    void *user_data;         // the user data of visitor
+    int aggregate;           // count the objects and bytes per prefix, default disable
+    int64_t object_num;      // out, the number of walked objects
+    int64_t total_size;      // out, the bytes of walked objects
+    aos_list_t prefix_stat_list; // out, oss_walk_prefix_stat_t sorted by prefix if aggregate is enabled
+} oss_parallel_walk_params_t;
+
 typedef struct {
     char *suffix;
     char *type;
 } oss_content_type_t;
 
+typedef struct {
+    int64_t  part_size;  // the tuned part size, bytes
+    int32_t  thread_num; // the tuned number of concurrent part tasks
+    int64_t  bandwidth;  // the best measured aggregate throughput, bytes per second
+    int64_t  rtt;        // the measured round trip time of a small request, microseconds
+} oss_resumable_tuned_params_t;
+
 typedef struct {
     int64_t  part_size;  // bytes, default 1MB
-    int32_t  thread_num;  // default 1
+    int32_t  thread_num;  // default 1, the upper limit of threads when auto_tune is enabled
     int      enable_checkpoint; // default disable, false
     aos_string_t checkpoint_path;  // dafault ./filepath.ucp or ./filepath.dcp
+    int32_t  checkpoint_sync_num;  // default 0, only flush, otherwise fsync the checkpoint every n completed parts
+    int      auto_tune;  // default disable, tune part size and thread num by measured throughput
+    oss_resumable_tuned_params_t tuned; // in: values persisted from a former transfer, out: the tuned values
 } oss_resumable_clt_params_t;
 
 typedef struct {
@@ -257,7 +257,7 @@ aos_status_t *oss_do_upload_part_from_buffer(const oss_request_options_t *option
     oss_fill_read_response_body(resp, resp_body);
 
     if (is_enable_crc(options) && has_crc_in_response(resp)) {
-        oss_check_crc_consistent(req->crc64, resp->headers, s);
+        oss_check_response_crc(req->crc64, resp, s);
     }
 
     return s; 
@@ -317,7 +317,7 @@ aos_status_t *oss_do_upload_part_from_file(const oss_request_options_t *options,
     oss_fill_read_response_body(resp, resp_body);
 
     if (is_enable_crc(options) && has_crc_in_response(resp)) {
-        oss_check_crc_consistent(req->crc64, resp->headers, s);
+        oss_check_response_crc(req->crc64, resp, s);
     }
 
     return s;
@@ -327,6 +327,15 @@ aos_status_t *oss_upload_part_copy(const oss_request_options_t *options,
                                    oss_upload_part_copy_params_t *params, 
                                    aos_table_t *headers, 
                                    aos_table_t **resp_headers)
+{
+    return oss_do_upload_part_copy(options, params, headers, resp_headers, NULL);
+}
+
+aos_status_t *oss_do_upload_part_copy(const oss_request_options_t *options,
+                                      oss_upload_part_copy_params_t *params, 
+                                      aos_table_t *headers, 
+                                      aos_table_t **resp_headers,
+                                      aos_list_t *resp_body)
 {
     aos_status_t *s = NULL;
     aos_http_request_t *req = NULL;
@@ -358,6 +367,7 @@ aos_status_t *oss_upload_part_copy(const oss_request_options_t *options,
 
     s = oss_process_request(options, req, resp);
     oss_fill_read_response_header(resp, resp_headers);
+    oss_fill_read_response_body(resp, resp_body);
 
     return s;
 }
@@ -384,7 +394,7 @@ aos_status_t *oss_get_sorted_uploaded_part(oss_request_options_t *options,
     char *part_num_str = NULL;
 
     parent_pool = options->pool;
-    part_arr = aos_palloc(parent_pool, OSS_MAX_PART_NUM * sizeof(oss_upload_part_t *));
+    part_arr = aos_palloc(parent_pool, OSS_PER_RET_NUM * sizeof(oss_upload_part_t));
     params = oss_create_list_upload_part_params(parent_pool);
     while (params->truncated) {
         aos_pool_create(&subpool, parent_pool);
@@ -402,7 +412,7 @@ aos_status_t *oss_get_sorted_uploaded_part(oss_request_options_t *options,
         }
         aos_list_for_each_entry(oss_list_part_content_t, part_content, &params->part_list, node) {
             oss_upload_part_t upload_part;
-            upload_part.etag = part_content->etag.data;
+            upload_part.etag = apr_pstrdup(parent_pool, part_content->etag.data);
             upload_part.part_num = atoi(part_content->part_number.data);
             part_arr[part_index++] = upload_part;
             uploaded_part_count++;
@@ -411,11 +421,11 @@ aos_status_t *oss_get_sorted_uploaded_part(oss_request_options_t *options,
         aos_list_init(&params->part_list);
         if (params->next_part_number_marker.data != NULL) {
             aos_str_set(&params->part_number_marker, 
-                        params->next_part_number_marker.data);
+                        apr_pstrdup(parent_pool, params->next_part_number_marker.data));
         }
         
         //sort multipart upload part content
-        qsort(part_arr, uploaded_part_count, sizeof(part_arr[0]), part_sort_cmp);
+        qsort(part_arr, part_index, sizeof(part_arr[0]), part_sort_cmp);
 
         for (index = 0; index < part_index; ++index) {
             complete_content = oss_create_complete_part_content(parent_pool);
@@ -434,6 +444,58 @@ aos_status_t *oss_get_sorted_uploaded_part(oss_request_options_t *options,
     return ret;
 }
 
+aos_status_t *oss_get_uploaded_parts(oss_request_options_t *options,
+                                     const aos_string_t *bucket, 
+                                     const aos_string_t *object, 
+                                     const aos_string_t *upload_id,
+                                     int part_num,
+                                     oss_checkpoint_part_t *parts)
+{
+    aos_pool_t *subpool = NULL;
+    aos_pool_t *parent_pool = NULL;
+    aos_status_t *s = NULL;
+    aos_status_t *ret = NULL;
+    int index = 0;
+    oss_list_upload_part_params_t *params = NULL;
+    oss_list_part_content_t *part_content = NULL;
+    aos_table_t *list_part_resp_headers = NULL;
+
+    parent_pool = options->pool;
+    params = oss_create_list_upload_part_params(parent_pool);
+    while (params->truncated) {
+        aos_pool_create(&subpool, parent_pool);
+        options->pool = subpool;
+        s = oss_list_upload_part(options, bucket, object,
+                upload_id, params, &list_part_resp_headers);
+        ret = aos_status_dup(parent_pool, s);
+        if (!aos_status_is_ok(s)) {
+            aos_pool_destroy(subpool);
+            options->pool = parent_pool;
+            return ret;
+        }
+
+        // a part is reusable only if it has the expected size, parts are not contiguous
+        aos_list_for_each_entry(oss_list_part_content_t, part_content, &params->part_list, node) {
+            index = atoi(part_content->part_number.data) - 1;
+            if (index >= 0 && index < part_num && 
+                aos_atoi64(part_content->size.data) == parts[index].size) {
+                parts[index].completed = AOS_TRUE;
+                aos_str_set(&parts[index].etag, apr_pstrdup(parent_pool, part_content->etag.data));
+            }
+        }
+
+        aos_list_init(&params->part_list);
+        if (params->next_part_number_marker.data != NULL) {
+            aos_str_set(&params->part_number_marker, 
+                        apr_pstrdup(parent_pool, params->next_part_number_marker.data));
+        }
+        aos_pool_destroy(subpool);
+    }
+    options->pool = parent_pool;
+
+    return ret;
+}
+
 aos_status_t *oss_upload_file(oss_request_options_t *options,
                               const aos_string_t *bucket, 
                               const aos_string_t *object, 
@@ -441,21 +503,32 @@ aos_status_t *oss_upload_file(oss_request_options_t *options,
                               aos_string_t *filepath, 
                               int64_t part_size,
                               aos_table_t *headers)
+{
+    return oss_do_upload_file(options, bucket, object, upload_id, filepath, 
+                              part_size, OSS_DEFAULT_THREAD_NUM, headers);
+}
+
+aos_status_t *oss_do_upload_file(oss_request_options_t *options,
+                                 const aos_string_t *bucket, 
+                                 const aos_string_t *object, 
+                                 aos_string_t *upload_id,
+                                 aos_string_t *filepath, 
+                                 int64_t part_size,
+                                 int32_t thread_num,
+                                 aos_table_t *headers)
 {
     aos_pool_t *subpool = NULL;
     aos_pool_t *parent_pool = NULL;
-    int64_t start_pos;
-    int64_t end_pos;
-    int part_num;
-    int part_count = 0;
+    int part_num = 0;
+    int undo_num = 0;
+    int i = 0;
     int res = AOSE_OK;
+    apr_finfo_t finfo;
     aos_status_t *s = NULL;
     aos_status_t *ret = NULL;
-    aos_file_buf_t *fb = NULL;
-    oss_upload_file_t *upload_file = NULL;
-    aos_table_t *upload_part_resp_headers = NULL;
+    oss_checkpoint_part_t *parts = NULL;
+    oss_checkpoint_part_t *undo_parts = NULL;
     char *part_num_str = NULL;
-    char *etag = NULL;
     aos_list_t complete_part_list;
     oss_complete_part_content_t *complete_content = NULL;
     aos_table_t *complete_resp_headers = NULL;
@@ -463,6 +536,20 @@ aos_status_t *oss_upload_file(oss_request_options_t *options,
     aos_list_init(&complete_part_list);
     parent_pool = options->pool;
 
+    //get part size
+    res = oss_get_file_info(filepath, parent_pool, &finfo);
+    if (res != AOSE_OK) {
+        s = aos_status_create(parent_pool);
+        aos_file_error_status_set(s, res);
+        return s;
+    }
+    oss_get_part_size(finfo.size, &part_size);
+
+    //build parts, an empty file is uploaded as one empty part
+    part_num = aos_max(oss_get_part_num(finfo.size, part_size), 1);
+    parts = (oss_checkpoint_part_t *)aos_pcalloc(parent_pool, sizeof(oss_checkpoint_part_t) * part_num);
+    oss_build_parts(finfo.size, part_size, parts);
+
     //get upload_id and uploaded part
     aos_pool_create(&subpool, options->pool);
     options->pool = subpool;
@@ -479,9 +566,9 @@ aos_status_t *oss_upload_file(oss_request_options_t *options,
             options->pool = parent_pool;
             return ret;
         }
+        aos_str_set(upload_id, apr_pstrdup(parent_pool, upload_id->data));
     } else {
-        s = oss_get_sorted_uploaded_part(options, bucket, object, upload_id, 
-                &complete_part_list, &part_count);
+        s = oss_get_uploaded_parts(options, bucket, object, upload_id, part_num, parts);
         if (!aos_status_is_ok(s)) {
             ret = aos_status_dup(parent_pool, s);
             aos_pool_destroy(subpool);
@@ -490,56 +577,32 @@ aos_status_t *oss_upload_file(oss_request_options_t *options,
         }
     }
     aos_pool_destroy(subpool);
+    options->pool = parent_pool;
 
-    //get part size
-    fb = aos_create_file_buf(parent_pool);
-    res = aos_open_file_for_read(parent_pool, filepath->data, fb);
-    if (res != AOSE_OK) {
-        s = aos_status_create(parent_pool);
-        aos_file_error_status_set(s, res);
-        options->pool = parent_pool;
-        return s;
+    //upload the missing parts concurrently
+    undo_parts = (oss_checkpoint_part_t *)aos_palloc(parent_pool, sizeof(oss_checkpoint_part_t) * part_num);
+    for (i = 0; i < part_num; i++) {
+        if (!parts[i].completed) {
+            undo_parts[undo_num++] = parts[i];
+        }
     }
-    oss_get_part_size(fb->file_last, &part_size);
-
-    //upload part from file
-    upload_file = oss_create_upload_file(parent_pool);
-    aos_str_set(&upload_file->filename, filepath->data);
-    start_pos = part_size * part_count;
-    end_pos = start_pos + part_size;
-    part_num = part_count + 1;
-
-    while (1) {
-        aos_pool_create(&subpool, parent_pool);
-        options->pool = subpool;
-        upload_file->file_pos = start_pos;
-        upload_file->file_last = end_pos;
-        
-        s = oss_upload_part_from_file(options, bucket, object, upload_id,
-            part_num, upload_file, &upload_part_resp_headers);
+    if (undo_num > 0) {
+        s = oss_upload_parts(options, bucket, object, filepath, upload_id, 
+                             thread_num, undo_num, undo_parts);
         if (!aos_status_is_ok(s)) {
-            ret = aos_status_dup(parent_pool, s);
-            aos_pool_destroy(subpool);
-            options->pool = parent_pool;
-            return ret;
+            return s;
+        }
+        for (i = 0; i < undo_num; i++) {
+            parts[undo_parts[i].index].etag = undo_parts[i].etag;
         }
-         
+    }
+
+    for (i = 0; i < part_num; i++) {
         complete_content = oss_create_complete_part_content(parent_pool);
-        part_num_str = apr_psprintf(parent_pool, "%d", part_num);
+        part_num_str = apr_psprintf(parent_pool, "%d", parts[i].index + 1);
         aos_str_set(&complete_content->part_number, part_num_str);
-        etag = apr_pstrdup(parent_pool, 
-                           (char*)apr_table_get(upload_part_resp_headers, "ETag"));
-        aos_str_set(&complete_content->etag, etag);
+        aos_str_set(&complete_content->etag, parts[i].etag.data);
         aos_list_add_tail(&complete_content->node, &complete_part_list);
-        aos_pool_destroy(subpool);
-        if (end_pos >= fb->file_last) {
-            break;
-        }
-        start_pos += part_size;
-        end_pos += part_size;
-        if (end_pos > fb->file_last)
-            end_pos = fb->file_last;
-        part_num += 1;
     }
 
     //complete multipart
@@ -69,7 +69,7 @@ aos_status_t *oss_do_put_object_from_buffer(const oss_request_options_t *options
     oss_fill_read_response_header(resp, resp_headers);
 
     if (is_enable_crc(options) && has_crc_in_response(resp)) {
-        oss_check_crc_consistent(req->crc64, resp->headers, s);
+        oss_check_response_crc(req->crc64, resp, s);
     }
 
     return s;
@@ -124,7 +124,7 @@ aos_status_t *oss_do_put_object_from_file(const oss_request_options_t *options,
     oss_fill_read_response_header(resp, resp_headers);
 
     if (is_enable_crc(options) && has_crc_in_response(resp)) {
-        oss_check_crc_consistent(req->crc64, resp->headers, s);
+        oss_check_response_crc(req->crc64, resp, s);
     }
 
     return s;
@@ -167,7 +167,7 @@ aos_status_t *oss_do_get_object_to_buffer(const oss_request_options_t *options,
 
     if (is_enable_crc(options) && has_crc_in_response(resp) &&  
         !has_range_or_process_in_request(req)) {
-        oss_check_crc_consistent(resp->crc64, resp->headers, s);
+        oss_check_response_crc(resp->crc64, resp, s);
     }
 
     return s;
@@ -220,7 +220,7 @@ aos_status_t *oss_do_get_object_to_file(const oss_request_options_t *options,
 
     if (is_enable_crc(options) && has_crc_in_response(resp) && 
         !has_range_or_process_in_request(req)) {
-            oss_check_crc_consistent(resp->crc64, resp->headers, s);
+            oss_check_response_crc(resp->crc64, resp, s);
     }
 
     oss_temp_file_rename(s, tmp_filename.data, filename->data, options->pool);
@@ -228,6 +228,103 @@ aos_status_t *oss_do_get_object_to_file(const oss_request_options_t *options,
     return s;
 }
 
+static void oss_set_range_header(const oss_request_options_t *options, aos_table_t *headers, 
+                                 int64_t offset, int64_t size)
+{
+    char *range;
+
+    if (size < 0) {
+        range = apr_psprintf(options->pool, "bytes=%" APR_INT64_T_FMT "-", offset);
+    } else {
+        range = apr_psprintf(options->pool, "bytes=%" APR_INT64_T_FMT "-%" APR_INT64_T_FMT, 
+                             offset, offset + size - 1);
+    }
+    apr_table_set(headers, OSS_RANGE, range);
+}
+
+static void oss_check_range_crc64(const oss_request_options_t *options, aos_http_request_t *req, 
+                                  aos_http_response_t *resp, oss_range_crc64_t *range_crc, aos_status_t *s)
+{
+    if (aos_status_is_ok(s) && NULL != range_crc && is_enable_crc(options) && 
+        has_crc_in_response(resp) && NULL == apr_table_get(req->query_params, OSS_PROCESS)) {
+        oss_add_range_crc64(range_crc, resp, s);
+    }
+}
+
+aos_status_t *oss_get_object_range_to_buffer(const oss_request_options_t *options, 
+                                             const aos_string_t *bucket, 
+                                             const aos_string_t *object,
+                                             int64_t offset,
+                                             int64_t size,
+                                             aos_table_t *headers, 
+                                             aos_table_t *params,
+                                             oss_range_crc64_t *range_crc,
+                                             aos_list_t *buffer, 
+                                             aos_table_t **resp_headers)
+{
+    aos_status_t *s = NULL;
+    aos_http_request_t *req = NULL;
+    aos_http_response_t *resp = NULL;
+
+    headers = aos_table_create_if_null(options, headers, 1);
+    params = aos_table_create_if_null(options, params, 0);
+    oss_set_range_header(options, headers, offset, size);
+
+    oss_init_object_request(options, bucket, object, HTTP_GET, 
+                            &req, params, headers, NULL, 0, &resp);
+
+    s = oss_process_request(options, req, resp);
+    oss_fill_read_response_body(resp, buffer);
+    oss_fill_read_response_header(resp, resp_headers);
+
+    oss_check_range_crc64(options, req, resp, range_crc, s);
+
+    return s;
+}
+
+aos_status_t *oss_get_object_range_to_file(const oss_request_options_t *options, 
+                                           const aos_string_t *bucket, 
+                                           const aos_string_t *object,
+                                           int64_t offset,
+                                           int64_t size,
+                                           aos_table_t *headers, 
+                                           aos_table_t *params,
+                                           oss_range_crc64_t *range_crc,
+                                           aos_string_t *filename, 
+                                           aos_table_t **resp_headers)
+{
+    aos_status_t *s = NULL;
+    aos_http_request_t *req = NULL;
+    aos_http_response_t *resp = NULL;
+    int res = AOSE_OK;
+    aos_string_t tmp_filename;
+
+    headers = aos_table_create_if_null(options, headers, 1);
+    params = aos_table_create_if_null(options, params, 0);
+    oss_set_range_header(options, headers, offset, size);
+
+    oss_get_temporary_file_name(options->pool, filename, &tmp_filename);
+
+    oss_init_object_request(options, bucket, object, HTTP_GET, 
+                            &req, params, headers, NULL, 0, &resp);
+
+    s = aos_status_create(options->pool);
+    res = oss_init_read_response_body_to_file(options->pool, &tmp_filename, resp);
+    if (res != AOSE_OK) {
+        aos_file_error_status_set(s, res);
+        return s;
+    }
+
+    s = oss_process_request(options, req, resp);
+    oss_fill_read_response_header(resp, resp_headers);
+
+    oss_check_range_crc64(options, req, resp, range_crc, s);
+
+    oss_temp_file_rename(s, tmp_filename.data, filename->data, options->pool);
+
+    return s;
+}
+
 aos_status_t *oss_head_object(const oss_request_options_t *options, 
                               const aos_string_t *bucket, 
                               const aos_string_t *object,
@@ -289,7 +386,7 @@ aos_status_t *oss_copy_object(const oss_request_options_t *options,
     aos_http_request_t *req = NULL;
     aos_http_response_t *resp = NULL;
     aos_table_t *query_params = NULL;
-    char buffer[AOS_MAX_QUERY_ARG_LEN*3+1];
+    char *buffer = NULL;
     int res = -1;
 
     s = aos_status_create(options->pool);
@@ -298,6 +395,8 @@ aos_status_t *oss_copy_object(const oss_request_options_t *options,
     query_params = aos_table_create_if_null(options, query_params, 0);
 
     /* init headers */
+    buffer = aos_palloc(options->pool, aos_url_encode_len(source_object->data, 
+        strlen(source_object->data)) + 1);
     res = aos_url_encode(buffer, source_object->data, AOS_MAX_QUERY_ARG_LEN);
     if (res != AOSE_OK) {
         aos_status_set(s, res, AOS_URL_ENCODE_ERROR_CODE, NULL);
@@ -387,7 +486,7 @@ aos_status_t *oss_do_append_object_from_buffer(const oss_request_options_t *opti
     oss_fill_read_response_body(resp, resp_body);
 
     if (is_enable_crc(options) && has_crc_in_response(resp)) {
-        oss_check_crc_consistent(req->crc64, resp->headers, s);
+        oss_check_response_crc(req->crc64, resp, s);
     }
 
     return s;
@@ -476,7 +575,7 @@ aos_status_t *oss_do_append_object_from_file(const oss_request_options_t *option
     oss_fill_read_response_body(resp, resp_body);
 
     if (is_enable_crc(options) && has_crc_in_response(resp)) {
-        oss_check_crc_consistent(req->crc64, resp->headers, s);
+        oss_check_response_crc(req->crc64, resp, s);
     }
 
     return s;
@@ -506,7 +605,7 @@ aos_status_t *oss_put_object_from_buffer_by_url(const oss_request_options_t *opt
     oss_fill_read_response_header(resp, resp_headers);
 
     if (is_enable_crc(options) && has_crc_in_response(resp)) {
-        oss_check_crc_consistent(req->crc64, resp->headers, s);
+        oss_check_response_crc(req->crc64, resp, s);
     }
 
     return s;
@@ -541,7 +640,7 @@ aos_status_t *oss_put_object_from_file_by_url(const oss_request_options_t *optio
     oss_fill_read_response_header(resp, resp_headers);
 
     if (is_enable_crc(options) && has_crc_in_response(resp)) {
-        oss_check_crc_consistent(req->crc64, resp->headers, s);
+        oss_check_response_crc(req->crc64, resp, s);
     }
 
     return s;
@@ -570,7 +669,7 @@ aos_status_t *oss_get_object_to_buffer_by_url(const oss_request_options_t *optio
 
     if (is_enable_crc(options) && has_crc_in_response(resp) &&  
         !has_range_or_process_in_request(req)) {
-            oss_check_crc_consistent(resp->crc64, resp->headers, s);
+            oss_check_response_crc(resp->crc64, resp, s);
     }
 
     return s;
@@ -610,7 +709,7 @@ aos_status_t *oss_get_object_to_file_by_url(const oss_request_options_t *options
 
     if (is_enable_crc(options) && has_crc_in_response(resp) && 
         !has_range_or_process_in_request(req)) {
-            oss_check_crc_consistent(resp->crc64, resp->headers, s);
+            oss_check_response_crc(resp->crc64, resp, s);
     }
 
     oss_temp_file_rename(s, tmp_filename.data, filename->data, options->pool);
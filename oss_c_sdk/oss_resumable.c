@@ -3,6 +3,7 @@
 #include "aos_util.h"
 #include "aos_string.h"
 #include "aos_status.h"
+#include "aos_crc64.h"
 #include "oss_auth.h"
 #include "oss_util.h"
 #include "oss_xml.h"
@@ -82,10 +83,20 @@ int oss_open_checkpoint_file(aos_pool_t *pool,  aos_string_t *checkpoint_path, o
     if (s == APR_SUCCESS) {
         aos_error_log("apr_file_info_get failure, code:%d %s.", s, apr_strerror(s, buf, sizeof(buf)));
         checkpoint->thefile = thefile;
+        aos_str_set(&checkpoint->thefile_path, apr_pstrdup(pool, checkpoint_path->data));
     }
     return s;
 }
 
+void oss_close_checkpoint_file(oss_checkpoint_t *checkpoint)
+{
+    // a failed compaction may leave no handle
+    if (NULL != checkpoint->thefile) {
+        apr_file_close(checkpoint->thefile);
+        checkpoint->thefile = NULL;
+    }
+}
+
 int oss_get_part_num(int64_t file_size, int64_t part_size)
 {
     int64_t num = 0;
@@ -118,18 +129,30 @@ void oss_build_thread_params(oss_upload_thread_params_t *thr_params, int part_nu
     aos_http_controller_t *ctl;
     for (; i < part_num; i++) {
         aos_pool_create(&subpool, parent_pool); 
-        config = oss_config_create(subpool);
-        aos_str_set(&config->endpoint, options->config->endpoint.data);
-        aos_str_set(&config->access_key_id, options->config->access_key_id.data);
-        aos_str_set(&config->access_key_secret, options->config->access_key_secret.data);
-        config->is_cname = options->config->is_cname;
         ctl = aos_http_controller_create(subpool, 0);
+        if (options->client != NULL && options->client->config == options->config) {
+            // the client and its config are shared by the part threads
+            config = options->config;
+            if (options->client->http_options != NULL) {
+                ctl->options = options->client->http_options;
+            }
+        } else {
+            config = oss_config_create(subpool);
+            aos_str_set(&config->endpoint, options->config->endpoint.data);
+            aos_str_set(&config->access_key_id, options->config->access_key_id.data);
+            aos_str_set(&config->access_key_secret, options->config->access_key_secret.data);
+            config->is_cname = options->config->is_cname;
+        }
         thr_params[i].options.config = config;
         thr_params[i].options.ctl = ctl;
         thr_params[i].options.pool = subpool;
+        thr_params[i].options.client = options->client;
         thr_params[i].bucket = bucket;
         thr_params[i].object = object;
         thr_params[i].filepath = filepath;
+        thr_params[i].source_bucket = NULL;
+        thr_params[i].source_object = NULL;
+        thr_params[i].source_etag = NULL;
         thr_params[i].upload_id = upload_id;
         thr_params[i].part = parts + i;
         thr_params[i].result = result + i;
@@ -159,6 +182,130 @@ void oss_set_task_tracker(oss_upload_thread_params_t *thr_params, int part_num,
     }
 }
 
+void oss_set_task_state(oss_upload_thread_params_t *thr_params, int part_num, 
+                        apr_uint32_t *running, oss_part_task_state_t *states)
+{
+    int i = 0;
+    for (; i < part_num; i++) {
+        thr_params[i].running = running;
+        thr_params[i].state = states + i;
+        thr_params[i].state->ctls[0] = thr_params[i].options.ctl;
+    }
+}
+
+void oss_set_copy_source(oss_upload_thread_params_t *thr_params, int part_num, 
+                         aos_string_t *source_bucket, aos_string_t *source_object,
+                         aos_string_t *source_etag)
+{
+    int i = 0;
+    for (; i < part_num; i++) {
+        thr_params[i].source_bucket = source_bucket;
+        thr_params[i].source_object = source_object;
+        thr_params[i].source_etag = source_etag;
+    }
+}
+
+void oss_launch_part_task(apr_thread_pool_t *thrp, oss_upload_thread_params_t *params, apr_byte_t priority)
+{
+    apr_atomic_inc32(&params->state->running);
+    apr_atomic_inc32(params->running);
+    apr_thread_pool_push(thrp, upload_part, params, priority, NULL);
+}
+
+int oss_launch_part_tasks(apr_thread_pool_t *thrp, oss_upload_thread_params_t *thr_params, 
+                          int launched_num, int part_num, int32_t thread_num, apr_uint32_t done_num)
+{
+    // the thread pool only spawns threads in push, a part is pushed once another one is done
+    while (launched_num < part_num && launched_num - (int)done_num < thread_num) {
+        oss_launch_part_task(thrp, thr_params + launched_num, 0);
+        launched_num++;
+    }
+    return launched_num;
+}
+
+void oss_cancel_part_tasks(oss_part_task_state_t *state)
+{
+    int i = 0;
+    for (; i < 2; i++) {
+        if (NULL != state->ctls[i]) {
+            // the read callback aborts the transfer
+            ((aos_http_controller_ex_t *)state->ctls[i])->error_code = AOSE_ABORT_CALLBACK;
+        }
+    }
+}
+
+void oss_record_part_time(int64_t *part_times, int *count, int64_t part_time)
+{
+    int i = *count;
+    for (; i > 0 && part_times[i - 1] > part_time; i--) {
+        part_times[i] = part_times[i - 1];
+    }
+    part_times[i] = part_time;
+    (*count)++;
+}
+
+int oss_launch_speculative_tasks(apr_thread_pool_t *thrp, oss_upload_thread_params_t *thr_params, 
+                                 oss_upload_thread_params_t **spec_params, int part_num, int64_t median,
+                                 aos_pool_t *parent_pool, oss_request_options_t *options)
+{
+    int i = 0;
+    int launched = 0;
+    int64_t threshold;
+    apr_time_t now;
+    oss_part_task_state_t *state;
+    oss_part_task_result_t *result;
+    oss_upload_thread_params_t *spec;
+
+    now = apr_time_now();
+    threshold = aos_max(median * OSS_STRAGGLER_FACTOR, OSS_STRAGGLER_MIN_ELAPSED);
+    for (; i < part_num; i++) {
+        state = thr_params[i].state;
+        if (state->speculated || !apr_atomic_read32(&state->started) || apr_atomic_read32(&state->done) ||
+            now - state->start_time < threshold) {
+            continue;
+        }
+
+        result = (oss_part_task_result_t *)aos_pcalloc(parent_pool, sizeof(oss_part_task_result_t));
+        spec = (oss_upload_thread_params_t *)aos_pcalloc(parent_pool, sizeof(oss_upload_thread_params_t));
+        oss_build_thread_params(spec, 1, parent_pool, options, thr_params[i].bucket, thr_params[i].object,
+            thr_params[i].filepath, thr_params[i].upload_id, thr_params[i].part, result);
+        oss_set_task_tracker(spec, 1, thr_params[i].launched, thr_params[i].failed, thr_params[i].completed, 
+            thr_params[i].failed_parts, thr_params[i].completed_parts);
+        oss_set_copy_source(spec, 1, thr_params[i].source_bucket, thr_params[i].source_object, 
+            thr_params[i].source_etag);
+        spec->running = thr_params[i].running;
+        spec->state = state;
+        state->ctls[1] = spec->options.ctl;
+        state->speculated = AOS_TRUE;
+        spec_params[i] = spec;
+
+        aos_warn_log("part %d is slow, elapsed:%" APR_INT64_T_FMT ", median:%" APR_INT64_T_FMT 
+                     ", launch a speculative task.\n", thr_params[i].part->index + 1, now - state->start_time, median);
+        oss_launch_part_task(thrp, spec, APR_THREAD_TASK_PRIORITY_HIGHEST);
+        launched++;
+    }
+
+    return launched;
+}
+
+void oss_destroy_part_tasks(apr_uint32_t *running, oss_upload_thread_params_t *thr_params, 
+                            oss_upload_thread_params_t **spec_params, int part_num)
+{
+    int i = 0;
+
+    // wait until the losers of speculated parts exit
+    while (apr_atomic_read32(running) > 0) {
+        apr_sleep(1000);
+    }
+
+    oss_destroy_thread_pool(thr_params, part_num);
+    for (i = 0; i < part_num; i++) {
+        if (NULL != spec_params[i]) {
+            aos_pool_destroy(spec_params[i]->options.pool);
+        }
+    }
+}
+
 int oss_verify_checkpoint_md5(aos_pool_t *pool, const oss_checkpoint_t *checkpoint)
 {
     return AOS_TRUE;
@@ -186,12 +333,136 @@ void oss_build_upload_checkpoint(aos_pool_t *pool, oss_checkpoint_t *checkpoint,
     checkpoint->part_num = i;
 }
 
-int oss_dump_checkpoint(aos_pool_t *pool, const oss_checkpoint_t *checkpoint) 
+void oss_build_copy_checkpoint(aos_pool_t *pool, oss_checkpoint_t *checkpoint, const aos_string_t *copy_source,
+                               const aos_string_t *object, int64_t object_size, const char *object_last_modified, 
+                               const char *object_etag, aos_string_t *upload_id, int64_t part_size)
+{
+    int i = 0;
+
+    checkpoint->cp_type = OSS_CP_COPY;
+    aos_str_set(&checkpoint->file_path, aos_pstrdup(pool, copy_source));
+    aos_str_set(&checkpoint->object_name, aos_pstrdup(pool, object));
+    checkpoint->object_size = object_size;
+    aos_str_set(&checkpoint->object_last_modified, apr_pstrdup(pool, object_last_modified));
+    aos_str_set(&checkpoint->object_etag, apr_pstrdup(pool, object_etag));
+    aos_str_set(&checkpoint->upload_id, aos_pstrdup(pool, upload_id));
+
+    checkpoint->part_size = part_size;
+    for (; i * part_size < object_size; i++) {
+        checkpoint->parts[i].index = i;
+        checkpoint->parts[i].offset = i * part_size;
+        checkpoint->parts[i].size = aos_min(part_size, (object_size - i * part_size));
+        checkpoint->parts[i].completed = AOS_FALSE;
+        aos_str_set(&checkpoint->parts[i].etag , "");
+    }
+    checkpoint->part_num = i;
+}
+
+static void oss_cp_put_uint32(char *p, uint32_t v)
+{
+    int i;
+    for (i = 0; i < 4; i++) {
+        p[i] = (char)(v >> (i * 8));
+    }
+}
+
+static void oss_cp_put_uint64(char *p, uint64_t v)
+{
+    int i;
+    for (i = 0; i < 8; i++) {
+        p[i] = (char)(v >> (i * 8));
+    }
+}
+
+static uint32_t oss_cp_get_uint32(const char *p)
+{
+    uint32_t v = 0;
+    int i;
+    for (i = 3; i >= 0; i--) {
+        v = (v << 8) | (unsigned char)p[i];
+    }
+    return v;
+}
+
+static uint64_t oss_cp_get_uint64(const char *p)
+{
+    uint64_t v = 0;
+    int i;
+    for (i = 7; i >= 0; i--) {
+        v = (v << 8) | (unsigned char)p[i];
+    }
+    return v;
+}
+
+/*
+ * the record of a completed part: index, etag length, etag, part crc64 and the crc64 of the record,
+ * returns the record length, 0 if the etag is too long for a record
+ */
+static int oss_build_checkpoint_record(char *buf, const oss_checkpoint_part_t *part)
+{
+    int len;
+    if (part->etag.len > OSS_CP_JOURNAL_MAX_ETAG_LEN) {
+        return 0;
+    }
+    oss_cp_put_uint32(buf, (uint32_t)part->index);
+    oss_cp_put_uint32(buf + 4, (uint32_t)part->etag.len);
+    if (part->etag.len > 0) {
+        memcpy(buf + 8, part->etag.data, part->etag.len);
+    }
+    len = 8 + part->etag.len;
+    oss_cp_put_uint64(buf + len, part->crc64);
+    len += 8;
+    oss_cp_put_uint64(buf + len, aos_crc64(0, buf, len));
+    return len + 8;
+}
+
+static int oss_write_checkpoint_file(oss_checkpoint_t *checkpoint, const char *buf, apr_size_t len, 
+                                     int force_sync)
+{
+    apr_status_t s;
+    char errbuf[256];
+
+    if (NULL == checkpoint->thefile) {
+        return AOSE_FILE_WRITE_ERROR;
+    }
+
+    s = apr_file_write_full(checkpoint->thefile, buf, len, NULL);
+    if (s != APR_SUCCESS) {
+        aos_error_log("apr_file_write fialure, code:%d %s.", s, apr_strerror(s, errbuf, sizeof(errbuf)));
+        return AOSE_FILE_WRITE_ERROR;
+    }
+
+    s = apr_file_flush(checkpoint->thefile);
+    if (s != APR_SUCCESS) {
+        aos_error_log("apr_file_flush fialure, code:%d %s.", s, apr_strerror(s, errbuf, sizeof(errbuf)));
+        return AOSE_FILE_FLUSH_ERROR;
+    }
+
+    if (checkpoint->sync_num > 0 && (force_sync || checkpoint->unsynced_num >= checkpoint->sync_num)) {
+        s = apr_file_sync(checkpoint->thefile);
+        if (s != APR_SUCCESS) {
+            aos_error_log("apr_file_sync fialure, code:%d %s.", s, apr_strerror(s, errbuf, sizeof(errbuf)));
+            return AOSE_FILE_FLUSH_ERROR;
+        }
+        checkpoint->unsynced_num = 0;
+    }
+
+    return AOSE_OK;
+}
+
+int oss_dump_checkpoint(aos_pool_t *pool, oss_checkpoint_t *checkpoint) 
 {
     char *xml_body = NULL;
+    char *body = NULL;
+    char *tmp_path = NULL;
+    apr_file_t *tmp_file = NULL;
+    apr_file_t *thefile = NULL;
     apr_status_t s;
+    int rv;
     char buf[256];
+    apr_size_t xml_len;
     apr_size_t len;
+    int i;
     
     // to xml
     xml_body = oss_build_checkpoint_xml(pool, checkpoint);
@@ -199,28 +470,164 @@ int oss_dump_checkpoint(aos_pool_t *pool, const oss_checkpoint_t *checkpoint)
         return AOSE_OUT_MEMORY;
     }
 
-    // truncate to empty
-    s = apr_file_trunc(checkpoint->thefile, 0);
-    if (s != APR_SUCCESS) {
-        aos_error_log("apr_file_write fialure, code:%d %s.", s, apr_strerror(s, buf, sizeof(buf)));
-        return AOSE_FILE_TRUNC_ERROR;
+    // header, xml and a record for each completed part, so that the part crc64 survives compaction
+    xml_len = strlen(xml_body);
+    len = OSS_CP_JOURNAL_HEADER_LEN + xml_len;
+    for (i = 0; i < checkpoint->part_num; i++) {
+        if (checkpoint->parts[i].completed) {
+            len += OSS_CP_JOURNAL_RECORD_LEN + checkpoint->parts[i].etag.len;
+        }
     }
-   
-    // write to file
-    len = strlen(xml_body);
-    s = apr_file_write(checkpoint->thefile, xml_body, &len);
+    body = (char *)aos_palloc(pool, len);
+    memcpy(body, OSS_CP_JOURNAL_MAGIC, OSS_CP_JOURNAL_MAGIC_LEN);
+    oss_cp_put_uint32(body + OSS_CP_JOURNAL_MAGIC_LEN, (uint32_t)xml_len);
+    oss_cp_put_uint64(body + OSS_CP_JOURNAL_MAGIC_LEN + 4, aos_crc64(0, xml_body, xml_len));
+    memcpy(body + OSS_CP_JOURNAL_HEADER_LEN, xml_body, xml_len);
+    len = OSS_CP_JOURNAL_HEADER_LEN + xml_len;
+    for (i = 0; i < checkpoint->part_num; i++) {
+        if (checkpoint->parts[i].completed) {
+            len += oss_build_checkpoint_record(body + len, &checkpoint->parts[i]);
+        }
+    }
+
+    // write a new file and rename it over the old one, a crash leaves either of them complete
+    tmp_path = apr_psprintf(pool, "%s.tmp", checkpoint->thefile_path.data);
+    s = apr_file_open(&tmp_file, tmp_path, APR_CREATE | APR_WRITE | APR_TRUNCATE, 
+                      APR_UREAD | APR_UWRITE | APR_GREAD, pool);
     if (s != APR_SUCCESS) {
-        aos_error_log("apr_file_write fialure, code:%d %s.", s, apr_strerror(s, buf, sizeof(buf)));
-        return AOSE_FILE_WRITE_ERROR;
+        aos_error_log("apr_file_open failure, code:%d %s.", s, apr_strerror(s, buf, sizeof(buf)));
+        return AOSE_OPEN_FILE_ERROR;
+    }
+    thefile = checkpoint->thefile;
+    checkpoint->thefile = tmp_file;
+    rv = oss_write_checkpoint_file(checkpoint, body, len, AOS_TRUE);
+    checkpoint->thefile = thefile;
+    if (rv == AOSE_OK && checkpoint->sync_num <= 0 && (s = apr_file_sync(tmp_file)) != APR_SUCCESS) {
+        aos_error_log("apr_file_sync fialure, code:%d %s.", s, apr_strerror(s, buf, sizeof(buf)));
+        rv = AOSE_FILE_FLUSH_ERROR;
+    }
+    apr_file_close(tmp_file);
+    if (rv != AOSE_OK) {
+        apr_file_remove(tmp_path, pool);
+        return rv;
     }
 
-    // flush file
-    s = apr_file_flush(checkpoint->thefile);
+    // the old handle is closed first, an open file can not be replaced on windows
+    apr_file_close(thefile);
+    rv = AOSE_OK;
+    s = apr_file_rename(tmp_path, checkpoint->thefile_path.data, pool);
     if (s != APR_SUCCESS) {
-        aos_error_log("apr_file_flush fialure, code:%d %s.", s, apr_strerror(s, buf, sizeof(buf)));
-        return AOSE_FILE_FLUSH_ERROR;
+        aos_error_log("apr_file_rename failure, code:%d %s.", s, apr_strerror(s, buf, sizeof(buf)));
+        apr_file_remove(tmp_path, pool);
+        rv = AOSE_FILE_WRITE_ERROR;
+    }
+    s = apr_file_open(&checkpoint->thefile, checkpoint->thefile_path.data, APR_CREATE | APR_WRITE | APR_APPEND, 
+                      APR_UREAD | APR_UWRITE | APR_GREAD, pool);
+    if (s != APR_SUCCESS) {
+        aos_error_log("apr_file_open failure, code:%d %s.", s, apr_strerror(s, buf, sizeof(buf)));
+        checkpoint->thefile = NULL;
+        return AOSE_OPEN_FILE_ERROR;
+    }
+    if (rv == AOSE_OK) {
+        checkpoint->record_num = 0;
+        checkpoint->unsynced_num = 0;
+    }
+
+    return rv;
+}
+
+int oss_append_checkpoint(aos_pool_t *pool, oss_checkpoint_t *checkpoint, int32_t part_index, 
+                          aos_string_t *etag, uint64_t crc64)
+{
+    char buf[OSS_CP_JOURNAL_RECORD_LEN + OSS_CP_JOURNAL_MAX_ETAG_LEN];
+    int len;
+
+    oss_update_checkpoint(pool, checkpoint, part_index, etag);
+    checkpoint->parts[part_index].crc64 = crc64;
+
+    if (checkpoint->record_num >= OSS_CP_JOURNAL_COMPACT_NUM && 
+        checkpoint->record_num * OSS_CP_JOURNAL_COMPACT_RATIO >= checkpoint->part_num) {
+        return oss_dump_checkpoint(pool, checkpoint);
+    }
+
+    len = oss_build_checkpoint_record(buf, &checkpoint->parts[part_index]);
+    if (0 == len) {
+        return oss_dump_checkpoint(pool, checkpoint);
+    }
+
+    checkpoint->record_num++;
+    checkpoint->unsynced_num++;
+    return oss_write_checkpoint_file(checkpoint, buf, len, AOS_FALSE);
+}
+
+/*
+ * replay the records after the header, a torn or corrupted record ends the journal,
+ * the parts of the records after it are uploaded again
+ */
+static void oss_replay_checkpoint_records(aos_pool_t *pool, const char *buf, apr_size_t len, 
+                                          oss_checkpoint_t *checkpoint)
+{
+    apr_size_t pos = 0;
+    uint32_t index;
+    uint32_t etag_len;
+    apr_size_t record_len;
+    oss_checkpoint_part_t *part;
+
+    while (len - pos >= OSS_CP_JOURNAL_RECORD_LEN) {
+        index = oss_cp_get_uint32(buf + pos);
+        etag_len = oss_cp_get_uint32(buf + pos + 4);
+        if (etag_len > OSS_CP_JOURNAL_MAX_ETAG_LEN || index >= (uint32_t)checkpoint->part_num) {
+            break;
+        }
+        record_len = OSS_CP_JOURNAL_RECORD_LEN + etag_len;
+        if (len - pos < record_len || 
+            aos_crc64(0, (void *)(buf + pos), record_len - 8) != oss_cp_get_uint64(buf + pos + record_len - 8)) {
+            break;
+        }
+
+        part = &checkpoint->parts[index];
+        part->completed = AOS_TRUE;
+        aos_str_set(&part->etag, apr_pstrmemdup(pool, buf + pos + 8, etag_len));
+        part->crc64 = oss_cp_get_uint64(buf + pos + 8 + etag_len);
+        pos += record_len;
+        checkpoint->record_num++;
+    }
+
+    if (pos < len) {
+        aos_warn_log("checkpoint journal is torn, %" APR_SIZE_T_FMT " bytes ignored.", len - pos);
+    }
+}
+
+static int oss_checkpoint_parse_from_journal(aos_pool_t *pool, const char *buf, apr_size_t len, 
+                                             oss_checkpoint_t *checkpoint)
+{
+    apr_size_t xml_len;
+    char *xml_body;
+    int res;
+
+    // a torn header means the checkpoint is lost
+    if (len < OSS_CP_JOURNAL_HEADER_LEN) {
+        return AOSE_XML_PARSE_ERROR;
+    }
+    xml_len = oss_cp_get_uint32(buf + OSS_CP_JOURNAL_MAGIC_LEN);
+    if (len - OSS_CP_JOURNAL_HEADER_LEN < xml_len || 
+        aos_crc64(0, (void *)(buf + OSS_CP_JOURNAL_HEADER_LEN), xml_len) != 
+            oss_cp_get_uint64(buf + OSS_CP_JOURNAL_MAGIC_LEN + 4)) {
+        return AOSE_XML_PARSE_ERROR;
+    }
+
+    xml_body = apr_pstrmemdup(pool, buf + OSS_CP_JOURNAL_HEADER_LEN, xml_len);
+    res = oss_checkpoint_parse_from_body(pool, xml_body, checkpoint);
+    if (res != AOSE_OK) {
+        return res;
+    }
+    if (checkpoint->part_num < 0 || checkpoint->part_num > OSS_MAX_PART_NUM) {
+        return AOSE_XML_PARSE_ERROR;
     }
 
+    checkpoint->record_num = 0;
+    oss_replay_checkpoint_records(pool, buf + OSS_CP_JOURNAL_HEADER_LEN + xml_len, 
+        len - OSS_CP_JOURNAL_HEADER_LEN - xml_len, checkpoint);
     return AOSE_OK;
 }
 
@@ -260,7 +667,11 @@ int oss_load_checkpoint(aos_pool_t *pool, const aos_string_t *filepath, oss_chec
     apr_file_close(thefile);
     xml_body[len] = '\0';
 
-    // parse
+    // parse, the checkpoint of the former versions is a plain xml
+    if (len >= OSS_CP_JOURNAL_MAGIC_LEN && 
+        0 == memcmp(xml_body, OSS_CP_JOURNAL_MAGIC, OSS_CP_JOURNAL_MAGIC_LEN)) {
+        return oss_checkpoint_parse_from_journal(pool, xml_body, len, checkpoint);
+    }
     return oss_checkpoint_parse_from_body(pool, xml_body, checkpoint);
 }
 
@@ -274,6 +685,163 @@ int oss_is_upload_checkpoint_valid(aos_pool_t *pool, oss_checkpoint_t *checkpoin
     return AOS_FALSE;
 }
 
+int oss_is_copy_checkpoint_valid(aos_pool_t *pool, oss_checkpoint_t *checkpoint, const aos_string_t *copy_source,
+                                 const aos_string_t *object, int64_t object_size, const char *object_last_modified, 
+                                 const char *object_etag)
+{
+    if (oss_verify_checkpoint_md5(pool, checkpoint) && 
+        (checkpoint->cp_type == OSS_CP_COPY) && 
+        (strcmp(checkpoint->file_path.data, copy_source->data) == 0) && 
+        (strcmp(checkpoint->object_name.data, object->data) == 0) && 
+        (checkpoint->object_size == object_size) && 
+        (strcmp(checkpoint->object_last_modified.data, object_last_modified) == 0) && 
+        (strcmp(checkpoint->object_etag.data, object_etag) == 0)) {
+        return AOS_TRUE;
+    }
+    return AOS_FALSE;
+}
+
+int oss_get_parts_crc64(const oss_checkpoint_part_t *parts, int part_num, uint64_t *crc64)
+{
+    aos_crc64_zeros_t zeros[2];  // the parts are of the same size but the last one
+    aos_crc64_zeros_t *op;
+    uint64_t crc = 0;
+    int zeros_num = 0;
+    int i;
+
+    for (i = 0; i < part_num; i++) {
+        if (0 == parts[i].crc64 && parts[i].size > 0) {
+            return AOS_FALSE;
+        }
+        if (zeros_num > 0 && zeros[0].len == (uintmax_t)parts[i].size) {
+            op = &zeros[0];
+        } else if (zeros_num > 1 && zeros[1].len == (uintmax_t)parts[i].size) {
+            op = &zeros[1];
+        } else {
+            op = &zeros[zeros_num < 2 ? zeros_num++ : 1];
+            aos_crc64_zeros_init(op, (uintmax_t)parts[i].size);
+        }
+        crc = aos_crc64_combine_zeros(op, crc, parts[i].crc64);
+    }
+
+    *crc64 = crc;
+    return AOS_TRUE;
+}
+
+void oss_check_complete_crc64(const oss_request_options_t *options, const oss_checkpoint_part_t *parts, 
+                              int part_num, const aos_table_t *resp_headers, aos_status_t *s)
+{
+    uint64_t crc64;
+
+    // the crc64 of the object is combined from the parts, the file is not read again
+    if (aos_status_is_ok(s) && NULL != resp_headers && is_enable_crc(options) && 
+        oss_get_parts_crc64(parts, part_num, &crc64)) {
+        oss_check_crc_consistent(crc64, resp_headers, s);
+    }
+}
+
+void * APR_THREAD_FUNC verify_part_crc64(apr_thread_t *thd, void *data)
+{
+    oss_verify_thread_params_t *params = NULL;
+    aos_pool_t *pool = NULL;
+    apr_file_t *thefile;
+    apr_off_t offset;
+    apr_size_t len;
+    apr_status_t s;
+    int64_t left;
+    uint64_t crc64 = 0;
+    char *buf;
+
+    params = (oss_verify_thread_params_t *)data;
+    offset = params->part->offset;
+    left = params->part->size;
+
+    aos_pool_create(&pool, NULL);
+    buf = (char *)aos_palloc(pool, OSS_CP_VERIFY_BUFFER_SIZE);
+    s = apr_file_open(&thefile, params->filepath->data, APR_READ, APR_UREAD | APR_GREAD, pool);
+    if (s == APR_SUCCESS) {
+        s = apr_file_seek(thefile, APR_SET, &offset);
+    }
+    while (s == APR_SUCCESS && left > 0) {
+        len = (apr_size_t)aos_min(left, OSS_CP_VERIFY_BUFFER_SIZE);
+        s = apr_file_read_full(thefile, buf, len, &len);
+        crc64 = aos_crc64(crc64, buf, len);
+        left -= len;
+    }
+    params->matched = (s == APR_SUCCESS && crc64 == params->part->crc64) ? AOS_TRUE : AOS_FALSE;
+    aos_pool_destroy(pool);
+
+    apr_queue_push(params->verified_parts, params);
+    return NULL;
+}
+
+int oss_verify_upload_checkpoint_parts(aos_pool_t *pool, oss_checkpoint_t *checkpoint, 
+                                       const aos_string_t *filepath, apr_finfo_t *finfo, int32_t thread_num)
+{
+    oss_verify_thread_params_t *params;
+    oss_verify_thread_params_t *verified;
+    apr_thread_pool_t *thrp;
+    apr_queue_t *verified_parts;
+    void *task_result;
+    int verify_num = 0;
+    int i = 0;
+    int rv;
+
+    // the file is touched, the parts of the same content are kept
+    if (!oss_verify_checkpoint_md5(pool, checkpoint) || 
+        checkpoint->cp_type != OSS_CP_UPLOAD || 
+        checkpoint->file_size != finfo->size) {
+        return AOSE_INVALID_ARGUMENT;
+    }
+
+    params = (oss_verify_thread_params_t *)aos_pcalloc(pool, 
+        sizeof(oss_verify_thread_params_t) * (checkpoint->part_num + 1));
+    for (i = 0; i < checkpoint->part_num; i++) {
+        if (!checkpoint->parts[i].completed) {
+            continue;
+        }
+        if (0 == checkpoint->parts[i].crc64) {
+            // no crc64 to compare, upload it again
+            checkpoint->parts[i].completed = AOS_FALSE;
+            aos_str_set(&checkpoint->parts[i].etag, "");
+            continue;
+        }
+        params[verify_num].filepath = (aos_string_t *)filepath;
+        params[verify_num].part = &checkpoint->parts[i];
+        verify_num++;
+    }
+
+    if (verify_num > 0) {
+        rv = apr_thread_pool_create(&thrp, 0, thread_num > 0 ? thread_num : 1, pool);
+        if (APR_SUCCESS != rv) {
+            return rv;
+        }
+        rv = apr_queue_create(&verified_parts, verify_num, pool);
+        if (APR_SUCCESS != rv) {
+            apr_thread_pool_destroy(thrp);
+            return rv;
+        }
+
+        for (i = 0; i < verify_num; i++) {
+            params[i].verified_parts = verified_parts;
+            apr_thread_pool_push(thrp, verify_part_crc64, params + i, 0, NULL);
+        }
+        for (i = 0; i < verify_num; i++) {
+            apr_queue_pop(verified_parts, &task_result);
+            verified = (oss_verify_thread_params_t *)task_result;
+            if (!verified->matched) {
+                verified->part->completed = AOS_FALSE;
+                aos_str_set(&verified->part->etag, "");
+                verified->part->crc64 = 0;
+            }
+        }
+        apr_thread_pool_destroy(thrp);
+    }
+
+    checkpoint->file_last_modified = finfo->mtime;
+    return AOSE_OK;
+}
+
 void oss_update_checkpoint(aos_pool_t *pool, oss_checkpoint_t *checkpoint, int32_t part_index, aos_string_t *etag) 
 {
     char *p = NULL;
@@ -302,64 +870,277 @@ void * APR_THREAD_FUNC upload_part(apr_thread_t *thd, void *data)
 {
     aos_status_t *s = NULL;
     oss_upload_thread_params_t *params = NULL;
+    oss_part_task_state_t *state = NULL;
     oss_upload_file_t *upload_file = NULL;
+    oss_upload_part_copy_params_t *copy_params = NULL;
+    aos_table_t *copy_headers = NULL;
     aos_table_t *resp_headers = NULL;
+    aos_list_t resp_body;
+    aos_string_t etag;
+    const char *crc64;
     int part_num;
-    char *etag;
+    int retry;
     
     params = (oss_upload_thread_params_t *)data;
-    if (apr_atomic_read32(params->failed) > 0) {
-        apr_atomic_inc32(params->launched);
+    state = params->state;
+    if (apr_atomic_read32(params->failed) > 0 || apr_atomic_read32(&state->done)) {
+        if (apr_atomic_cas32(&state->done, AOS_TRUE, AOS_FALSE) == AOS_FALSE) {
+            apr_atomic_inc32(params->launched);
+        }
+        apr_atomic_dec32(&state->running);
+        apr_atomic_dec32(params->running);
         return NULL;
     }
 
+    if (!apr_atomic_read32(&state->started)) {
+        state->start_time = apr_time_now();
+        apr_atomic_set32(&state->started, AOS_TRUE);
+    }
+
     part_num = params->part->index + 1;
-    upload_file = oss_create_upload_file(params->options.pool);
-    aos_str_set(&upload_file->filename, params->filepath->data);
-    upload_file->file_pos = params->part->offset;
-    upload_file->file_last = params->part->offset + params->part->size;
+    if (NULL != params->source_object) {
+        copy_params = oss_create_upload_part_copy_params(params->options.pool);
+        copy_params->source_bucket = *params->source_bucket;
+        copy_params->source_object = *params->source_object;
+        copy_params->dest_bucket = *params->bucket;
+        copy_params->dest_object = *params->object;
+        copy_params->upload_id = *params->upload_id;
+        copy_params->part_num = part_num;
+        copy_params->range_start = params->part->offset;
+        copy_params->range_end = params->part->offset + params->part->size - 1;
+    } else {
+        upload_file = oss_create_upload_file(params->options.pool);
+        aos_str_set(&upload_file->filename, params->filepath->data);
+        upload_file->file_pos = params->part->offset;
+        upload_file->file_last = params->part->offset + params->part->size;
+    }
+
+    for (retry = 0; ; retry++) {
+        if (NULL != copy_params) {
+            // a part of another version of the source fails with 412
+            copy_headers = NULL;
+            if (NULL != params->source_etag && !aos_is_null_string(params->source_etag)) {
+                copy_headers = aos_table_make(params->options.pool, 3);
+                apr_table_set(copy_headers, OSS_COPY_SOURCE_IF_MATCH, params->source_etag->data);
+            }
+            aos_list_init(&resp_body);
+            s = oss_do_upload_part_copy(&params->options, copy_params, copy_headers, &resp_headers, &resp_body);
+        } else {
+            s = oss_upload_part_from_file(&params->options, params->bucket, params->object, params->upload_id,
+                part_num, upload_file, &resp_headers);
+        }
+        if (aos_status_is_ok(s) || retry >= OSS_PART_RETRY_NUM || !aos_should_retry(s)) {
+            break;
+        }
+
+        aos_warn_log("upload part %d failure, code:%d, retry:%d.\n", part_num, s->code, retry + 1);
+        apr_sleep(OSS_PART_RETRY_BACKOFF << retry);
+
+        // the other task of the part may have won or the upload is failed, the controller is canceled
+        ((aos_http_controller_ex_t *)params->options.ctl)->error_code = AOSE_OK;
+        if (apr_atomic_read32(params->failed) > 0 || apr_atomic_read32(&state->done)) {
+            break;
+        }
+    }
+    params->result->start_time = params->options.ctl->start_time;
+    params->result->finish_time = params->options.ctl->finish_time;
 
-    s = oss_upload_part_from_file(&params->options, params->bucket, params->object, params->upload_id,
-        part_num, upload_file, &resp_headers);
     if (!aos_status_is_ok(s)) {
-        apr_atomic_inc32(params->failed);
+        // the last task of the part reports the failure
         params->result->s = s;
-        apr_queue_push(params->failed_parts, params->result);
+        if (apr_atomic_dec32(&state->running) == 0 && 
+            apr_atomic_cas32(&state->done, AOS_TRUE, AOS_FALSE) == AOS_FALSE) {
+            apr_atomic_inc32(params->failed);
+            apr_queue_push(params->failed_parts, params->result);
+        }
+        apr_atomic_dec32(params->running);
         return s;
     }
 
-    etag = apr_pstrdup(params->options.pool, (char*)apr_table_get(resp_headers, "ETag"));
-    aos_str_set(&params->result->etag, etag);
-    apr_atomic_inc32(params->completed);
-    apr_queue_push(params->completed_parts, params->result);
+    // the first finished task of the part wins the etag, upload part copy returns it in the body
+    aos_str_null(&etag);
+    if (NULL != copy_params) {
+        oss_copy_part_result_parse_from_body(params->options.pool, &resp_body, &etag);
+    }
+    if (aos_is_null_string(&etag)) {
+        aos_str_set(&etag, apr_pstrdup(params->options.pool, (char*)apr_table_get(resp_headers, "ETag")));
+    }
+    params->result->etag = etag;
+    crc64 = NULL == resp_headers ? NULL : apr_table_get(resp_headers, OSS_HASH_CRC64_ECMA);
+    params->result->crc64 = NULL == crc64 ? 0 : aos_atoui64(crc64);
+    params->result->s = s;
+    if (apr_atomic_cas32(&state->done, AOS_TRUE, AOS_FALSE) == AOS_FALSE) {
+        oss_cancel_part_tasks(state);
+        apr_atomic_inc32(params->completed);
+        apr_queue_push(params->completed_parts, params->result);
+    }
+    apr_atomic_dec32(&state->running);
+    apr_atomic_dec32(params->running);
     return NULL;
 }
 
-aos_status_t *oss_resumable_upload_file_without_cp(oss_request_options_t *options,
-                                                   aos_string_t *bucket, 
-                                                   aos_string_t *object, 
-                                                   aos_string_t *filepath,                           
-                                                   aos_table_t *headers,
-                                                   aos_table_t *params,
-                                                   int32_t thread_num,
-                                                   int64_t part_size,
-                                                   apr_finfo_t *finfo,
-                                                   oss_progress_callback progress_callback,
-                                                   aos_table_t **resp_headers,
-                                                   aos_list_t *resp_body) 
+int64_t oss_auto_tune_part_size(int64_t file_size, int64_t part_size, int32_t max_thread_num,
+                                const oss_resumable_tuned_params_t *tuned)
+{
+    if (part_size <= 0) {
+        part_size = AOS_DEFAULT_PART_SIZE;
+    }
+
+    // a part should last some round trips, so that the request overhead is small
+    if (tuned->bandwidth > 0 && tuned->rtt > 0 && tuned->thread_num > 0) {
+        part_size = tuned->bandwidth / tuned->thread_num * tuned->rtt / APR_USEC_PER_SEC * OSS_AUTO_TUNE_RTT_FACTOR;
+    } else if (tuned->part_size > 0) {
+        part_size = tuned->part_size;
+    }
+
+    // leave enough parts to keep all threads busy
+    if (max_thread_num > 0) {
+        part_size = aos_min(part_size, file_size / (max_thread_num * 2));
+    }
+
+    part_size = aos_max(part_size, OSS_AUTO_TUNE_MIN_PART_SIZE);
+    part_size = aos_min(part_size, AOS_MAX_PART_SIZE);
+    oss_get_part_size(file_size, &part_size);
+
+    return part_size;
+}
+
+void oss_init_auto_tuner(oss_auto_tuner_t *tuner, oss_resumable_clt_params_t *clt_params)
+{
+    memset(tuner, 0, sizeof(oss_auto_tuner_t));
+    tuner->max_thread_num = clt_params->thread_num > 0 ? 
+        oss_get_thread_num(clt_params) : OSS_AUTO_TUNE_MAX_THREAD_NUM;
+    tuner->thread_num = clt_params->tuned.thread_num > 0 ? 
+        clt_params->tuned.thread_num : OSS_AUTO_TUNE_INIT_THREAD_NUM;
+    tuner->thread_num = aos_min(tuner->thread_num, tuner->max_thread_num);
+    tuner->best_thread_num = tuner->thread_num;
+    tuner->growing = tuner->thread_num < tuner->max_thread_num;
+    tuner->rtt = clt_params->tuned.rtt;
+    tuner->window_start = apr_time_now();
+}
+
+void oss_auto_tuner_set_rtt(oss_auto_tuner_t *tuner, const aos_http_controller_t *ctl)
+{
+    if (ctl->start_time > 0 && ctl->finish_time > ctl->start_time) {
+        tuner->rtt = ctl->finish_time - ctl->start_time;
+    }
+}
+
+int32_t oss_auto_tuner_on_part_completed(oss_auto_tuner_t *tuner, const oss_part_task_result_t *result)
+{
+    int64_t elapsed;
+    int64_t throughput;
+    apr_time_t now;
+
+    tuner->window_bytes += result->part->size;
+    tuner->window_parts++;
+    if (tuner->window_parts < tuner->thread_num) {
+        return tuner->thread_num;
+    }
+
+    // aggregate throughput of the window, every thread has completed about one part
+    now = aos_max(result->finish_time, tuner->window_start);
+    elapsed = aos_max(now - tuner->window_start, 1);
+    throughput = tuner->window_bytes * APR_USEC_PER_SEC / elapsed;
+
+    if (!tuner->growing) {
+        tuner->best_throughput = aos_max(tuner->best_throughput, throughput);
+    } else if (throughput * 100 > tuner->best_throughput * (100 + OSS_AUTO_TUNE_MIN_GAIN)) {
+        // additive increase
+        tuner->best_throughput = throughput;
+        tuner->best_thread_num = tuner->thread_num;
+        if (tuner->thread_num < tuner->max_thread_num) {
+            tuner->thread_num++;
+        } else {
+            tuner->growing = AOS_FALSE;
+        }
+    } else {
+        // stop growing, fall back to the best one
+        tuner->growing = AOS_FALSE;
+        tuner->thread_num = tuner->best_thread_num;
+    }
+    aos_debug_log("auto tune, throughput:%" APR_INT64_T_FMT ", thread num:%d\n", 
+                  throughput, tuner->thread_num);
+
+    tuner->window_start = now;
+    tuner->window_bytes = 0;
+    tuner->window_parts = 0;
+
+    return tuner->thread_num;
+}
+
+int32_t oss_auto_tuner_on_part_failed(oss_auto_tuner_t *tuner)
+{
+    // multiplicative decrease
+    tuner->thread_num = aos_max(tuner->thread_num / 2, 1);
+    tuner->best_thread_num = aos_min(tuner->best_thread_num, tuner->thread_num);
+    tuner->growing = AOS_FALSE;
+    tuner->window_start = apr_time_now();
+    tuner->window_bytes = 0;
+    tuner->window_parts = 0;
+    return tuner->thread_num;
+}
+
+void oss_auto_tuner_export(const oss_auto_tuner_t *tuner, int64_t part_size, oss_resumable_tuned_params_t *tuned)
+{
+    tuned->part_size = part_size;
+    tuned->thread_num = tuner->best_thread_num;
+    if (tuner->best_throughput > 0) {
+        tuned->bandwidth = tuner->best_throughput;
+    }
+    if (tuner->rtt > 0) {
+        tuned->rtt = tuner->rtt;
+    }
+}
+
+aos_status_t *oss_upload_parts(oss_request_options_t *options,
+                               const aos_string_t *bucket, 
+                               const aos_string_t *object, 
+                               const aos_string_t *filepath,
+                               const aos_string_t *upload_id,
+                               int32_t thread_num,
+                               int part_num,
+                               oss_checkpoint_part_t *parts)
+{
+    return oss_do_upload_parts(options, bucket, object, filepath, NULL, NULL, NULL, 
+        upload_id, thread_num, part_num, parts, NULL, NULL, NULL, 0);
+}
+
+static void oss_complete_part_task(aos_pool_t *pool, oss_part_task_result_t *task_res,
+                                   oss_progress_callback progress_callback, 
+                                   int64_t *consume_bytes, int64_t total_size)
+{
+    task_res->part->completed = AOS_TRUE;
+    aos_str_set(&task_res->part->etag, apr_pstrdup(pool, task_res->etag.data));
+    task_res->part->crc64 = task_res->crc64;
+    if (NULL != progress_callback) {
+        *consume_bytes += task_res->part->size;
+        progress_callback(*consume_bytes, total_size);
+    }
+}
+
+aos_status_t *oss_do_upload_parts(oss_request_options_t *options,
+                                  const aos_string_t *bucket, 
+                                  const aos_string_t *object, 
+                                  const aos_string_t *filepath,
+                                  const aos_string_t *source_bucket,
+                                  const aos_string_t *source_object,
+                                  const aos_string_t *source_etag,
+                                  const aos_string_t *upload_id,
+                                  int32_t thread_num,
+                                  int part_num,
+                                  oss_checkpoint_part_t *parts,
+                                  oss_checkpoint_t *checkpoint,
+                                  oss_auto_tuner_t *tuner,
+                                  oss_progress_callback progress_callback,
+                                  int64_t total_size)
 {
-    aos_pool_t *subpool = NULL;
     aos_pool_t *parent_pool = NULL;
     aos_status_t *s = NULL;
     aos_status_t *ret = NULL;
-    aos_list_t completed_part_list;
-    oss_complete_part_content_t *complete_content = NULL;
-    aos_string_t upload_id;
-    oss_checkpoint_part_t *parts;
     oss_part_task_result_t *results;
-    oss_part_task_result_t *task_res;
+    oss_part_task_result_t *task_res = NULL;
     oss_upload_thread_params_t *thr_params;
-    aos_table_t *cb_headers = NULL;
     apr_thread_pool_t *thrp;
     apr_uint32_t launched = 0;
     apr_uint32_t failed = 0;
@@ -367,96 +1148,196 @@ aos_status_t *oss_resumable_upload_file_without_cp(oss_request_options_t *option
     apr_uint32_t total_num = 0;
     apr_queue_t *failed_parts;
     apr_queue_t *completed_parts;
+    apr_uint32_t running = 0;
+    oss_part_task_state_t *states;
+    oss_upload_thread_params_t **spec_params;
+    int64_t *part_times;
+    int part_time_num = 0;
+    apr_time_t last_check = 0;
     int64_t consume_bytes = 0;
+    int left_rv = AOSE_OK;
     void *task_result;
-    char *part_num_str;
-    char *etag;
-    int part_num = 0;
+    int launched_num = 0;
     int i = 0;
     int rv;
 
     // prepare
     parent_pool = options->pool;
     ret = aos_status_create(parent_pool);
-    part_num = oss_get_part_num(finfo->size, part_size);
-    parts = (oss_checkpoint_part_t *)aos_palloc(parent_pool, sizeof(oss_checkpoint_part_t) * part_num);
-    oss_build_parts(finfo->size, part_size, parts);
-    results = (oss_part_task_result_t *)aos_palloc(parent_pool, sizeof(oss_part_task_result_t) * part_num);
+    results = (oss_part_task_result_t *)aos_pcalloc(parent_pool, sizeof(oss_part_task_result_t) * part_num);
     thr_params = (oss_upload_thread_params_t *)aos_palloc(parent_pool, sizeof(oss_upload_thread_params_t) * part_num);
-    oss_build_thread_params(thr_params, part_num, parent_pool, options, bucket, object, filepath, &upload_id, parts, results);
-    
-    // init upload
-    aos_pool_create(&subpool, parent_pool);
-    options->pool = subpool;
-    s = oss_init_multipart_upload(options, bucket, object, &upload_id, headers, resp_headers);
-    if (!aos_status_is_ok(s)) {
-        s = aos_status_dup(parent_pool, s);
-        aos_pool_destroy(subpool);
-        options->pool = parent_pool;
-        return s;
+    oss_build_thread_params(thr_params, part_num, parent_pool, options, (aos_string_t *)bucket, 
+        (aos_string_t *)object, (aos_string_t *)filepath, (aos_string_t *)upload_id, parts, results);
+    if (NULL != source_object) {
+        oss_set_copy_source(thr_params, part_num, (aos_string_t *)source_bucket, (aos_string_t *)source_object, 
+            (aos_string_t *)source_etag);
     }
-    aos_str_set(&upload_id, apr_pstrdup(parent_pool, upload_id.data));
-    options->pool = parent_pool;
-    aos_pool_destroy(subpool);
+    states = (oss_part_task_state_t *)aos_pcalloc(parent_pool, sizeof(oss_part_task_state_t) * part_num);
+    spec_params = (oss_upload_thread_params_t **)aos_pcalloc(parent_pool, sizeof(oss_upload_thread_params_t *) * part_num);
+    part_times = (int64_t *)aos_palloc(parent_pool, sizeof(int64_t) * part_num);
 
-    // upload parts    
+    if (NULL != tuner) {
+        thread_num = tuner->thread_num;
+    }
     rv = apr_thread_pool_create(&thrp, 0, thread_num, parent_pool);
     if (APR_SUCCESS != rv) {
         aos_status_set(ret, rv, AOS_CREATE_THREAD_POOL_ERROR_CODE, NULL); 
+        oss_destroy_thread_pool(thr_params, part_num);
         return ret;
     }
 
     rv = apr_queue_create(&failed_parts, part_num, parent_pool);
     if (APR_SUCCESS != rv) {
         aos_status_set(ret, rv, AOS_CREATE_QUEUE_ERROR_CODE, NULL); 
+        oss_destroy_thread_pool(thr_params, part_num);
         return ret;
     }
 
     rv = apr_queue_create(&completed_parts, part_num, parent_pool);
     if (APR_SUCCESS != rv) {
         aos_status_set(ret, rv, AOS_CREATE_QUEUE_ERROR_CODE, NULL); 
+        oss_destroy_thread_pool(thr_params, part_num);
         return ret;
     }
 
     // launch
     oss_set_task_tracker(thr_params, part_num, &launched, &failed, &completed, failed_parts, completed_parts);
-    for (i = 0; i < part_num; i++) {
-        apr_thread_pool_push(thrp, upload_part, thr_params + i, 0, NULL);
+    oss_set_task_state(thr_params, part_num, &running, states);
+    if (NULL != tuner) {
+        tuner->window_start = apr_time_now();
     }
+    launched_num = oss_launch_part_tasks(thrp, thr_params, 0, part_num, thread_num, 0);
 
-    // wait until all tasks exit
-    total_num = apr_atomic_read32(&launched) + apr_atomic_read32(&failed) + apr_atomic_read32(&completed);
-    for ( ; total_num < (apr_uint32_t)part_num; ) {
+    // wait until all launched parts are done, keep thread_num parts in flight
+    for ( ; total_num < (apr_uint32_t)launched_num; ) {
         rv = apr_queue_trypop(completed_parts, &task_result);
-        if (rv == APR_EINTR || rv == APR_EAGAIN) {
-            apr_sleep(1000);
-        } else if(rv == APR_EOF) {
-            break;
-        } else if(rv == APR_SUCCESS) {
+        if (rv == APR_SUCCESS) {
             task_res = (oss_part_task_result_t*)task_result;
-            if (NULL != progress_callback) {
-                consume_bytes += task_res->part->size;
-                progress_callback(consume_bytes, finfo->size);
+            oss_complete_part_task(parent_pool, task_res, progress_callback, &consume_bytes, total_size);
+            oss_record_part_time(part_times, &part_time_num, task_res->finish_time - task_res->start_time);
+            if (NULL != tuner && oss_auto_tuner_on_part_completed(tuner, task_res) != thread_num) {
+                thread_num = tuner->thread_num;
+                apr_thread_pool_thread_max_set(thrp, thread_num);
+            }
+            if (NULL != checkpoint) {
+                rv = oss_append_checkpoint(parent_pool, checkpoint, task_res->part->index, 
+                    &task_res->etag, task_res->crc64);
+                if (rv != AOSE_OK) {
+                    aos_status_set(ret, rv, AOS_WRITE_FILE_ERROR_CODE, NULL);
+                    apr_atomic_inc32(&failed);
+                    task_res->s = ret;
+                    apr_queue_push(failed_parts, task_res);
+                }
             }
+        } else if (rv == APR_EOF) {
+            break;
+        } else {
+            apr_sleep(1000);
+        }
+        if (part_time_num >= OSS_STRAGGLER_MIN_SAMPLES && apr_time_now() - last_check > OSS_STRAGGLER_CHECK_INTERVAL) {
+            oss_launch_speculative_tasks(thrp, thr_params, spec_params, part_num, 
+                part_times[part_time_num / 2], parent_pool, options);
+            last_check = apr_time_now();
         }
         total_num = apr_atomic_read32(&launched) + apr_atomic_read32(&failed) + apr_atomic_read32(&completed);
+        if (apr_atomic_read32(&failed) == 0) {
+            launched_num = oss_launch_part_tasks(thrp, thr_params, launched_num, part_num, thread_num, total_num);
+        }
+        if (NULL != tuner) {
+            tuner->peak_thread_num = aos_max(tuner->peak_thread_num, (int32_t)apr_thread_pool_threads_count(thrp));
+        }
     }
 
     // deal with left successful parts
-    while(APR_SUCCESS == apr_queue_trypop(completed_parts, &task_result)) {
+    while (APR_SUCCESS == apr_queue_trypop(completed_parts, &task_result)) {
         task_res = (oss_part_task_result_t*)task_result;
-        if (NULL != progress_callback) {
-            consume_bytes += task_res->part->size;
-            progress_callback(consume_bytes, finfo->size);
+        oss_complete_part_task(parent_pool, task_res, progress_callback, &consume_bytes, total_size);
+        if (NULL != checkpoint && AOSE_OK == left_rv) {
+            left_rv = oss_append_checkpoint(parent_pool, checkpoint, task_res->part->index, 
+                &task_res->etag, task_res->crc64);
         }
     }
+    if (left_rv != AOSE_OK && apr_atomic_read32(&failed) == 0) {
+        aos_status_set(ret, left_rv, AOS_WRITE_FILE_ERROR_CODE, NULL);
+        oss_destroy_part_tasks(&running, thr_params, spec_params, part_num);
+        return ret;
+    }
 
     // failed
     if (apr_atomic_read32(&failed) > 0) {
+        if (NULL != tuner) {
+            oss_auto_tuner_on_part_failed(tuner);
+        }
         apr_queue_pop(failed_parts, &task_result);
         task_res = (oss_part_task_result_t*)task_result;
         s = aos_status_dup(parent_pool, task_res->s);
-        oss_destroy_thread_pool(thr_params, part_num);
+        for (i = 0; i < part_num; i++) {
+            oss_cancel_part_tasks(states + i);
+        }
+        oss_destroy_part_tasks(&running, thr_params, spec_params, part_num);
+        return s;
+    }
+
+    oss_destroy_part_tasks(&running, thr_params, spec_params, part_num);
+    ret->code = 200;
+    return ret;
+}
+
+aos_status_t *oss_resumable_upload_file_without_cp(oss_request_options_t *options,
+                                                   aos_string_t *bucket, 
+                                                   aos_string_t *object, 
+                                                   aos_string_t *filepath,                           
+                                                   aos_table_t *headers,
+                                                   aos_table_t *params,
+                                                   int32_t thread_num,
+                                                   int64_t part_size,
+                                                   oss_auto_tuner_t *tuner,
+                                                   apr_finfo_t *finfo,
+                                                   oss_progress_callback progress_callback,
+                                                   aos_table_t **resp_headers,
+                                                   aos_list_t *resp_body) 
+{
+    aos_pool_t *subpool = NULL;
+    aos_pool_t *parent_pool = NULL;
+    aos_status_t *s = NULL;
+    aos_list_t completed_part_list;
+    oss_complete_part_content_t *complete_content = NULL;
+    aos_string_t upload_id;
+    oss_checkpoint_part_t *parts;
+    aos_table_t *cb_headers = NULL;
+    aos_table_t *complete_headers = NULL;
+    char *part_num_str;
+    char *etag;
+    int part_num = 0;
+    int i = 0;
+
+    // prepare
+    parent_pool = options->pool;
+    part_num = oss_get_part_num(finfo->size, part_size);
+    parts = (oss_checkpoint_part_t *)aos_palloc(parent_pool, sizeof(oss_checkpoint_part_t) * part_num);
+    oss_build_parts(finfo->size, part_size, parts);
+    
+    // init upload
+    aos_pool_create(&subpool, parent_pool);
+    options->pool = subpool;
+    s = oss_init_multipart_upload(options, bucket, object, &upload_id, headers, resp_headers);
+    if (!aos_status_is_ok(s)) {
+        s = aos_status_dup(parent_pool, s);
+        aos_pool_destroy(subpool);
+        options->pool = parent_pool;
+        return s;
+    }
+    aos_str_set(&upload_id, apr_pstrdup(parent_pool, upload_id.data));
+    options->pool = parent_pool;
+    aos_pool_destroy(subpool);
+    if (NULL != tuner) {
+        oss_auto_tuner_set_rtt(tuner, options->ctl);
+    }
+
+    // upload parts    
+    s = oss_do_upload_parts(options, bucket, object, filepath, NULL, NULL, NULL, &upload_id, 
+        thread_num, part_num, parts, NULL, tuner, progress_callback, finfo->size);
+    if (!aos_status_is_ok(s)) {
         return s;
     }
 
@@ -465,13 +1346,12 @@ aos_status_t *oss_resumable_upload_file_without_cp(oss_request_options_t *option
     aos_list_init(&completed_part_list);
     for (i = 0; i < part_num; i++) {
         complete_content = oss_create_complete_part_content(subpool);
-        part_num_str = apr_psprintf(subpool, "%d", thr_params[i].part->index + 1);
+        part_num_str = apr_psprintf(subpool, "%d", parts[i].index + 1);
         aos_str_set(&complete_content->part_number, part_num_str);
-        etag = apr_pstrdup(subpool, thr_params[i].result->etag.data);
+        etag = apr_pstrdup(subpool, parts[i].etag.data);
         aos_str_set(&complete_content->etag, etag);
         aos_list_add_tail(&complete_content->node, &completed_part_list);
     }
-    oss_destroy_thread_pool(thr_params, part_num);
 
     // complete upload
     options->pool = subpool;
@@ -483,7 +1363,11 @@ aos_status_t *oss_resumable_upload_file_without_cp(oss_request_options_t *option
         }
     }
     s = oss_do_complete_multipart_upload(options, bucket, object, &upload_id, 
-        &completed_part_list, cb_headers, NULL, resp_headers, resp_body);
+        &completed_part_list, cb_headers, NULL, &complete_headers, resp_body);
+    oss_check_complete_crc64(options, parts, part_num, complete_headers, s);
+    if (NULL != resp_headers) {
+        *resp_headers = complete_headers;
+    }
     s = aos_status_dup(parent_pool, s);
     aos_pool_destroy(subpool);
     options->pool = parent_pool;
@@ -499,7 +1383,9 @@ aos_status_t *oss_resumable_upload_file_with_cp(oss_request_options_t *options,
                                                 aos_table_t *params,
                                                 int32_t thread_num,
                                                 int64_t part_size,
+                                                oss_auto_tuner_t *tuner,
                                                 aos_string_t *checkpoint_path,
+                                                int32_t checkpoint_sync_num,
                                                 apr_finfo_t *finfo,
                                                 oss_progress_callback progress_callback,
                                                 aos_table_t **resp_headers,
@@ -513,22 +1399,10 @@ aos_status_t *oss_resumable_upload_file_with_cp(oss_request_options_t *options,
     oss_complete_part_content_t *complete_content = NULL;
     aos_string_t upload_id;
     oss_checkpoint_part_t *parts;
-    oss_part_task_result_t *results;
-    oss_part_task_result_t *task_res;
-    oss_upload_thread_params_t *thr_params;
     aos_table_t *cb_headers = NULL;
-    apr_thread_pool_t *thrp;
-    apr_uint32_t launched = 0;
-    apr_uint32_t failed = 0;
-    apr_uint32_t completed = 0;
-    apr_uint32_t total_num = 0;
-    apr_queue_t *failed_parts;
-    apr_queue_t *completed_parts;
+    aos_table_t *complete_headers = NULL;
     oss_checkpoint_t *checkpoint = NULL;
     int need_init_upload = AOS_TRUE;
-    int has_left_result = AOS_FALSE;
-    int64_t consume_bytes = 0;
-    void *task_result;
     char *part_num_str;
     int part_num = 0;
     int i = 0;
@@ -540,7 +1414,8 @@ aos_status_t *oss_resumable_upload_file_with_cp(oss_request_options_t *options,
     checkpoint = oss_create_checkpoint_content(parent_pool);
     if(oss_does_file_exist(checkpoint_path, parent_pool)) {
         if (AOSE_OK == oss_load_checkpoint(parent_pool, checkpoint_path, checkpoint) && 
-            oss_is_upload_checkpoint_valid(parent_pool, checkpoint, finfo)) {
+            (oss_is_upload_checkpoint_valid(parent_pool, checkpoint, finfo) || 
+             AOSE_OK == oss_verify_upload_checkpoint_parts(parent_pool, checkpoint, filepath, finfo, thread_num))) {
                 aos_str_set(&upload_id, checkpoint->upload_id.data);
                 need_init_upload = AOS_FALSE;
         } else {
@@ -562,6 +1437,9 @@ aos_status_t *oss_resumable_upload_file_with_cp(oss_request_options_t *options,
         aos_str_set(&upload_id, apr_pstrdup(parent_pool, upload_id.data));
         options->pool = parent_pool;
         aos_pool_destroy(subpool);
+        if (NULL != tuner) {
+            oss_auto_tuner_set_rtt(tuner, options->ctl);
+        }
 
         // build checkpoint
         oss_build_upload_checkpoint(parent_pool, checkpoint, filepath, finfo, &upload_id, part_size);
@@ -573,91 +1451,22 @@ aos_status_t *oss_resumable_upload_file_with_cp(oss_request_options_t *options,
         return ret;
     }
 
-    // prepare
-    ret = aos_status_create(parent_pool);
-    parts = (oss_checkpoint_part_t *)aos_palloc(parent_pool, sizeof(oss_checkpoint_part_t) * (checkpoint->part_num));
-    oss_get_checkpoint_undo_parts(checkpoint, &part_num, parts);
-    results = (oss_part_task_result_t *)aos_palloc(parent_pool, sizeof(oss_part_task_result_t) * part_num);
-    thr_params = (oss_upload_thread_params_t *)aos_palloc(parent_pool, sizeof(oss_upload_thread_params_t) * part_num);
-    oss_build_thread_params(thr_params, part_num, parent_pool, options, bucket, object, filepath, &upload_id, parts, results);
-
-    // upload parts    
-    rv = apr_thread_pool_create(&thrp, 0, thread_num, parent_pool);
-    if (APR_SUCCESS != rv) {
-        aos_status_set(ret, rv, AOS_CREATE_THREAD_POOL_ERROR_CODE, NULL); 
+    // compact the loaded journal, the completed parts are appended from now on
+    checkpoint->sync_num = checkpoint_sync_num;
+    rv = oss_dump_checkpoint(parent_pool, checkpoint);
+    if (rv != AOSE_OK) {
+        oss_close_checkpoint_file(checkpoint);
+        aos_status_set(ret, rv, AOS_WRITE_FILE_ERROR_CODE, NULL);
         return ret;
     }
 
-    rv = apr_queue_create(&failed_parts, part_num, parent_pool);
-    if (APR_SUCCESS != rv) {
-        aos_status_set(ret, rv, AOS_CREATE_QUEUE_ERROR_CODE, NULL); 
-        return ret;
-    }
-
-    rv = apr_queue_create(&completed_parts, part_num, parent_pool);
-    if (APR_SUCCESS != rv) {
-        aos_status_set(ret, rv, AOS_CREATE_QUEUE_ERROR_CODE, NULL); 
-        return ret;
-    }
-
-    // launch
-    oss_set_task_tracker(thr_params, part_num, &launched, &failed, &completed, failed_parts, completed_parts);
-    for (i = 0; i < part_num; i++) {
-        apr_thread_pool_push(thrp, upload_part, thr_params + i, 0, NULL);
-    }
-
-    // wait until all tasks exit
-    total_num = apr_atomic_read32(&launched) + apr_atomic_read32(&failed) + apr_atomic_read32(&completed);
-    for ( ; total_num < (apr_uint32_t)part_num; ) {
-        rv = apr_queue_trypop(completed_parts, &task_result);
-        if (rv == APR_EINTR || rv == APR_EAGAIN) {
-            apr_sleep(1000);
-        } else if(rv == APR_EOF) {
-            break;
-        } else if(rv == APR_SUCCESS) {
-            task_res = (oss_part_task_result_t*)task_result;
-            oss_update_checkpoint(parent_pool, checkpoint, task_res->part->index, &task_res->etag);
-            rv = oss_dump_checkpoint(parent_pool, checkpoint);
-            if (rv != AOSE_OK) {
-                int idx = task_res->part->index;
-                aos_status_set(ret, rv, AOS_WRITE_FILE_ERROR_CODE, NULL);
-                apr_atomic_inc32(&failed);
-                thr_params[idx].result->s = ret;
-                apr_queue_push(failed_parts, thr_params[idx].result);
-            }
-            if (NULL != progress_callback) {
-                consume_bytes += task_res->part->size;
-                progress_callback(consume_bytes, finfo->size);
-            }
-        }
-        total_num = apr_atomic_read32(&launched) + apr_atomic_read32(&failed) + apr_atomic_read32(&completed);
-    }
-
-    // deal with left successful parts
-    while(APR_SUCCESS == apr_queue_trypop(completed_parts, &task_result)) {
-        task_res = (oss_part_task_result_t*)task_result;
-        oss_update_checkpoint(parent_pool, checkpoint, task_res->part->index, &task_res->etag);
-        consume_bytes += task_res->part->size;
-        has_left_result = AOS_TRUE;
-    }
-    if (has_left_result) {
-        rv = oss_dump_checkpoint(parent_pool, checkpoint);
-        if (rv != AOSE_OK) {
-            aos_status_set(ret, rv, AOS_WRITE_FILE_ERROR_CODE, NULL);
-            return ret;
-        }
-        if (NULL != progress_callback) {
-            progress_callback(consume_bytes, finfo->size);
-        }
-    }
-    apr_file_close(checkpoint->thefile);
-
-    // failed
-    if (apr_atomic_read32(&failed) > 0) {
-        apr_queue_pop(failed_parts, &task_result);
-        task_res = (oss_part_task_result_t*)task_result;
-        s = aos_status_dup(parent_pool, task_res->s);
-        oss_destroy_thread_pool(thr_params, part_num);
+    // upload parts    
+    parts = (oss_checkpoint_part_t *)aos_palloc(parent_pool, sizeof(oss_checkpoint_part_t) * (checkpoint->part_num));
+    oss_get_checkpoint_undo_parts(checkpoint, &part_num, parts);
+    s = oss_do_upload_parts(options, bucket, object, filepath, NULL, NULL, NULL, &upload_id, 
+        thread_num, part_num, parts, checkpoint, tuner, progress_callback, finfo->size);
+    oss_close_checkpoint_file(checkpoint);
+    if (!aos_status_is_ok(s)) {
         return s;
     }
     
@@ -671,7 +1480,6 @@ aos_status_t *oss_resumable_upload_file_with_cp(oss_request_options_t *options,
         aos_str_set(&complete_content->etag, checkpoint->parts[i].etag.data);
         aos_list_add_tail(&complete_content->node, &completed_part_list);
     }
-    oss_destroy_thread_pool(thr_params, part_num);
 
     // complete upload
     options->pool = subpool;
@@ -683,7 +1491,11 @@ aos_status_t *oss_resumable_upload_file_with_cp(oss_request_options_t *options,
         }
     }
     s = oss_do_complete_multipart_upload(options, bucket, object, &upload_id, 
-        &completed_part_list, cb_headers, NULL, resp_headers, resp_body);
+        &completed_part_list, cb_headers, NULL, &complete_headers, resp_body);
+    oss_check_complete_crc64(options, checkpoint->parts, checkpoint->part_num, complete_headers, s);
+    if (NULL != resp_headers) {
+        *resp_headers = complete_headers;
+    }
     s = aos_status_dup(parent_pool, s);
     aos_pool_destroy(subpool);
     options->pool = parent_pool;
@@ -707,6 +1519,8 @@ aos_status_t *oss_resumable_upload_file(oss_request_options_t *options,
 {
     int32_t thread_num = 0;
     int64_t part_size = 0;
+    oss_auto_tuner_t tuner;
+    oss_auto_tuner_t *ptuner = NULL;
     aos_string_t checkpoint_path;
     aos_pool_t *sub_pool;
     apr_finfo_t finfo;
@@ -727,15 +1541,254 @@ aos_status_t *oss_resumable_upload_file(oss_request_options_t *options,
     part_size = clt_params->part_size;
     oss_get_part_size(finfo.size, &part_size);
 
+    if (NULL != clt_params && clt_params->auto_tune) {
+        oss_init_auto_tuner(&tuner, clt_params);
+        part_size = oss_auto_tune_part_size(finfo.size, clt_params->part_size, 
+            tuner.max_thread_num, &clt_params->tuned);
+        ptuner = &tuner;
+    }
+
     if (NULL != clt_params && clt_params->enable_checkpoint) {
         oss_get_checkpoint_path(clt_params, filepath, sub_pool, &checkpoint_path);
         s = oss_resumable_upload_file_with_cp(options, bucket, object, filepath, headers, params, thread_num, 
-            part_size, &checkpoint_path, &finfo, progress_callback, resp_headers, resp_body);
+            part_size, ptuner, &checkpoint_path, clt_params->checkpoint_sync_num, &finfo, 
+            progress_callback, resp_headers, resp_body);
     } else {
         s = oss_resumable_upload_file_without_cp(options, bucket, object, filepath, headers, params, thread_num, 
-            part_size, &finfo, progress_callback, resp_headers, resp_body);
+            part_size, ptuner, &finfo, progress_callback, resp_headers, resp_body);
+    }
+
+    if (NULL != ptuner) {
+        oss_auto_tuner_export(ptuner, part_size, &clt_params->tuned);
     }
 
     aos_pool_destroy(sub_pool);
     return s;
 }
+
+static aos_status_t *oss_do_parallel_copy_object(oss_request_options_t *options,
+                                                   aos_string_t *source_bucket, 
+                                                   aos_string_t *source_object, 
+                                                   aos_string_t *dest_bucket, 
+                                                   aos_string_t *dest_object, 
+                                                   aos_table_t *headers,
+                                                   oss_resumable_clt_params_t *clt_params, 
+                                                   aos_table_t **resp_headers,
+                                                   aos_list_t *resp_body)
+{
+    aos_pool_t *subpool = NULL;
+    aos_pool_t *parent_pool = NULL;
+    aos_status_t *s = NULL;
+    aos_status_t *ret = NULL;
+    aos_table_t *head_resp_headers = NULL;
+    aos_table_t *abort_resp_headers = NULL;
+    aos_table_t *complete_headers = NULL;
+    aos_list_t completed_part_list;
+    oss_complete_part_content_t *complete_content = NULL;
+    oss_checkpoint_t *checkpoint = NULL;
+    oss_checkpoint_t *dump_checkpoint = NULL;
+    oss_checkpoint_part_t *parts;
+    aos_string_t copy_source;
+    aos_string_t cp_name;
+    aos_string_t checkpoint_path;
+    aos_string_t upload_id;
+    int64_t object_size;
+    int64_t part_size;
+    int32_t thread_num;
+    const char *value;
+    char *last_modified;
+    char *etag;
+    char *part_num_str;
+    char *p;
+    int need_init_upload = AOS_TRUE;
+    int part_num = 0;
+    int i = 0;
+    int rv;
+
+    parent_pool = options->pool;
+    ret = aos_status_create(parent_pool);
+    thread_num = oss_get_thread_num(clt_params);
+
+    // head source object
+    aos_pool_create(&subpool, parent_pool);
+    options->pool = subpool;
+    s = oss_head_object(options, source_bucket, source_object, NULL, &head_resp_headers);
+    if (!aos_status_is_ok(s)) {
+        s = aos_status_dup(parent_pool, s);
+        aos_pool_destroy(subpool);
+        options->pool = parent_pool;
+        return s;
+    }
+    value = apr_table_get(head_resp_headers, OSS_CONTENT_LENGTH);
+    object_size = (NULL == value) ? 0 : aos_atoi64(value);
+    value = apr_table_get(head_resp_headers, "Last-Modified");
+    last_modified = apr_pstrdup(parent_pool, (NULL == value) ? "" : value);
+    value = apr_table_get(head_resp_headers, "ETag");
+    etag = apr_pstrdup(parent_pool, (NULL == value) ? "" : value);
+    options->pool = parent_pool;
+    aos_pool_destroy(subpool);
+
+    // the range of upload part copy can not be empty
+    if (0 == object_size) {
+        return oss_copy_object(options, source_bucket, source_object, dest_bucket, dest_object, 
+            headers, resp_headers);
+    }
+
+    part_size = (NULL == clt_params || clt_params->part_size <= 0) ? 
+        AOS_DEFAULT_PART_SIZE : clt_params->part_size;
+    oss_get_part_size(object_size, &part_size);
+
+    // checkpoint
+    p = apr_psprintf(parent_pool, "/%.*s/%.*s", source_bucket->len, source_bucket->data, 
+        source_object->len, source_object->data);
+    aos_str_set(&copy_source, p);
+    checkpoint = oss_create_checkpoint_content(parent_pool);
+    if (NULL != clt_params && clt_params->enable_checkpoint) {
+        // default to ./bucket.object.cp, the separators of the object name are replaced
+        p = apr_psprintf(parent_pool, "%.*s.%.*s", dest_bucket->len, dest_bucket->data, 
+            dest_object->len, dest_object->data);
+        for (i = 0; p[i] != '\0'; i++) {
+            if (p[i] == '/' || p[i] == '\\') {
+                p[i] = '_';
+            }
+        }
+        aos_str_set(&cp_name, p);
+        oss_get_checkpoint_path(clt_params, &cp_name, parent_pool, &checkpoint_path);
+
+        if (oss_does_file_exist(&checkpoint_path, parent_pool)) {
+            if (AOSE_OK == oss_load_checkpoint(parent_pool, &checkpoint_path, checkpoint) && 
+                oss_is_copy_checkpoint_valid(parent_pool, checkpoint, &copy_source, dest_object, 
+                    object_size, last_modified, etag)) {
+                aos_str_set(&upload_id, checkpoint->upload_id.data);
+                need_init_upload = AOS_FALSE;
+            } else {
+                apr_file_remove(checkpoint_path.data, parent_pool);
+            }
+        }
+        dump_checkpoint = checkpoint;
+    }
+
+    if (need_init_upload) {
+        // init upload 
+        aos_pool_create(&subpool, parent_pool);
+        options->pool = subpool;
+        s = oss_init_multipart_upload(options, dest_bucket, dest_object, &upload_id, headers, NULL);
+        if (!aos_status_is_ok(s)) {
+            s = aos_status_dup(parent_pool, s);
+            aos_pool_destroy(subpool);
+            options->pool = parent_pool;
+            return s;
+        }
+        aos_str_set(&upload_id, apr_pstrdup(parent_pool, upload_id.data));
+        options->pool = parent_pool;
+        aos_pool_destroy(subpool);
+
+        // build checkpoint
+        oss_build_copy_checkpoint(parent_pool, checkpoint, &copy_source, dest_object, object_size, 
+            last_modified, etag, &upload_id, part_size);
+    }
+
+    if (NULL != dump_checkpoint) {
+        rv = oss_open_checkpoint_file(parent_pool, &checkpoint_path, checkpoint);
+        if (rv != APR_SUCCESS) {
+            aos_status_set(ret, rv, AOS_OPEN_FILE_ERROR_CODE, NULL);
+            return ret;
+        }
+        checkpoint->sync_num = clt_params->checkpoint_sync_num;
+        rv = oss_dump_checkpoint(parent_pool, checkpoint);
+        if (rv != AOSE_OK) {
+            oss_close_checkpoint_file(checkpoint);
+            aos_status_set(ret, rv, AOS_WRITE_FILE_ERROR_CODE, NULL);
+            return ret;
+        }
+    }
+
+    // copy parts
+    parts = (oss_checkpoint_part_t *)aos_palloc(parent_pool, sizeof(oss_checkpoint_part_t) * (checkpoint->part_num));
+    oss_get_checkpoint_undo_parts(checkpoint, &part_num, parts);
+    if (part_num > 0) {
+        s = oss_do_upload_parts(options, dest_bucket, dest_object, NULL, source_bucket, source_object, 
+            &checkpoint->object_etag, &upload_id, thread_num, part_num, parts, dump_checkpoint, NULL, NULL, 0);
+        if (!aos_status_is_ok(s)) {
+            if (NULL != dump_checkpoint) {
+                oss_close_checkpoint_file(checkpoint);
+            }
+            if (412 == s->code) {
+                // the source is changed, the parts copied so far are of the old version
+                aos_pool_create(&subpool, parent_pool);
+                options->pool = subpool;
+                oss_abort_multipart_upload(options, dest_bucket, dest_object, &upload_id, &abort_resp_headers);
+                options->pool = parent_pool;
+                aos_pool_destroy(subpool);
+                if (NULL != dump_checkpoint) {
+                    apr_file_remove(checkpoint_path.data, parent_pool);
+                }
+            }
+            return s;
+        }
+        for (i = 0; i < part_num; i++) {
+            checkpoint->parts[parts[i].index].completed = AOS_TRUE;
+            checkpoint->parts[parts[i].index].etag = parts[i].etag;
+            checkpoint->parts[parts[i].index].crc64 = parts[i].crc64;
+        }
+    }
+    if (NULL != dump_checkpoint) {
+        oss_close_checkpoint_file(checkpoint);
+    }
+
+    // complete upload
+    aos_pool_create(&subpool, parent_pool);
+    aos_list_init(&completed_part_list);
+    for (i = 0; i < checkpoint->part_num; i++) {
+        complete_content = oss_create_complete_part_content(subpool);
+        part_num_str = apr_psprintf(subpool, "%d", checkpoint->parts[i].index + 1);
+        aos_str_set(&complete_content->part_number, part_num_str);
+        aos_str_set(&complete_content->etag, checkpoint->parts[i].etag.data);
+        aos_list_add_tail(&complete_content->node, &completed_part_list);
+    }
+
+    options->pool = subpool;
+    s = oss_do_complete_multipart_upload(options, dest_bucket, dest_object, &upload_id, 
+        &completed_part_list, NULL, NULL, &complete_headers, resp_body);
+    oss_check_complete_crc64(options, checkpoint->parts, checkpoint->part_num, complete_headers, s);
+    if (NULL != resp_headers) {
+        *resp_headers = complete_headers;
+    }
+    s = aos_status_dup(parent_pool, s);
+    aos_pool_destroy(subpool);
+    options->pool = parent_pool;
+
+    // remove chepoint file
+    if (NULL != dump_checkpoint && aos_status_is_ok(s)) {
+        apr_file_remove(checkpoint_path.data, parent_pool);
+    }
+
+    return s;
+}
+
+aos_status_t *oss_parallel_copy_object(oss_request_options_t *options,
+                                       aos_string_t *source_bucket, 
+                                       aos_string_t *source_object, 
+                                       aos_string_t *dest_bucket, 
+                                       aos_string_t *dest_object, 
+                                       aos_table_t *headers,
+                                       oss_resumable_clt_params_t *clt_params, 
+                                       aos_table_t **resp_headers,
+                                       aos_list_t *resp_body)
+{
+    aos_status_t *s = NULL;
+    int restart = 0;
+
+    // the parts are copied only if the source still has the etag of the head, otherwise start over
+    for (; ; restart++) {
+        s = oss_do_parallel_copy_object(options, source_bucket, source_object, dest_bucket, dest_object, 
+            headers, clt_params, resp_headers, resp_body);
+        if (412 != s->code || restart >= OSS_COPY_RESTART_NUM) {
+            break;
+        }
+        aos_warn_log("source object %.*s is changed during copy, restart:%d.\n", 
+                     source_object->len, source_object->data, restart + 1);
+    }
+
+    return s;
+}
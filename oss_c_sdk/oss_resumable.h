@@ -5,11 +5,39 @@
 #include "apr_atomic.h"
 #include "apr_queue.h"
 #include "apr_thread_pool.h"
+#include "apr_thread_proc.h"
+#include "apr_thread_mutex.h"
 
 AOS_CPP_START
 
 #define OSS_CP_UPLOAD   1
 #define OSS_CP_DOWNLOAD 2
+#define OSS_CP_COPY     3
+
+#define OSS_CP_JOURNAL_MAGIC           "OSSCPJ01"
+#define OSS_CP_JOURNAL_MAGIC_LEN       8
+#define OSS_CP_JOURNAL_HEADER_LEN      20   // magic, xml length and xml crc64
+#define OSS_CP_JOURNAL_RECORD_LEN      24   // index, etag length, part crc64 and record crc64, without etag
+#define OSS_CP_JOURNAL_MAX_ETAG_LEN    256  // a longer etag is only kept by the header
+#define OSS_CP_JOURNAL_COMPACT_NUM     1024 // compact once the records reach both this and 
+#define OSS_CP_JOURNAL_COMPACT_RATIO   4    // a quarter of the parts, so compaction stays linear
+#define OSS_CP_VERIFY_BUFFER_SIZE      (64 * 1024) // the read buffer of a part verification task
+
+#define OSS_AUTO_TUNE_MIN_PART_SIZE    (100 * 1024)
+#define OSS_AUTO_TUNE_INIT_THREAD_NUM  2
+#define OSS_AUTO_TUNE_MAX_THREAD_NUM   32
+#define OSS_AUTO_TUNE_RTT_FACTOR       20 // a part should take about 20 round trips
+#define OSS_AUTO_TUNE_MIN_GAIN         5  // percent of throughput gain to keep growing
+
+#define OSS_LIST_ITERATOR_PAGE_NUM     3  // a page in use, a page ready and a page being listed
+
+#define OSS_PART_RETRY_NUM             3
+#define OSS_COPY_RESTART_NUM           2  // the copy restarts if the source object changes meanwhile
+#define OSS_PART_RETRY_BACKOFF         (100 * 1000) // microseconds, doubled for each retry
+#define OSS_STRAGGLER_FACTOR           4  // a part is slow if it takes 4 times of the median part time
+#define OSS_STRAGGLER_MIN_SAMPLES      3
+#define OSS_STRAGGLER_MIN_ELAPSED      (5 * APR_USEC_PER_SEC)
+#define OSS_STRAGGLER_CHECK_INTERVAL   APR_USEC_PER_SEC
 
 typedef struct {
     int32_t index;  // the index of part, start from 0
@@ -17,42 +45,76 @@ typedef struct {
     int64_t size;   // the size of part
     int completed;  // AOS_TRUE completed, AOS_FALSE uncompleted
     aos_string_t etag; // the etag of part, for upload
+    uint64_t crc64;    // the crc64 of part, 0 if unknown
 } oss_checkpoint_part_t;
 
 typedef struct {
     aos_string_t md5;      // the md5 of checkout content
-    int cp_type;           // 1 upload, 2 download
+    int cp_type;           // 1 upload, 2 download, 3 copy
     apr_file_t *thefile;   // the handle of checkpoint file
+    aos_string_t thefile_path; // the path of checkpoint file, compaction writes a new file and renames it
 
-    aos_string_t file_path;        // local file path 
+    aos_string_t file_path;        // local file path, or /bucket/object of the copy source
     int64_t    file_size;          // local file size, for upload
     apr_time_t file_last_modified; // local file last modified time, for upload
     aos_string_t file_md5;         // the md5 of the local file content, for upload, reserved
 
     aos_string_t object_name;          // object name
-    int64_t object_size;               // object size, for download
-    aos_string_t object_last_modified; // object last modified time, for download
-    aos_string_t object_etag;          // object etag, for download
+    int64_t object_size;               // object size, for download and copy
+    aos_string_t object_last_modified; // object last modified time, for download and copy
+    aos_string_t object_etag;          // object etag, for download and copy
 
     aos_string_t upload_id;  // upload id
 
     int  part_num;                 // the total number of parts
     int64_t part_size;             // the part size, byte
     oss_checkpoint_part_t *parts;  // the parts of local or object, from 0
+
+    int32_t sync_num;      // fsync the checkpoint file every sync_num records, 0 only flush
+    int32_t record_num;    // the records appended since the last compaction
+    int32_t unsynced_num;  // the records appended since the last fsync
 } oss_checkpoint_t;
 
 typedef struct {
     oss_checkpoint_part_t *part;
     aos_status_t *s;
-    aos_string_t etag; 
+    aos_string_t etag;
+    uint64_t crc64;      // the crc64 of part returned by oss, 0 if not returned
+    int64_t start_time;  // the controller start time of the part request
+    int64_t finish_time; // the controller finish time of the part request
 } oss_part_task_result_t;
 
+typedef struct {
+    int32_t thread_num;       // the current number of concurrent part tasks
+    int32_t max_thread_num;   // the upper limit of concurrent part tasks
+    int32_t best_thread_num;  // the thread num of the best throughput
+    int     growing;          // AOS_TRUE while concurrency is additively increased
+    int64_t best_throughput;  // the best aggregate throughput, bytes per second
+    int64_t rtt;              // the round trip time, microseconds
+    apr_time_t window_start;  // the start time of the current measure window
+    int64_t window_bytes;     // the bytes completed in the current measure window
+    int32_t window_parts;     // the parts completed in the current measure window
+    int32_t peak_thread_num;  // the most worker threads seen running at once
+} oss_auto_tuner_t;
+
+typedef struct {
+    apr_uint32_t started;    // AOS_TRUE once the first task of the part starts, use atomic
+    apr_uint32_t done;       // AOS_TRUE once the part is completed or failed, use atomic
+    apr_uint32_t running;    // the number of launched but unfinished tasks of the part, use atomic
+    apr_time_t start_time;   // the time the first task of the part starts
+    int speculated;          // AOS_TRUE once a speculative task is launched for the part
+    aos_http_controller_t *ctls[2]; // the controllers of the original and the speculative task
+} oss_part_task_state_t;
+
 typedef struct {
     oss_request_options_t options;
     aos_string_t *bucket;
     aos_string_t *object; 
     aos_string_t *upload_id;
     aos_string_t *filepath;
+    aos_string_t *source_bucket;   // the source bucket of upload part copy, NULL for upload from file
+    aos_string_t *source_object;   // the source object of upload part copy, NULL for upload from file
+    aos_string_t *source_etag;     // the etag the source object must still have, NULL for upload from file
     oss_checkpoint_part_t *part;
     oss_part_task_result_t *result;
 
@@ -61,8 +123,17 @@ typedef struct {
     apr_uint32_t *completed;       // the number of completed part tasks, use atomic
     apr_queue_t  *failed_parts;    // the queue of failed parts tasks, thread safe
     apr_queue_t  *completed_parts; // the queue of completed parts tasks, thread safe
+    apr_uint32_t *running;         // the number of launched but unfinished tasks, use atomic
+    oss_part_task_state_t *state;  // the state shared by the tasks of the same part
 } oss_upload_thread_params_t;
 
+typedef struct {
+    aos_string_t *filepath;
+    oss_checkpoint_part_t *part;
+    int matched;                     // AOS_TRUE if the local crc64 of the part equals the recorded one
+    apr_queue_t *verified_parts;     // the queue of verified parts, thread safe
+} oss_verify_thread_params_t;
+
 int32_t oss_get_thread_num(oss_resumable_clt_params_t *clt_params);
 
 void oss_get_checkpoint_path(oss_resumable_clt_params_t *clt_params, const aos_string_t *filepath, 
@@ -74,7 +145,9 @@ int oss_does_file_exist(const aos_string_t *filepath, aos_pool_t *pool);
 
 int oss_open_checkpoint_file(aos_pool_t *pool,  aos_string_t *checkpoint_path, oss_checkpoint_t *checkpoint);
 
-int oss_open_checkpoint_file(aos_pool_t *pool,  aos_string_t *checkpoint_path, oss_checkpoint_t *checkpoint); 
+int oss_open_checkpoint_file(aos_pool_t *pool,  aos_string_t *checkpoint_path, oss_checkpoint_t *checkpoint);
+
+void oss_close_checkpoint_file(oss_checkpoint_t *checkpoint); 
 
 int oss_get_part_num(int64_t file_size, int64_t part_size);
 
@@ -92,12 +165,38 @@ void oss_set_task_tracker(oss_upload_thread_params_t *thr_params, int part_num,
                           apr_uint32_t *launched, apr_uint32_t *failed, apr_uint32_t *completed,
                           apr_queue_t *failed_parts, apr_queue_t *completed_parts);
 
+void oss_set_task_state(oss_upload_thread_params_t *thr_params, int part_num, 
+                        apr_uint32_t *running, oss_part_task_state_t *states);
+
+void oss_set_copy_source(oss_upload_thread_params_t *thr_params, int part_num, 
+                         aos_string_t *source_bucket, aos_string_t *source_object,
+                         aos_string_t *source_etag);
+
+void oss_launch_part_task(apr_thread_pool_t *thrp, oss_upload_thread_params_t *params, apr_byte_t priority);
+
+int oss_launch_part_tasks(apr_thread_pool_t *thrp, oss_upload_thread_params_t *thr_params, 
+                          int launched_num, int part_num, int32_t thread_num, apr_uint32_t done_num);
+
+void oss_cancel_part_tasks(oss_part_task_state_t *state);
+
+void oss_record_part_time(int64_t *part_times, int *count, int64_t part_time);
+
+int oss_launch_speculative_tasks(apr_thread_pool_t *thrp, oss_upload_thread_params_t *thr_params, 
+                                 oss_upload_thread_params_t **spec_params, int part_num, int64_t median,
+                                 aos_pool_t *parent_pool, oss_request_options_t *options);
+
+void oss_destroy_part_tasks(apr_uint32_t *running, oss_upload_thread_params_t *thr_params, 
+                            oss_upload_thread_params_t **spec_params, int part_num);
+
 int oss_verify_checkpoint_md5(aos_pool_t *pool, const oss_checkpoint_t *checkpoint);
 
 void oss_build_upload_checkpoint(aos_pool_t *pool, oss_checkpoint_t *checkpoint, aos_string_t *file_path, 
                                  apr_finfo_t *finfo, aos_string_t *upload_id, int64_t part_size);
 
-int oss_dump_checkpoint(aos_pool_t *pool, const oss_checkpoint_t *checkpoint);
+int oss_dump_checkpoint(aos_pool_t *pool, oss_checkpoint_t *checkpoint);
+
+int oss_append_checkpoint(aos_pool_t *pool, oss_checkpoint_t *checkpoint, int32_t part_index, 
+                          aos_string_t *etag, uint64_t crc64);
 
 int oss_load_checkpoint(aos_pool_t *pool, const aos_string_t *filepath, oss_checkpoint_t *checkpoint);
 
@@ -105,10 +204,70 @@ int oss_is_upload_checkpoint_valid(aos_pool_t *pool, oss_checkpoint_t *checkpoin
 
 void oss_update_checkpoint(aos_pool_t *pool, oss_checkpoint_t *checkpoint, int32_t part_index, aos_string_t *etag);
 
+void oss_build_copy_checkpoint(aos_pool_t *pool, oss_checkpoint_t *checkpoint, const aos_string_t *copy_source,
+                               const aos_string_t *object, int64_t object_size, const char *object_last_modified, 
+                               const char *object_etag, aos_string_t *upload_id, int64_t part_size);
+
+int oss_is_copy_checkpoint_valid(aos_pool_t *pool, oss_checkpoint_t *checkpoint, const aos_string_t *copy_source,
+                                 const aos_string_t *object, int64_t object_size, const char *object_last_modified, 
+                                 const char *object_etag);
+
+int oss_verify_upload_checkpoint_parts(aos_pool_t *pool, oss_checkpoint_t *checkpoint, 
+                                       const aos_string_t *filepath, apr_finfo_t *finfo, int32_t thread_num);
+
+int oss_get_parts_crc64(const oss_checkpoint_part_t *parts, int part_num, uint64_t *crc64);
+
+void oss_check_complete_crc64(const oss_request_options_t *options, const oss_checkpoint_part_t *parts, 
+                              int part_num, const aos_table_t *resp_headers, aos_status_t *s);
+
 void oss_get_checkpoint_undo_parts(oss_checkpoint_t *checkpoint, int *part_num, oss_checkpoint_part_t *parts);
 
 void * APR_THREAD_FUNC upload_part(apr_thread_t *thd, void *data);
 
+void * APR_THREAD_FUNC verify_part_crc64(apr_thread_t *thd, void *data);
+
+int64_t oss_auto_tune_part_size(int64_t file_size, int64_t part_size, int32_t max_thread_num,
+                                const oss_resumable_tuned_params_t *tuned);
+
+void oss_init_auto_tuner(oss_auto_tuner_t *tuner, oss_resumable_clt_params_t *clt_params);
+
+void oss_auto_tuner_set_rtt(oss_auto_tuner_t *tuner, const aos_http_controller_t *ctl);
+
+int32_t oss_auto_tuner_on_part_completed(oss_auto_tuner_t *tuner, const oss_part_task_result_t *result);
+
+int32_t oss_auto_tuner_on_part_failed(oss_auto_tuner_t *tuner);
+
+void oss_auto_tuner_export(const oss_auto_tuner_t *tuner, int64_t part_size, oss_resumable_tuned_params_t *tuned);
+
+aos_status_t *oss_upload_parts(oss_request_options_t *options,
+                               const aos_string_t *bucket, 
+                               const aos_string_t *object, 
+                               const aos_string_t *filepath,
+                               const aos_string_t *upload_id,
+                               int32_t thread_num,
+                               int part_num,
+                               oss_checkpoint_part_t *parts);
+
+/*
+ * upload the parts from the file, or copy them from the source object, the completed 
+ * parts are appended to the checkpoint and the concurrency follows the tuner if not NULL
+ */
+aos_status_t *oss_do_upload_parts(oss_request_options_t *options,
+                                  const aos_string_t *bucket, 
+                                  const aos_string_t *object, 
+                                  const aos_string_t *filepath,
+                                  const aos_string_t *source_bucket,
+                                  const aos_string_t *source_object,
+                                  const aos_string_t *source_etag,
+                                  const aos_string_t *upload_id,
+                                  int32_t thread_num,
+                                  int part_num,
+                                  oss_checkpoint_part_t *parts,
+                                  oss_checkpoint_t *checkpoint,
+                                  oss_auto_tuner_t *tuner,
+                                  oss_progress_callback progress_callback,
+                                  int64_t total_size);
+
 aos_status_t *oss_resumable_upload_file_without_cp(oss_request_options_t *options,
                                                    aos_string_t *bucket, 
                                                    aos_string_t *object, 
@@ -117,6 +276,7 @@ aos_status_t *oss_resumable_upload_file_without_cp(oss_request_options_t *option
                                                    aos_table_t *params,
                                                    int32_t thread_num,
                                                    int64_t part_size,
+                                                   oss_auto_tuner_t *tuner,
                                                    apr_finfo_t *finfo,
                                                    oss_progress_callback progress_callback,
                                                    aos_table_t **resp_headers,
@@ -130,7 +290,9 @@ aos_status_t *oss_resumable_upload_file_with_cp(oss_request_options_t *options,
                                                 aos_table_t *params,
                                                 int32_t thread_num,
                                                 int64_t part_size,
+                                                oss_auto_tuner_t *tuner,
                                                 aos_string_t *checkpoint_path,
+                                                int32_t checkpoint_sync_num,
                                                 apr_finfo_t *finfo,
                                                 oss_progress_callback progress_callback,
                                                 aos_table_t **resp_headers,
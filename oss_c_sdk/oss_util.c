@@ -158,24 +158,29 @@ oss_config_t *oss_config_create(aos_pool_t *p)
     return (oss_config_t *)aos_pcalloc(p, sizeof(oss_config_t));
 }
 
-void oss_config_resolve(aos_pool_t *pool, oss_config_t *config, aos_http_controller_t *ctl)
+static void oss_resolve_proxy(aos_pool_t *pool, oss_config_t *config, aos_http_request_options_t *op)
 {
     if(!aos_is_null_string(&config->proxy_host)) {
         // proxy host:port
         if (config->proxy_port == 0) {
-            ctl->options->proxy_host = apr_psprintf(pool, "%.*s", config->proxy_host.len, config->proxy_host.data);
+            op->proxy_host = apr_psprintf(pool, "%.*s", config->proxy_host.len, config->proxy_host.data);
         } else {
-            ctl->options->proxy_host = apr_psprintf(pool, "%.*s:%d", config->proxy_host.len, config->proxy_host.data, 
+            op->proxy_host = apr_psprintf(pool, "%.*s:%d", config->proxy_host.len, config->proxy_host.data, 
                 config->proxy_port);
         }
         // authorize user:passwd
         if (!aos_is_null_string(&config->proxy_user) && !aos_is_null_string(&config->proxy_passwd)) {
-            ctl->options->proxy_auth = apr_psprintf(pool, "%.*s:%.*s", config->proxy_user.len, 
+            op->proxy_auth = apr_psprintf(pool, "%.*s:%.*s", config->proxy_user.len, 
                 config->proxy_user.data, config->proxy_passwd.len, config->proxy_passwd.data);
         }
     }
 }
 
+void oss_config_resolve(aos_pool_t *pool, oss_config_t *config, aos_http_controller_t *ctl)
+{
+    oss_resolve_proxy(pool, config, ctl->options);
+}
+
 oss_request_options_t *oss_request_options_create(aos_pool_t *p)
 {
     int s;
@@ -194,6 +199,206 @@ oss_request_options_t *oss_request_options_create(aos_pool_t *p)
     return options;
 }
 
+int oss_request_options_reuse(oss_request_options_t *options)
+{
+    aos_http_request_context_t *ctx;
+
+    if (options->ctl == NULL) {
+        return AOSE_INVALID_ARGUMENT;
+    }
+    if (options->ctl->context != NULL) {
+        return AOSE_OK;
+    }
+
+    ctx = aos_http_request_context_create(options->pool);
+    if (ctx == NULL) {
+        return AOSE_OUT_MEMORY;
+    }
+    options->ctl->context = ctx;
+    options->ctl->pool = ctx->pool;
+    options->pool = ctx->pool;
+
+    return AOSE_OK;
+}
+
+void oss_request_options_reset(oss_request_options_t *options)
+{
+    aos_http_controller_ex_t *ctl;
+
+    if (options->ctl == NULL || options->ctl->context == NULL) {
+        return;
+    }
+
+    ctl = (aos_http_controller_ex_t *)options->ctl;
+    ctl->start_time = 0;
+    ctl->first_byte_time = 0;
+    ctl->finish_time = 0;
+    ctl->error_code = AOSE_OK;
+    ctl->reason = NULL;
+    aos_http_request_context_reset(ctl->context);
+}
+
+oss_client_t *oss_client_create(aos_pool_t *p, oss_config_t *config)
+{
+    apr_status_t s;
+    char buf[256];
+    const char *proto;
+    int proto_len;
+    oss_client_t *client;
+
+    client = (oss_client_t *)aos_pcalloc(p, sizeof(oss_client_t));
+    client->pool = p;
+    client->config = config;
+
+    proto = starts_with(&config->endpoint, AOS_HTTP_PREFIX) ? AOS_HTTP_PREFIX : "";
+    proto = starts_with(&config->endpoint, AOS_HTTPS_PREFIX) ? AOS_HTTPS_PREFIX : proto;
+    proto_len = strlen(proto);
+    client->proto = apr_pstrdup(p, proto);
+    client->host.data = apr_pstrmemdup(p, config->endpoint.data + proto_len, 
+                                       config->endpoint.len - proto_len);
+    client->host.len = config->endpoint.len - proto_len;
+    client->is_ip = is_valid_ip(client->host.data);
+
+    // the default options are shared unless there is a proxy to set
+    client->http_options = aos_default_http_request_options;
+    if (!aos_is_null_string(&config->proxy_host)) {
+        client->http_options = aos_http_request_options_create(p);
+        if (aos_default_http_request_options != NULL) {
+            *client->http_options = *aos_default_http_request_options;
+        }
+        oss_resolve_proxy(p, config, client->http_options);
+    }
+
+    aos_hmac_sha1_key_init(&client->sign_key, (const unsigned char *)config->access_key_secret.data, 
+                           config->access_key_secret.len);
+
+    if ((s = apr_thread_mutex_create(&client->mutex, APR_THREAD_MUTEX_DEFAULT, p)) != APR_SUCCESS) {
+        aos_error_log("apr_thread_mutex_create failure, code:%d %s.", s, apr_strerror(s, buf, sizeof(buf)));
+        return NULL;
+    }
+    // the buckets are added by any thread, p is not locked by the client mutex
+    if ((s = aos_pool_create(&client->bucket_pool, p)) != APR_SUCCESS) {
+        aos_error_log("aos_pool_create failure, code:%d %s.", s, apr_strerror(s, buf, sizeof(buf)));
+        return NULL;
+    }
+    client->bucket_table = (oss_client_bucket_table_t *)aos_pcalloc(client->bucket_pool, 
+            sizeof(oss_client_bucket_table_t));
+
+    return client;
+}
+
+oss_request_options_t *oss_client_request_options_create(oss_client_t *client, aos_pool_t *p)
+{
+    oss_request_options_t *options;
+
+    options = oss_request_options_create(p);
+    if (options == NULL) {
+        return NULL;
+    }
+    options->config = client->config;
+    options->ctl = aos_http_controller_create(options->pool, 0);
+    if (client->http_options != NULL) {
+        options->ctl->options = client->http_options;
+    }
+    options->client = client;
+
+    return options;
+}
+
+static oss_client_bucket_t *oss_client_bucket_create(oss_client_t *client, const aos_string_t *bucket)
+{
+    aos_pool_t *p = client->bucket_pool;
+    oss_client_bucket_t *cb;
+
+    cb = (oss_client_bucket_t *)aos_pcalloc(p, sizeof(oss_client_bucket_t));
+    cb->name.data = apr_pstrmemdup(p, bucket->data, bucket->len);
+    cb->name.len = bucket->len;
+    cb->resource_prefix.data = apr_psprintf(p, "%.*s/", bucket->len, bucket->data);
+    cb->resource_prefix.len = bucket->len + 1;
+    cb->resource = client->is_ip ? cb->name.data : cb->resource_prefix.data;
+
+    if (client->config->is_cname || client->is_ip) {
+        cb->host = client->host.data;
+        cb->uri = cb->name.data;
+    } else {
+        cb->host = apr_psprintf(p, "%.*s.%.*s", bucket->len, bucket->data, 
+                                client->host.len, client->host.data);
+        cb->uri = apr_pstrdup(p, "");
+    }
+
+    if (!client->config->is_cname && client->is_ip) {
+        cb->uri_prefix = cb->resource_prefix;
+    } else {
+        aos_str_set(&cb->uri_prefix, "");
+    }
+
+    return cb;
+}
+
+static oss_client_bucket_t *oss_client_find_bucket(const oss_client_bucket_table_t *table, 
+                                                   const aos_string_t *bucket)
+{
+    int i;
+
+    for (i = 0; i < table->num; i++) {
+        if (table->buckets[i]->name.len == bucket->len && 
+            memcmp(table->buckets[i]->name.data, bucket->data, bucket->len) == 0)
+        {
+            return table->buckets[i];
+        }
+    }
+    return NULL;
+}
+
+const oss_client_bucket_t *oss_client_get_bucket(oss_client_t *client, const aos_string_t *bucket)
+{
+    oss_client_bucket_t *cb;
+    oss_client_bucket_table_t *table;
+    oss_client_bucket_table_t *grown;
+
+    // a published table is never written again, it is read without the mutex,
+    // the swap below is a full barrier so its buckets are visible before it
+    table = client->bucket_table;
+    if ((cb = oss_client_find_bucket(table, bucket)) != NULL) {
+        return cb;
+    }
+
+    apr_thread_mutex_lock(client->mutex);
+    table = client->bucket_table;
+    cb = oss_client_find_bucket(table, bucket);
+    if (cb == NULL && table->num < OSS_CLIENT_BUCKET_NUM) {
+        cb = oss_client_bucket_create(client, bucket);
+        grown = (oss_client_bucket_table_t *)aos_palloc(client->bucket_pool, sizeof(oss_client_bucket_table_t));
+        *grown = *table;
+        grown->buckets[grown->num++] = cb;
+        // the readers of the old table may still scan it, it stays in the pool
+        apr_atomic_casptr((volatile void **)&client->bucket_table, grown, table);
+    }
+    apr_thread_mutex_unlock(client->mutex);
+
+    return cb;
+}
+
+// the bucket strings when the options carry a client for their config
+static const oss_client_bucket_t *oss_options_get_bucket(const oss_request_options_t *options, 
+                                                         const aos_string_t *bucket)
+{
+    if (options->client == NULL || options->client->config != options->config) {
+        return NULL;
+    }
+    return oss_client_get_bucket(options->client, bucket);
+}
+
+static char *oss_concat_str(aos_pool_t *p, const aos_string_t *prefix, const aos_string_t *str)
+{
+    char *out = aos_palloc(p, prefix->len + str->len + 1);
+
+    memcpy(out, prefix->data, prefix->len);
+    memcpy(out + prefix->len, str->data, str->len);
+    out[prefix->len + str->len] = '\0';
+    return out;
+}
+
 void oss_get_object_uri(const oss_request_options_t *options,
                         const aos_string_t *bucket,
                         const aos_string_t *object,
@@ -202,6 +407,16 @@ void oss_get_object_uri(const oss_request_options_t *options,
     int32_t proto_len;
     const char *raw_endpoint_str;
     aos_string_t raw_endpoint;
+    const oss_client_bucket_t *cb;
+
+    if ((cb = oss_options_get_bucket(options, bucket)) != NULL) {
+        req->proto = options->client->proto;
+        req->host = cb->host;
+        req->resource = oss_concat_str(options->pool, &cb->resource_prefix, object);
+        req->uri = cb->uri_prefix.len == 0 ? object->data : 
+                   oss_concat_str(options->pool, &cb->uri_prefix, object);
+        return;
+    }
 
     generate_proto(options, req);
 
@@ -242,6 +457,15 @@ void oss_get_bucket_uri(const oss_request_options_t *options,
     int32_t proto_len;
     const char *raw_endpoint_str;
     aos_string_t raw_endpoint;
+    const oss_client_bucket_t *cb;
+
+    if ((cb = oss_options_get_bucket(options, bucket)) != NULL) {
+        req->proto = options->client->proto;
+        req->host = cb->host;
+        req->resource = cb->resource;
+        req->uri = cb->uri;
+        return;
+    }
 
     generate_proto(options, req);
 
@@ -397,7 +621,7 @@ void oss_fill_read_response_header(aos_http_response_t *resp,
                                    aos_table_t **headers)
 {
     if (NULL != headers && NULL != resp) {        
-        *headers = resp->headers;
+        *headers = aos_http_response_headers(resp);
     }
 }
 
@@ -425,6 +649,199 @@ oss_list_object_common_prefix_t *oss_create_list_object_common_prefix(aos_pool_t
             p, sizeof(oss_list_object_common_prefix_t));
 }
 
+static apr_status_t oss_list_object_compact_cleanup(void *data)
+{
+    oss_list_object_compact_t *compact = (oss_list_object_compact_t *)data;
+
+    free(compact->keys);
+    free(compact->key_offsets);
+    free(compact->sizes);
+    free(compact->last_modified);
+    free(compact->etags);
+    free(compact->etag_part_nums);
+    return APR_SUCCESS;
+}
+
+oss_list_object_compact_t *oss_create_list_object_compact(aos_pool_t *p)
+{
+    oss_list_object_compact_t *compact;
+
+    compact = (oss_list_object_compact_t *)aos_pcalloc(p, sizeof(oss_list_object_compact_t));
+    // the arrays grow by realloc, a pool would keep every outgrown copy until it is destroyed
+    apr_pool_cleanup_register(p, compact, oss_list_object_compact_cleanup, apr_pool_cleanup_null);
+    return compact;
+}
+
+static int oss_realloc(void **ptr, int64_t size)
+{
+    void *p = realloc(*ptr, (size_t)size);
+    if (NULL == p) {
+        return AOSE_OUT_MEMORY;
+    }
+    *ptr = p;
+    return AOSE_OK;
+}
+
+static int oss_list_object_compact_reserve_keys(oss_list_object_compact_t *compact, int64_t len)
+{
+    int64_t cap;
+
+    if (compact->keys_len + len <= compact->keys_cap) {
+        return AOSE_OK;
+    }
+    cap = aos_max(compact->keys_cap * 2, compact->keys_len + len);
+    cap = aos_max(cap, 4096);
+    if (oss_realloc((void **)&compact->keys, cap) != AOSE_OK) {
+        return AOSE_OUT_MEMORY;
+    }
+    compact->keys_cap = cap;
+    return AOSE_OK;
+}
+
+int oss_list_object_compact_add(oss_list_object_compact_t *compact)
+{
+    int cap;
+    int i;
+
+    if (compact->count == compact->capacity) {
+        cap = compact->capacity == 0 ? 256 : compact->capacity * 2;
+        if (oss_realloc((void **)&compact->key_offsets, cap * sizeof(int64_t)) != AOSE_OK ||
+            oss_realloc((void **)&compact->sizes, cap * sizeof(int64_t)) != AOSE_OK ||
+            oss_realloc((void **)&compact->last_modified, cap * sizeof(int64_t)) != AOSE_OK ||
+            oss_realloc((void **)&compact->etags, (int64_t)cap * OSS_ETAG_DIGEST_LEN) != AOSE_OK ||
+            oss_realloc((void **)&compact->etag_part_nums, cap * sizeof(int32_t)) != AOSE_OK)
+        {
+            return AOSE_OUT_MEMORY;
+        }
+        compact->capacity = cap;
+    }
+    if (oss_list_object_compact_reserve_keys(compact, 1) != AOSE_OK) {
+        return AOSE_OUT_MEMORY;
+    }
+
+    // an empty key until the key of the object is set
+    i = compact->count++;
+    compact->key_offsets[i] = compact->keys_len;
+    compact->keys[compact->keys_len++] = '\0';
+    compact->sizes[i] = 0;
+    compact->last_modified[i] = -1;
+    memset(compact->etags + (int64_t)i * OSS_ETAG_DIGEST_LEN, 0, OSS_ETAG_DIGEST_LEN);
+    compact->etag_part_nums[i] = -1;
+    return AOSE_OK;
+}
+
+int oss_list_object_compact_set_key(oss_list_object_compact_t *compact, const char *key, int len)
+{
+    // the key replaces the empty key of the last object at the end of keys
+    compact->keys_len = compact->key_offsets[compact->count - 1];
+    if (oss_list_object_compact_reserve_keys(compact, len + 1) != AOSE_OK) {
+        return AOSE_OUT_MEMORY;
+    }
+    memcpy(compact->keys + compact->keys_len, key, len);
+    compact->keys_len += len;
+    compact->keys[compact->keys_len++] = '\0';
+    return AOSE_OK;
+}
+
+void oss_list_object_compact_set_size(oss_list_object_compact_t *compact, const char *size)
+{
+    compact->sizes[compact->count - 1] = aos_atoi64(size);
+}
+
+void oss_list_object_compact_set_last_modified(oss_list_object_compact_t *compact, const char *str, int len)
+{
+    int64_t t;
+
+    if (aos_parse_iso8601_gmt_time(str, len, &t) == AOSE_OK) {
+        compact->last_modified[compact->count - 1] = t;
+    }
+}
+
+static int oss_hex_value(char c)
+{
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    } else if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    } else if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    return -1;
+}
+
+void oss_list_object_compact_set_etag(oss_list_object_compact_t *compact, const char *str, int len)
+{
+    unsigned char digest[OSS_ETAG_DIGEST_LEN];
+    int part_num = 0;
+    int hi;
+    int lo;
+    int i;
+
+    if (len >= 2 && str[0] == '"' && str[len - 1] == '"') {
+        str++;
+        len -= 2;
+    }
+    if (len < 2 * OSS_ETAG_DIGEST_LEN) {
+        return;
+    }
+    for (i = 0; i < OSS_ETAG_DIGEST_LEN; i++) {
+        hi = oss_hex_value(str[2 * i]);
+        lo = oss_hex_value(str[2 * i + 1]);
+        if (hi < 0 || lo < 0) {
+            return;
+        }
+        digest[i] = (unsigned char)((hi << 4) | lo);
+    }
+
+    // the etag of a multipart object is followed by the number of parts
+    if (len > 2 * OSS_ETAG_DIGEST_LEN) {
+        if (str[2 * OSS_ETAG_DIGEST_LEN] != '-' || len == 2 * OSS_ETAG_DIGEST_LEN + 1 || 
+            len > 2 * OSS_ETAG_DIGEST_LEN + 9) {
+            return;
+        }
+        for (i = 2 * OSS_ETAG_DIGEST_LEN + 1; i < len; i++) {
+            if (str[i] < '0' || str[i] > '9') {
+                return;
+            }
+            part_num = part_num * 10 + (str[i] - '0');
+        }
+    }
+
+    memcpy(compact->etags + (int64_t)(compact->count - 1) * OSS_ETAG_DIGEST_LEN, digest, OSS_ETAG_DIGEST_LEN);
+    compact->etag_part_nums[compact->count - 1] = part_num;
+}
+
+const char *oss_list_object_compact_key(const oss_list_object_compact_t *compact, int i)
+{
+    return compact->keys + compact->key_offsets[i];
+}
+
+int oss_list_object_compact_key_len(const oss_list_object_compact_t *compact, int i)
+{
+    int64_t end = i + 1 < compact->count ? compact->key_offsets[i + 1] : compact->keys_len;
+    return (int)(end - compact->key_offsets[i] - 1);
+}
+
+int oss_list_object_compact_etag(const oss_list_object_compact_t *compact, int i, char etag[OSS_ETAG_STRING_LEN])
+{
+    const unsigned char *digest = compact->etags + (int64_t)i * OSS_ETAG_DIGEST_LEN;
+    int len = 0;
+
+    if (compact->etag_part_nums[i] < 0) {
+        etag[0] = '\0';
+        return 0;
+    }
+    etag[len++] = '"';
+    aos_hex_encode(digest, OSS_ETAG_DIGEST_LEN, etag + len, 1);
+    len += 2 * OSS_ETAG_DIGEST_LEN;
+    if (compact->etag_part_nums[i] > 0) {
+        len += apr_snprintf(etag + len, OSS_ETAG_STRING_LEN - len - 1, "-%d", compact->etag_part_nums[i]);
+    }
+    etag[len++] = '"';
+    etag[len] = '\0';
+    return len;
+}
+
 oss_list_multipart_upload_content_t *oss_create_list_multipart_upload_content(aos_pool_t *p)
 {
     return (oss_list_multipart_upload_content_t*)oss_create_api_result_content(
@@ -520,6 +937,39 @@ oss_object_key_t *oss_create_oss_object_key(aos_pool_t *p)
     return (oss_object_key_t *)aos_pcalloc(p, sizeof(oss_object_key_t));
 }
 
+oss_delete_failed_object_t *oss_create_delete_failed_object(aos_pool_t *p)
+{
+    return (oss_delete_failed_object_t *)aos_pcalloc(p, sizeof(oss_delete_failed_object_t));
+}
+
+oss_delete_objects_by_prefix_params_t *oss_create_delete_objects_by_prefix_params(aos_pool_t *p)
+{
+    oss_delete_objects_by_prefix_params_t *params;
+    params = (oss_delete_objects_by_prefix_params_t *)aos_pcalloc(
+            p, sizeof(oss_delete_objects_by_prefix_params_t));
+    params->thread_num = OSS_DEFAULT_THREAD_NUM;
+    params->queue_num = 2 * OSS_DEFAULT_THREAD_NUM;
+    params->batch_size = OSS_PER_RET_NUM;
+    aos_list_init(&params->failed_object_list);
+    return params;
+}
+
+oss_walk_prefix_stat_t *oss_create_walk_prefix_stat(aos_pool_t *p)
+{
+    return (oss_walk_prefix_stat_t *)aos_pcalloc(p, sizeof(oss_walk_prefix_stat_t));
+}
+
+oss_parallel_walk_params_t *oss_create_parallel_walk_params(aos_pool_t *p)
+{
+    oss_parallel_walk_params_t *params;
+    params = (oss_parallel_walk_params_t *)aos_pcalloc(
+            p, sizeof(oss_parallel_walk_params_t));
+    params->thread_num = OSS_DEFAULT_THREAD_NUM;
+    aos_str_set(&params->delimiter, "/");
+    aos_list_init(&params->prefix_stat_list);
+    return params;
+}
+
 oss_live_channel_publish_url_t *oss_create_live_channel_publish_url(aos_pool_t *p)
 {
     return (oss_live_channel_publish_url_t *)aos_pcalloc(p, sizeof(oss_live_channel_publish_url_t));
@@ -629,6 +1079,19 @@ const char *get_oss_acl_str(oss_acl_e oss_acl)
     }
 }
 
+static void oss_options_create_request(const oss_request_options_t *options,
+                                       aos_http_request_t **req, 
+                                       aos_http_response_t **resp)
+{
+    if (options->ctl != NULL && options->ctl->context != NULL) {
+        *req = aos_http_request_context_request(options->ctl->context);
+        *resp = aos_http_request_context_response(options->ctl->context);
+    } else {
+        *req = aos_http_request_create(options->pool);
+        *resp = aos_http_response_create(options->pool);
+    }
+}
+
 void oss_init_request(const oss_request_options_t *options, 
                       http_method_e method,
                       aos_http_request_t **req, 
@@ -636,8 +1099,7 @@ void oss_init_request(const oss_request_options_t *options,
                       aos_table_t *headers, 
                       aos_http_response_t **resp)
 {
-    *req = aos_http_request_create(options->pool);
-    *resp = aos_http_response_create(options->pool);
+    oss_options_create_request(options, req, resp);
     (*req)->method = method;
     init_sts_token_header();
     (*req)->headers = headers;
@@ -699,8 +1161,7 @@ void oss_init_signed_url_request(const oss_request_options_t *options,
                                  aos_table_t *headers, 
                                  aos_http_response_t **resp)
 {
-    *req = aos_http_request_create(options->pool);
-    *resp = aos_http_response_create(options->pool);
+    oss_options_create_request(options, req, resp);
     (*req)->method = method;
     (*req)->headers = headers;
     (*req)->query_params = params;
@@ -715,7 +1176,11 @@ aos_status_t *oss_send_request(aos_http_controller_t *ctl,
     const char *reason;
     int res = AOSE_OK;
 
-    s = aos_status_create(ctl->pool);
+    if (ctl->context != NULL) {
+        s = aos_http_request_context_status(ctl->context);
+    } else {
+        s = aos_status_create(ctl->pool);
+    }
     res = aos_http_send_request(ctl, req, resp);
 
     if (res != AOSE_OK) {
@@ -727,13 +1192,7 @@ aos_status_t *oss_send_request(aos_http_controller_t *ctl,
         s->code = resp->status;
     }
 
-    s->req_id = (char*)(apr_table_get(resp->headers, "x-oss-request-id"));
-    if (s->req_id == NULL) {
-        s->req_id = (char*)(apr_table_get(resp->headers, "x-img-request-id"));
-        if (s->req_id == NULL) {
-            s->req_id = "";
-        }
-    }
+    s->req_id = resp->req_id != NULL ? resp->req_id : "";
 
     return s;
 }
@@ -745,9 +1204,13 @@ aos_status_t *oss_process_request(const oss_request_options_t *options,
     int res = AOSE_OK;
     aos_status_t *s;
 
-    s = aos_status_create(options->pool);
-    res = oss_sign_request(req, options->config);
+    if (options->client != NULL && options->client->config == options->config) {
+        res = oss_client_sign_request(req, options->client);
+    } else {
+        res = oss_sign_request(req, options->config);
+    }
     if (res != AOSE_OK) {
+        s = aos_status_create(options->pool);
         aos_status_set(s, res, AOS_CLIENT_ERROR_CODE, NULL);
         return s;
     }
@@ -830,7 +1293,11 @@ aos_table_t* aos_table_create_if_null(const oss_request_options_t *options,
                                       int table_size) 
 {
     if (table == NULL) {
-        table = aos_table_make(options->pool, table_size);
+        if (options->ctl != NULL && options->ctl->context != NULL) {
+            table = aos_http_request_context_table(options->ctl->context, table_size);
+        } else {
+            table = aos_table_make(options->pool, table_size);
+        }
     }
     return table;
 }
@@ -842,11 +1309,7 @@ int is_enable_crc(const oss_request_options_t *options)
 
 int has_crc_in_response(const aos_http_response_t *resp) 
 {
-    if (NULL != apr_table_get(resp->headers, OSS_HASH_CRC64_ECMA)) {
-        return AOS_TRUE;
-    }
-
-    return AOS_FALSE;
+    return resp->has_hash_crc64 ? AOS_TRUE : AOS_FALSE;
 }
 
 int has_range_or_process_in_request(const aos_http_request_t *req) 
@@ -877,6 +1340,127 @@ int oss_check_crc_consistent(uint64_t crc, const apr_table_t *resp_headers, aos_
     return res;
 }
 
+int oss_check_response_crc(uint64_t crc, const aos_http_response_t *resp, aos_status_t *s)
+{
+    if (resp->has_hash_crc64 && crc != resp->hash_crc64) {
+        aos_inconsistent_error_status_set(s, AOSE_CRC_INCONSISTENT_ERROR);
+        return AOSE_CRC_INCONSISTENT_ERROR;
+    }
+    return AOSE_OK;
+}
+
+oss_range_crc64_t *oss_create_range_crc64(aos_pool_t *p)
+{
+    oss_range_crc64_t *range_crc;
+
+    range_crc = (oss_range_crc64_t *)aos_pcalloc(p, sizeof(oss_range_crc64_t));
+    if (apr_thread_mutex_create(&range_crc->mutex, APR_THREAD_MUTEX_DEFAULT, p) != APR_SUCCESS) {
+        aos_error_log("apr_thread_mutex_create failure.");
+        return NULL;
+    }
+    range_crc->object_size = -1;
+    range_crc->parts = apr_array_make(p, 8, sizeof(oss_checkpoint_part_t));
+    range_crc->verified = AOS_FALSE;
+
+    return range_crc;
+}
+
+static int oss_parse_content_range(const char *str, int64_t *start, int64_t *end, int64_t *total)
+{
+    char *pos;
+
+    // bytes 100-199/1000
+    if (strncasecmp(str, "bytes ", 6) != 0) {
+        return AOS_FALSE;
+    }
+    *start = apr_strtoi64(str + 6, &pos, 10);
+    if (*pos++ != '-') {
+        return AOS_FALSE;
+    }
+    *end = apr_strtoi64(pos, &pos, 10);
+    if (*pos++ != '/' || !isdigit((unsigned char)*pos)) {
+        return AOS_FALSE;
+    }
+    *total = apr_strtoi64(pos, &pos, 10);
+
+    return *start >= 0 && *start <= *end && *end < *total;
+}
+
+int oss_add_range_crc64(oss_range_crc64_t *range_crc, const aos_http_response_t *resp, aos_status_t *s)
+{
+    const char *value;
+    int64_t start;
+    int64_t end;
+    int64_t total;
+    int64_t covered;
+    uint64_t srv_crc64;
+    uint64_t crc64;
+    oss_checkpoint_part_t *parts;
+    oss_checkpoint_part_t *part;
+    int res = AOSE_OK;
+    int i;
+
+    if (!resp->has_hash_crc64) {
+        return AOSE_OK;
+    }
+    srv_crc64 = resp->hash_crc64;
+
+    // a response without Content-Range carries the whole object
+    value = aos_http_response_header(resp, OSS_CONTENT_RANGE);
+    if (NULL == value) {
+        start = 0;
+        end = resp->body_len - 1;
+        total = resp->body_len;
+    } else if (!oss_parse_content_range(value, &start, &end, &total)) {
+        aos_warn_log("invalid content range %s, the crc64 is not checked.", value);
+        return AOSE_OK;
+    }
+
+    apr_thread_mutex_lock(range_crc->mutex);
+
+    if (range_crc->object_size < 0) {
+        range_crc->object_size = total;
+        range_crc->object_crc64 = srv_crc64;
+    } else if (range_crc->object_size != total || range_crc->object_crc64 != srv_crc64) {
+        // the object is overwritten between the ranges
+        apr_thread_mutex_unlock(range_crc->mutex);
+        aos_inconsistent_error_status_set(s, AOSE_CRC_INCONSISTENT_ERROR);
+        return AOSE_CRC_INCONSISTENT_ERROR;
+    }
+
+    // keep the ranges in offset order, a range fetched again replaces the old one
+    parts = (oss_checkpoint_part_t *)range_crc->parts->elts;
+    for (i = 0; i < range_crc->parts->nelts && parts[i].offset < start; i++) {
+    }
+    if (i == range_crc->parts->nelts || parts[i].offset != start) {
+        apr_array_push(range_crc->parts);
+        parts = (oss_checkpoint_part_t *)range_crc->parts->elts;
+        memmove(&parts[i + 1], &parts[i], (range_crc->parts->nelts - 1 - i) * sizeof(oss_checkpoint_part_t));
+    }
+    part = &parts[i];
+    memset(part, 0, sizeof(oss_checkpoint_part_t));
+    part->offset = start;
+    part->size = end - start + 1;
+    part->completed = AOS_TRUE;
+    part->crc64 = resp->crc64;
+
+    covered = 0;
+    for (i = 0; i < range_crc->parts->nelts && parts[i].offset == covered; i++) {
+        covered += parts[i].size;
+    }
+
+    if (i == range_crc->parts->nelts && covered == range_crc->object_size && 
+        oss_get_parts_crc64(parts, range_crc->parts->nelts, &crc64)) 
+    {
+        res = oss_check_response_crc(crc64, resp, s);
+        range_crc->verified = (AOSE_OK == res);
+    }
+
+    apr_thread_mutex_unlock(range_crc->mutex);
+
+    return res;
+}
+
 int oss_get_temporary_file_name(aos_pool_t *p, const aos_string_t *filename, aos_string_t *temp_file_name)
 {
     int len = filename->len + 1;
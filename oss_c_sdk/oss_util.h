@@ -2,11 +2,14 @@
 #define LIBOSS_UTIL_H
 
 #include "aos_string.h"
+#include "aos_util.h"
 #include "aos_transport.h"
 #include "aos_status.h"
 #include "oss_define.h"
 #include "oss_resumable.h"
 
+#include <apr_hash.h>
+
 OSS_CPP_START
 
 #define init_sts_token_header() do { \
@@ -48,6 +51,87 @@ void oss_config_resolve(aos_pool_t *pool, oss_config_t *config, aos_http_control
 **/
 oss_request_options_t *oss_request_options_create(aos_pool_t *p);
 
+/**
+  * @brief  let the options reuse one request context, the request, the
+  *         response, the status, the tables and the curl header list of a
+  *         call are allocated once and reset by oss_request_options_reset.
+  *         options->pool becomes the call pool of the context, cleared by
+  *         every reset, destroy the pool the options were created with
+  * @return AOSE_OK, AOSE_INVALID_ARGUMENT without a controller
+**/
+int oss_request_options_reuse(oss_request_options_t *options);
+
+/**
+  * @brief  reset the request context of the options between calls,
+  *         everything the last call returned is invalid afterwards
+**/
+void oss_request_options_reset(oss_request_options_t *options);
+
+#define OSS_CLIENT_BUCKET_NUM 64
+
+/**
+  * the host, uri and resource strings of one bucket, the object requests
+  * only append the object key to the prefixes
+**/
+typedef struct {
+    aos_string_t name;
+    char *host;
+    char *uri;                      /*< of the bucket requests */
+    char *resource;                 /*< of the bucket requests */
+    aos_string_t uri_prefix;        /*< "bucket/" for an ip endpoint, else empty */
+    aos_string_t resource_prefix;   /*< "bucket/" */
+} oss_client_bucket_t;
+
+/**
+  * the buckets of a client, never changed once published. a new bucket
+  * publishes a copy with the bucket appended, so lookups take no lock
+**/
+typedef struct {
+    int num;
+    oss_client_bucket_t *buckets[OSS_CLIENT_BUCKET_NUM];
+} oss_client_bucket_table_t;
+
+/**
+  * the per request derivation of a config done once: the proto and host
+  * of the endpoint, the addressing mode, the proxy strings and the hmac key
+  * state of the access key secret. The config must not change while the
+  * client is in use, a client is shared by any number of threads.
+**/
+struct oss_client_s {
+    aos_pool_t *pool;
+    oss_config_t *config;
+    char *proto;
+    aos_string_t host;                          /*< the endpoint without the proto */
+    int is_ip;
+    aos_http_request_options_t *http_options;   /*< the default options with the proxy resolved */
+    aos_hmac_sha1_key_t sign_key;
+    apr_thread_mutex_t *mutex;                  /*< taken to add a bucket only */
+    aos_pool_t *bucket_pool;                    /*< a subpool of pool for buckets, guarded by mutex */
+    oss_client_bucket_table_t * volatile bucket_table; /*< the published buckets, swapped by atomic */
+};
+
+/**
+  * @brief  create an oss client from config, allocated from p. The client
+  *         keeps the buckets in a subpool of p, p itself is not locked, so
+  *         it must not be shared with other threads while the client lives.
+  * @return the client, or NULL on failure
+**/
+oss_client_t *oss_client_create(aos_pool_t *p, oss_config_t *config);
+
+/**
+  * @brief  create oss request options using the client, the controller
+  *         uses the proxy resolved http options of the client
+  * @return oss request options
+**/
+oss_request_options_t *oss_client_request_options_create(oss_client_t *client, aos_pool_t *p);
+
+/**
+  * @brief  get the bucket strings of the client, built on the first use,
+  *         at most OSS_CLIENT_BUCKET_NUM buckets are kept
+  * @return the bucket strings, NULL when the client is full
+**/
+const oss_client_bucket_t *oss_client_get_bucket(oss_client_t *client, const aos_string_t *bucket);
+
 /**
   * @brief  init oss request
 **/
@@ -166,6 +250,28 @@ oss_list_part_content_t *oss_create_list_part_content(aos_pool_t *p);
 oss_list_multipart_upload_content_t *oss_create_list_multipart_upload_content(aos_pool_t *p);
 oss_complete_part_content_t *oss_create_complete_part_content(aos_pool_t *p);
 
+/**
+  * @brief  create the compact list results, the arrays are released with the pool
+**/
+oss_list_object_compact_t *oss_create_list_object_compact(aos_pool_t *p);
+
+/**
+  * @brief  append an object to the compact list results, the setters fill the last object
+  * @return AOSE_OK success, AOSE_OUT_MEMORY if the arrays can not grow
+**/
+int oss_list_object_compact_add(oss_list_object_compact_t *compact);
+int oss_list_object_compact_set_key(oss_list_object_compact_t *compact, const char *key, int len);
+void oss_list_object_compact_set_size(oss_list_object_compact_t *compact, const char *size);
+void oss_list_object_compact_set_last_modified(oss_list_object_compact_t *compact, const char *str, int len);
+void oss_list_object_compact_set_etag(oss_list_object_compact_t *compact, const char *str, int len);
+
+/**
+  * @brief  get the key or the quoted etag of object i of the compact list results
+**/
+const char *oss_list_object_compact_key(const oss_list_object_compact_t *compact, int i);
+int oss_list_object_compact_key_len(const oss_list_object_compact_t *compact, int i);
+int oss_list_object_compact_etag(const oss_list_object_compact_t *compact, int i, char etag[OSS_ETAG_STRING_LEN]);
+
 /**
   * @brief  create oss api list parameters
   * @return oss api list parameters
@@ -205,6 +311,30 @@ oss_lifecycle_rule_content_t *oss_create_lifecycle_rule_content(aos_pool_t *p);
 **/
 oss_object_key_t *oss_create_oss_object_key(aos_pool_t *p);
 
+/**
+  * @brief  create oss failed object content for delete objects by prefix
+  * @return oss failed object content
+**/
+oss_delete_failed_object_t *oss_create_delete_failed_object(aos_pool_t *p);
+
+/**
+  * @brief  create oss delete objects by prefix params
+  * @return oss delete objects by prefix params
+**/
+oss_delete_objects_by_prefix_params_t *oss_create_delete_objects_by_prefix_params(aos_pool_t *p);
+
+/**
+  * @brief  create oss prefix stat content for parallel walk
+  * @return oss prefix stat content
+**/
+oss_walk_prefix_stat_t *oss_create_walk_prefix_stat(aos_pool_t *p);
+
+/**
+  * @brief  create oss parallel walk params
+  * @return oss parallel walk params
+**/
+oss_parallel_walk_params_t *oss_create_parallel_walk_params(aos_pool_t *p);
+
 /**
   * @brief  create oss live channel publish url content for delete objects
   * @return oss live channel publish url content
@@ -284,6 +414,33 @@ int has_range_or_process_in_request(const aos_http_request_t *req) ;
 **/
 int oss_check_crc_consistent(uint64_t crc, const apr_table_t *resp_headers, aos_status_t *s);
 
+/**
+ * @brief check crc consistent with the crc64 header parsed from the response
+**/
+int oss_check_response_crc(uint64_t crc, const aos_http_response_t *resp, aos_status_t *s);
+
+typedef struct {
+    apr_thread_mutex_t *mutex;  // the ranges may be fetched by several threads
+    int64_t object_size;        // the object size from the first response, -1 if unknown
+    uint64_t object_crc64;      // the crc64 of object from the first response
+    aos_array_header_t *parts;  // the fetched ranges in offset order, oss_checkpoint_part_t
+    int verified;               // AOS_TRUE if the ranges cover the object and the crc64 matched
+} oss_range_crc64_t;
+
+/**
+  * @brief  create the crc64 of ranges fetched by ranged GETs
+  * @return oss range crc64, NULL if the mutex can not be created
+**/
+oss_range_crc64_t *oss_create_range_crc64(aos_pool_t *p);
+
+/**
+  * @brief  add the crc64 of a ranged GET response, the range is taken from Content-Range. 
+  *         once the ranges cover the object, they are combined in offset order and
+  *         checked with x-oss-hash-crc64ecma. overlapped ranges are never combined.
+  * @return AOSE_OK, AOSE_CRC_INCONSISTENT_ERROR if the crc64 or the object changed
+**/
+int oss_add_range_crc64(oss_range_crc64_t *range_crc, const aos_http_response_t *resp, aos_status_t *s);
+
 int oss_get_temporary_file_name(aos_pool_t *p, const aos_string_t *filename, aos_string_t *temp_file_name);
 
 int oss_temp_file_rename(aos_status_t *s, const char *from_path, const char *to_path, apr_pool_t *pool);
@@ -47,6 +47,84 @@ char* new_xml_buff(mxml_node_t *doc)
     return (s);
 }
 
+static const char oss_xml_declaration[] = "<?xml version=\"1.0\" encoding=\"utf-8\"?>";
+
+void oss_xml_writer_alloc(aos_pool_t *p, oss_xml_writer_t *w)
+{
+    w->buf = (char *)aos_palloc(p, (apr_size_t)w->len + 1);
+    w->len = 0;
+}
+
+void oss_xml_write_raw(oss_xml_writer_t *w, const char *data, int64_t len)
+{
+    if (NULL != w->buf && len > 0) {
+        memcpy(w->buf + w->len, data, (size_t)len);
+    }
+    w->len += len;
+}
+
+void oss_xml_write_escaped(oss_xml_writer_t *w, const char *data, int64_t len)
+{
+    const char *end = data + len;
+    const char *run = data;
+    const char *entity;
+
+    for (; data < end; data++) {
+        switch (*data) {
+        case '&':
+            entity = "&amp;";
+            break;
+        case '<':
+            entity = "&lt;";
+            break;
+        case '>':
+            entity = "&gt;";
+            break;
+        case '"':
+            entity = "&quot;";
+            break;
+        default:
+            continue;
+        }
+        oss_xml_write_raw(w, run, data - run);
+        oss_xml_write_raw(w, entity, strlen(entity));
+        run = data + 1;
+    }
+    oss_xml_write_raw(w, run, end - run);
+}
+
+void oss_xml_write_start(oss_xml_writer_t *w, const char *name)
+{
+    oss_xml_write_raw(w, "<", 1);
+    oss_xml_write_raw(w, name, strlen(name));
+    oss_xml_write_raw(w, ">", 1);
+}
+
+void oss_xml_write_end(oss_xml_writer_t *w, const char *name)
+{
+    oss_xml_write_raw(w, "</", 2);
+    oss_xml_write_raw(w, name, strlen(name));
+    oss_xml_write_raw(w, ">", 1);
+}
+
+void oss_xml_write_str(oss_xml_writer_t *w, const char *name, const char *value, int64_t len)
+{
+    oss_xml_write_start(w, name);
+    if (NULL != value) {
+        oss_xml_write_escaped(w, value, len);
+    }
+    oss_xml_write_end(w, name);
+}
+
+void oss_xml_write_int64(oss_xml_writer_t *w, const char *name, int64_t value)
+{
+    char buff[AOS_MAX_INT64_STRING_LEN];
+    int len;
+
+    len = apr_snprintf(buff, AOS_MAX_INT64_STRING_LEN, "%" APR_INT64_T_FMT, value);
+    oss_xml_write_str(w, name, buff, len);
+}
+
 int get_xmldoc(aos_list_t *bc, mxml_node_t **root)
 {
     int res;
@@ -205,33 +283,455 @@ void oss_list_objects_common_prefix_parse(aos_pool_t *p, mxml_node_t *xml_node,
     }
 }
 
+#define OSS_XML_STATE_TEXT       0
+#define OSS_XML_STATE_TAG_START  1
+#define OSS_XML_STATE_TAG        2
+#define OSS_XML_STATE_SKIP       3
+
+#define OSS_LIST_CONTEXT_NONE      0
+#define OSS_LIST_CONTEXT_CONTENTS  1
+#define OSS_LIST_CONTEXT_OWNER     2
+#define OSS_LIST_CONTEXT_PREFIXES  3
+
+#define OSS_LIST_FIELD_NONE           0
+#define OSS_LIST_FIELD_KEY            1
+#define OSS_LIST_FIELD_LAST_MODIFIED  2
+#define OSS_LIST_FIELD_ETAG           3
+#define OSS_LIST_FIELD_SIZE           4
+
+static int oss_xml_unescape(char *dst, const char *src, int len);
+static void oss_list_objects_parser_append(oss_list_objects_parser_t *parser, const char *data, int len);
+static void oss_list_objects_parser_set_value(oss_list_objects_parser_t *parser, const char *data, int len);
+static void oss_list_objects_parser_set_field(oss_list_objects_parser_t *parser, const char *data, int len);
+static void oss_list_objects_parser_start_field(oss_list_objects_parser_t *parser);
+static void oss_list_objects_parser_start_element(oss_list_objects_parser_t *parser);
+static void oss_list_objects_parser_end_element(oss_list_objects_parser_t *parser);
+
+int oss_xml_unescape(char *dst, const char *src, int len)
+{
+    const char *end = src + len;
+    const char *amp;
+    const char *semi;
+    char *d = dst;
+    unsigned long code;
+    char *stop;
+
+    while (src < end) {
+        amp = memchr(src, '&', end - src);
+        if (NULL == amp) {
+            memcpy(d, src, end - src);
+            d += end - src;
+            break;
+        }
+        memcpy(d, src, amp - src);
+        d += amp - src;
+        src = amp;
+
+        semi = memchr(amp, ';', aos_min(end - amp, 12));
+        if (NULL == semi) {
+            *d++ = *src++;
+            continue;
+        }
+        if (semi - amp == 3 && strncmp(amp, "&lt;", 4) == 0) {
+            *d++ = '<';
+        } else if (semi - amp == 3 && strncmp(amp, "&gt;", 4) == 0) {
+            *d++ = '>';
+        } else if (semi - amp == 4 && strncmp(amp, "&amp;", 5) == 0) {
+            *d++ = '&';
+        } else if (semi - amp == 5 && strncmp(amp, "&quot;", 6) == 0) {
+            *d++ = '"';
+        } else if (semi - amp == 5 && strncmp(amp, "&apos;", 6) == 0) {
+            *d++ = '\'';
+        } else if (amp[1] == '#') {
+            // strtoul would take spaces and a sign, the digits start right away
+            if ((amp[2] == 'x' || amp[2] == 'X') && isxdigit((unsigned char)amp[3])) {
+                code = strtoul(amp + 3, &stop, 16);
+            } else if (isdigit((unsigned char)amp[2])) {
+                code = strtoul(amp + 2, &stop, 10);
+            } else {
+                stop = NULL;
+                code = 0;
+            }
+            // surrogates are not characters, they have no utf-8 encoding
+            if (stop != semi || code == 0 || code > 0x10FFFF || (code >= 0xD800 && code <= 0xDFFF)) {
+                *d++ = *src++;
+                continue;
+            }
+            // utf-8, the encoded length never exceeds the length of the reference
+            if (code < 0x80) {
+                *d++ = (char)code;
+            } else if (code < 0x800) {
+                *d++ = (char)(0xC0 | (code >> 6));
+                *d++ = (char)(0x80 | (code & 0x3F));
+            } else if (code < 0x10000) {
+                *d++ = (char)(0xE0 | (code >> 12));
+                *d++ = (char)(0x80 | ((code >> 6) & 0x3F));
+                *d++ = (char)(0x80 | (code & 0x3F));
+            } else {
+                *d++ = (char)(0xF0 | (code >> 18));
+                *d++ = (char)(0x80 | ((code >> 12) & 0x3F));
+                *d++ = (char)(0x80 | ((code >> 6) & 0x3F));
+                *d++ = (char)(0x80 | (code & 0x3F));
+            }
+        } else {
+            *d++ = *src++;
+            continue;
+        }
+        src = semi + 1;
+    }
+
+    return d - dst;
+}
+
+oss_list_objects_parser_t *oss_create_list_objects_parser(aos_pool_t *p, aos_list_t *object_list,
+    aos_list_t *common_prefix_list, aos_string_t *marker, int *truncated)
+{
+    oss_list_objects_parser_t *parser;
+
+    parser = (oss_list_objects_parser_t *)aos_pcalloc(p, sizeof(oss_list_objects_parser_t));
+    parser->pool = p;
+    parser->object_list = object_list;
+    parser->common_prefix_list = common_prefix_list;
+    parser->marker = marker;
+    parser->truncated = truncated;
+    parser->object_tail = NULL == object_list ? NULL : object_list->prev;
+    parser->prefix_tail = common_prefix_list->prev;
+    parser->saved_marker = *marker;
+    parser->state = OSS_XML_STATE_TEXT;
+    parser->context = OSS_LIST_CONTEXT_NONE;
+    *truncated = 0;
+
+    return parser;
+}
+
+oss_list_objects_parser_t *oss_create_list_objects_compact_parser(aos_pool_t *p, 
+    oss_list_object_compact_t *compact, aos_list_t *common_prefix_list, 
+    aos_string_t *marker, int *truncated)
+{
+    oss_list_objects_parser_t *parser;
+
+    parser = oss_create_list_objects_parser(p, NULL, common_prefix_list, marker, truncated);
+    parser->compact = compact;
+    parser->compact_count = compact->count;
+    parser->compact_keys_len = compact->keys_len;
+
+    return parser;
+}
+
+void oss_list_objects_parser_append(oss_list_objects_parser_t *parser, const char *data, int len)
+{
+    char *text;
+    int cap;
+
+    if (parser->text_len + len > parser->text_cap) {
+        cap = aos_max(parser->text_cap * 2, parser->text_len + len);
+        cap = aos_max(cap, 256);
+        text = (char *)aos_palloc(parser->pool, cap);
+        if (parser->text_len > 0) {
+            memcpy(text, parser->text, parser->text_len);
+        }
+        parser->text = text;
+        parser->text_cap = cap;
+    }
+    memcpy(parser->text + parser->text_len, data, len);
+    parser->text_len += len;
+}
+
+void oss_list_objects_parser_set_value(oss_list_objects_parser_t *parser, const char *data, int len)
+{
+    char *value;
+
+    if (parser->text_len > 0) {
+        oss_list_objects_parser_append(parser, data, len);
+        data = parser->text;
+        len = parser->text_len;
+    }
+    if (parser->target == &parser->compact_field) {
+        oss_list_objects_parser_set_field(parser, data, len);
+    } else if (len > 0) {
+        value = (char *)aos_palloc(parser->pool, len + 1);
+        parser->target->len = oss_xml_unescape(value, data, len);
+        value[parser->target->len] = '\0';
+        parser->target->data = value;
+        if (parser->target == &parser->is_truncated) {
+            *parser->truncated = strcasecmp(value, "false") == 0 ? 0 : 1;
+        }
+    }
+    parser->text_len = 0;
+    parser->target = NULL;
+}
+
+void oss_list_objects_parser_set_field(oss_list_objects_parser_t *parser, const char *data, int len)
+{
+    oss_list_object_compact_t *compact = parser->compact;
+
+    // the decoded text is copied by the setters, so a buffer serves all the fields
+    if (len + 1 > parser->field_cap) {
+        parser->field_cap = aos_max(len + 1, 256);
+        parser->field_buf = (char *)aos_palloc(parser->pool, parser->field_cap);
+    }
+    len = oss_xml_unescape(parser->field_buf, data, len);
+    parser->field_buf[len] = '\0';
+
+    switch (parser->field) {
+    case OSS_LIST_FIELD_KEY:
+        if (oss_list_object_compact_set_key(compact, parser->field_buf, len) != AOSE_OK) {
+            parser->error = AOSE_OUT_MEMORY;
+        }
+        break;
+    case OSS_LIST_FIELD_LAST_MODIFIED:
+        oss_list_object_compact_set_last_modified(compact, parser->field_buf, len);
+        break;
+    case OSS_LIST_FIELD_ETAG:
+        oss_list_object_compact_set_etag(compact, parser->field_buf, len);
+        break;
+    case OSS_LIST_FIELD_SIZE:
+        oss_list_object_compact_set_size(compact, parser->field_buf);
+        break;
+    default:
+        break;
+    }
+    parser->field = OSS_LIST_FIELD_NONE;
+}
+
+void oss_list_objects_parser_start_field(oss_list_objects_parser_t *parser)
+{
+    const char *name = parser->name;
+
+    parser->field = OSS_LIST_FIELD_NONE;
+    if (strcmp(name, "Key") == 0) {
+        parser->field = OSS_LIST_FIELD_KEY;
+    } else if (strcmp(name, "LastModified") == 0) {
+        parser->field = OSS_LIST_FIELD_LAST_MODIFIED;
+    } else if (strcmp(name, "ETag") == 0) {
+        parser->field = OSS_LIST_FIELD_ETAG;
+    } else if (strcmp(name, "Size") == 0) {
+        parser->field = OSS_LIST_FIELD_SIZE;
+    } else if (strcmp(name, "Owner") == 0) {
+        parser->context = OSS_LIST_CONTEXT_OWNER;
+    }
+    if (parser->field != OSS_LIST_FIELD_NONE) {
+        parser->target = &parser->compact_field;
+    }
+}
+
+void oss_list_objects_parser_start_element(oss_list_objects_parser_t *parser)
+{
+    const char *name = parser->name;
+
+    parser->depth++;
+    parser->has_root = AOS_TRUE;
+    parser->target = NULL;
+    parser->text_len = 0;
+
+    if (parser->depth == 2) {
+        if (strcmp(name, "Contents") == 0 && NULL != parser->compact) {
+            if (oss_list_object_compact_add(parser->compact) != AOSE_OK) {
+                parser->error = AOSE_OUT_MEMORY;
+            }
+            parser->context = OSS_LIST_CONTEXT_CONTENTS;
+        } else if (strcmp(name, "Contents") == 0) {
+            parser->content = oss_create_list_object_content(parser->pool);
+            parser->context = OSS_LIST_CONTEXT_CONTENTS;
+        } else if (strcmp(name, "CommonPrefixes") == 0) {
+            parser->common_prefix = oss_create_list_object_common_prefix(parser->pool);
+            parser->context = OSS_LIST_CONTEXT_PREFIXES;
+        } else if (strcmp(name, "NextMarker") == 0) {
+            parser->target = parser->marker;
+        } else if (strcmp(name, "IsTruncated") == 0) {
+            parser->target = &parser->is_truncated;
+        }
+    } else if (parser->depth == 3 && parser->context == OSS_LIST_CONTEXT_CONTENTS && NULL != parser->compact) {
+        oss_list_objects_parser_start_field(parser);
+    } else if (parser->depth == 3 && parser->context == OSS_LIST_CONTEXT_CONTENTS) {
+        if (strcmp(name, "Key") == 0) {
+            parser->target = &parser->content->key;
+        } else if (strcmp(name, "LastModified") == 0) {
+            parser->target = &parser->content->last_modified;
+        } else if (strcmp(name, "ETag") == 0) {
+            parser->target = &parser->content->etag;
+        } else if (strcmp(name, "Size") == 0) {
+            parser->target = &parser->content->size;
+        } else if (strcmp(name, "Owner") == 0) {
+            parser->context = OSS_LIST_CONTEXT_OWNER;
+        }
+    } else if (parser->depth == 3 && parser->context == OSS_LIST_CONTEXT_PREFIXES) {
+        if (strcmp(name, "Prefix") == 0) {
+            parser->target = &parser->common_prefix->prefix;
+        }
+    } else if (parser->depth == 4 && parser->context == OSS_LIST_CONTEXT_OWNER && NULL == parser->compact) {
+        if (strcmp(name, "ID") == 0) {
+            parser->target = &parser->content->owner_id;
+        } else if (strcmp(name, "DisplayName") == 0) {
+            parser->target = &parser->content->owner_display_name;
+        }
+    }
+}
+
+void oss_list_objects_parser_end_element(oss_list_objects_parser_t *parser)
+{
+    if (parser->depth == 2 && parser->context == OSS_LIST_CONTEXT_CONTENTS) {
+        if (NULL == parser->compact) {
+            aos_list_add_tail(&parser->content->node, parser->object_list);
+        }
+        parser->context = OSS_LIST_CONTEXT_NONE;
+    } else if (parser->depth == 2 && parser->context == OSS_LIST_CONTEXT_PREFIXES) {
+        aos_list_add_tail(&parser->common_prefix->node, parser->common_prefix_list);
+        parser->context = OSS_LIST_CONTEXT_NONE;
+    } else if (parser->depth == 3 && parser->context == OSS_LIST_CONTEXT_OWNER) {
+        parser->context = OSS_LIST_CONTEXT_CONTENTS;
+    }
+
+    parser->target = NULL;
+    parser->text_len = 0;
+    if (--parser->depth < 0) {
+        parser->error = AOSE_XML_PARSE_ERROR;
+    }
+}
+
+int oss_list_objects_parser_feed(oss_list_objects_parser_t *parser, const char *data, int len)
+{
+    const char *p = data;
+    const char *end = data + len;
+    const char *lt;
+    char c;
+
+    while (p < end && parser->error == AOSE_OK) {
+        switch (parser->state) {
+        case OSS_XML_STATE_TEXT:
+            lt = memchr(p, '<', end - p);
+            if (NULL == lt) {
+                if (NULL != parser->target) {
+                    oss_list_objects_parser_append(parser, p, end - p);
+                }
+                return AOSE_OK;
+            }
+            if (NULL != parser->target) {
+                oss_list_objects_parser_set_value(parser, p, lt - p);
+            }
+            p = lt + 1;
+            parser->state = OSS_XML_STATE_TAG_START;
+            break;
+        case OSS_XML_STATE_TAG_START:
+            parser->closing = AOS_FALSE;
+            parser->self_closing = AOS_FALSE;
+            parser->name_done = AOS_FALSE;
+            parser->name_len = 0;
+            parser->quote = '\0';
+            if (*p == '?' || *p == '!') {
+                // xml declaration, comments and cdata are not expected in the body
+                parser->state = OSS_XML_STATE_SKIP;
+                p++;
+                break;
+            }
+            if (*p == '/') {
+                parser->closing = AOS_TRUE;
+                p++;
+            }
+            parser->state = OSS_XML_STATE_TAG;
+            break;
+        case OSS_XML_STATE_TAG:
+            c = *p++;
+            if (parser->quote != '\0') {
+                if (c == parser->quote) {
+                    parser->quote = '\0';
+                }
+            } else if (c == '>') {
+                parser->name[parser->name_len] = '\0';
+                if (parser->closing) {
+                    oss_list_objects_parser_end_element(parser);
+                } else {
+                    oss_list_objects_parser_start_element(parser);
+                    if (parser->self_closing) {
+                        oss_list_objects_parser_end_element(parser);
+                    }
+                }
+                parser->state = OSS_XML_STATE_TEXT;
+            } else if (c == '"' || c == '\'') {
+                parser->quote = c;
+                parser->name_done = AOS_TRUE;
+                parser->self_closing = AOS_FALSE;
+            } else if (c == '/') {
+                parser->name_done = AOS_TRUE;
+                parser->self_closing = AOS_TRUE;
+            } else if (aos_is_space_or_cntrl(c)) {
+                parser->name_done = parser->name_len > 0;
+                parser->self_closing = AOS_FALSE;
+            } else {
+                if (!parser->name_done && parser->name_len < (int)sizeof(parser->name) - 1) {
+                    parser->name[parser->name_len++] = c;
+                }
+                parser->name_done = parser->name_done || parser->name_len == (int)sizeof(parser->name) - 1;
+                parser->self_closing = AOS_FALSE;
+            }
+            break;
+        default:
+            lt = memchr(p, '>', end - p);
+            if (NULL == lt) {
+                return AOSE_OK;
+            }
+            p = lt + 1;
+            parser->state = OSS_XML_STATE_TEXT;
+            break;
+        }
+    }
+
+    return parser->error;
+}
+
+int oss_list_objects_parser_finish(oss_list_objects_parser_t *parser)
+{
+    if (parser->error != AOSE_OK || !parser->has_root || parser->depth != 0 || 
+        parser->state != OSS_XML_STATE_TEXT) {
+        oss_list_objects_parser_rollback(parser);
+        return AOSE_XML_PARSE_ERROR;
+    }
+    return AOSE_OK;
+}
+
+void oss_list_objects_parser_rollback(oss_list_objects_parser_t *parser)
+{
+    // the nodes after the tails live in the pool, they are only unlinked
+    if (NULL != parser->object_list) {
+        parser->object_tail->next = parser->object_list;
+        parser->object_list->prev = parser->object_tail;
+    }
+    if (NULL != parser->compact) {
+        parser->compact->count = parser->compact_count;
+        parser->compact->keys_len = parser->compact_keys_len;
+    }
+    parser->prefix_tail->next = parser->common_prefix_list;
+    parser->common_prefix_list->prev = parser->prefix_tail;
+    *parser->marker = parser->saved_marker;
+    *parser->truncated = 0;
+}
+
+int oss_write_list_objects_body(aos_http_response_t *resp, const char *buffer, int len)
+{
+    if (oss_list_objects_parser_feed((oss_list_objects_parser_t *)resp->user_data, buffer, len) != AOSE_OK) {
+        return -1;
+    }
+    resp->body_len += len;
+    return len;
+}
+
 int oss_list_objects_parse_from_body(aos_pool_t *p, aos_list_t *bc,
     aos_list_t *object_list, aos_list_t *common_prefix_list, aos_string_t *marker, int *truncated)
 {
+    oss_list_objects_parser_t *parser;
+    aos_buf_t *b;
     int res;
-    mxml_node_t *root;
-    const char next_marker_xml_path[] = "NextMarker";
-    const char truncated_xml_path[] = "IsTruncated";
-    const char buckets_xml_path[] = "Contents";
-    const char common_prefix_xml_path[] = "CommonPrefixes";
-    char* next_marker;
 
-    res = get_xmldoc(bc, &root);
-    if (res == AOSE_OK) {
-        next_marker = get_xmlnode_value(p, root, next_marker_xml_path);
-        if (next_marker) {
-            aos_str_set(marker, next_marker);
+    parser = oss_create_list_objects_parser(p, object_list, common_prefix_list, marker, truncated);
+    aos_list_for_each_entry(aos_buf_t, b, bc, node) {
+        res = oss_list_objects_parser_feed(parser, (char *)b->pos, aos_buf_size(b));
+        if (res != AOSE_OK) {
+            oss_list_objects_parser_rollback(parser);
+            return res;
         }
-
-        *truncated = get_truncated_from_xml(p, root, truncated_xml_path);
-        
-        oss_list_objects_contents_parse(p, root, buckets_xml_path, object_list);
-        oss_list_objects_common_prefix_parse(p, root, common_prefix_xml_path, common_prefix_list);
-
-        mxmlDelete(root);
     }
-    
-    return res;
+
+    return oss_list_objects_parser_finish(parser);
 }
 
 int oss_upload_id_parse_from_body(aos_pool_t *p, aos_list_t *bc, aos_string_t *upload_id)
@@ -253,6 +753,25 @@ int oss_upload_id_parse_from_body(aos_pool_t *p, aos_list_t *bc, aos_string_t *u
     return res;
 }
 
+int oss_copy_part_result_parse_from_body(aos_pool_t *p, aos_list_t *bc, aos_string_t *etag)
+{
+    int res;
+    mxml_node_t *root;
+    const char xml_path[] = "ETag";
+    char *value;
+
+    res = get_xmldoc(bc, &root);
+    if (res == AOSE_OK) {
+        value = get_xmlnode_value(p, root, xml_path);
+        if (value) {
+            aos_str_set(etag, value);
+        }
+        mxmlDelete(root);
+    }
+
+    return res;
+}
+
 void oss_list_parts_contents_parse(aos_pool_t *p, mxml_node_t *root, const char *xml_path, 
     aos_list_t *part_list)
 {
@@ -415,36 +934,33 @@ int oss_list_multipart_uploads_parse_from_body(aos_pool_t *p, aos_list_t *bc,
     return res;
 }
 
-char *build_complete_multipart_upload_xml(aos_pool_t *p, aos_list_t *bc)
+static void oss_write_complete_multipart_upload_xml(oss_xml_writer_t *w, aos_list_t *bc)
 {
-    char *xml_buff;
-    char *complete_part_xml;
-    aos_string_t xml_doc;
-    mxml_node_t *doc;
-    mxml_node_t *root_node;
     oss_complete_part_content_t *content;
 
-    doc = mxmlNewXML("1.0");
-    root_node = mxmlNewElement(doc, "CompleteMultipartUpload");
+    oss_xml_write_raw(w, oss_xml_declaration, sizeof(oss_xml_declaration) - 1);
+    oss_xml_write_start(w, "CompleteMultipartUpload");
     aos_list_for_each_entry(oss_complete_part_content_t, content, bc, node) {
-        mxml_node_t *part_node = mxmlNewElement(root_node, "Part");
-        mxml_node_t *part_number_node = mxmlNewElement(part_node, "PartNumber");
-        mxml_node_t *etag_node = mxmlNewElement(part_node, "ETag");
-        mxmlNewText(part_number_node, 0, content->part_number.data);
-        mxmlNewText(etag_node, 0, content->etag.data);
-    }
-    
-    xml_buff = new_xml_buff(doc);
-    if (xml_buff == NULL) {
-        return NULL;
+        oss_xml_write_start(w, "Part");
+        oss_xml_write_str(w, "PartNumber", content->part_number.data, content->part_number.len);
+        oss_xml_write_str(w, "ETag", content->etag.data, content->etag.len);
+        oss_xml_write_end(w, "Part");
     }
-    aos_str_set(&xml_doc, xml_buff);
-    complete_part_xml = aos_pstrdup(p, &xml_doc);
+    oss_xml_write_end(w, "CompleteMultipartUpload");
+    oss_xml_write_raw(w, "\n", 1);
+}
 
-    free(xml_buff);
-    mxmlDelete(doc);
+char *build_complete_multipart_upload_xml(aos_pool_t *p, aos_list_t *bc)
+{
+    oss_xml_writer_t w = {NULL, 0};
 
-    return complete_part_xml;
+    // measure first, then write into a buffer of the exact size
+    oss_write_complete_multipart_upload_xml(&w, bc);
+    oss_xml_writer_alloc(p, &w);
+    oss_write_complete_multipart_upload_xml(&w, bc);
+    w.buf[w.len] = '\0';
+
+    return w.buf;
 }
 
 void build_complete_multipart_upload_body(aos_pool_t *p, aos_list_t *part_list, aos_list_t *body)
@@ -1181,37 +1697,32 @@ int oss_live_channel_history_parse_from_body(aos_pool_t *p, aos_list_t *bc, aos_
     return res;
 }
 
-char *build_objects_xml(aos_pool_t *p, aos_list_t *object_list, const char *quiet)
+static void oss_write_objects_xml(oss_xml_writer_t *w, aos_list_t *object_list, const char *quiet)
 {
-    char *object_xml;
-    char *xml_buff;
-    aos_string_t xml_doc;
-    mxml_node_t *doc;
-    mxml_node_t *root_node;
     oss_object_key_t *content;
-    mxml_node_t *quiet_node;
 
-    doc = mxmlNewXML("1.0");
-    root_node = mxmlNewElement(doc, "Delete");
-    quiet_node = mxmlNewElement(root_node, "Quiet");
-    mxmlNewText(quiet_node, 0, quiet);
+    oss_xml_write_raw(w, oss_xml_declaration, sizeof(oss_xml_declaration) - 1);
+    oss_xml_write_start(w, "Delete");
+    oss_xml_write_str(w, "Quiet", quiet, strlen(quiet));
     aos_list_for_each_entry(oss_object_key_t, content, object_list, node) {
-        mxml_node_t *object_node = mxmlNewElement(root_node, "Object");
-        mxml_node_t *key_node = mxmlNewElement(object_node, "Key");
-        mxmlNewText(key_node, 0, content->key.data);
+        oss_xml_write_start(w, "Object");
+        oss_xml_write_str(w, "Key", content->key.data, content->key.len);
+        oss_xml_write_end(w, "Object");
     }
+    oss_xml_write_end(w, "Delete");
+    oss_xml_write_raw(w, "\n", 1);
+}
 
-    xml_buff = new_xml_buff(doc);
-    if (xml_buff == NULL) {
-        return NULL;
-    }
-    aos_str_set(&xml_doc, xml_buff);
-    object_xml = aos_pstrdup(p, &xml_doc);
+char *build_objects_xml(aos_pool_t *p, aos_list_t *object_list, const char *quiet)
+{
+    oss_xml_writer_t w = {NULL, 0};
 
-    free(xml_buff);
-    mxmlDelete(doc);
+    oss_write_objects_xml(&w, object_list, quiet);
+    oss_xml_writer_alloc(p, &w);
+    oss_write_objects_xml(&w, object_list, quiet);
+    w.buf[w.len] = '\0';
 
-    return object_xml;
+    return w.buf;
 }
 
 void build_delete_objects_body(aos_pool_t *p, aos_list_t *object_list, int is_quiet, aos_list_t *body)
@@ -1286,82 +1797,70 @@ int get_xmlnode_value_int64(aos_pool_t *p, mxml_node_t *xml_node, const char *xm
     return AOS_TRUE;
 }
 
-char *oss_build_checkpoint_xml(aos_pool_t *p, const oss_checkpoint_t *checkpoint)
+static void oss_write_checkpoint_xml(oss_xml_writer_t *w, const oss_checkpoint_t *checkpoint)
 {
-    char *checkpoint_xml;
-    char *xml_buff;
-    aos_string_t xml_doc;
-    mxml_node_t *doc;
-    mxml_node_t *root_node;
-    mxml_node_t *local_node;
-    mxml_node_t *object_node;
-    mxml_node_t *cpparts_node;
-    mxml_node_t *parts_node;
-    int i = 0;
+    int i;
 
-    doc = mxmlNewXML("1.0");
-    root_node = mxmlNewElement(doc, "Checkpoint");
+    oss_xml_write_raw(w, oss_xml_declaration, sizeof(oss_xml_declaration) - 1);
+    oss_xml_write_start(w, "Checkpoint");
 
     // MD5
-    set_xmlnode_value_str(root_node, "MD5", &checkpoint->md5);
+    oss_xml_write_str(w, "MD5", checkpoint->md5.data, checkpoint->md5.len);
 
     // Type
-    set_xmlnode_value_int(root_node, "Type", checkpoint->cp_type);
+    oss_xml_write_int64(w, "Type", checkpoint->cp_type);
 
     // LocalFile
-    local_node = mxmlNewElement(root_node, "LocalFile");
-    // LocalFile.Path
-    set_xmlnode_value_str(local_node, "Path", &checkpoint->file_path);
-    // LocalFile.Size
-    set_xmlnode_value_int64(local_node, "Size", checkpoint->file_size);
-    // LocalFile.LastModified
-    set_xmlnode_value_int64(local_node, "LastModified", checkpoint->file_last_modified);
-    // LocalFile.MD5
-    set_xmlnode_value_str(local_node, "MD5", &checkpoint->file_md5);
+    oss_xml_write_start(w, "LocalFile");
+    oss_xml_write_str(w, "Path", checkpoint->file_path.data, checkpoint->file_path.len);
+    oss_xml_write_int64(w, "Size", checkpoint->file_size);
+    oss_xml_write_int64(w, "LastModified", checkpoint->file_last_modified);
+    oss_xml_write_str(w, "MD5", checkpoint->file_md5.data, checkpoint->file_md5.len);
+    oss_xml_write_end(w, "LocalFile");
 
     // Object
-    object_node = mxmlNewElement(root_node, "Object");
-    // Object.Key
-    set_xmlnode_value_str(object_node, "Key", &checkpoint->object_name);
-    // Object.Size
-    set_xmlnode_value_int64(object_node, "Size", checkpoint->object_size);
-    // Object.LastModified
-    set_xmlnode_value_str(object_node, "LastModified", &checkpoint->object_last_modified);
-    // Object.ETag
-    set_xmlnode_value_str(object_node, "ETag", &checkpoint->object_etag);
+    oss_xml_write_start(w, "Object");
+    oss_xml_write_str(w, "Key", checkpoint->object_name.data, checkpoint->object_name.len);
+    oss_xml_write_int64(w, "Size", checkpoint->object_size);
+    oss_xml_write_str(w, "LastModified", checkpoint->object_last_modified.data, 
+                      checkpoint->object_last_modified.len);
+    oss_xml_write_str(w, "ETag", checkpoint->object_etag.data, checkpoint->object_etag.len);
+    oss_xml_write_end(w, "Object");
 
     // UploadId
-    set_xmlnode_value_str(root_node, "UploadId", &checkpoint->upload_id);
+    oss_xml_write_str(w, "UploadId", checkpoint->upload_id.data, checkpoint->upload_id.len);
 
     // CpParts
-    cpparts_node = mxmlNewElement(root_node, "CPParts");
-    // CpParts.Number
-    set_xmlnode_value_int(cpparts_node, "Number", checkpoint->part_num);
-    // CpParts.Size
-    set_xmlnode_value_int64(cpparts_node, "Size", checkpoint->part_size);
-    // CpParts.Parts
-    parts_node = mxmlNewElement(cpparts_node, "Parts");
+    oss_xml_write_start(w, "CPParts");
+    oss_xml_write_int64(w, "Number", checkpoint->part_num);
+    oss_xml_write_int64(w, "Size", checkpoint->part_size);
+    oss_xml_write_start(w, "Parts");
     for (i = 0; i < checkpoint->part_num; i++) {
-        mxml_node_t *part_node = mxmlNewElement(parts_node, "Part");
-        set_xmlnode_value_int(part_node, "Index", checkpoint->parts[i].index);
-        set_xmlnode_value_int64(part_node, "Offset", checkpoint->parts[i].offset);
-        set_xmlnode_value_int64(part_node, "Size", checkpoint->parts[i].size);
-        set_xmlnode_value_int(part_node, "Completed", checkpoint->parts[i].completed);
-        set_xmlnode_value_str(part_node, "ETag", &checkpoint->parts[i].etag);
-    }
+        oss_xml_write_start(w, "Part");
+        oss_xml_write_int64(w, "Index", checkpoint->parts[i].index);
+        oss_xml_write_int64(w, "Offset", checkpoint->parts[i].offset);
+        oss_xml_write_int64(w, "Size", checkpoint->parts[i].size);
+        oss_xml_write_int64(w, "Completed", checkpoint->parts[i].completed);
+        oss_xml_write_str(w, "ETag", checkpoint->parts[i].etag.data, checkpoint->parts[i].etag.len);
+        oss_xml_write_end(w, "Part");
+    }
+    oss_xml_write_end(w, "Parts");
+    oss_xml_write_end(w, "CPParts");
+
+    oss_xml_write_end(w, "Checkpoint");
+    oss_xml_write_raw(w, "\n", 1);
+}
 
-    // dump
-    xml_buff = new_xml_buff(doc);
-    if (xml_buff == NULL) {
-        return NULL;
-    }
-    aos_str_set(&xml_doc, xml_buff);
-    checkpoint_xml = aos_pstrdup(p, &xml_doc);
+char *oss_build_checkpoint_xml(aos_pool_t *p, const oss_checkpoint_t *checkpoint)
+{
+    oss_xml_writer_t w = {NULL, 0};
 
-    free(xml_buff);
-    mxmlDelete(doc);
+    oss_write_checkpoint_xml(&w, checkpoint);
+    oss_xml_writer_alloc(p, &w);
+    oss_write_checkpoint_xml(&w, checkpoint);
+    w.buf[w.len] = '\0';
 
-    return checkpoint_xml;
+    return w.buf;
 }
 
 int oss_checkpoint_parse_from_body(aos_pool_t *p, const char *xml_body, oss_checkpoint_t *checkpoint)
@@ -16,6 +16,23 @@ OSS_CPP_START
 int get_xmldoc(aos_list_t *bc, mxml_node_t **root);
 char *get_xmlnode_value(aos_pool_t *p, mxml_node_t * root, const char *xml_path);
 
+/**
+  * @brief  xml writer writing the escaped body straight into a buffer, 
+  *         a writer without buffer only measures the length of the body
+**/
+typedef struct {
+    char *buf;
+    int64_t len;
+} oss_xml_writer_t;
+
+void oss_xml_writer_alloc(aos_pool_t *p, oss_xml_writer_t *w);
+void oss_xml_write_raw(oss_xml_writer_t *w, const char *data, int64_t len);
+void oss_xml_write_escaped(oss_xml_writer_t *w, const char *data, int64_t len);
+void oss_xml_write_start(oss_xml_writer_t *w, const char *name);
+void oss_xml_write_end(oss_xml_writer_t *w, const char *name);
+void oss_xml_write_str(oss_xml_writer_t *w, const char *name, const char *value, int64_t len);
+void oss_xml_write_int64(oss_xml_writer_t *w, const char *name, int64_t value);
+
 /**
   * @brief  build xml body for complete_multipart_upload
 **/
@@ -75,6 +92,11 @@ int oss_acl_parse_from_body(aos_pool_t *p, aos_list_t *bc, aos_string_t *oss_acl
 **/
 int oss_upload_id_parse_from_body(aos_pool_t *p, aos_list_t *bc, aos_string_t *upload_id);
 
+/**
+  * @brief parse etag from xml body for upload part copy
+**/
+int oss_copy_part_result_parse_from_body(aos_pool_t *p, aos_list_t *bc, aos_string_t *etag);
+
 /**
   * @brief parse objects from xml body for list objects
 **/
@@ -89,6 +111,68 @@ void oss_list_objects_common_prefix_parse(aos_pool_t *p, mxml_node_t *root, cons
 int oss_list_objects_parse_from_body(aos_pool_t *p, aos_list_t *bc, aos_list_t *object_list,
             aos_list_t *common_prefix_list, aos_string_t *marker, int *truncated);
 
+/**
+  * @brief  streaming parser for list objects, the body is fed chunk by chunk 
+  *         and the contents are produced without building a xml document
+**/
+typedef struct {
+    aos_pool_t *pool;
+    aos_list_t *object_list;
+    aos_list_t *common_prefix_list;
+    aos_string_t *marker;
+    int *truncated;
+    aos_list_t *object_tail;  // the last node of object_list before the page
+    aos_list_t *prefix_tail;  // the last node of common_prefix_list before the page
+    aos_string_t saved_marker; // the marker before the page
+
+    int state;                // OSS_XML_STATE_XXX
+    int depth;                // the depth of the current element, the root is 1
+    int has_root;             // AOS_TRUE once the root element starts
+    int closing;              // the current tag is an end tag
+    int self_closing;         // the current tag ends with "/>"
+    int name_done;            // the name of the current tag ends, attributes follow
+    char quote;               // the quote of the attribute value in the current tag
+    char name[32];            // the name of the current tag, longer names are truncated
+    int name_len;
+
+    int context;              // OSS_LIST_CONTEXT_XXX
+    aos_string_t *target;     // the field receiving the text of the current element
+    aos_string_t is_truncated;
+    oss_list_object_content_t *content;
+    oss_list_object_common_prefix_t *common_prefix;
+    oss_list_object_compact_t *compact; // the objects go to compact instead of object_list if not NULL
+    aos_string_t compact_field;  // the target of the fields of compact objects
+    int compact_count;        // the count of compact before the page
+    int64_t compact_keys_len; // the end of the keys of compact before the page
+    int field;                // OSS_LIST_FIELD_XXX of the current element of a compact object
+    char *field_buf;          // the decoded text of the field, reused by the fields
+    int field_cap;
+
+    char *text;               // the text of the target split over chunks
+    int text_len;
+    int text_cap;
+    int error;
+} oss_list_objects_parser_t;
+
+oss_list_objects_parser_t *oss_create_list_objects_parser(aos_pool_t *p, aos_list_t *object_list,
+            aos_list_t *common_prefix_list, aos_string_t *marker, int *truncated);
+oss_list_objects_parser_t *oss_create_list_objects_compact_parser(aos_pool_t *p, 
+            oss_list_object_compact_t *compact, aos_list_t *common_prefix_list, 
+            aos_string_t *marker, int *truncated);
+int oss_list_objects_parser_feed(oss_list_objects_parser_t *parser, const char *data, int len);
+int oss_list_objects_parser_finish(oss_list_objects_parser_t *parser);
+
+/**
+  * @brief  drop what the parser added to the caller's lists, they are left as
+  *         before the page. finish does it itself if the body is invalid
+**/
+void oss_list_objects_parser_rollback(oss_list_objects_parser_t *parser);
+
+/**
+  * @brief  write callback of the response body, user_data of the response is the parser
+**/
+int oss_write_list_objects_body(aos_http_response_t *resp, const char *buffer, int len);
+
 /**
   * @brief parse parts from xml body for list upload part
 **/
@@ -26,7 +26,7 @@ void append_object_from_buffer()
     char *next_append_position = NULL;
     char *object_type = NULL;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     headers1 = aos_table_make(p, 0);
@@ -41,7 +41,7 @@ void append_object_from_buffer()
                          strlen(OSS_OBJECT_TYPE_APPENDABLE))) 
         {
             printf("object[%s]'s type[%s] is not Appendable\n", OBJECT_NAME, object_type);
-            aos_pool_destroy(p);
+            aos_pool_release(p);
             return;
         }
 
@@ -63,7 +63,7 @@ void append_object_from_buffer()
         printf("append object from buffer failed\n");
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void append_object_from_file()
@@ -83,7 +83,7 @@ void append_object_from_file()
     char *next_append_position = NULL;
     char *object_type = NULL;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     headers1 = aos_table_make(options->pool, 0);
@@ -99,7 +99,7 @@ void append_object_from_file()
                          strlen(OSS_OBJECT_TYPE_APPENDABLE))) 
         {
             printf("object[%s]'s type[%s] is not Appendable\n", OBJECT_NAME, object_type);
-            aos_pool_destroy(p);
+            aos_pool_release(p);
             return;
         }
         
@@ -116,7 +116,7 @@ void append_object_from_file()
         printf("append object from file failed\n");
     }    
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void append_object_sample()
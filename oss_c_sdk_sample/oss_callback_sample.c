@@ -38,7 +38,7 @@ void put_object_from_buffer_with_callback()
         "}";
 
     /* init sample */
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
    
@@ -78,7 +78,7 @@ void put_object_from_buffer_with_callback()
         pos += size;
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void multipart_from_buffer_with_callback()
@@ -115,7 +115,7 @@ void multipart_from_buffer_with_callback()
         "\"callbackBodyType\":\"application/x-www-form-urlencoded\""
         "}";
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     aos_str_set(&bucket, BUCKET_NAME);
@@ -137,7 +137,7 @@ void multipart_from_buffer_with_callback()
                upload_id.len, upload_id.data);
     } else {
         printf("Init multipart upload failed\n");
-        aos_pool_destroy(p);
+        aos_pool_release(p);
         return;
     }
 
@@ -151,7 +151,7 @@ void multipart_from_buffer_with_callback()
         printf("Multipart upload part from file succeeded\n");
     } else {
         printf("Multipart upload part from file failed\n");
-        aos_pool_destroy(p);
+        aos_pool_release(p);
         return;
     }
 
@@ -163,7 +163,7 @@ void multipart_from_buffer_with_callback()
         printf("Multipart upload part from file succeeded\n");
     } else {
         printf("Multipart upload part from file failed\n");
-        aos_pool_destroy(p);
+        aos_pool_release(p);
         return;
     }
 
@@ -178,7 +178,7 @@ void multipart_from_buffer_with_callback()
         printf("List multipart succeeded\n");
     } else {
         printf("List multipart failed\n");
-        aos_pool_destroy(p);
+        aos_pool_release(p);
         return;
     }
 
@@ -212,7 +212,7 @@ void multipart_from_buffer_with_callback()
         pos += size;
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void callback_sample()
@@ -25,7 +25,7 @@ void append_object_from_buffer_with_crc()
     aos_list_t buffer;
     aos_buf_t *content = NULL;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     headers = aos_table_make(p, 0);
@@ -58,7 +58,7 @@ void append_object_from_buffer_with_crc()
     /* delete object */
     s= oss_delete_object(options, &bucket, &object, NULL);
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void append_object_from_file_with_crc()
@@ -77,7 +77,7 @@ void append_object_from_file_with_crc()
     aos_list_t resp_body;
     oss_request_options_t *options = NULL;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     headers = aos_table_make(p, 0);
@@ -111,7 +111,7 @@ void append_object_from_file_with_crc()
     /* delete object */
     s= oss_delete_object(options, &bucket, &object, NULL);
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void disable_crc() 
@@ -128,7 +128,7 @@ void disable_crc()
     aos_buf_t *content;
 
     /* init test*/
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
    
@@ -150,10 +150,10 @@ void disable_crc()
         printf("put object from buffer failed\n");      
     } 
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 
     /* get object */
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
 
@@ -166,7 +166,7 @@ void disable_crc()
         printf("get object to buffer failed\n");      
     } 
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void crc_sample()
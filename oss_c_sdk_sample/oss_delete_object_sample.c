@@ -18,7 +18,7 @@ void delete_object()
     aos_table_t *resp_headers = NULL;
     aos_status_t *s = NULL;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     aos_str_set(&bucket, BUCKET_NAME);
@@ -32,7 +32,7 @@ void delete_object()
         printf("delete object failed\n");
     }    
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void delete_objects()
@@ -51,7 +51,7 @@ void delete_objects()
     aos_list_t deleted_object_list;
     int is_quiet = AOS_TRUE;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     aos_str_set(&bucket, BUCKET_NAME);
@@ -68,7 +68,7 @@ void delete_objects()
     s = oss_delete_objects(options, &bucket, &object_list, is_quiet,
         &resp_headers, &deleted_object_list);
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 
     if (aos_status_is_ok(s)) {
         printf("delete objects succeeded\n");
@@ -26,7 +26,7 @@ void get_object_to_buffer()
     int64_t size = 0;
     int64_t pos = 0;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     aos_str_set(&bucket, BUCKET_NAME);
@@ -58,7 +58,7 @@ void get_object_to_buffer()
         pos += size;
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void get_object_to_local_file()
@@ -75,7 +75,7 @@ void get_object_to_local_file()
     aos_status_t *s = NULL;
     aos_string_t file;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     aos_str_set(&bucket, BUCKET_NAME);
@@ -91,7 +91,7 @@ void get_object_to_local_file()
         printf("get object to local file failed\n");
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void get_object_to_buffer_with_range()
@@ -112,7 +112,7 @@ void get_object_to_buffer_with_range()
     int64_t size = 0;
     int64_t pos = 0;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     aos_str_set(&bucket, BUCKET_NAME);
@@ -148,7 +148,7 @@ void get_object_to_buffer_with_range()
         pos += size;
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void get_object_to_local_file_with_range()
@@ -165,7 +165,7 @@ void get_object_to_local_file_with_range()
     aos_status_t *s = NULL;
     aos_string_t file;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     aos_str_set(&bucket, BUCKET_NAME);
@@ -185,7 +185,7 @@ void get_object_to_local_file_with_range()
         printf("get object to local file failed\n");
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void get_object_by_signed_url()
@@ -205,7 +205,7 @@ void get_object_by_signed_url()
     char *signed_url = NULL;
     int64_t expires_time;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
 
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
@@ -242,7 +242,7 @@ void get_object_by_signed_url()
         printf("get object by signed url failed\n");
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void get_oss_dir_to_local_dir()
@@ -254,7 +254,7 @@ void get_oss_dir_to_local_dir()
     oss_request_options_t *options = NULL;
     oss_list_object_params_t *params = NULL;
 
-    aos_pool_create(&parent_pool, NULL);
+    aos_pool_acquire(&parent_pool);
     options = oss_request_options_create(parent_pool);
     init_sample_request_options(options, is_cname);
     aos_str_set(&bucket, BUCKET_NAME);
@@ -267,14 +267,13 @@ void get_oss_dir_to_local_dir()
         aos_table_t *list_object_resp_headers = NULL;
         oss_list_object_content_t *list_content = NULL;
         
-        aos_pool_create(&list_object_pool, parent_pool);
+        aos_pool_acquire(&list_object_pool);
         options->pool = list_object_pool;
         s = oss_list_object(options, &bucket, params, &list_object_resp_headers);
         if (!aos_status_is_ok(s)) {
             aos_error_log("list objects of dir[%s] fail\n", DIR_NAME);
-            aos_status_dup(parent_pool, s);
-            aos_pool_destroy(list_object_pool);
-            options->pool = parent_pool;
+            aos_pool_release(list_object_pool);
+            aos_pool_release(parent_pool);
             return;
         }        
 
@@ -291,7 +290,7 @@ void get_oss_dir_to_local_dir()
 
                 aos_str_set(&object, list_content->key.data);
 
-                aos_pool_create(&get_object_pool, parent_pool);
+                aos_pool_acquire(&get_object_pool);
                 options->pool = get_object_pool;
 
                 s = oss_get_object_to_file(options, &bucket, &object, 
@@ -300,7 +299,7 @@ void get_oss_dir_to_local_dir()
                     aos_error_log("get object[%s] fail\n", object.data);
                 }
 
-                aos_pool_destroy(get_object_pool);
+                aos_pool_release(get_object_pool);
                 options->pool = list_object_pool;
             }
         }
@@ -310,7 +309,7 @@ void get_oss_dir_to_local_dir()
             aos_str_set(&params->marker, params->next_marker.data);
         }
 
-        aos_pool_destroy(list_object_pool);
+        aos_pool_release(list_object_pool);
     }
 
     if (aos_status_is_ok(s)) {
@@ -318,7 +317,7 @@ void get_oss_dir_to_local_dir()
     } else {
         printf("get dir failed\n");
     }
-    aos_pool_destroy(parent_pool);
+    aos_pool_release(parent_pool);
 }
 
 void get_object_sample()
@@ -22,7 +22,7 @@ void head_object()
     char *object_type = NULL;
     int64_t content_length = 0;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     aos_str_set(&bucket, BUCKET_NAME);
@@ -45,7 +45,7 @@ void head_object()
         printf("head object failed\n");
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void head_object_sample()
@@ -30,7 +30,7 @@ void image_resize()
     aos_status_t *s = NULL;
     aos_string_t filename;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     aos_str_set(&bucket, BUCKET_NAME);
@@ -49,7 +49,7 @@ void image_resize()
         printf("get object to file failed\n");  
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void image_crop() 
@@ -65,7 +65,7 @@ void image_crop()
     aos_status_t *s = NULL;
     aos_string_t filename;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     aos_str_set(&bucket, BUCKET_NAME);
@@ -84,7 +84,7 @@ void image_crop()
         printf("get object to file failed\n");  
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void image_rotate() 
@@ -100,7 +100,7 @@ void image_rotate()
     aos_status_t *s = NULL;
     aos_string_t filename;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     aos_str_set(&bucket, BUCKET_NAME);
@@ -119,7 +119,7 @@ void image_rotate()
         printf("get object to file failed\n");  
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void image_sharpen() 
@@ -135,7 +135,7 @@ void image_sharpen()
     aos_status_t *s = NULL;
     aos_string_t filename;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     aos_str_set(&bucket, BUCKET_NAME);
@@ -154,7 +154,7 @@ void image_sharpen()
         printf("get object to file failed\n");  
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void image_watermark() 
@@ -170,7 +170,7 @@ void image_watermark()
     aos_status_t *s = NULL;
     aos_string_t filename;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     aos_str_set(&bucket, BUCKET_NAME);
@@ -189,7 +189,7 @@ void image_watermark()
         printf("get object to file failed\n");  
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void image_format() {
@@ -204,7 +204,7 @@ void image_format() {
     aos_status_t *s = NULL;
     aos_string_t filename;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     aos_str_set(&bucket, BUCKET_NAME);
@@ -223,7 +223,7 @@ void image_format() {
         printf("get object to file failed\n");  
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void iamge_info()
@@ -244,7 +244,7 @@ void iamge_info()
     int64_t size = 0;
     int64_t pos = 0;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     aos_str_set(&bucket, BUCKET_NAME);
@@ -276,7 +276,7 @@ void iamge_info()
         pos += size;
     }
     
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void put_example_image()
@@ -291,7 +291,7 @@ void put_example_image()
     aos_table_t *headers = NULL;
     aos_table_t *resp_headers = NULL;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
 
@@ -307,7 +307,7 @@ void put_example_image()
         printf("put object from file failed\n");  
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 
@@ -327,7 +327,7 @@ void put_sample_image()
     aos_table_t *headers = NULL;
     aos_table_t *resp_headers = NULL;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
 
@@ -343,7 +343,7 @@ void put_sample_image()
         printf("put object from file failed\n");
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void image_sample()
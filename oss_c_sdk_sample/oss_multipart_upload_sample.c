@@ -28,7 +28,7 @@ void multipart_upload_file_from_buffer()
     int part_num1 = 1;
     int part_num2 = 2;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     headers = aos_table_make(p, 1);
@@ -45,7 +45,7 @@ void multipart_upload_file_from_buffer()
                upload_id.len, upload_id.data);
     } else {
         printf("Init multipart upload failed\n");
-        aos_pool_destroy(p);
+        aos_pool_release(p);
         return;
     }    
 
@@ -59,7 +59,7 @@ void multipart_upload_file_from_buffer()
         printf("Upload multipart part succeeded\n");
     } else {
         printf("Upload multipart part failed\n");
-        aos_pool_destroy(p);
+        aos_pool_release(p);
         return;
     }
 
@@ -72,7 +72,7 @@ void multipart_upload_file_from_buffer()
         printf("Upload multipart part succeeded\n");
     } else {
         printf("Upload multipart part failed\n");
-        aos_pool_destroy(p);
+        aos_pool_release(p);
         return;
     }    
 
@@ -87,7 +87,7 @@ void multipart_upload_file_from_buffer()
         printf("List multipart succeeded\n");
     } else {
         printf("List multipart failed\n");
-        aos_pool_destroy(p);
+        aos_pool_release(p);
         return;
     }
 
@@ -111,7 +111,7 @@ void multipart_upload_file_from_buffer()
         printf("Complete multipart upload failed\n");
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void multipart_upload_file_from_file()
@@ -135,7 +135,7 @@ void multipart_upload_file_from_file()
     int64_t pos = 0;
     int64_t file_length = 0;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     headers = aos_table_make(p, 1);
@@ -152,7 +152,7 @@ void multipart_upload_file_from_file()
                upload_id.len, upload_id.data);
     } else {
         printf("Init multipart upload failed\n");
-        aos_pool_destroy(p);
+        aos_pool_release(p);
         return;
     }
 
@@ -185,7 +185,7 @@ void multipart_upload_file_from_file()
         printf("List multipart succeeded\n");
     } else {
         printf("List multipart failed\n");
-        aos_pool_destroy(p);
+        aos_pool_release(p);
         return;
     }
 
@@ -208,7 +208,7 @@ void multipart_upload_file_from_file()
         printf("Complete multipart upload from file failed\n");
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void abort_multipart_upload()
@@ -223,7 +223,7 @@ void abort_multipart_upload()
     aos_string_t upload_id;
     aos_status_t *s = NULL;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     headers = aos_table_make(p, 1);
@@ -238,7 +238,7 @@ void abort_multipart_upload()
                upload_id.len, upload_id.data);
     } else {
         printf("Init multipart upload failed\n"); 
-        aos_pool_destroy(p);
+        aos_pool_release(p);
         return;
     }
     
@@ -252,7 +252,7 @@ void abort_multipart_upload()
         printf("Abort multipart upload failed\n"); 
     }    
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void multipart_object_sample()
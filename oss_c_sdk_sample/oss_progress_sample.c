@@ -25,7 +25,7 @@ void put_and_get_from_buffer_with_progress()
     aos_buf_t *content;
 
     /* init test*/
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
    
@@ -47,14 +47,14 @@ void put_and_get_from_buffer_with_progress()
         printf("put object from buffer succeeded\n");
     } else {
         printf("put object from buffer failed\n");
-        aos_pool_destroy(p);
+        aos_pool_release(p);
         return;
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 
     /* test get object */
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
 
@@ -66,7 +66,7 @@ void put_and_get_from_buffer_with_progress()
         printf("get object to buffer failed\n");
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void put_and_get_from_file_with_progress()
@@ -83,7 +83,7 @@ void put_and_get_from_file_with_progress()
     char *download_filename = "get_object_to_local_file.txt";
 
     /* init test*/
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
    
@@ -99,14 +99,14 @@ void put_and_get_from_file_with_progress()
         printf("put object from file succeeded\n");
     } else {
         printf("put object from file failed\n");
-        aos_pool_destroy(p);
+        aos_pool_release(p);
         return;
     }
     
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 
     /* get object */
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     aos_str_set(&filename, download_filename);
@@ -119,7 +119,7 @@ void put_and_get_from_file_with_progress()
         printf("get object to file failed\n");
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void append_object_with_progress()
@@ -142,7 +142,7 @@ void append_object_with_progress()
     aos_buf_t *content;
 
     /* init test*/
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
    
@@ -164,14 +164,14 @@ void append_object_with_progress()
         printf("progress: append object from buffer succeeded\n");
     } else {
         printf("progress: append object from buffer failed\n");
-        aos_pool_destroy(p);
+        aos_pool_release(p);
         return;
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 
     /* append object from file*/
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
 
@@ -188,7 +188,7 @@ void append_object_with_progress()
 
     oss_delete_object(options, &bucket, &object, NULL);
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void multipart_upload_from_buffer_with_progress()
@@ -207,7 +207,7 @@ void multipart_upload_from_buffer_with_progress()
     oss_complete_part_content_t *complete_content1 = NULL;
     int part_num = 1;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     aos_str_set(&bucket, BUCKET_NAME);
@@ -220,7 +220,7 @@ void multipart_upload_from_buffer_with_progress()
                upload_id.len, upload_id.data);
     } else {
         printf("Init multipart upload failed\n");
-        aos_pool_destroy(p);
+        aos_pool_release(p);
         return;
     } 
 
@@ -234,7 +234,7 @@ void multipart_upload_from_buffer_with_progress()
         printf("Upload multipart part succeeded\n");
     } else {
         printf("Upload multipart part failed\n");
-        aos_pool_destroy(p);
+        aos_pool_release(p);
         return;
     }
 
@@ -246,7 +246,7 @@ void multipart_upload_from_buffer_with_progress()
         printf("Upload multipart part succeeded\n");
     } else {
         printf("Upload multipart part failed\n");
-        aos_pool_destroy(p);
+        aos_pool_release(p);
         return;
     }
 
@@ -275,7 +275,7 @@ void multipart_upload_from_buffer_with_progress()
         printf("Complete multipart upload failed\n");
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void multipart_upload_from_file_with_progress()
@@ -294,7 +294,7 @@ void multipart_upload_from_file_with_progress()
     oss_complete_part_content_t *complete_content1 = NULL;
     int part_num = 1;    
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     aos_str_set(&bucket, BUCKET_NAME);
@@ -310,7 +310,7 @@ void multipart_upload_from_file_with_progress()
                upload_id.len, upload_id.data);
     } else {
         printf("Init multipart upload failed\n");
-        aos_pool_destroy(p);
+        aos_pool_release(p);
         return;
     }  
 
@@ -324,7 +324,7 @@ void multipart_upload_from_file_with_progress()
         printf("Upload multipart part succeeded\n");
     } else {
         printf("Upload multipart part failed\n");
-        aos_pool_destroy(p);
+        aos_pool_release(p);
         return;
     }
 
@@ -353,7 +353,7 @@ void multipart_upload_from_file_with_progress()
         printf("Complete multipart upload failed\n");
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void progress_sample()
@@ -22,7 +22,7 @@ void put_object_from_buffer()
     char *str = "test oss c sdk";
     aos_status_t *s = NULL;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     headers = aos_table_make(p, 1);
@@ -43,7 +43,7 @@ void put_object_from_buffer()
         printf("put object from buffer failed\n");      
     }    
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void put_object_from_buffer_with_md5()
@@ -65,7 +65,7 @@ void put_object_from_buffer_with_md5()
     char *str = "test oss c sdk";
     aos_status_t *s = NULL;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     headers = aos_table_make(p, 2);
@@ -95,7 +95,7 @@ void put_object_from_buffer_with_md5()
     printf("put object from buffer with md5 failed\n");
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void put_object_from_file()
@@ -111,7 +111,7 @@ void put_object_from_file()
     aos_status_t *s = NULL;
     aos_string_t file;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     headers = aos_table_make(options->pool, 1);
@@ -130,7 +130,7 @@ void put_object_from_file()
             s->code, s->error_code, s->error_msg, s->req_id);
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void put_object_by_signed_url()
@@ -150,7 +150,7 @@ void put_object_by_signed_url()
     char *signed_url = NULL;
     int64_t expires_time;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
 
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
@@ -187,7 +187,7 @@ void put_object_by_signed_url()
         printf("put object by signed url failed\n");
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void create_dir()
@@ -202,7 +202,7 @@ void create_dir()
     aos_status_t *s = NULL;
     aos_list_t buffer;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     headers = aos_table_make(options->pool, 0);
@@ -219,7 +219,7 @@ void create_dir()
         printf("create dir failed\n");
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void put_object_to_dir()
@@ -236,7 +236,7 @@ void put_object_to_dir()
     aos_status_t *s = NULL;
     aos_string_t file;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     headers = aos_table_make(options->pool, 0);
@@ -258,7 +258,7 @@ void put_object_to_dir()
     }
 
     free(key);
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void put_object_sample()
@@ -22,7 +22,7 @@ void resumable_upload_with_multi_threads()
     oss_request_options_t *options = NULL;
     oss_resumable_clt_params_t *clt_params;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     headers = aos_table_make(p, 0);
@@ -42,7 +42,7 @@ void resumable_upload_with_multi_threads()
         printf("upload failed\n");
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void resumable_upload_with_resumable()
@@ -59,7 +59,7 @@ void resumable_upload_with_resumable()
     oss_request_options_t *options = NULL;
     oss_resumable_clt_params_t *clt_params;
 
-    aos_pool_create(&p, NULL);
+    aos_pool_acquire(&p);
     options = oss_request_options_create(p);
     init_sample_request_options(options, is_cname);
     headers = aos_table_make(p, 0);
@@ -79,7 +79,7 @@ void resumable_upload_with_resumable()
         printf("upload failed\n");
     }
 
-    aos_pool_destroy(p);
+    aos_pool_release(p);
 }
 
 void resumable_object_sample()
@@ -2,6 +2,7 @@
 #define OSS_SAMPLE_UTIL_H
 
 #include "aos_http_io.h"
+#include "aos_pool_cache.h"
 #include "aos_string.h"
 #include "aos_transport.h"
 #include "oss_define.h"
@@ -7,6 +7,8 @@
 #include "aos_status.h"
 #include "oss_auth.h"
 #include "oss_xml.h"
+#include "aos_pool_cache.h"
+#include "oss_test_util.h"
 #include "oss_util.c"
 #include "aos_transport.c"
 
@@ -27,6 +29,240 @@ void test_get_xml_doc_with_empty_aos_list(CuTest *tc)
     printf("test_get_xml_doc_with_empty_aos_list ok\n");
 }
 
+void test_oss_list_objects_parser(CuTest *tc)
+{
+    aos_pool_t *p;
+    int ret;
+    int i;
+    int len;
+    int step;
+    int truncated;
+    aos_string_t marker;
+    aos_list_t object_list;
+    aos_list_t common_prefix_list;
+    oss_list_objects_parser_t *parser;
+    oss_list_object_content_t *content;
+    oss_list_object_common_prefix_t *common_prefix;
+    const char *xml = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<ListBucketResult xmlns=\"http://doc.oss-cn-hangzhou.aliyuncs.com\">"
+        "<Name>bucket</Name><Prefix>fun/</Prefix><Marker></Marker><MaxKeys>2</MaxKeys><Delimiter>/</Delimiter>"
+        "<IsTruncated>true</IsTruncated><NextMarker>fun/b&amp;c</NextMarker>"
+        "<Contents><Key>fun/a&lt;1&gt;</Key><LastModified>2012-02-24T08:42:32.000Z</LastModified>"
+        "<ETag>&quot;5B3C1A2E053D763E1B002CC607C5A0FE&quot;</ETag><Type>Normal</Type><Size>344606</Size>"
+        "<StorageClass>Standard</StorageClass><Owner><ID>0022012</ID><DisplayName>user-example</DisplayName></Owner>"
+        "</Contents>"
+        "<Contents><Key>fun/b&amp;c</Key><Size>0</Size><Owner/></Contents>"
+        "<CommonPrefixes><Prefix>fun/movie/</Prefix></CommonPrefixes>"
+        "</ListBucketResult>";
+
+    aos_pool_create(&p, NULL);
+    len = strlen(xml);
+
+    // the result does not depend on how the body is split into chunks
+    for (step = 1; step <= len; step += (step < 16 ? 1 : 97)) {
+        aos_list_init(&object_list);
+        aos_list_init(&common_prefix_list);
+        aos_str_null(&marker);
+        parser = oss_create_list_objects_parser(p, &object_list, &common_prefix_list, &marker, &truncated);
+        for (i = 0, ret = AOSE_OK; i < len && ret == AOSE_OK; i += step) {
+            ret = oss_list_objects_parser_feed(parser, xml + i, aos_min(step, len - i));
+        }
+        CuAssertIntEquals(tc, AOSE_OK, ret);
+        CuAssertIntEquals(tc, AOSE_OK, oss_list_objects_parser_finish(parser));
+
+        CuAssertIntEquals(tc, 1, truncated);
+        CuAssertStrEquals(tc, "fun/b&c", marker.data);
+
+        content = aos_list_entry(object_list.next, oss_list_object_content_t, node);
+        CuAssertStrEquals(tc, "fun/a<1>", content->key.data);
+        CuAssertStrEquals(tc, "2012-02-24T08:42:32.000Z", content->last_modified.data);
+        CuAssertStrEquals(tc, "\"5B3C1A2E053D763E1B002CC607C5A0FE\"", content->etag.data);
+        CuAssertStrEquals(tc, "344606", content->size.data);
+        CuAssertStrEquals(tc, "0022012", content->owner_id.data);
+        CuAssertStrEquals(tc, "user-example", content->owner_display_name.data);
+
+        content = aos_list_entry(content->node.next, oss_list_object_content_t, node);
+        CuAssertStrEquals(tc, "fun/b&c", content->key.data);
+        CuAssertStrEquals(tc, "0", content->size.data);
+        CuAssertTrue(tc, content->node.next == &object_list);
+
+        common_prefix = aos_list_entry(common_prefix_list.next, oss_list_object_common_prefix_t, node);
+        CuAssertStrEquals(tc, "fun/movie/", common_prefix->prefix.data);
+        CuAssertTrue(tc, common_prefix->node.next == &common_prefix_list);
+    }
+
+    // incomplete body, the lists keep the results of the previous page only
+    aos_str_set(&marker, "fun/a");
+    parser = oss_create_list_objects_parser(p, &object_list, &common_prefix_list, &marker, &truncated);
+    oss_list_objects_parser_feed(parser, xml, len - 5);
+    CuAssertIntEquals(tc, AOSE_XML_PARSE_ERROR, oss_list_objects_parser_finish(parser));
+    CuAssertStrEquals(tc, "fun/a", marker.data);
+    CuAssertIntEquals(tc, 0, truncated);
+    content = aos_list_entry(object_list.prev, oss_list_object_content_t, node);
+    CuAssertStrEquals(tc, "fun/b&c", content->key.data);
+    CuAssertTrue(tc, content->node.next == &object_list);
+    CuAssertTrue(tc, object_list.next->next == &content->node);
+    common_prefix = aos_list_entry(common_prefix_list.next, oss_list_object_common_prefix_t, node);
+    CuAssertTrue(tc, common_prefix->node.next == &common_prefix_list);
+    CuAssertTrue(tc, common_prefix_list.prev == &common_prefix->node);
+
+    // empty body
+    parser = oss_create_list_objects_parser(p, &object_list, &common_prefix_list, &marker, &truncated);
+    CuAssertIntEquals(tc, AOSE_XML_PARSE_ERROR, oss_list_objects_parser_finish(parser));
+
+    // numeric references, the invalid ones are kept as text
+    aos_list_init(&object_list);
+    parser = oss_create_list_objects_parser(p, &object_list, &common_prefix_list, &marker, &truncated);
+    xml = "<ListBucketResult><Contents><Key>a&#65;&#x42;&# 65;&#+65;&#x-41;&#xD800;&#55296;</Key>"
+        "</Contents></ListBucketResult>";
+    CuAssertIntEquals(tc, AOSE_OK, oss_list_objects_parser_feed(parser, xml, strlen(xml)));
+    CuAssertIntEquals(tc, AOSE_OK, oss_list_objects_parser_finish(parser));
+    content = aos_list_entry(object_list.next, oss_list_object_content_t, node);
+    CuAssertStrEquals(tc, "aAB&# 65;&#+65;&#x-41;&#xD800;&#55296;", content->key.data);
+
+    aos_pool_destroy(p);
+
+    printf("test_oss_list_objects_parser ok\n");
+}
+
+void test_oss_list_objects_compact_parser(CuTest *tc)
+{
+    aos_pool_t *p;
+    int ret;
+    int i;
+    int len;
+    int truncated;
+    char etag[OSS_ETAG_STRING_LEN];
+    char key[32];
+    aos_string_t marker;
+    aos_list_t common_prefix_list;
+    oss_list_objects_parser_t *parser;
+    oss_list_object_compact_t *compact;
+    oss_list_object_common_prefix_t *common_prefix;
+    const char *xml = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<ListBucketResult xmlns=\"http://doc.oss-cn-hangzhou.aliyuncs.com\">"
+        "<Name>bucket</Name><Prefix>fun/</Prefix><Marker></Marker><MaxKeys>3</MaxKeys><Delimiter>/</Delimiter>"
+        "<IsTruncated>true</IsTruncated><NextMarker>fun/c</NextMarker>"
+        "<Contents><Key>fun/a&lt;1&gt;</Key><LastModified>2012-02-24T08:42:32.000Z</LastModified>"
+        "<ETag>&quot;5B3C1A2E053D763E1B002CC607C5A0FE&quot;</ETag><Type>Normal</Type><Size>344606</Size>"
+        "<StorageClass>Standard</StorageClass><Owner><ID>0022012</ID><DisplayName>user-example</DisplayName></Owner>"
+        "</Contents>"
+        "<Contents><Key>fun/b&amp;c</Key><ETag>\"0123456789abcdef0123456789ABCDEF-12\"</ETag><Size>0</Size><Owner/></Contents>"
+        "<Contents><Key>fun/c</Key><ETag>unknown</ETag></Contents>"
+        "<CommonPrefixes><Prefix>fun/movie/</Prefix></CommonPrefixes>"
+        "</ListBucketResult>";
+
+    aos_pool_create(&p, NULL);
+    len = strlen(xml);
+
+    aos_list_init(&common_prefix_list);
+    aos_str_null(&marker);
+    compact = oss_create_list_object_compact(p);
+    parser = oss_create_list_objects_compact_parser(p, compact, &common_prefix_list, &marker, &truncated);
+    for (i = 0, ret = AOSE_OK; i < len && ret == AOSE_OK; i += 7) {
+        ret = oss_list_objects_parser_feed(parser, xml + i, aos_min(7, len - i));
+    }
+    CuAssertIntEquals(tc, AOSE_OK, ret);
+    CuAssertIntEquals(tc, AOSE_OK, oss_list_objects_parser_finish(parser));
+    CuAssertIntEquals(tc, 1, truncated);
+    CuAssertStrEquals(tc, "fun/c", marker.data);
+    common_prefix = aos_list_entry(common_prefix_list.next, oss_list_object_common_prefix_t, node);
+    CuAssertStrEquals(tc, "fun/movie/", common_prefix->prefix.data);
+
+    CuAssertIntEquals(tc, 3, compact->count);
+    CuAssertStrEquals(tc, "fun/a<1>", oss_list_object_compact_key(compact, 0));
+    CuAssertIntEquals(tc, 8, oss_list_object_compact_key_len(compact, 0));
+    CuAssertTrue(tc, 344606 == compact->sizes[0]);
+    CuAssertTrue(tc, 1330072952 == compact->last_modified[0]);
+    CuAssertIntEquals(tc, 0, compact->etag_part_nums[0]);
+    oss_list_object_compact_etag(compact, 0, etag);
+    CuAssertStrEquals(tc, "\"5B3C1A2E053D763E1B002CC607C5A0FE\"", etag);
+
+    CuAssertStrEquals(tc, "fun/b&c", oss_list_object_compact_key(compact, 1));
+    CuAssertIntEquals(tc, 7, oss_list_object_compact_key_len(compact, 1));
+    CuAssertTrue(tc, 0 == compact->sizes[1]);
+    CuAssertTrue(tc, -1 == compact->last_modified[1]);
+    CuAssertIntEquals(tc, 12, compact->etag_part_nums[1]);
+    oss_list_object_compact_etag(compact, 1, etag);
+    CuAssertStrEquals(tc, "\"0123456789ABCDEF0123456789ABCDEF-12\"", etag);
+
+    // an etag not of md5 is not kept
+    CuAssertStrEquals(tc, "fun/c", oss_list_object_compact_key(compact, 2));
+    CuAssertIntEquals(tc, -1, compact->etag_part_nums[2]);
+    CuAssertIntEquals(tc, 0, oss_list_object_compact_etag(compact, 2, etag));
+
+    // the arrays and the keys grow past their initial capacity
+    for (i = 3; i < 10000; i++) {
+        apr_snprintf(key, sizeof(key), "key/%d", i);
+        CuAssertIntEquals(tc, AOSE_OK, oss_list_object_compact_add(compact));
+        CuAssertIntEquals(tc, AOSE_OK, oss_list_object_compact_set_key(compact, key, strlen(key)));
+    }
+    CuAssertIntEquals(tc, 10000, compact->count);
+    CuAssertStrEquals(tc, "fun/c", oss_list_object_compact_key(compact, 2));
+    CuAssertStrEquals(tc, "key/9999", oss_list_object_compact_key(compact, 9999));
+
+    // a failed page leaves the objects of the previous pages only
+    parser = oss_create_list_objects_compact_parser(p, compact, &common_prefix_list, &marker, &truncated);
+    oss_list_objects_parser_feed(parser, xml, len - 5);
+    CuAssertIntEquals(tc, AOSE_XML_PARSE_ERROR, oss_list_objects_parser_finish(parser));
+    CuAssertIntEquals(tc, 10000, compact->count);
+    CuAssertStrEquals(tc, "key/9999", oss_list_object_compact_key(compact, 9999));
+    CuAssertIntEquals(tc, AOSE_OK, oss_list_object_compact_add(compact));
+    CuAssertIntEquals(tc, AOSE_OK, oss_list_object_compact_set_key(compact, "next", 4));
+    CuAssertStrEquals(tc, "next", oss_list_object_compact_key(compact, 10000));
+    CuAssertStrEquals(tc, "key/9999", oss_list_object_compact_key(compact, 9999));
+
+    aos_pool_destroy(p);
+
+    printf("test_oss_list_objects_compact_parser ok\n");
+}
+
+void test_build_xml_body_escaped(CuTest *tc)
+{
+    aos_pool_t *p;
+    char *xml;
+    aos_list_t part_list;
+    aos_list_t object_list;
+    oss_complete_part_content_t *part;
+    oss_object_key_t *object_key;
+
+    aos_pool_create(&p, NULL);
+
+    aos_list_init(&part_list);
+    part = oss_create_complete_part_content(p);
+    aos_str_set(&part->part_number, "1");
+    aos_str_set(&part->etag, "\"5B3C1A2E053D763E1B002CC607C5A0FE\"");
+    aos_list_add_tail(&part->node, &part_list);
+    part = oss_create_complete_part_content(p);
+    aos_str_set(&part->part_number, "2");
+    aos_str_set(&part->etag, "\"0123456789ABCDEF0123456789ABCDEF\"");
+    aos_list_add_tail(&part->node, &part_list);
+    xml = build_complete_multipart_upload_xml(p, &part_list);
+    CuAssertStrEquals(tc, "<?xml version=\"1.0\" encoding=\"utf-8\"?>"
+        "<CompleteMultipartUpload>"
+        "<Part><PartNumber>1</PartNumber><ETag>&quot;5B3C1A2E053D763E1B002CC607C5A0FE&quot;</ETag></Part>"
+        "<Part><PartNumber>2</PartNumber><ETag>&quot;0123456789ABCDEF0123456789ABCDEF&quot;</ETag></Part>"
+        "</CompleteMultipartUpload>\n", xml);
+
+    aos_list_init(&object_list);
+    object_key = oss_create_oss_object_key(p);
+    aos_str_set(&object_key->key, "a&b<c>.txt");
+    aos_list_add_tail(&object_key->node, &object_list);
+    object_key = oss_create_oss_object_key(p);
+    aos_str_set(&object_key->key, "");
+    aos_list_add_tail(&object_key->node, &object_list);
+    xml = build_objects_xml(p, &object_list, "true");
+    CuAssertStrEquals(tc, "<?xml version=\"1.0\" encoding=\"utf-8\"?>"
+        "<Delete><Quiet>true</Quiet>"
+        "<Object><Key>a&amp;b&lt;c&gt;.txt</Key></Object>"
+        "<Object><Key></Key></Object>"
+        "</Delete>\n", xml);
+
+    aos_pool_destroy(p);
+
+    printf("test_build_xml_body_escaped ok\n");
+}
+
 /*
  * aos_list.h
  */
@@ -375,6 +611,12 @@ void test_aos_should_retry(CuTest *tc) {
     aos_status_set(&s, 0, "-993", "");
     CuAssertIntEquals(tc, 0, aos_should_retry(&s));
 
+    aos_status_set(&s, AOSE_CONNECTION_FAILED, AOS_HTTP_IO_ERROR_CODE, "");
+    CuAssertIntEquals(tc, 1, aos_should_retry(&s));
+
+    aos_status_set(&s, AOSE_OPEN_FILE_ERROR, AOS_OPEN_FILE_ERROR_CODE, "");
+    CuAssertIntEquals(tc, 0, aos_should_retry(&s));
+
     aos_status_set(&s, 0, "0", "NULL");
     CuAssertIntEquals(tc, 0, aos_should_retry(&s));
 
@@ -445,11 +687,695 @@ void test_aos_strtoull(CuTest *tc)
     CuAssertTrue(tc, val == UINT64_MAX);
 }
 
+void test_oss_get_string_to_sign(CuTest *tc)
+{
+    aos_pool_t *p;
+    aos_table_t *headers;
+    aos_table_t *params;
+    aos_string_t canon_res;
+    aos_string_t signstr;
+    aos_string_t secret;
+    aos_hmac_sha1_key_t key;
+    unsigned char hmac1[20];
+    unsigned char hmac2[20];
+    char hex[41];
+    int i;
+
+    aos_pool_create(&p, NULL);
+
+    /* RFC 2202 test case 2, with and without the cached key state */
+    aos_str_set(&secret, "Jefe");
+    HMAC_SHA1(hmac1, (unsigned char *)secret.data, secret.len, 
+              (unsigned char *)"what do ya want for nothing?", 28);
+    aos_hmac_sha1_key_init(&key, (unsigned char *)secret.data, secret.len);
+    aos_hmac_sha1(hmac2, &key, (unsigned char *)"what do ya want for nothing?", 28);
+    for (i = 0; i < 20; i++) {
+        apr_snprintf(hex + i * 2, 3, "%02x", hmac1[i]);
+    }
+    CuAssertStrEquals(tc, "effcdf6ae5eb2fa2d27416d5f184df9c259a7c79", hex);
+    CuAssertTrue(tc, memcmp(hmac1, hmac2, 20) == 0);
+
+    /* the metas are lowercased and sorted, the sub resources are in the canonicalized order */
+    headers = aos_table_make(p, 4);
+    apr_table_set(headers, OSS_CONTENT_TYPE, "text/plain");
+    apr_table_set(headers, OSS_DATE, "Wed, 28 Mar 2018 09:00:00 GMT");
+    apr_table_set(headers, "x-oss-meta-b", " 2 ");
+    apr_table_set(headers, "X-OSS-Meta-A", "1");
+    params = aos_table_make(p, 4);
+    apr_table_set(params, "uploads", "");
+    apr_table_set(params, "partNumber", "1");
+    apr_table_set(params, "max-keys", "10");
+    apr_table_set(params, "acl", "");
+    aos_str_set(&canon_res, "/bucket/object");
+
+    CuAssertIntEquals(tc, AOSE_OK, oss_get_string_to_sign(p, HTTP_GET, &canon_res, 
+        headers, params, &signstr));
+    CuAssertStrEquals(tc, "GET\n\ntext/plain\nWed, 28 Mar 2018 09:00:00 GMT\n"
+        "x-oss-meta-a:1\nx-oss-meta-b:2\n/bucket/object?acl&partNumber=1&uploads", 
+        apr_pstrndup(p, signstr.data, signstr.len));
+
+    /* a string to sign larger than the stack buffer */
+    apr_table_set(headers, "x-oss-meta-c", apr_psprintf(p, "%0*d", OSS_SIGN_BUFFER_SIZE, 0));
+    CuAssertIntEquals(tc, AOSE_OK, oss_get_string_to_sign(p, HTTP_GET, &canon_res, 
+        headers, params, &signstr));
+    CuAssertIntEquals(tc, 115 + 14 + OSS_SIGN_BUFFER_SIZE, signstr.len);
+
+    aos_pool_destroy(p);
+
+    printf("test_oss_get_string_to_sign ok\n");
+}
+
+void test_aos_codec(CuTest *tc)
+{
+    aos_pool_t *p;
+    aos_table_t *params;
+    aos_string_t querystr;
+    const char *src = "my-bucket/photos/2018/03/28/summer holiday~beach_01.jpg?x=1&y=%";
+    const char *encoded = "my-bucket%2Fphotos%2F2018%2F03%2F28%2Fsummer%20holiday~beach_01.jpg%3Fx%3D1%26y%3D%25";
+    const char *fox = "The quick brown fox jumps over the lazy dog";
+    unsigned char bytes[37];
+    char out[128];
+    char *url;
+    int len;
+    int i;
+
+    aos_pool_create(&p, NULL);
+
+    /* the exact length is known before encoding, past the sixteen byte blocks */
+    CuAssertIntEquals(tc, (int)strlen(encoded), (int)aos_url_encode_len(src, strlen(src)));
+    len = (int)aos_url_encode_buf(out, src, strlen(src));
+    CuAssertIntEquals(tc, (int)strlen(encoded), len);
+    out[len] = '\0';
+    CuAssertStrEquals(tc, encoded, out);
+    CuAssertIntEquals(tc, 9, (int)aos_url_encode_len("\xe4\xb8\xad", 3));
+
+    /* RFC 4648 vectors and the SIMD path */
+    CuAssertIntEquals(tc, 0, aos_base64_encode((unsigned char *)"", 0, out));
+    len = aos_base64_encode((unsigned char *)"f", 1, out);
+    CuAssertStrEquals(tc, "Zg==", apr_pstrndup(p, out, len));
+    len = aos_base64_encode((unsigned char *)"fo", 2, out);
+    CuAssertStrEquals(tc, "Zm8=", apr_pstrndup(p, out, len));
+    len = aos_base64_encode((unsigned char *)"foobar", 6, out);
+    CuAssertStrEquals(tc, "Zm9vYmFy", apr_pstrndup(p, out, len));
+    len = aos_base64_encode((unsigned char *)fox, (int)strlen(fox), out);
+    CuAssertIntEquals(tc, AOS_BASE64_ENCODE_LEN((int)strlen(fox)), len);
+    CuAssertStrEquals(tc, "VGhlIHF1aWNrIGJyb3duIGZveCBqdW1wcyBvdmVyIHRoZSBsYXp5IGRvZw==", 
+        apr_pstrndup(p, out, len));
+
+    for (i = 0; i < (int)sizeof(bytes); i++) {
+        bytes[i] = (unsigned char)(i * 7);
+    }
+    aos_hex_encode(bytes, sizeof(bytes), out, 1);
+    CuAssertStrEquals(tc, "00070E151C232A31383F464D545B626970777E858C939AA1A8AFB6BDC4CBD2D9E0E7EEF5FC", 
+        apr_pstrndup(p, out, 2 * sizeof(bytes)));
+    aos_hex_encode(bytes, 3, out, 0);
+    CuAssertStrEquals(tc, "00070e", apr_pstrndup(p, out, 6));
+
+    /* the query string and the url are written in one exact allocation */
+    params = aos_table_make(p, 2);
+    apr_table_set(params, "acl", "");
+    apr_table_set(params, "prefix", "a b/c");
+    CuAssertIntEquals(tc, AOSE_OK, aos_query_params_to_string(p, params, &querystr));
+    CuAssertStrEquals(tc, "?acl&prefix=a%20b%2Fc", apr_pstrndup(p, querystr.data, querystr.len));
+    CuAssertIntEquals(tc, AOSE_OK, aos_build_url(p, "http://", "bucket.oss.aliyuncs.com", 
+        "dir/obj 1", &querystr, &url));
+    CuAssertStrEquals(tc, "http://bucket.oss.aliyuncs.com/dir%2Fobj%201?acl&prefix=a%20b%2Fc", url);
+
+    /* a key and value checked encoded, as they go on the wire */
+    apr_table_set(params, "prefix", apr_psprintf(p, "%0*d", AOS_MAX_QUERY_ARG_LEN / 2, 0));
+    CuAssertIntEquals(tc, AOSE_OK, aos_query_params_to_string(p, params, &querystr));
+    apr_table_set(params, "prefix", apr_psprintf(p, "%*d", AOS_MAX_QUERY_ARG_LEN / 2, 0));
+    CuAssertIntEquals(tc, AOSE_INVALID_ARGUMENT, aos_query_params_to_string(p, params, &querystr));
+
+    aos_pool_destroy(p);
+
+    printf("test_aos_codec ok, kernel:%s\n", aos_codec_kernel());
+}
+
+static char *digest_hex(aos_pool_t *p, const unsigned char *digest, int len)
+{
+    char *hex = (char *)aos_palloc(p, len * 2 + 1);
+    int i;
+
+    for (i = 0; i < len; i++) {
+        apr_snprintf(hex + i * 2, 3, "%02x", digest[i]);
+    }
+    return hex;
+}
+
+void test_digest_kernel(CuTest *tc)
+{
+    aos_pool_t *p = NULL;
+    char *filename = "oss_test_digest.txt";
+    const char *msg = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+    const char *digits = "1234567890123456789012345678901234567890"
+                         "1234567890123456789012345678901234567890";
+    unsigned char buf[8192];
+    unsigned char digest[APR_SHA1_DIGESTSIZE];
+    unsigned char expect[APR_SHA1_DIGESTSIZE];
+    unsigned char parts[6][APR_MD5_DIGESTSIZE];
+    int64_t offsets[6] = {0, 1, 100, 4096, 5000, 8191};
+    int64_t sizes[6] = {8192, 8000, 0, 4096, 3000, 1};
+    aos_sha1_ctx_t sha1;
+    aos_sha1_ctx_t sha1_ctx[2];
+    aos_md5_ctx_t md5;
+    aos_md5_ctx_t md5_ctx[6];
+    aos_md5_ctx_t *lanes[6];
+    const unsigned char *data[6];
+    apr_size_t lens[6];
+    apr_size_t i;
+    apr_size_t step;
+    int k;
+
+    aos_pool_create(&p, NULL);
+    for (i = 0; i < sizeof(buf); i++) {
+        buf[i] = (unsigned char)('a' + (i * 2654435761u >> 13) % 26);
+    }
+
+    /* FIPS 180 and RFC 1321 vectors */
+    aos_sha1_init(&sha1);
+    aos_sha1_update(&sha1, "abc", 3);
+    aos_sha1_final(digest, &sha1);
+    CuAssertStrEquals(tc, "a9993e364706816aba3e25717850c26c9cd0d89d", digest_hex(p, digest, 20));
+    aos_sha1_init(&sha1);
+    aos_sha1_update(&sha1, msg, strlen(msg));
+    aos_sha1_final(digest, &sha1);
+    CuAssertStrEquals(tc, "84983e441c3bd26ebaae4aa1f95129e5e54670f1", digest_hex(p, digest, 20));
+    aos_md5_init(&md5);
+    aos_md5_update(&md5, "abc", 3);
+    aos_md5_final(digest, &md5);
+    CuAssertStrEquals(tc, "900150983cd24fb0d6963f7d28e17f72", digest_hex(p, digest, 16));
+
+    /* the sha1 block buffering, one shot against uneven updates */
+    aos_sha1_init(&sha1_ctx[0]);
+    aos_sha1_init(&sha1_ctx[1]);
+    aos_sha1_update(&sha1_ctx[0], buf, sizeof(buf));
+    for (i = 0; i < sizeof(buf); i += step) {
+        step = aos_min(sizeof(buf) - i, 1 + i % 131);
+        aos_sha1_update(&sha1_ctx[1], buf + i, step);
+    }
+    aos_sha1_final(digest, &sha1_ctx[0]);
+    aos_sha1_final(expect, &sha1_ctx[1]);
+    CuAssertTrue(tc, memcmp(digest, expect, APR_SHA1_DIGESTSIZE) == 0);
+
+    /* multi buffer md5 against one stream at a time, lanes of different
+       lengths, partial blocks left from the previous update */
+    for (k = 0; k < 6; k++) {
+        aos_md5_init(&md5_ctx[k]);
+        aos_md5_update(&md5_ctx[k], digits, k * 13);
+        lanes[k] = &md5_ctx[k];
+        data[k] = buf + offsets[k];
+        lens[k] = (apr_size_t)sizes[k];
+    }
+    aos_md5_multi_update(lanes, data, lens, 6);
+    for (k = 0; k < 6; k++) {
+        aos_md5_init(&md5);
+        aos_md5_update(&md5, digits, k * 13);
+        aos_md5_update(&md5, buf + offsets[k], (apr_size_t)sizes[k]);
+        aos_md5_final(expect, &md5);
+        aos_md5_final(digest, &md5_ctx[k]);
+        CuAssertTrue(tc, memcmp(digest, expect, APR_MD5_DIGESTSIZE) == 0);
+    }
+    aos_md5_init(&md5);
+    aos_md5_update(&md5, digits, 80);
+    aos_md5_final(digest, &md5);
+    CuAssertStrEquals(tc, "57edf4a22be3c955ac49da2e2107b67a", digest_hex(p, digest, 16));
+
+    /* file parts */
+    fill_test_file(p, filename, apr_pstrmemdup(p, (char *)buf, sizeof(buf)));
+    CuAssertIntEquals(tc, AOSE_OK, aos_md5_file_parts(p, filename, offsets, sizes, 6, parts));
+    for (k = 0; k < 6; k++) {
+        aos_md5_init(&md5);
+        aos_md5_update(&md5, buf + offsets[k], (apr_size_t)sizes[k]);
+        aos_md5_final(expect, &md5);
+        CuAssertTrue(tc, memcmp(parts[k], expect, APR_MD5_DIGESTSIZE) == 0);
+    }
+    sizes[0] = sizeof(buf) + 1;
+    CuAssertIntEquals(tc, AOSE_FILE_READ_ERROR, aos_md5_file_parts(p, filename, offsets, sizes, 1, parts));
+    CuAssertIntEquals(tc, AOSE_OPEN_FILE_ERROR, aos_md5_file_parts(p, "oss_test_digest_none.txt", 
+        offsets, sizes, 1, parts));
+
+    apr_file_remove(filename, p);
+    aos_pool_destroy(p);
+
+    printf("test_digest_kernel ok, sha1:%s, md5:%s\n", aos_sha1_kernel(), aos_md5_kernel());
+}
+
+void test_aos_hmac_sha1_key_cache(CuTest *tc)
+{
+    const aos_hmac_sha1_key_t *key;
+    const unsigned char *msg = (const unsigned char *)"message";
+    unsigned char hmac1[20];
+    unsigned char hmac2[20];
+    char secret[16];
+    int i;
+
+    key = aos_hmac_sha1_key_get((const unsigned char *)"secret-0", 8);
+    CuAssertTrue(tc, key == aos_hmac_sha1_key_get((const unsigned char *)"secret-0", 8));
+    aos_hmac_sha1(hmac1, key, msg, 7);
+    HMAC_SHA1(hmac2, (const unsigned char *)"secret-0", 8, msg, 7);
+    CuAssertTrue(tc, memcmp(hmac1, hmac2, 20) == 0);
+
+    /* the evicted slot is built again for its secret */
+    for (i = 1; i <= AOS_HMAC_KEY_CACHE_NUM; i++) {
+        apr_snprintf(secret, sizeof(secret), "secret-%d", i);
+        aos_hmac_sha1(hmac1, aos_hmac_sha1_key_get((const unsigned char *)secret, (int)strlen(secret)), msg, 7);
+        HMAC_SHA1(hmac2, (const unsigned char *)secret, (int)strlen(secret), msg, 7);
+        CuAssertTrue(tc, memcmp(hmac1, hmac2, 20) == 0);
+    }
+    aos_hmac_sha1(hmac1, aos_hmac_sha1_key_get((const unsigned char *)"secret-0", 8), msg, 7);
+    HMAC_SHA1(hmac2, (const unsigned char *)"secret-0", 8, msg, 7);
+    CuAssertTrue(tc, memcmp(hmac1, hmac2, 20) == 0);
+
+    printf("test_aos_hmac_sha1_key_cache ok\n");
+}
+
+void test_oss_client(CuTest *tc)
+{
+    aos_pool_t *p;
+    oss_config_t *config;
+    oss_client_t *client;
+    oss_request_options_t *options;
+    oss_request_options_t *plain;
+    aos_string_t bucket;
+    aos_string_t object;
+    aos_http_request_t req1;
+    aos_http_request_t req2;
+    const char *endpoints[] = {"http://oss-cn-hangzhou.aliyuncs.com", "https://140.205.63.8", "oss.example.com"};
+    int i;
+    int is_cname;
+
+    aos_pool_create(&p, NULL);
+    aos_str_set(&bucket, "bucket-1");
+    aos_str_set(&object, "dir/key-2");
+
+    /* the client strings match the per request derivation in every addressing mode */
+    for (i = 0; i < 3; i++) {
+        for (is_cname = 0; is_cname < 2; is_cname++) {
+            config = oss_config_create(p);
+            aos_str_set(&config->endpoint, endpoints[i]);
+            aos_str_set(&config->access_key_id, "id");
+            aos_str_set(&config->access_key_secret, "secret");
+            config->is_cname = is_cname;
+            client = oss_client_create(p, config);
+            CuAssertTrue(tc, client != NULL);
+            options = oss_client_request_options_create(client, p);
+            plain = oss_request_options_create(p);
+            plain->config = config;
+
+            oss_get_object_uri(options, &bucket, &object, &req1);
+            oss_get_object_uri(plain, &bucket, &object, &req2);
+            CuAssertStrEquals(tc, req2.proto, req1.proto);
+            CuAssertStrEquals(tc, req2.host, req1.host);
+            CuAssertStrEquals(tc, req2.uri, req1.uri);
+            CuAssertStrEquals(tc, req2.resource, req1.resource);
+
+            oss_get_bucket_uri(options, &bucket, &req1);
+            oss_get_bucket_uri(plain, &bucket, &req2);
+            CuAssertStrEquals(tc, req2.proto, req1.proto);
+            CuAssertStrEquals(tc, req2.host, req1.host);
+            CuAssertStrEquals(tc, req2.uri, req1.uri);
+            CuAssertStrEquals(tc, req2.resource, req1.resource);
+        }
+    }
+    CuAssertTrue(tc, oss_client_get_bucket(client, &bucket) == oss_client_get_bucket(client, &bucket));
+
+    /* the same signature with the key state of the client */
+    aos_str_set(&object, "key-2");
+    oss_get_object_uri(options, &bucket, &object, &req1);
+    req1.pool = p;
+    req1.method = HTTP_GET;
+    req1.headers = aos_table_make(p, 2);
+    req1.query_params = aos_table_make(p, 0);
+    apr_table_set(req1.headers, OSS_DATE, "Wed, 28 Mar 2018 09:00:00 GMT");
+    req2 = req1;
+    req2.headers = aos_table_make(p, 2);
+    apr_table_set(req2.headers, OSS_DATE, "Wed, 28 Mar 2018 09:00:00 GMT");
+    CuAssertIntEquals(tc, AOSE_OK, oss_client_sign_request(&req1, client));
+    CuAssertIntEquals(tc, AOSE_OK, oss_sign_request(&req2, config));
+    CuAssertStrEquals(tc, apr_table_get(req2.headers, OSS_AUTHORIZATION), 
+        apr_table_get(req1.headers, OSS_AUTHORIZATION));
+
+    aos_pool_destroy(p);
+
+    printf("test_oss_client ok\n");
+}
+
+void test_oss_request_options_reuse(CuTest *tc)
+{
+    aos_pool_t *p;
+    oss_request_options_t *options;
+    aos_http_request_context_t *ctx;
+    aos_http_request_t *req;
+    aos_http_response_t *resp;
+    aos_http_request_t *req2;
+    aos_http_response_t *resp2;
+    aos_table_t *headers;
+    aos_table_t *params;
+    aos_status_t *s;
+    aos_string_t bucket;
+    aos_string_t object;
+    aos_curl_http_transport_t t;
+    struct curl_slist *node;
+    int i;
+
+    aos_pool_create(&p, NULL);
+    aos_str_set(&bucket, "bucket-1");
+    aos_str_set(&object, "key-2");
+    options = oss_request_options_create(p);
+    options->config = oss_config_create(p);
+    aos_str_set(&options->config->endpoint, "oss-cn-hangzhou.aliyuncs.com");
+    options->ctl = aos_http_controller_create(p, 0);
+    CuAssertIntEquals(tc, AOSE_OK, oss_request_options_reuse(options));
+    ctx = options->ctl->context;
+    CuAssertTrue(tc, ctx != NULL);
+    CuAssertTrue(tc, options->pool == ctx->pool);
+
+    /* every call gets the same objects back, cleared */
+    for (i = 0; i < 3; i++) {
+        headers = aos_table_create_if_null(options, NULL, 0);
+        params = aos_table_create_if_null(options, NULL, 0);
+        CuAssertTrue(tc, headers == ctx->tables[0]);
+        CuAssertTrue(tc, params == ctx->tables[1]);
+        CuAssertIntEquals(tc, 0, apr_table_elts(headers)->nelts);
+        apr_table_set(headers, OSS_CONTENT_TYPE, "text/plain");
+        apr_table_set(headers, OSS_DATE, "Wed, 28 Mar 2018 09:00:00 GMT");
+
+        oss_init_object_request(options, &bucket, &object, HTTP_PUT, 
+                                &req, params, headers, NULL, 0, &resp);
+        CuAssertTrue(tc, req == &ctx->req);
+        CuAssertTrue(tc, resp == &ctx->resp);
+        CuAssertIntEquals(tc, 0, apr_table_elts(resp->headers)->nelts);
+        CuAssertIntEquals(tc, -1, resp->status);
+        CuAssertStrEquals(tc, "key-2", req->uri);
+        apr_table_set(resp->headers, "x-oss-request-id", "id");
+
+        s = aos_http_request_context_status(ctx);
+        CuAssertTrue(tc, s == &ctx->status);
+        CuAssertIntEquals(tc, 0, s->code);
+        s->code = 200;
+
+        /* the curl headers are the nodes of the context */
+        memset(&t, 0, sizeof(t));
+        t.pool = options->pool;
+        t.req = req;
+        t.controller = (aos_http_controller_ex_t *)options->ctl;
+        t.cleanup = aos_fstack_create(t.pool, 5);
+        aos_init_curl_headers(&t);
+        CuAssertTrue(tc, t.headers == ctx->header_nodes);
+        CuAssertIntEquals(tc, 0, t.cleanup->nelts);
+        node = t.headers;
+        CuAssertStrEquals(tc, "Content-Length: 0", node->data);
+        node = node->next;
+        CuAssertStrEquals(tc, "Content-Type: text/plain", node->data);
+        node = node->next;
+        CuAssertStrEquals(tc, "Date: Wed, 28 Mar 2018 09:00:00 GMT", node->data);
+        CuAssertTrue(tc, node->next == NULL);
+
+        /* a second request of one call comes from the call pool */
+        oss_init_object_request(options, &bucket, &object, HTTP_GET, 
+                                &req2, params, headers, NULL, 0, &resp2);
+        CuAssertTrue(tc, req2 != req && resp2 != resp);
+        CuAssertTrue(tc, aos_http_request_context_status(ctx) != s);
+
+        oss_request_options_reset(options);
+    }
+
+    aos_pool_destroy(p);
+
+    printf("test_oss_request_options_reuse ok\n");
+}
+
+void test_oss_request_options_reuse_pool_growth(CuTest *tc)
+{
+    aos_pool_t *p;
+    oss_request_options_t *options;
+    aos_http_request_t *req;
+    aos_http_response_t *resp;
+    aos_table_t *headers;
+    aos_table_t *params;
+    aos_string_t bucket;
+    aos_string_t object;
+    char value[1024];
+    char *first;
+    char *last;
+    int i;
+
+    aos_pool_create(&p, NULL);
+    aos_str_set(&bucket, "bucket-1");
+    aos_str_set(&object, "key-2");
+    options = oss_request_options_create(p);
+    options->config = oss_config_create(p);
+    aos_str_set(&options->config->endpoint, "oss-cn-hangzhou.aliyuncs.com");
+    options->ctl = aos_http_controller_create(p, 0);
+    CuAssertIntEquals(tc, AOSE_OK, oss_request_options_reuse(options));
+    memset(value, 'v', sizeof(value) - 1);
+    value[sizeof(value) - 1] = '\0';
+
+    /* nothing is allocated from the parent pool between the two markers */
+    first = (char *)aos_palloc(p, 1);
+    for (i = 0; i < 1000; i++) {
+        headers = aos_table_create_if_null(options, NULL, 0);
+        params = aos_table_create_if_null(options, NULL, 0);
+        apr_table_set(headers, "x-oss-meta-value", value);
+        apr_table_add(headers, OSS_DATE, "Wed, 28 Mar 2018 09:00:00 GMT");
+        apr_table_set(params, "uploadId", value);
+        oss_init_object_request(options, &bucket, &object, HTTP_PUT, 
+                                &req, params, headers, NULL, 0, &resp);
+        apr_table_set(resp->headers, "x-oss-request-id", value);
+        oss_request_options_reset(options);
+    }
+    last = (char *)aos_palloc(p, 1);
+    CuAssertTrue(tc, last > first && last - first <= 64);
+
+    aos_pool_destroy(p);
+
+    printf("test_oss_request_options_reuse_pool_growth ok\n");
+}
+
+void test_aos_pool_cache(CuTest *tc)
+{
+    aos_pool_t *p1;
+    aos_pool_t *p2;
+    aos_pool_t *pools[AOS_POOL_CACHE_SIZE + 1];
+    aos_pool_t *subpool;
+    aos_pool_stats_t before;
+    aos_pool_stats_t after;
+    aos_pool_stats_t global;
+    char *buf;
+    int i;
+
+    aos_pool_get_thread_stats(&before);
+
+    /* a released pool comes back cleared from the cache of the thread */
+    CuAssertIntEquals(tc, APR_SUCCESS, aos_pool_acquire(&p1));
+    buf = (char *)aos_palloc(p1, 64 * 1024);
+    memset(buf, 'a', 64 * 1024);
+    aos_pool_create(&subpool, p1);
+    aos_palloc(subpool, 1024);
+    aos_pool_release(p1);
+    CuAssertIntEquals(tc, APR_SUCCESS, aos_pool_acquire(&p2));
+    CuAssertTrue(tc, p1 == p2);
+    aos_pool_create(&subpool, p2);
+    aos_pool_destroy(subpool);
+
+    aos_pool_get_thread_stats(&after);
+    CuAssertIntEquals(tc, 2, (int)(after.acquired - before.acquired));
+    CuAssertIntEquals(tc, 1, (int)(after.released - before.released));
+    CuAssertIntEquals(tc, before.in_use + 1, after.in_use);
+    aos_pool_release(p2);
+
+    /* the cache keeps AOS_POOL_CACHE_SIZE pools, the others are destroyed */
+    aos_pool_get_thread_stats(&before);
+    for (i = 0; i <= AOS_POOL_CACHE_SIZE; i++) {
+        CuAssertIntEquals(tc, APR_SUCCESS, aos_pool_acquire(&pools[i]));
+    }
+    for (i = 0; i <= AOS_POOL_CACHE_SIZE; i++) {
+        aos_pool_release(pools[i]);
+    }
+    aos_pool_get_thread_stats(&after);
+    CuAssertIntEquals(tc, 1, (int)(after.destroyed - before.destroyed));
+    CuAssertTrue(tc, after.peak_in_use >= AOS_POOL_CACHE_SIZE + 1);
+    CuAssertIntEquals(tc, before.in_use, after.in_use);
+
+    aos_pool_get_stats(&global);
+    CuAssertTrue(tc, global.acquired >= after.acquired);
+    CuAssertTrue(tc, global.peak_in_use >= after.peak_in_use);
+
+    printf("test_aos_pool_cache ok\n");
+}
+
+void test_aos_memory_budget(CuTest *tc)
+{
+    aos_pool_t *p;
+    aos_memory_hold_t *hold;
+    aos_memory_budget_stats_t before;
+    aos_memory_budget_stats_t stats;
+    int64_t limit;
+
+    aos_memory_budget_get_stats(&before);
+    limit = before.used + 4 * AOS_MEMORY_BUDGET_UNIT;
+    aos_memory_budget_set(limit, 0);
+
+    /* a hold acquires by units */
+    aos_pool_create(&p, NULL);
+    hold = aos_memory_hold_create(p);
+    CuAssertIntEquals(tc, AOSE_OK, aos_memory_hold_use(hold, 100, 1));
+    CuAssertTrue(tc, hold->size == AOS_MEMORY_BUDGET_UNIT);
+    CuAssertIntEquals(tc, AOSE_OK, aos_memory_hold_use(hold, AOS_MEMORY_BUDGET_UNIT - 100, 1));
+    CuAssertTrue(tc, hold->size == AOS_MEMORY_BUDGET_UNIT);
+    CuAssertIntEquals(tc, AOSE_OK, aos_memory_hold_use(hold, 3 * AOS_MEMORY_BUDGET_UNIT, 1));
+    aos_memory_budget_get_stats(&stats);
+    CuAssertTrue(tc, stats.used == limit);
+    CuAssertTrue(tc, stats.peak >= limit);
+
+    /* the budget is exhausted, waiting gives up after the timeout */
+    CuAssertIntEquals(tc, AOSE_OVER_MEMORY, aos_memory_hold_use(hold, 1, 1));
+    CuAssertIntEquals(tc, AOSE_OVER_MEMORY, aos_memory_budget_acquire(1, 0));
+    aos_memory_budget_set(limit, 10 * 1000);
+    CuAssertIntEquals(tc, AOSE_OVER_MEMORY, aos_memory_budget_acquire(1, 1));
+    aos_memory_budget_get_stats(&stats);
+    CuAssertTrue(tc, stats.rejected == before.rejected + 3);
+    CuAssertTrue(tc, stats.waited == before.waited + 1);
+
+    /* the pool gives the bytes back */
+    aos_pool_destroy(p);
+    aos_memory_budget_get_stats(&stats);
+    CuAssertTrue(tc, stats.used == before.used);
+    CuAssertIntEquals(tc, AOSE_OK, aos_memory_budget_acquire(AOS_MEMORY_BUDGET_UNIT, 0));
+    aos_memory_budget_release(AOS_MEMORY_BUDGET_UNIT);
+
+    /* a known length is reserved at once, the writes within it take nothing */
+    aos_pool_create(&p, NULL);
+    hold = aos_memory_hold_create(p);
+    CuAssertIntEquals(tc, AOSE_OK, aos_memory_hold_reserve(hold, 3 * AOS_MEMORY_BUDGET_UNIT + 10, 1));
+    CuAssertTrue(tc, hold->size == 3 * AOS_MEMORY_BUDGET_UNIT + 10);
+    CuAssertIntEquals(tc, AOSE_OK, aos_memory_hold_use(hold, 3 * AOS_MEMORY_BUDGET_UNIT + 10, 0));
+    aos_memory_budget_get_stats(&stats);
+    CuAssertTrue(tc, stats.used == before.used + 3 * AOS_MEMORY_BUDGET_UNIT + 10);
+
+    /* a second reservation does not fit, it takes no part of the budget */
+    CuAssertIntEquals(tc, AOSE_OVER_MEMORY, aos_memory_hold_reserve(aos_memory_hold_create(p), 
+        AOS_MEMORY_BUDGET_UNIT, 0));
+    aos_memory_budget_get_stats(&stats);
+    CuAssertTrue(tc, stats.used == before.used + 3 * AOS_MEMORY_BUDGET_UNIT + 10);
+    aos_pool_destroy(p);
+    aos_memory_budget_get_stats(&stats);
+    CuAssertTrue(tc, stats.used == before.used);
+
+    aos_memory_budget_set(before.limit, 0);
+
+    printf("test_aos_memory_budget ok\n");
+}
+
+void test_aos_http_response_parse_header(CuTest *tc)
+{
+    aos_pool_t *p;
+    aos_http_response_t *resp;
+    aos_table_t *headers;
+    aos_status_t *s;
+    int i;
+    const char *lines[] = {
+        "HTTP/1.1 200 OK\r\n",
+        "content-length:  1024 \r\n",
+        "ETag: \"D41D8CD98F00B204E9800998ECF8427E\"\r\n",
+        "x-img-request-id: img-id\r\n",
+        "x-oss-request-id: 5A2B3C4D\r\n",
+        "x-oss-hash-crc64ecma: 18446744073709551615\r\n",
+        "Last-Modified: Wed, 28 Mar 2018 09:00:00 GMT\r\n",
+        "\r\n"
+    };
+
+    aos_pool_create(&p, NULL);
+    resp = aos_http_response_create(p);
+    for (i = 0; i < (int)(sizeof(lines) / sizeof(lines[0])); i++) {
+        aos_http_response_parse_header(resp, lines[i], (int)strlen(lines[i]));
+    }
+
+    /* the well-known headers are in their fields */
+    CuAssertTrue(tc, resp->content_length == 1024);
+    CuAssertStrEquals(tc, "\"D41D8CD98F00B204E9800998ECF8427E\"", resp->etag.data);
+    CuAssertIntEquals(tc, 34, resp->etag.len);
+    CuAssertStrEquals(tc, "5A2B3C4D", resp->req_id);
+    CuAssertIntEquals(tc, 1, resp->has_hash_crc64);
+    CuAssertTrue(tc, resp->hash_crc64 == UINT64_MAX);
+    CuAssertIntEquals(tc, AOS_TRUE, has_crc_in_response(resp));
+    s = aos_status_create(p);
+    CuAssertIntEquals(tc, AOSE_OK, oss_check_response_crc(UINT64_MAX, resp, s));
+    CuAssertIntEquals(tc, AOSE_CRC_INCONSISTENT_ERROR, oss_check_response_crc(1, resp, s));
+
+    /* the table is only built on demand */
+    CuAssertIntEquals(tc, 0, apr_table_elts(resp->headers)->nelts);
+    CuAssertStrEquals(tc, "Wed, 28 Mar 2018 09:00:00 GMT", aos_http_response_header(resp, "last-modified"));
+    CuAssertTrue(tc, aos_http_response_header(resp, "Content-Range") == NULL);
+    headers = NULL;
+    oss_fill_read_response_header(resp, &headers);
+    CuAssertIntEquals(tc, 6, apr_table_elts(headers)->nelts);
+    CuAssertStrEquals(tc, "1024", apr_table_get(headers, "Content-Length"));
+    CuAssertStrEquals(tc, "img-id", apr_table_get(headers, "x-img-request-id"));
+    CuAssertTrue(tc, headers == aos_http_response_headers(resp));
+    CuAssertIntEquals(tc, 6, apr_table_elts(headers)->nelts);
+
+    aos_pool_destroy(p);
+
+    printf("test_aos_http_response_parse_header ok\n");
+}
+
+void test_aos_curl_profile(CuTest *tc)
+{
+    aos_curl_profile_key_t key1;
+    aos_curl_profile_key_t key2;
+    aos_curl_profile_t *profile1;
+    aos_curl_profile_t *profile2;
+    CURL *curl1;
+    CURL *curl2;
+    char agent[64];
+
+    memset(&key1, 0, sizeof(key1));
+    key1.header_callback = aos_curl_default_header_callback;
+    key1.read_callback = aos_curl_default_read_callback;
+    key1.write_callback = aos_curl_default_write_callback;
+    key1.user_agent = "aos-test-profile";
+    key1.dns_cache_timeout = AOS_DNS_CACHE_TIMOUT;
+    key1.connect_timeout = AOS_CONNECT_TIMEOUT;
+    key1.speed_limit = AOS_MIN_SPEED_LIMIT;
+    key1.speed_time = AOS_MIN_SPEED_TIME;
+
+    /* equal options make the same profile, whatever the strings are */
+    key2 = key1;
+    strcpy(agent, "aos-test-profile");
+    key2.user_agent = agent;
+    profile1 = aos_curl_profile_get(&key1);
+    CuAssertTrue(tc, profile1 != NULL);
+    CuAssertTrue(tc, profile1->key.user_agent != key1.user_agent);
+    profile2 = aos_curl_profile_get(&key2);
+    CuAssertTrue(tc, profile1 == profile2);
+
+    key2.proxy_host = "127.0.0.1:8080";
+    CuAssertIntEquals(tc, 0, aos_curl_profile_key_equal(&key1, &key2));
+    key2.proxy_host = NULL;
+    key2.connect_timeout++;
+    CuAssertIntEquals(tc, 0, aos_curl_profile_key_equal(&key1, &key2));
+
+    /* the handles go back to the stack of their profile */
+    curl1 = aos_curl_profile_request_get(profile1);
+    CuAssertTrue(tc, curl1 != NULL && curl1 != profile1->curl_template);
+    aos_curl_profile_request_release(profile1, curl1);
+    curl2 = aos_curl_profile_request_get(profile1);
+    CuAssertTrue(tc, curl1 == curl2);
+    aos_curl_profile_request_release(profile1, curl2);
+
+    printf("test_aos_curl_profile ok\n");
+}
+
 CuSuite *test_aos()
 {
     CuSuite* suite = CuSuiteNew();   
 
     SUITE_ADD_TEST(suite, test_get_xml_doc_with_empty_aos_list);
+    SUITE_ADD_TEST(suite, test_oss_list_objects_parser);
+    SUITE_ADD_TEST(suite, test_oss_list_objects_compact_parser);
+    SUITE_ADD_TEST(suite, test_build_xml_body_escaped);
     SUITE_ADD_TEST(suite, test_aos_list_movelist_with_empty_list);
     SUITE_ADD_TEST(suite, test_starts_with_failed);
     SUITE_ADD_TEST(suite, test_is_valid_ip);
@@ -472,6 +1398,17 @@ CuSuite *test_aos()
     SUITE_ADD_TEST(suite, test_aos_should_retry);
     SUITE_ADD_TEST(suite, test_aos_strtoll);
     SUITE_ADD_TEST(suite, test_aos_strtoull);
+    SUITE_ADD_TEST(suite, test_oss_get_string_to_sign);
+    SUITE_ADD_TEST(suite, test_aos_codec);
+    SUITE_ADD_TEST(suite, test_digest_kernel);
+    SUITE_ADD_TEST(suite, test_aos_hmac_sha1_key_cache);
+    SUITE_ADD_TEST(suite, test_oss_client);
+    SUITE_ADD_TEST(suite, test_oss_request_options_reuse);
+    SUITE_ADD_TEST(suite, test_oss_request_options_reuse_pool_growth);
+    SUITE_ADD_TEST(suite, test_aos_pool_cache);
+    SUITE_ADD_TEST(suite, test_aos_memory_budget);
+    SUITE_ADD_TEST(suite, test_aos_http_response_parse_header);
+    SUITE_ADD_TEST(suite, test_aos_curl_profile);
 
     return suite;
 }
@@ -0,0 +1,169 @@
+#include "CuTest.h"
+#include "aos_log.h"
+#include "aos_util.h"
+#include "aos_http_io.h"
+#include "aos_crc64.h"
+#include "aos_digest.h"
+
+/*
+ * The throughput of the kernels against the portable code. They take
+ * seconds and only print the numbers, so they are not part of
+ * oss_c_sdk_test and are built by "make oss_c_sdk_benchmark" only.
+ */
+
+void test_crc_benchmark(CuTest *tc)
+{
+    aos_pool_t *p = NULL;
+    size_t len = 16 * 1024 * 1024;
+    int rounds = 8;
+    unsigned char *buf;
+    uint64_t crc1 = 0;
+    uint64_t crc2 = 0;
+    apr_time_t start;
+    apr_time_t kernel_time;
+    apr_time_t slice8_time;
+    size_t i;
+    int r;
+
+    aos_pool_create(&p, NULL);
+    buf = (unsigned char *)aos_palloc(p, len);
+    for (i = 0; i < len; i++) {
+        buf[i] = (unsigned char)(i * 2654435761u >> 13);
+    }
+
+    start = apr_time_now();
+    for (r = 0; r < rounds; r++) {
+        crc1 = aos_crc64(crc1, buf, len);
+    }
+    kernel_time = aos_max(apr_time_now() - start, 1);
+
+    start = apr_time_now();
+    for (r = 0; r < rounds; r++) {
+        crc2 = aos_crc64_slice8(crc2, buf, len);
+    }
+    slice8_time = aos_max(apr_time_now() - start, 1);
+
+    CuAssertTrue(tc, crc1 == crc2);
+
+    aos_pool_destroy(p);
+
+    printf("test_crc_benchmark ok, %s:%.2f GB/s, slice-by-8:%.2f GB/s\n", aos_crc64_kernel(),
+        (double)len * rounds / kernel_time / 1000, (double)len * rounds / slice8_time / 1000);
+}
+
+void test_digest_benchmark(CuTest *tc)
+{
+    aos_pool_t *p = NULL;
+    apr_size_t len = 16 * 1024 * 1024;
+    int rounds = 4;
+    unsigned char *buf;
+    unsigned char digest[4][APR_MD5_DIGESTSIZE];
+    aos_sha1_ctx_t sha1;
+    apr_sha1_ctx_t apr_sha1;
+    aos_md5_ctx_t md5[4];
+    aos_md5_ctx_t *lanes[4];
+    const unsigned char *data[4];
+    apr_size_t lens[4];
+    apr_time_t start;
+    apr_time_t sha1_time;
+    apr_time_t apr_sha1_time;
+    apr_time_t md5_time;
+    apr_time_t apr_md5_time;
+    apr_size_t i;
+    int r;
+    int k;
+
+    aos_pool_create(&p, NULL);
+    buf = (unsigned char *)aos_palloc(p, len);
+    for (i = 0; i < len; i++) {
+        buf[i] = (unsigned char)(i * 2654435761u >> 13);
+    }
+
+    start = apr_time_now();
+    for (r = 0; r < rounds; r++) {
+        aos_sha1_init(&sha1);
+        aos_sha1_update(&sha1, buf, len);
+        aos_sha1_final(digest[0], &sha1);
+    }
+    sha1_time = aos_max(apr_time_now() - start, 1);
+
+    start = apr_time_now();
+    for (r = 0; r < rounds; r++) {
+        apr_sha1_init(&apr_sha1);
+        apr_sha1_update_binary(&apr_sha1, buf, (unsigned int)len);
+        apr_sha1_final(digest[1], &apr_sha1);
+    }
+    apr_sha1_time = aos_max(apr_time_now() - start, 1);
+    CuAssertTrue(tc, memcmp(digest[0], digest[1], APR_SHA1_DIGESTSIZE) == 0);
+
+    /* four streams, abreast and one after another */
+    for (k = 0; k < 4; k++) {
+        lanes[k] = &md5[k];
+        data[k] = buf + k;
+        lens[k] = len - 4;
+    }
+    start = apr_time_now();
+    for (r = 0; r < rounds; r++) {
+        for (k = 0; k < 4; k++) {
+            aos_md5_init(&md5[k]);
+        }
+        aos_md5_multi_update(lanes, data, lens, 4);
+    }
+    aos_md5_final(digest[0], &md5[3]);
+    md5_time = aos_max(apr_time_now() - start, 1);
+
+    start = apr_time_now();
+    for (r = 0; r < rounds; r++) {
+        for (k = 0; k < 4; k++) {
+            apr_md5_init(&md5[k]);
+            apr_md5_update(&md5[k], data[k], lens[k]);
+        }
+    }
+    apr_md5_final(digest[1], &md5[3]);
+    apr_md5_time = aos_max(apr_time_now() - start, 1);
+    CuAssertTrue(tc, memcmp(digest[0], digest[1], APR_MD5_DIGESTSIZE) == 0);
+
+    aos_pool_destroy(p);
+
+    printf("test_digest_benchmark ok, sha1 %s:%.2f GB/s, apr:%.2f GB/s, md5 x4 %s:%.2f GB/s, apr:%.2f GB/s\n",
+        aos_sha1_kernel(), (double)len * rounds / sha1_time / 1000, 
+        (double)len * rounds / apr_sha1_time / 1000, aos_md5_kernel(),
+        (double)len * 4 * rounds / md5_time / 1000, (double)len * 4 * rounds / apr_md5_time / 1000);
+}
+
+CuSuite *test_aos_benchmark()
+{
+    CuSuite* suite = CuSuiteNew();
+
+    SUITE_ADD_TEST(suite, test_crc_benchmark);
+    SUITE_ADD_TEST(suite, test_digest_benchmark);
+
+    return suite;
+}
+
+int main(int argc, char *argv[])
+{
+    int exit_code;
+    CuSuite *suite = NULL;
+    CuString *output = NULL;
+
+    if (aos_http_io_initialize(NULL, 0) != AOSE_OK) {
+        exit(1);
+    }
+    aos_log_set_level(AOS_LOG_OFF);
+
+    suite = test_aos_benchmark();
+    output = CuStringNew();
+    CuSuiteRun(suite);
+    CuSuiteSummary(suite, output);
+    CuSuiteDetails(suite, output);
+    printf("%s\n", output->buffer);
+
+    exit_code = suite->failCount > 0 ? 1 : 0;
+
+    CuSuiteFreeDeep(suite);
+    CuStringFree(output);
+    aos_http_io_deinitialize();
+
+    return exit_code;
+}
@@ -223,6 +223,60 @@ void test_list_object(CuTest *tc)
     printf("test_list_object ok\n");
 }
 
+void test_list_object_iterator(CuTest *tc)
+{
+    aos_pool_t *p = NULL;
+    aos_string_t bucket;
+    oss_request_options_t *options = NULL;
+    int is_cname = 0;
+    aos_status_t *s = NULL;
+    oss_list_object_params_t *params = NULL;
+    oss_list_iterator_t *iter = NULL;
+    oss_list_object_page_t *page = NULL;
+    oss_list_object_content_t *content = NULL;
+    int page_num = 0;
+    int size = 0;
+    char *keys[2];
+
+    aos_pool_create(&p, NULL);
+    options = oss_request_options_create(p);
+    init_test_request_options(options, is_cname);
+    params = oss_create_list_object_params(p);
+    params->max_ret = 1;
+    aos_str_set(&params->prefix, "oss_test");
+    aos_str_set(&bucket, TEST_BUCKET_NAME);
+
+    // a page a key, the second page is listed while the first one is processed
+    s = oss_create_list_iterator(options, &bucket, params, 2, &iter);
+    CuAssertIntEquals(tc, 200, s->code);
+    CuAssertPtrNotNull(tc, iter);
+
+    for (s = oss_list_iterator_next(iter, &page); page != NULL; s = oss_list_iterator_next(iter, &page)) {
+        CuAssertIntEquals(tc, 200, s->code);
+        CuAssertIntEquals(tc, page_num == 0, page->truncated);
+        aos_list_for_each_entry(oss_list_object_content_t, content, &page->object_list, node) {
+            CuAssertTrue(tc, size < 2);
+            keys[size++] = apr_psprintf(p, "%.*s", content->key.len, content->key.data);
+        }
+        ++page_num;
+    }
+    CuAssertIntEquals(tc, 200, s->code);
+    CuAssertIntEquals(tc, 2, page_num);
+    CuAssertIntEquals(tc, 2, size);
+    CuAssertStrEquals(tc, "oss_test_object1", keys[0]);
+    CuAssertStrEquals(tc, "oss_test_object2", keys[1]);
+
+    // the end is sticky
+    s = oss_list_iterator_next(iter, &page);
+    CuAssertIntEquals(tc, 200, s->code);
+    CuAssertPtrEquals(tc, NULL, page);
+
+    oss_list_iterator_destroy(iter);
+    aos_pool_destroy(p);
+
+    printf("test_list_object_iterator ok\n");
+}
+
 void test_list_object_with_delimiter(CuTest *tc)
 {
     aos_pool_t *p = NULL;
@@ -486,6 +540,144 @@ void test_delete_objects_by_prefix(CuTest *tc)
     printf("test_delete_object_by_prefix ok\n");
 }
 
+void test_delete_objects_by_prefix_concurrently(CuTest *tc)
+{
+    aos_pool_t *p = NULL;
+    oss_request_options_t *options = NULL;
+    int is_cname = 0;
+    aos_string_t bucket;
+    aos_status_t *s = NULL;
+    aos_string_t prefix;
+    char *prefix_str = "oss_tmp4/";
+    char *object_name = NULL;
+    char *str = "test c oss sdk";
+    aos_table_t *headers = NULL;
+    oss_delete_objects_by_prefix_params_t *params = NULL;
+    oss_list_object_params_t *list_params = NULL;
+    int i;
+
+    aos_pool_create(&p, NULL);
+    options = oss_request_options_create(p);
+    init_test_request_options(options, is_cname);
+    aos_str_set(&bucket, TEST_BUCKET_NAME);
+    aos_str_set(&prefix, prefix_str);
+
+    for (i = 0; i < 7; i++) {
+        object_name = apr_psprintf(p, "%s%d", prefix_str, i);
+        headers = aos_table_make(p, 0);
+        s = create_test_object(options, TEST_BUCKET_NAME, object_name, str, headers);
+        CuAssertIntEquals(tc, 200, s->code);
+    }
+
+    // 4 batches of at most 2 keys, 2 deleting and 1 waiting
+    params = oss_create_delete_objects_by_prefix_params(p);
+    params->thread_num = 2;
+    params->queue_num = 1;
+    params->batch_size = 2;
+    s = oss_do_delete_objects_by_prefix(options, &bucket, &prefix, params, NULL);
+    CuAssertIntEquals(tc, 200, s->code);
+    CuAssertTrue(tc, 7 == params->deleted_num);
+    CuAssertTrue(tc, 0 == params->failed_num);
+    CuAssertTrue(tc, aos_list_empty(&params->failed_object_list));
+
+    list_params = oss_create_list_object_params(p);
+    aos_str_set(&list_params->prefix, prefix_str);
+    s = oss_list_object(options, &bucket, list_params, NULL);
+    CuAssertIntEquals(tc, 200, s->code);
+    CuAssertTrue(tc, aos_list_empty(&list_params->object_list));
+
+    aos_pool_destroy(p);
+
+    printf("test_delete_objects_by_prefix_concurrently ok\n");
+}
+
+static int count_walked_object(const oss_list_object_content_t *content, void *user_data)
+{
+    apr_atomic_inc32((apr_uint32_t *)user_data);
+    return AOSE_OK;
+}
+
+void test_parallel_walk(CuTest *tc)
+{
+    aos_pool_t *p = NULL;
+    oss_request_options_t *options = NULL;
+    int is_cname = 0;
+    aos_string_t bucket;
+    aos_status_t *s = NULL;
+    aos_string_t prefix;
+    char *prefix_str = "oss_tmp5/";
+    char *object_names[] = {"oss_tmp5/1", "oss_tmp5/a/2", "oss_tmp5/a/3", "oss_tmp5/b/c/4"};
+    char *str = "test c oss sdk";
+    aos_table_t *headers = NULL;
+    oss_parallel_walk_params_t *params = NULL;
+    oss_walk_prefix_stat_t *stat = NULL;
+    apr_uint32_t visited = 0;
+    int i;
+
+    aos_pool_create(&p, NULL);
+    options = oss_request_options_create(p);
+    init_test_request_options(options, is_cname);
+    aos_str_set(&bucket, TEST_BUCKET_NAME);
+    aos_str_set(&prefix, prefix_str);
+
+    for (i = 0; i < 4; i++) {
+        headers = aos_table_make(p, 0);
+        s = create_test_object(options, TEST_BUCKET_NAME, object_names[i], str, headers);
+        CuAssertIntEquals(tc, 200, s->code);
+    }
+
+    params = oss_create_parallel_walk_params(p);
+    params->thread_num = 2;
+    params->visitor = count_walked_object;
+    params->user_data = &visited;
+    params->aggregate = 1;
+    s = oss_parallel_walk(options, &bucket, &prefix, params);
+    CuAssertIntEquals(tc, 200, s->code);
+    CuAssertTrue(tc, 4 == params->object_num);
+    CuAssertTrue(tc, 4 * strlen(str) == params->total_size);
+    CuAssertIntEquals(tc, 4, visited);
+
+    // du of each prefix, sorted by prefix
+    i = 0;
+    aos_list_for_each_entry(oss_walk_prefix_stat_t, stat, &params->prefix_stat_list, node) {
+        if (i == 0) {
+            CuAssertStrEquals(tc, "oss_tmp5/", stat->prefix.data);
+            CuAssertIntEquals(tc, 0, stat->depth);
+            CuAssertTrue(tc, 4 == stat->object_num);
+        } else if (i == 1) {
+            CuAssertStrEquals(tc, "oss_tmp5/a/", stat->prefix.data);
+            CuAssertTrue(tc, 2 == stat->object_num);
+            CuAssertTrue(tc, 2 * strlen(str) == stat->total_size);
+        } else if (i == 2) {
+            CuAssertStrEquals(tc, "oss_tmp5/b/", stat->prefix.data);
+            CuAssertTrue(tc, 1 == stat->object_num);
+        } else if (i == 3) {
+            CuAssertStrEquals(tc, "oss_tmp5/b/c/", stat->prefix.data);
+            CuAssertIntEquals(tc, 2, stat->depth);
+            CuAssertTrue(tc, 1 == stat->object_num);
+        }
+        i++;
+    }
+    CuAssertIntEquals(tc, 4, i);
+
+    // sub prefixes deeper than max_depth are listed as a whole
+    params->max_depth = 1;
+    params->visitor = NULL;
+    s = oss_parallel_walk(options, &bucket, &prefix, params);
+    CuAssertIntEquals(tc, 200, s->code);
+    CuAssertTrue(tc, 4 == params->object_num);
+    stat = aos_list_get_last(&params->prefix_stat_list, oss_walk_prefix_stat_t, node);
+    CuAssertStrEquals(tc, "oss_tmp5/b/", stat->prefix.data);
+    CuAssertTrue(tc, 1 == stat->object_num);
+
+    s = oss_delete_objects_by_prefix(options, &bucket, &prefix);
+    CuAssertIntEquals(tc, 200, s->code);
+
+    aos_pool_destroy(p);
+
+    printf("test_parallel_walk ok\n");
+}
+
 CuSuite *test_oss_bucket()
 {
     CuSuite* suite = CuSuiteNew();
@@ -495,8 +687,11 @@ CuSuite *test_oss_bucket()
     SUITE_ADD_TEST(suite, test_put_bucket_acl);
     SUITE_ADD_TEST(suite, test_get_bucket_acl);
     SUITE_ADD_TEST(suite, test_delete_objects_by_prefix);
+    SUITE_ADD_TEST(suite, test_delete_objects_by_prefix_concurrently);
     SUITE_ADD_TEST(suite, test_list_object);
+    SUITE_ADD_TEST(suite, test_list_object_iterator);
     SUITE_ADD_TEST(suite, test_list_object_with_delimiter);
+    SUITE_ADD_TEST(suite, test_parallel_walk);
     SUITE_ADD_TEST(suite, test_delete_bucket);
     SUITE_ADD_TEST(suite, test_lifecycle);
     SUITE_ADD_TEST(suite, test_delete_objects_quiet);
@@ -246,6 +246,232 @@ void test_crc_combine(CuTest *tc)
      printf("test_crc_combine ok\n");
 }
 
+void test_crc_combine_parts(CuTest *tc)
+{
+    oss_checkpoint_part_t parts[4];
+    aos_crc64_zeros_t zeros;
+    char buf[1000];
+    uint64_t crc;
+    int64_t part_size = 300;
+    int part_num;
+    int i;
+
+    for (i = 0; i < (int)sizeof(buf); i++) {
+        buf[i] = (char)(i * 7 + 3);
+    }
+
+    /* the cached operator of a block length */
+    aos_crc64_zeros_init(&zeros, 700);
+    crc = aos_crc64_combine_zeros(&zeros, aos_crc64(0, buf, 300), aos_crc64(0, buf + 300, 700));
+    CuAssertTrue(tc, crc == aos_crc64(0, buf, sizeof(buf)));
+
+    /* the parts of the same size and a short last part */
+    part_num = oss_get_part_num(sizeof(buf), part_size);
+    CuAssertIntEquals(tc, 4, part_num);
+    oss_build_parts(sizeof(buf), part_size, parts);
+    for (i = 0; i < part_num; i++) {
+        parts[i].crc64 = aos_crc64(0, buf + parts[i].offset, (size_t)parts[i].size);
+    }
+    CuAssertIntEquals(tc, AOS_TRUE, oss_get_parts_crc64(parts, part_num, &crc));
+    CuAssertTrue(tc, crc == aos_crc64(0, buf, sizeof(buf)));
+
+    /* a part without crc64 */
+    parts[2].crc64 = 0;
+    CuAssertIntEquals(tc, AOS_FALSE, oss_get_parts_crc64(parts, part_num, &crc));
+
+    printf("test_crc_combine_parts ok\n");
+}
+
+void test_crc_kernel(CuTest *tc)
+{
+    unsigned char buf[4096 + 16];
+    uint64_t crc;
+    size_t offset;
+    size_t len;
+
+    for (len = 0; len < sizeof(buf); len++) {
+        buf[len] = (unsigned char)(len * 31 + 7);
+    }
+
+    /* every alignment and tail length of the folding kernel */
+    for (offset = 0; offset < 16; offset++) {
+        for (len = 0; len <= 4096; len += (len < 512 ? 1 : 61)) {
+            crc = UINT64_C(0x0123456789abcdef) * len;
+            CuAssertTrue(tc, aos_crc64(crc, buf + offset, len) == aos_crc64_slice8(crc, buf + offset, len));
+        }
+    }
+
+    printf("test_crc_kernel ok, kernel:%s\n", aos_crc64_kernel());
+}
+
+void test_crc_stage(CuTest *tc)
+{
+    aos_pool_t *p = NULL;
+    char *object_name = "oss_test_crc_put_object.txt";
+    size_t len = 3 * AOS_CRC64_CHUNK_SIZE + 1234;
+    size_t step;
+    size_t i;
+    char *buf;
+    uint64_t crc;
+    aos_crc64_stage_t *stage;
+    aos_status_t *s = NULL;
+    int is_cname = 0;
+    aos_string_t bucket;
+    aos_string_t object;
+    oss_request_options_t *options = NULL;
+    aos_table_t *resp_headers = NULL;
+    aos_list_t buffer;
+    aos_buf_t *content;
+
+    aos_pool_create(&p, NULL);
+    buf = (char *)aos_palloc(p, len);
+    for (i = 0; i < len; i++) {
+        buf[i] = (char)(i * 2654435761u >> 11);
+    }
+
+    /* uneven feeds across the chunks and an initial crc */
+    stage = aos_crc64_stage_create(p, 0x1234, len);
+    for (i = 0; i < len; i += step) {
+        step = aos_min(len - i, 1000 + i % 70000);
+        aos_crc64_stage_feed(stage, buf + i, step);
+    }
+    crc = aos_crc64_stage_finish(stage);
+    CuAssertTrue(tc, crc == aos_crc64(0x1234, buf, len));
+
+    /* nothing fed */
+    stage = aos_crc64_stage_create(p, 0, len);
+    CuAssertTrue(tc, 0 == aos_crc64_stage_finish(stage));
+
+    /* a body of one chunk or of unknown size is hashed inline */
+    CuAssertTrue(tc, NULL == aos_crc64_stage_create(p, 0, AOS_CRC64_CHUNK_SIZE));
+    CuAssertTrue(tc, NULL == aos_crc64_stage_create(p, 0, -1));
+
+    /* a round trip with the hashing offloaded */
+    options = oss_request_options_create(p);
+    init_test_request_options(options, is_cname);
+    options->ctl->options->enable_crc = AOS_TRUE;
+    options->ctl->options->enable_crc_offload = AOS_TRUE;
+
+    aos_str_set(&bucket, TEST_BUCKET_NAME);
+    aos_str_set(&object, object_name);
+    aos_list_init(&buffer);
+    content = aos_buf_pack(options->pool, buf, (int)len);
+    aos_list_add_tail(&content->node, &buffer);
+
+    s = oss_put_object_from_buffer(options, &bucket, &object, &buffer, NULL, &resp_headers);
+    CuAssertIntEquals(tc, 200, s->code);
+
+    aos_list_init(&buffer);
+    s = oss_get_object_to_buffer(options, &bucket, &object, NULL, NULL, &buffer, &resp_headers);
+    CuAssertIntEquals(tc, 200, s->code);
+    CuAssertIntEquals(tc, (int)len, (int)aos_buf_list_len(&buffer));
+
+    options->ctl->options->enable_crc_offload = AOS_FALSE;
+    aos_pool_destroy(p);
+
+    printf("test_crc_stage ok\n");
+}
+
+static void set_range_response(aos_pool_t *p, aos_http_response_t *resp, const char *buf, 
+                               int64_t start, int64_t end, int64_t total, uint64_t crc64)
+{
+    char *line;
+
+    resp->pool = p;
+    resp->headers = aos_table_make(p, 2);
+    resp->header_lines = NULL;
+    line = apr_psprintf(p, "%s: bytes %" APR_INT64_T_FMT "-%" APR_INT64_T_FMT "/%" APR_INT64_T_FMT "\r\n", 
+        OSS_CONTENT_RANGE, start, end, total);
+    aos_http_response_parse_header(resp, line, (int)strlen(line));
+    line = apr_psprintf(p, "%s: %" APR_UINT64_T_FMT "\r\n", OSS_HASH_CRC64_ECMA, crc64);
+    aos_http_response_parse_header(resp, line, (int)strlen(line));
+    resp->body_len = end - start + 1;
+    resp->crc64 = aos_crc64(0, (void *)(buf + start), (size_t)resp->body_len);
+}
+
+void test_crc_ranges(CuTest *tc)
+{
+    aos_pool_t *p = NULL;
+    char *object_name = "oss_test_crc_put_object.txt";
+    char buf[1000];
+    uint64_t crc;
+    aos_http_response_t resp;
+    oss_range_crc64_t *range_crc;
+    aos_status_t *s = NULL;
+    int is_cname = 0;
+    aos_string_t bucket;
+    aos_string_t object;
+    oss_request_options_t *options = NULL;
+    aos_list_t buffer;
+    aos_buf_t *content;
+    int i;
+
+    aos_pool_create(&p, NULL);
+    for (i = 0; i < (int)sizeof(buf); i++) {
+        buf[i] = (char)(i * 13 + 5);
+    }
+    crc = aos_crc64(0, buf, sizeof(buf));
+    memset(&resp, 0, sizeof(resp));
+
+    /* the ranges out of order, checked once they cover the object */
+    range_crc = oss_create_range_crc64(p);
+    s = aos_status_create(p);
+    set_range_response(p, &resp, buf, 600, 999, 1000, crc);
+    CuAssertIntEquals(tc, AOSE_OK, oss_add_range_crc64(range_crc, &resp, s));
+    set_range_response(p, &resp, buf, 0, 299, 1000, crc);
+    CuAssertIntEquals(tc, AOSE_OK, oss_add_range_crc64(range_crc, &resp, s));
+    CuAssertIntEquals(tc, AOS_FALSE, range_crc->verified);
+    set_range_response(p, &resp, buf, 300, 599, 1000, crc);
+    CuAssertIntEquals(tc, AOSE_OK, oss_add_range_crc64(range_crc, &resp, s));
+    CuAssertIntEquals(tc, AOS_TRUE, range_crc->verified);
+
+    /* a corrupted range */
+    range_crc = oss_create_range_crc64(p);
+    set_range_response(p, &resp, buf, 0, 499, 1000, crc);
+    CuAssertIntEquals(tc, AOSE_OK, oss_add_range_crc64(range_crc, &resp, s));
+    set_range_response(p, &resp, buf, 500, 999, 1000, crc);
+    resp.crc64 ^= 1;
+    CuAssertIntEquals(tc, AOSE_CRC_INCONSISTENT_ERROR, oss_add_range_crc64(range_crc, &resp, s));
+    CuAssertIntEquals(tc, AOSE_CRC_INCONSISTENT_ERROR, s->code);
+
+    /* the range fetched again replaces the corrupted one */
+    s = aos_status_create(p);
+    set_range_response(p, &resp, buf, 500, 999, 1000, crc);
+    CuAssertIntEquals(tc, AOSE_OK, oss_add_range_crc64(range_crc, &resp, s));
+    CuAssertIntEquals(tc, AOS_TRUE, range_crc->verified);
+
+    /* the object is overwritten between the ranges */
+    range_crc = oss_create_range_crc64(p);
+    set_range_response(p, &resp, buf, 0, 499, 1000, crc);
+    CuAssertIntEquals(tc, AOSE_OK, oss_add_range_crc64(range_crc, &resp, s));
+    set_range_response(p, &resp, buf, 500, 999, 1000, crc + 1);
+    CuAssertIntEquals(tc, AOSE_CRC_INCONSISTENT_ERROR, oss_add_range_crc64(range_crc, &resp, s));
+
+    /* the ranges of an object from oss */
+    options = oss_request_options_create(p);
+    init_test_request_options(options, is_cname);
+    aos_str_set(&bucket, TEST_BUCKET_NAME);
+    aos_str_set(&object, object_name);
+    aos_list_init(&buffer);
+    content = aos_buf_pack(options->pool, buf, sizeof(buf));
+    aos_list_add_tail(&content->node, &buffer);
+    s = oss_put_object_from_buffer(options, &bucket, &object, &buffer, NULL, NULL);
+    CuAssertIntEquals(tc, 200, s->code);
+
+    range_crc = oss_create_range_crc64(p);
+    for (i = 0; i < (int)sizeof(buf); i += 256) {
+        aos_list_init(&buffer);
+        s = oss_get_object_range_to_buffer(options, &bucket, &object, i, 256, NULL, NULL, 
+                                           range_crc, &buffer, NULL);
+        CuAssertIntEquals(tc, 206, s->code);
+    }
+    CuAssertIntEquals(tc, AOS_TRUE, range_crc->verified);
+
+    aos_pool_destroy(p);
+
+    printf("test_crc_ranges ok\n");
+}
+
 void test_crc_negative(CuTest *tc)
 {
     aos_pool_t *p = NULL;
@@ -294,6 +520,10 @@ CuSuite *test_oss_crc()
     SUITE_ADD_TEST(suite, test_crc_append_object_from_file);
     SUITE_ADD_TEST(suite, test_crc_disable_crc);
     SUITE_ADD_TEST(suite, test_crc_combine);
+    SUITE_ADD_TEST(suite, test_crc_combine_parts);
+    SUITE_ADD_TEST(suite, test_crc_kernel);
+    SUITE_ADD_TEST(suite, test_crc_stage);
+    SUITE_ADD_TEST(suite, test_crc_ranges);
     SUITE_ADD_TEST(suite, test_crc_negative);
     SUITE_ADD_TEST(suite, test_crc_cleanup);
 
@@ -13,6 +13,12 @@
 #include "oss_test_util.h"
 #include "oss_multipart.c"
 
+#if defined(WIN32)
+static char *test_multipart_local_file = "..\\oss_c_sdk_test\\BingWallpaper-2017-01-19.jpg";
+#else
+static char *test_multipart_local_file = "oss_c_sdk_test/BingWallpaper-2017-01-19.jpg";
+#endif
+
 void test_multipart_setup(CuTest *tc)
 {
     aos_pool_t *p = NULL;
@@ -45,6 +51,7 @@ void test_multipart_cleanup(CuTest *tc)
     char *object_name4 = "oss_test_list_upload_part_with_empty";
     char *object_name5 = "test_oss_get_sorted_uploaded_part";
     char *object_name6 = "test_oss_get_sorted_uploaded_part_with_empty";
+    char *object_name7 = "oss_test_multipart_upload_from_file_with_holes";
     aos_table_t *resp_headers = NULL;
 
     aos_pool_create(&p, NULL);
@@ -59,6 +66,7 @@ void test_multipart_cleanup(CuTest *tc)
     delete_test_object(options, TEST_BUCKET_NAME, object_name4);
     delete_test_object(options, TEST_BUCKET_NAME, object_name5);
     delete_test_object(options, TEST_BUCKET_NAME, object_name6);
+    delete_test_object(options, TEST_BUCKET_NAME, object_name7);
 
     //delete test bucket
     aos_str_set(&bucket, TEST_BUCKET_NAME);
@@ -569,6 +577,65 @@ void test_upload_file_from_recover(CuTest *tc)
     printf("test_upload_file_from_recover ok\n");
 }
 
+void test_upload_file_from_recover_with_holes(CuTest *tc) 
+{
+    aos_pool_t *p = NULL;
+    aos_string_t bucket;
+    char *object_name = "oss_test_multipart_upload_from_file_with_holes";
+    aos_string_t object; 
+    int is_cname = 0; 
+    oss_request_options_t *options = NULL;
+    aos_status_t *s = NULL;
+    int part_size = 100*1024;
+    aos_string_t upload_id;
+    aos_string_t filepath;
+    oss_upload_file_t *upload_file = NULL;
+    aos_table_t *resp_headers = NULL;
+    int64_t content_length = 0;
+
+    aos_pool_create(&p, NULL);
+    options = oss_request_options_create(p);
+    init_test_request_options(options, is_cname);
+    aos_str_set(&bucket, TEST_BUCKET_NAME);
+    aos_str_set(&object, object_name);
+    aos_str_set(&filepath, test_multipart_local_file);
+
+    //init mulitipart
+    s = init_test_multipart_upload(options, TEST_BUCKET_NAME, 
+                                   object_name, &upload_id);
+    CuAssertIntEquals(tc, 200, s->code);
+
+    //upload part 2 and 4 only
+    upload_file = oss_create_upload_file(p);
+    aos_str_set(&upload_file->filename, test_multipart_local_file);
+    upload_file->file_pos = part_size;
+    upload_file->file_last = part_size * 2;
+    s = oss_upload_part_from_file(options, &bucket, &object, &upload_id, 2, 
+                                  upload_file, &resp_headers);
+    CuAssertIntEquals(tc, 200, s->code);
+
+    upload_file->file_pos = part_size * 3;
+    upload_file->file_last = part_size * 4;
+    s = oss_upload_part_from_file(options, &bucket, &object, &upload_id, 4, 
+                                  upload_file, &resp_headers);
+    CuAssertIntEquals(tc, 200, s->code);
+
+    //upload the missing parts
+    s = oss_do_upload_file(options, &bucket, &object, &upload_id, &filepath, 
+                           part_size, 3, NULL);
+    CuAssertIntEquals(tc, 200, s->code);
+
+    //head object
+    s = oss_head_object(options, &bucket, &object, NULL, &resp_headers);
+    CuAssertIntEquals(tc, 200, s->code);
+    content_length = atol((char*)apr_table_get(resp_headers, OSS_CONTENT_LENGTH));
+    CuAssertTrue(tc, content_length == get_file_size(test_multipart_local_file));
+
+    aos_pool_destroy(p);
+
+    printf("test_upload_file_from_recover_with_holes ok\n");
+}
+
 void test_upload_file_from_recover_failed(CuTest *tc) 
 {
     aos_pool_t *p = NULL;
@@ -798,6 +865,7 @@ CuSuite *test_oss_multipart()
     SUITE_ADD_TEST(suite, test_upload_file);
     SUITE_ADD_TEST(suite, test_upload_file_failed_without_uploadid);
     SUITE_ADD_TEST(suite, test_upload_file_from_recover);
+    SUITE_ADD_TEST(suite, test_upload_file_from_recover_with_holes);
     SUITE_ADD_TEST(suite, test_upload_file_from_recover_failed);
     SUITE_ADD_TEST(suite, test_upload_part_copy);
     SUITE_ADD_TEST(suite, test_list_upload_part_with_empty);
@@ -51,6 +51,7 @@ void test_resumable_cleanup(CuTest *tc)
     delete_test_object(options, TEST_BUCKET_NAME, "test_resumable_upload_without_checkpoint.jpg");
     delete_test_object(options, TEST_BUCKET_NAME, "test_resumable_upload_partsize.jpg");
     delete_test_object(options, TEST_BUCKET_NAME, "test_resumable_upload_threads.jpg");
+    delete_test_object(options, TEST_BUCKET_NAME, "test_resumable_upload_auto_tune.jpg");
     delete_test_object(options, TEST_BUCKET_NAME, "test_resumable_upload_with_checkpoint.jpg");
     delete_test_object(options, TEST_BUCKET_NAME, "test_resumable_upload_with_checkpoint_format_invalid.jpg");
     delete_test_object(options, TEST_BUCKET_NAME, "test_resumable_upload_with_file_size_unavailable.jpg");
@@ -60,6 +61,7 @@ void test_resumable_cleanup(CuTest *tc)
     delete_test_object(options, TEST_BUCKET_NAME, "test_resumable_upload_progress_without_checkpoint.jpg");
     delete_test_object(options, TEST_BUCKET_NAME, "test_resumable_upload_callback_with_checkpoint.jpg");
     delete_test_object(options, TEST_BUCKET_NAME, "test_resumable_upload_progress_with_checkpoint.jpg");
+    delete_test_object(options, TEST_BUCKET_NAME, "test_resumable_parallel_copy_object.jpg");
 
     /* delete test bucket */
     aos_str_set(&bucket, TEST_BUCKET_NAME);
@@ -227,7 +229,9 @@ void test_resumable_oss_dump_checkpoint(CuTest *tc)
     aos_pool_t *p = NULL;
     aos_string_t file_path = aos_null_string;
     char *cp_file = "test_resumable_oss_dump_checkpoint.ucp";
+    aos_string_t tmp_path;
     oss_checkpoint_t *cp;
+    oss_checkpoint_t *cp_l;
     apr_finfo_t finfo;
     aos_string_t upload_id;
     int64_t part_size;
@@ -246,20 +250,32 @@ void test_resumable_oss_dump_checkpoint(CuTest *tc)
     oss_build_upload_checkpoint(p, cp, &file_path, &finfo, &upload_id, part_size);
 
     aos_str_set(&file_path, cp_file);
+    aos_str_set(&tmp_path, "test_resumable_oss_dump_checkpoint.ucp.tmp");
     rv = oss_open_checkpoint_file(p, &file_path, cp); 
     CuAssertIntEquals(tc, APR_SUCCESS, rv);
 
     rv = oss_dump_checkpoint(p, cp);
     CuAssertIntEquals(tc, AOSE_OK, rv);
-    apr_file_close(cp->thefile);
 
-    // write failed
-    rv = apr_file_open(&cp->thefile, file_path.data, APR_READ, APR_UREAD | APR_GREAD, p);
-    CuAssertIntEquals(tc, APR_SUCCESS, rv);
+    // the file is replaced, the handle still appends to it
+    rv = oss_dump_checkpoint(p, cp);
+    CuAssertIntEquals(tc, AOSE_OK, rv);
+    CuAssertIntEquals(tc, AOS_FALSE, oss_does_file_exist(&tmp_path, p));
+    oss_close_checkpoint_file(cp);
+    cp_l = oss_create_checkpoint_content(p);
+    rv = oss_load_checkpoint(p, &file_path, cp_l);
+    CuAssertIntEquals(tc, AOSE_OK, rv);
+    CuAssertStrEquals(tc, cp->upload_id.data, cp_l->upload_id.data);
 
+    // write failed, the old file is kept
+    rv = oss_open_checkpoint_file(p, &file_path, cp); 
+    CuAssertIntEquals(tc, APR_SUCCESS, rv);
+    aos_str_set(&cp->thefile_path, "/uvwxyz/abchij/test.ucp");
     rv = oss_dump_checkpoint(p, cp);
-    CuAssertIntEquals(tc, AOSE_FILE_TRUNC_ERROR, rv);
-    apr_file_close(cp->thefile);
+    CuAssertIntEquals(tc, AOSE_OPEN_FILE_ERROR, rv);
+    oss_close_checkpoint_file(cp);
+    rv = oss_load_checkpoint(p, &file_path, cp_l);
+    CuAssertIntEquals(tc, AOSE_OK, rv);
 
     apr_file_remove(cp_file, p);
 
@@ -331,6 +347,108 @@ void test_resumable_oss_load_checkpoint(CuTest *tc)
     printf("test_resumable_oss_load_checkpoint ok\n");
 }
 
+void test_resumable_oss_append_checkpoint(CuTest *tc)
+{
+    aos_pool_t *p = NULL;
+    aos_string_t file_path = aos_null_string;
+    char *cp_file = "test_resumable_oss_append_checkpoint.ucp";
+    oss_checkpoint_t *cp;
+    oss_checkpoint_t *cp_l;
+    apr_finfo_t finfo;
+    apr_file_t *thefile;
+    aos_string_t upload_id;
+    aos_string_t etag;
+    int64_t part_size;
+    int rv;
+
+    aos_pool_create(&p, NULL);
+
+    // build checkpoint
+    finfo.size = 510598;
+    finfo.mtime = 1459922563;  
+    aos_str_set(&file_path, "D:\\work\\oss\\BingWallpaper-2017-01-19.jpg");
+    aos_str_set(&upload_id, "0004B9894A22E5B1888A1E29F8236E2D");
+    part_size = 1024 * 100;
+
+    cp = oss_create_checkpoint_content(p);
+    oss_build_upload_checkpoint(p, cp, &file_path, &finfo, &upload_id, part_size);
+    cp->sync_num = 2;
+
+    aos_str_set(&file_path, cp_file);
+    rv = oss_open_checkpoint_file(p, &file_path, cp); 
+    CuAssertIntEquals(tc, APR_SUCCESS, rv);
+
+    // header, then a record for each completed part
+    rv = oss_dump_checkpoint(p, cp);
+    CuAssertIntEquals(tc, AOSE_OK, rv);
+    aos_str_set(&etag, "\"8BDA8F2EFF7B7BD4A2B7A6C3D2A1D8E1\"");
+    rv = oss_append_checkpoint(p, cp, 3, &etag, 1234567890123ULL);
+    CuAssertIntEquals(tc, AOSE_OK, rv);
+    aos_str_set(&etag, "\"0F7230CAA4BE94CCBDC99C5500000000\"");
+    rv = oss_append_checkpoint(p, cp, 0, &etag, 9876543210987ULL);
+    CuAssertIntEquals(tc, AOSE_OK, rv);
+    apr_file_close(cp->thefile);
+
+    cp_l = oss_create_checkpoint_content(p);
+    rv = oss_load_checkpoint(p, &file_path, cp_l);
+    CuAssertIntEquals(tc, AOSE_OK, rv);
+    CuAssertStrEquals(tc, cp->upload_id.data, cp_l->upload_id.data);
+    CuAssertIntEquals(tc, 5, cp_l->part_num);
+    CuAssertIntEquals(tc, AOS_TRUE, cp_l->parts[3].completed);
+    CuAssertStrEquals(tc, "\"8BDA8F2EFF7B7BD4A2B7A6C3D2A1D8E1\"", cp_l->parts[3].etag.data);
+    CuAssertTrue(tc, 1234567890123ULL == cp_l->parts[3].crc64);
+    CuAssertIntEquals(tc, AOS_TRUE, cp_l->parts[0].completed);
+    CuAssertTrue(tc, 9876543210987ULL == cp_l->parts[0].crc64);
+    CuAssertIntEquals(tc, AOS_FALSE, cp_l->parts[1].completed);
+
+    // torn tail, the last record is lost
+    rv = apr_stat(&finfo, cp_file, APR_FINFO_SIZE, p);
+    CuAssertIntEquals(tc, APR_SUCCESS, rv);
+    rv = apr_file_open(&thefile, cp_file, APR_WRITE, APR_UREAD | APR_UWRITE | APR_GREAD, p);
+    CuAssertIntEquals(tc, APR_SUCCESS, rv);
+    rv = apr_file_trunc(thefile, finfo.size - 5);
+    CuAssertIntEquals(tc, APR_SUCCESS, rv);
+    apr_file_close(thefile);
+
+    cp_l = oss_create_checkpoint_content(p);
+    rv = oss_load_checkpoint(p, &file_path, cp_l);
+    CuAssertIntEquals(tc, AOSE_OK, rv);
+    CuAssertIntEquals(tc, AOS_TRUE, cp_l->parts[3].completed);
+    CuAssertTrue(tc, 1234567890123ULL == cp_l->parts[3].crc64);
+    CuAssertIntEquals(tc, AOS_FALSE, cp_l->parts[0].completed);
+
+    // compaction keeps the completed parts
+    rv = oss_open_checkpoint_file(p, &file_path, cp_l); 
+    CuAssertIntEquals(tc, APR_SUCCESS, rv);
+    rv = oss_dump_checkpoint(p, cp_l);
+    CuAssertIntEquals(tc, AOSE_OK, rv);
+    apr_file_close(cp_l->thefile);
+
+    cp = oss_create_checkpoint_content(p);
+    rv = oss_load_checkpoint(p, &file_path, cp);
+    CuAssertIntEquals(tc, AOSE_OK, rv);
+    CuAssertIntEquals(tc, AOS_TRUE, cp->parts[3].completed);
+    CuAssertStrEquals(tc, "\"8BDA8F2EFF7B7BD4A2B7A6C3D2A1D8E1\"", cp->parts[3].etag.data);
+    CuAssertTrue(tc, 1234567890123ULL == cp->parts[3].crc64);
+    CuAssertIntEquals(tc, AOS_FALSE, cp->parts[0].completed);
+
+    // torn header
+    rv = apr_file_open(&thefile, cp_file, APR_WRITE, APR_UREAD | APR_UWRITE | APR_GREAD, p);
+    CuAssertIntEquals(tc, APR_SUCCESS, rv);
+    rv = apr_file_trunc(thefile, OSS_CP_JOURNAL_HEADER_LEN + 10);
+    CuAssertIntEquals(tc, APR_SUCCESS, rv);
+    apr_file_close(thefile);
+
+    rv = oss_load_checkpoint(p, &file_path, cp);
+    CuAssertIntEquals(tc, AOSE_XML_PARSE_ERROR, rv);
+
+    apr_file_remove(cp_file, p);
+
+    aos_pool_destroy(p);
+
+    printf("test_resumable_oss_append_checkpoint ok\n");
+}
+
 void test_resumable_oss_is_upload_checkpoint_valid(CuTest *tc)
 {
     aos_pool_t *p = NULL;
@@ -369,6 +487,237 @@ void test_resumable_oss_is_upload_checkpoint_valid(CuTest *tc)
     printf("test_resumable_oss_is_upload_checkpoint_valid ok\n");
 }
 
+void test_resumable_oss_is_copy_checkpoint_valid(CuTest *tc)
+{
+    aos_pool_t *p = NULL;
+    aos_string_t copy_source;
+    aos_string_t object;
+    aos_string_t other;
+    oss_checkpoint_t *cp;
+    aos_string_t upload_id;
+    char *last_modified = "Fri, 24 Feb 2012 06:07:48 GMT";
+    char *etag = "\"0F7230CAA4BE94CCBDC99C5500000000\"";
+    int rv;
+
+    aos_pool_create(&p, NULL);
+
+    // build checkpoint
+    aos_str_set(&copy_source, "/bucket/BingWallpaper-2017-01-19.jpg");
+    aos_str_set(&object, "BingWallpaper-2017-01-19.copy.jpg");
+    aos_str_set(&upload_id, "0004B9894A22E5B1888A1E29F8236E2D");
+
+    cp = oss_create_checkpoint_content(p);
+    oss_build_copy_checkpoint(p, cp, &copy_source, &object, 510598, last_modified, etag, &upload_id, 1024 * 100);
+    CuAssertIntEquals(tc, OSS_CP_COPY, cp->cp_type);
+    CuAssertIntEquals(tc, 5, cp->part_num);
+    CuAssertTrue(tc, 100998 == cp->parts[4].size);
+
+    rv = oss_is_copy_checkpoint_valid(p, cp, &copy_source, &object, 510598, last_modified, etag);
+    CuAssertTrue(tc, rv);
+
+    rv = oss_is_copy_checkpoint_valid(p, cp, &copy_source, &object, 510599, last_modified, etag);
+    CuAssertTrue(tc, !rv);
+
+    rv = oss_is_copy_checkpoint_valid(p, cp, &copy_source, &object, 510598, last_modified, "\"0\"");
+    CuAssertTrue(tc, !rv);
+
+    aos_str_set(&other, "/bucket/other.jpg");
+    rv = oss_is_copy_checkpoint_valid(p, cp, &other, &object, 510598, last_modified, etag);
+    CuAssertTrue(tc, !rv);
+
+    rv = oss_is_copy_checkpoint_valid(p, cp, &copy_source, &other, 510598, last_modified, etag);
+    CuAssertTrue(tc, !rv);
+
+    cp->cp_type = OSS_CP_UPLOAD;
+    rv = oss_is_copy_checkpoint_valid(p, cp, &copy_source, &object, 510598, last_modified, etag);
+    CuAssertTrue(tc, !rv);
+
+    aos_pool_destroy(p);
+
+    printf("test_resumable_oss_is_copy_checkpoint_valid ok\n");
+}
+
+void test_resumable_oss_verify_upload_checkpoint_parts(CuTest *tc)
+{
+    aos_pool_t *p = NULL;
+    aos_string_t file_path = aos_null_string;
+    char *local_file = "test_resumable_oss_verify_upload_checkpoint_parts.txt";
+    oss_checkpoint_t *cp;
+    apr_finfo_t finfo;
+    aos_string_t upload_id;
+    int64_t part_size;
+    char *content;
+    int len = 250 * 1024;
+    int i;
+    int rv;
+
+    aos_pool_create(&p, NULL);
+
+    content = (char *)aos_palloc(p, len + 1);
+    for (i = 0; i < len; i++) {
+        content[i] = 'a' + i % 26;
+    }
+    content[len] = '\0';
+    rv = fill_test_file(p, local_file, content);
+    CuAssertIntEquals(tc, APR_SUCCESS, rv);
+
+    // three completed parts, the crc64 of part 1 is wrong and part 2 has none
+    aos_str_set(&file_path, local_file);
+    rv = oss_get_file_info(&file_path, p, &finfo);
+    CuAssertIntEquals(tc, AOSE_OK, rv);
+    aos_str_set(&upload_id, "0004B9894A22E5B1888A1E29F8236E2D");
+    part_size = 1024 * 100;
+    cp = oss_create_checkpoint_content(p);
+    oss_build_upload_checkpoint(p, cp, &file_path, &finfo, &upload_id, part_size);
+    CuAssertIntEquals(tc, 3, cp->part_num);
+    for (i = 0; i < cp->part_num; i++) {
+        cp->parts[i].completed = AOS_TRUE;
+        aos_str_set(&cp->parts[i].etag, "\"8BDA8F2EFF7B7BD4A2B7A6C3D2A1D8E1\"");
+    }
+    cp->parts[0].crc64 = aos_crc64(0, content, (size_t)cp->parts[0].size);
+    cp->parts[1].crc64 = aos_crc64(0, content + cp->parts[1].offset, (size_t)cp->parts[1].size) + 1;
+    cp->parts[2].crc64 = 0;
+
+    // touched but unchanged
+    finfo.mtime += APR_USEC_PER_SEC;
+    CuAssertIntEquals(tc, AOS_FALSE, oss_is_upload_checkpoint_valid(p, cp, &finfo));
+    rv = oss_verify_upload_checkpoint_parts(p, cp, &file_path, &finfo, 2);
+    CuAssertIntEquals(tc, AOSE_OK, rv);
+    CuAssertIntEquals(tc, AOS_TRUE, cp->parts[0].completed);
+    CuAssertIntEquals(tc, AOS_FALSE, cp->parts[1].completed);
+    CuAssertStrEquals(tc, "", cp->parts[1].etag.data);
+    CuAssertIntEquals(tc, AOS_FALSE, cp->parts[2].completed);
+    CuAssertIntEquals(tc, AOS_TRUE, oss_is_upload_checkpoint_valid(p, cp, &finfo));
+
+    // size changed
+    finfo.size += 1;
+    rv = oss_verify_upload_checkpoint_parts(p, cp, &file_path, &finfo, 2);
+    CuAssertIntEquals(tc, AOSE_INVALID_ARGUMENT, rv);
+
+    apr_file_remove(local_file, p);
+
+    aos_pool_destroy(p);
+
+    printf("test_resumable_oss_verify_upload_checkpoint_parts ok\n");
+}
+
+void test_resumable_oss_auto_tuner(CuTest *tc)
+{
+    aos_pool_t *p = NULL;
+    oss_resumable_clt_params_t *clt_params;
+    oss_auto_tuner_t tuner;
+    oss_checkpoint_part_t part;
+    oss_part_task_result_t result;
+    int64_t part_size;
+    int32_t thread_num;
+
+    aos_pool_create(&p, NULL);
+
+    // part size, no history
+    clt_params = oss_create_resumable_clt_params_content(p, 0, 8, AOS_FALSE, NULL);
+    clt_params->auto_tune = AOS_TRUE;
+    part_size = oss_auto_tune_part_size(1024 * 1024 * 1024, clt_params->part_size, 8, &clt_params->tuned);
+    CuAssertTrue(tc, part_size == AOS_DEFAULT_PART_SIZE);
+
+    part_size = oss_auto_tune_part_size(1024 * 1024, clt_params->part_size, 8, &clt_params->tuned);
+    CuAssertTrue(tc, part_size == OSS_AUTO_TUNE_MIN_PART_SIZE);
+
+    // part size from persisted bandwidth and rtt, 10MB/s per thread and 50ms
+    clt_params->tuned.thread_num = 4;
+    clt_params->tuned.bandwidth = 40 * 1000 * 1000;
+    clt_params->tuned.rtt = 50 * 1000;
+    part_size = oss_auto_tune_part_size((int64_t)10 * 1024 * 1024 * 1024, 0, 8, &clt_params->tuned);
+    CuAssertTrue(tc, part_size == 10 * 1000 * 1000);
+
+    // concurrency grows while throughput improves
+    clt_params->tuned.thread_num = 0;
+    oss_init_auto_tuner(&tuner, clt_params);
+    CuAssertIntEquals(tc, OSS_AUTO_TUNE_INIT_THREAD_NUM, tuner.thread_num);
+    CuAssertIntEquals(tc, 8, tuner.max_thread_num);
+
+    part.size = 1000;
+    result.part = &part;
+    tuner.window_start = 0;
+    result.finish_time = APR_USEC_PER_SEC;
+    oss_auto_tuner_on_part_completed(&tuner, &result);
+    thread_num = oss_auto_tuner_on_part_completed(&tuner, &result);
+    CuAssertIntEquals(tc, 3, thread_num);
+
+    result.finish_time = 2 * APR_USEC_PER_SEC;
+    oss_auto_tuner_on_part_completed(&tuner, &result);
+    oss_auto_tuner_on_part_completed(&tuner, &result);
+    thread_num = oss_auto_tuner_on_part_completed(&tuner, &result);
+    CuAssertIntEquals(tc, 4, thread_num);
+
+    // throughput stops improving, fall back to the best one
+    result.finish_time = 4 * APR_USEC_PER_SEC;
+    oss_auto_tuner_on_part_completed(&tuner, &result);
+    oss_auto_tuner_on_part_completed(&tuner, &result);
+    oss_auto_tuner_on_part_completed(&tuner, &result);
+    thread_num = oss_auto_tuner_on_part_completed(&tuner, &result);
+    CuAssertIntEquals(tc, 3, thread_num);
+    CuAssertTrue(tc, !tuner.growing);
+
+    // errors halve concurrency
+    thread_num = oss_auto_tuner_on_part_failed(&tuner);
+    CuAssertIntEquals(tc, 1, thread_num);
+
+    oss_auto_tuner_export(&tuner, part_size, &clt_params->tuned);
+    CuAssertIntEquals(tc, 1, clt_params->tuned.thread_num);
+    CuAssertTrue(tc, clt_params->tuned.bandwidth == 3000);
+    CuAssertTrue(tc, clt_params->tuned.part_size == part_size);
+
+    aos_pool_destroy(p);
+
+    printf("test_resumable_oss_auto_tuner ok\n");
+}
+
+void test_resumable_oss_record_part_time(CuTest *tc)
+{
+    int64_t part_times[5];
+    int count = 0;
+
+    oss_record_part_time(part_times, &count, 300);
+    oss_record_part_time(part_times, &count, 100);
+    oss_record_part_time(part_times, &count, 500);
+    oss_record_part_time(part_times, &count, 200);
+    oss_record_part_time(part_times, &count, 400);
+
+    CuAssertIntEquals(tc, 5, count);
+    CuAssertTrue(tc, part_times[0] == 100);
+    CuAssertTrue(tc, part_times[count / 2] == 300);
+    CuAssertTrue(tc, part_times[4] == 500);
+
+    printf("test_resumable_oss_record_part_time ok\n");
+}
+
+void test_resumable_oss_upload_parts_without_parts(CuTest *tc)
+{
+    aos_pool_t *p = NULL;
+    oss_request_options_t *options = NULL;
+    aos_string_t bucket;
+    aos_string_t object;
+    aos_string_t filepath;
+    aos_string_t upload_id;
+    aos_status_t *s = NULL;
+
+    aos_pool_create(&p, NULL);
+    options = oss_request_options_create(p);
+    init_test_request_options(options, 0);
+    aos_str_set(&bucket, TEST_BUCKET_NAME);
+    aos_str_set(&object, "test_upload_parts_without_parts");
+    aos_str_set(&filepath, test_local_file);
+    aos_str_set(&upload_id, "upload-id");
+
+    // nothing is left to upload, the upload is successful
+    s = oss_upload_parts(options, &bucket, &object, &filepath, &upload_id, 3, 0, NULL);
+    CuAssertIntEquals(tc, 200, s->code);
+
+    aos_pool_destroy(p);
+
+    printf("test_resumable_oss_upload_parts_without_parts ok\n");
+}
+
 void test_resumable_checkpoint_xml(CuTest *tc)
 {
     aos_pool_t *p = NULL;
@@ -515,6 +864,161 @@ void test_resumable_upload_without_checkpoint(CuTest *tc)
     printf("test_resumable_upload_without_checkpoint ok\n");
 }
 
+void test_resumable_parallel_copy_object(CuTest *tc)
+{
+    aos_pool_t *p = NULL;
+    char *source_object_name = "test_resumable_upload_without_checkpoint.jpg";
+    char *dest_object_name = "test_resumable_parallel_copy_object.jpg";
+    aos_string_t bucket;
+    aos_string_t source_object;
+    aos_string_t dest_object;
+    aos_string_t checkpoint_path;
+    char *cp_path;
+    aos_status_t *s = NULL;
+    int is_cname = 0;
+    aos_table_t *headers = NULL;
+    aos_table_t *resp_headers = NULL;
+    aos_list_t resp_body;
+    oss_request_options_t *options = NULL;
+    oss_resumable_clt_params_t *clt_params;
+    int64_t content_length = 0;
+
+    aos_pool_create(&p, NULL);
+    options = oss_request_options_create(p);
+    init_test_request_options(options, is_cname);
+    headers = aos_table_make(p, 0);
+    aos_str_set(&bucket, TEST_BUCKET_NAME);
+    aos_str_set(&source_object, source_object_name);
+    aos_str_set(&dest_object, dest_object_name);
+    aos_list_init(&resp_body);
+
+    // copy object
+    clt_params = oss_create_resumable_clt_params_content(p, 1024 * 100, 3, AOS_TRUE, NULL);
+    s = oss_parallel_copy_object(options, &bucket, &source_object, &bucket, &dest_object, headers, 
+        clt_params, &resp_headers, &resp_body);
+    CuAssertIntEquals(tc, 200, s->code);
+
+    // the checkpoint is removed after the copy is completed
+    cp_path = apr_psprintf(p, "%s.%s.cp", TEST_BUCKET_NAME, dest_object_name);
+    aos_str_set(&checkpoint_path, cp_path);
+    CuAssertTrue(tc, !oss_does_file_exist(&checkpoint_path, p));
+
+    aos_pool_destroy(p);
+
+    // head object
+    aos_pool_create(&p, NULL);
+    options = oss_request_options_create(p);
+    init_test_request_options(options, is_cname);
+    s = oss_head_object(options, &bucket, &dest_object, NULL, &resp_headers);
+    CuAssertIntEquals(tc, 200, s->code);
+
+    content_length = atol((char*)apr_table_get(resp_headers, OSS_CONTENT_LENGTH));
+    CuAssertTrue(tc, content_length == get_file_size(test_local_file));
+
+    aos_pool_destroy(p);
+
+    printf("test_resumable_parallel_copy_object ok\n");
+}
+
+void test_resumable_upload_auto_tune(CuTest *tc)
+{
+    aos_pool_t *p = NULL;
+    char *object_name = "test_resumable_upload_auto_tune.jpg";
+    aos_string_t bucket;
+    aos_string_t object;
+    aos_string_t filename;
+    aos_status_t *s = NULL;
+    int is_cname = 0;
+    aos_table_t *headers = NULL;
+    aos_table_t *resp_headers = NULL;
+    aos_list_t resp_body;
+    oss_request_options_t *options = NULL;
+    oss_resumable_clt_params_t *clt_params;
+    int64_t content_length = 0;
+
+    aos_pool_create(&p, NULL);
+    options = oss_request_options_create(p);
+    init_test_request_options(options, is_cname);
+    headers = aos_table_make(p, 0);
+    aos_str_set(&bucket, TEST_BUCKET_NAME);
+    aos_str_set(&object, object_name);
+    aos_list_init(&resp_body);
+    aos_str_set(&filename, test_local_file);
+
+    // upload object
+    clt_params = oss_create_resumable_clt_params_content(p, 0, 4, AOS_FALSE, NULL);
+    clt_params->auto_tune = AOS_TRUE;
+    s = oss_resumable_upload_file(options, &bucket, &object, &filename, headers, NULL, 
+        clt_params, NULL, &resp_headers, &resp_body);
+    CuAssertIntEquals(tc, 200, s->code);
+    CuAssertTrue(tc, clt_params->tuned.part_size >= OSS_AUTO_TUNE_MIN_PART_SIZE);
+    CuAssertTrue(tc, clt_params->tuned.thread_num >= 1 && clt_params->tuned.thread_num <= 4);
+    CuAssertTrue(tc, clt_params->tuned.rtt > 0);
+
+    aos_pool_destroy(p);
+
+    // head object
+    aos_pool_create(&p, NULL);
+    options = oss_request_options_create(p);
+    init_test_request_options(options, is_cname);
+    s = oss_head_object(options, &bucket, &object, NULL, &resp_headers);
+    CuAssertIntEquals(tc, 200, s->code);
+
+    content_length = atol((char*)apr_table_get(resp_headers, OSS_CONTENT_LENGTH));
+    CuAssertTrue(tc, content_length == get_file_size(test_local_file));
+
+    aos_pool_destroy(p);
+
+    printf("test_resumable_upload_auto_tune ok\n");
+}
+
+void test_resumable_upload_auto_tune_threads(CuTest *tc)
+{
+    aos_pool_t *p = NULL;
+    char *object_name = "test_resumable_upload_auto_tune_threads.jpg";
+    aos_string_t bucket;
+    aos_string_t object;
+    aos_string_t filename;
+    aos_status_t *s = NULL;
+    int is_cname = 0;
+    aos_table_t *headers = NULL;
+    aos_table_t *resp_headers = NULL;
+    aos_list_t resp_body;
+    oss_request_options_t *options = NULL;
+    oss_resumable_clt_params_t *clt_params;
+    oss_auto_tuner_t tuner;
+    apr_finfo_t finfo;
+
+    aos_pool_create(&p, NULL);
+    options = oss_request_options_create(p);
+    init_test_request_options(options, is_cname);
+    headers = aos_table_make(p, 0);
+    aos_str_set(&bucket, TEST_BUCKET_NAME);
+    aos_str_set(&object, object_name);
+    aos_list_init(&resp_body);
+    aos_str_set(&filename, test_local_file);
+    CuAssertIntEquals(tc, AOSE_OK, oss_get_file_info(&filename, p, &finfo));
+
+    // start with one thread, the first measured window always raises it
+    clt_params = oss_create_resumable_clt_params_content(p, 0, 4, AOS_FALSE, NULL);
+    clt_params->tuned.thread_num = 1;
+    oss_init_auto_tuner(&tuner, clt_params);
+    CuAssertIntEquals(tc, 1, tuner.thread_num);
+    CuAssertTrue(tc, tuner.growing);
+
+    s = oss_resumable_upload_file_without_cp(options, &bucket, &object, &filename, headers, NULL, 
+        1, OSS_AUTO_TUNE_MIN_PART_SIZE, &tuner, &finfo, NULL, &resp_headers, &resp_body);
+    CuAssertIntEquals(tc, 200, s->code);
+
+    // the parts pushed after the raise run on more workers
+    CuAssertTrue(tc, tuner.best_throughput > 0);
+    CuAssertTrue(tc, tuner.peak_thread_num >= 2 && tuner.peak_thread_num <= 4);
+
+    aos_pool_destroy(p);
+
+    printf("test_resumable_upload_auto_tune_threads ok\n");
+}
+
 void test_resumable_upload_partsize(CuTest *tc)
 {
     aos_pool_t *p = NULL;
@@ -1361,12 +1865,21 @@ CuSuite *test_oss_resumable()
     SUITE_ADD_TEST(suite, test_resumable_oss_does_file_exist);
     SUITE_ADD_TEST(suite, test_resumable_oss_dump_checkpoint);
     SUITE_ADD_TEST(suite, test_resumable_oss_load_checkpoint);
+    SUITE_ADD_TEST(suite, test_resumable_oss_append_checkpoint);
     SUITE_ADD_TEST(suite, test_resumable_oss_is_upload_checkpoint_valid);
+    SUITE_ADD_TEST(suite, test_resumable_oss_is_copy_checkpoint_valid);
+    SUITE_ADD_TEST(suite, test_resumable_oss_verify_upload_checkpoint_parts);
+    SUITE_ADD_TEST(suite, test_resumable_oss_auto_tuner);
+    SUITE_ADD_TEST(suite, test_resumable_oss_record_part_time);
+    SUITE_ADD_TEST(suite, test_resumable_oss_upload_parts_without_parts);
     SUITE_ADD_TEST(suite, test_resumable_checkpoint_xml);
     SUITE_ADD_TEST(suite, test_resumable_upload_without_checkpoint);
+    SUITE_ADD_TEST(suite, test_resumable_parallel_copy_object);
     SUITE_ADD_TEST(suite, test_resumable_upload_with_checkpoint);
     SUITE_ADD_TEST(suite, test_resumable_upload_partsize);
     SUITE_ADD_TEST(suite, test_resumable_upload_threads);
+    SUITE_ADD_TEST(suite, test_resumable_upload_auto_tune);
+    SUITE_ADD_TEST(suite, test_resumable_upload_auto_tune_threads);
     SUITE_ADD_TEST(suite, test_resumable_upload_with_checkpoint_format_invalid);
     SUITE_ADD_TEST(suite, test_resumable_upload_with_checkpoint_path_invalid);
     SUITE_ADD_TEST(suite, test_resumable_upload_with_file_size_unavailable);